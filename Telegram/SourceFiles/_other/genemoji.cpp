@@ -1092,7 +1092,7 @@ void writeEmojiCategory(QTextStream &tcpp, uint64 *emojiCategory, uint32 size, c
 }
 
 bool genEmoji(QString emoji_in, const QString &emoji_out, const QString &emoji_png) {
-	int currentRow = 0, currentColumn = 0;
+	int tileRows[5]; // each category is written to its own tile, so that the app decodes only the tiles it draws from
 	uint32 min1 = 0xFFFFFFFFU, max1 = 0, min2 = 0xFFFFFFFFU, max2 = 0;
 
 	QImage sprites[5];
@@ -1123,6 +1123,7 @@ bool genEmoji(QString emoji_in, const QString &emoji_out, const QString &emoji_p
 		case 3: k = emojiCategory3; cnt = sizeof(emojiCategory3) / sizeof(emojiCategory3[0]); break;
 		case 4: k = emojiCategory4; cnt = sizeof(emojiCategory4) / sizeof(emojiCategory4[0]); break;
 		}
+		tileRows[i] = (cnt + inRow - 1) / inRow;
 		for (int j = 0; j < cnt; ++j) {
 			EmojiData data;
 			uint64 fullCode = k[j];
@@ -1130,14 +1131,9 @@ bool genEmoji(QString emoji_in, const QString &emoji_out, const QString &emoji_p
 			data.code2 = secondCode(fullCode);
 			data.category = i;
 			data.index = j;
-			data.x = currentColumn;
-			data.y = currentRow;
-			++currentColumn;
+			data.x = j % inRow;
+			data.y = j / inRow;
 
-			if (currentColumn == inRow) {
-				++currentRow;
-				currentColumn = 0;
-			}
 			uint32 high = data.code >> 16;
 			if (!high) { // small codes
 				if (data.code == 169 || data.code == 174) { // two small
@@ -1159,25 +1155,26 @@ bool genEmoji(QString emoji_in, const QString &emoji_out, const QString &emoji_p
 		}
 	}
 
-	if (currentColumn) ++currentRow;
-	if (!currentRow) {
+	if (emojisData.isEmpty()) {
 		cout << "No emojis written..\n";
 		return true;
 	}
 
-	for (int variantIndex = 0; variantIndex < variantsCount; variantIndex++) {
-		int imSize = imSizes[variantIndex];
+	for (int k = 0; k < variantsCount * 5; ++k) {
+		int variantIndex = k / 5, tile = k % 5, imSize = imSizes[variantIndex];
 
-		QImage emojisImg(inRow * imSize, currentRow * imSize, QImage::Format_ARGB32);
+		QImage emojisImg(inRow * imSize, tileRows[tile] * imSize, QImage::Format_ARGB32);
 		QPainter p(&emojisImg);
 		p.setCompositionMode(QPainter::CompositionMode_Source);
 		p.fillRect(0, 0, emojisImg.width(), emojisImg.height(), Qt::transparent);
 		for (EmojisData::const_iterator i = emojisData.cbegin(), e = emojisData.cend(); i != e; ++i) {
+			if (i->category != tile) continue;
+
 			int ind = i->index, row = ind / emojisInRow[i->category], col = ind % emojisInRow[i->category], size = sizes[i->category];
 			QPixmap emoji = QPixmap::fromImage(sprites[i->category].copy(col * size, row * size, size, size).scaled(imSize, imSize, Qt::IgnoreAspectRatio, Qt::SmoothTransformation), Qt::ColorOnly);
 			p.drawPixmap(i->x * imSize, i->y * imSize, emoji);
 		}
-		QString postfix = variantPostfix[variantIndex], emojif = emoji_png + postfix + ".png";
+		QString postfix = QString("%1_%2").arg(variantPostfix[variantIndex]).arg(tile), emojif = emoji_png + postfix + ".png";
 		QByteArray emojib;
 		{
 			QBuffer ebuf(&emojib);
@@ -1257,7 +1254,7 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org\n\
                 for (EmojisData::const_iterator i = emojisData.cbegin(), e = emojisData.cend(); i != e; ++i) {
                     int len = i->code2 ? 4 : ((i->code >> 16) ? 2 : 1);
 					bool withPostfix = emojiWithPostfixes.constFind(i->code) != emojiWithPostfixes.constEnd();
-                    tcpp << "\tnew (toFill++) EmojiData(" << (i->x * imSize) << ", " << (i->y * imSize) << ", 0x" << QString("%1").arg(i->code, 0, 16).toUpper().toUtf8().constData() << "U, 0x" << QString("%1").arg(i->code2, 0, 16).toUpper().toUtf8().constData() << "U, " << len << (withPostfix ? ", 0xFE0F" : "") << ");\n";
+                    tcpp << "\tnew (toFill++) EmojiData(" << (i->x * imSize) << ", " << (i->y * imSize) << ", " << i->category << ", 0x" << QString("%1").arg(i->code, 0, 16).toUpper().toUtf8().constData() << "U, 0x" << QString("%1").arg(i->code2, 0, 16).toUpper().toUtf8().constData() << "U, " << len << (withPostfix ? ", 0xFE0F" : "") << ");\n";
                 }
                 tcpp << "}\n\n";
             }
@@ -1399,7 +1396,7 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org\n\
 			cpp.close();
 		}
 		if (write_cpp) {
-			cout << "Emoji updated, writing " << currentRow << " rows, full count " << emojisData.size() << " emojis.\n";
+			cout << "Emoji updated, writing " << (tileRows[0] + tileRows[1] + tileRows[2] + tileRows[3] + tileRows[4]) << " rows in 5 tiles, full count " << emojisData.size() << " emojis.\n";
 			if (!cpp.open(QIODevice::WriteOnly)) throw Exception("Could not open style_auto.cpp for writing!");
 			if (cpp.write(cppText) != cppText.size()) throw Exception("Could not open style_auto.cpp for writing!");
 		}/**/
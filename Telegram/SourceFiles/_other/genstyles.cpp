@@ -1570,6 +1570,106 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org\n\
 			}
 			tcpp << "};\n";
 
+			// fonts and colors are emitted as constant tables, one per scale, FontData and ColorData are created on first use
+			typedef QMap<string, int> FontFamilies;
+			QVector<FontFamilies> fontFamilies(variantsCount);
+			QVector<QVector<string> > fontFamiliesList(variantsCount);
+			QVector<int> fontsTableSize(variantsCount, 0), colorsTableSize(variantsCount, 0);
+			int commonColorsTableSize = 0;
+
+			tcpp << "\nnamespace {\n";
+			{
+				Colors &clrs(colors[0]);
+				for (Colors::const_iterator i = clrs.cbegin(), e = clrs.cend(); i != e; ++i) {
+					bool differ = false;
+					for (int j = 1; j < variantsCount; ++j) {
+						const Colors &otherClrs(colors[variants[j]]);
+						Colors::const_iterator k = otherClrs.constFind(i.key());
+						if (k == otherClrs.cend() || k.value().color != i.value().color) {
+							differ = true;
+							break;
+						}
+					}
+					if (!differ) {
+						if (!commonColorsTableSize++) tcpp << "\tconst style::ColorInit _colorsCommon[] = {\n";
+						tcpp << "\t\t{ &_" << i.key().c_str() << ", " << i.value().color.c_str() << " },\n";
+					}
+				}
+				if (commonColorsTableSize) tcpp << "\t};\n";
+			}
+			for (int v = 0; v < variantsCount; ++v) {
+				variant = variants[v];
+
+				ByName::const_iterator j = scalarsMap.constFind("defaultFontFamily");
+				if (j != scalarsMap.cend()) {
+					if (scalars[j.value()].second.first == scString) {
+						if (scalars[j.value()].second.second.empty()) {
+							throw Exception(QString("Unexpected empty string in defaultFontFamily!").arg(token.c_str()));
+						}
+						string f = findScalarVariant(scalars[j.value()].second.second, variant);
+						fontFamilies[v].insert(f, fontFamiliesList[v].size());
+						fontFamiliesList[v].push_back(f);
+					} else {
+						throw Exception(QString("defaultFontFamily has bad type!"));
+					}
+				} else {
+					throw Exception(QString("defaultFontFamily not found!"));
+				}
+
+				Fonts &fnts(fonts[variant]);
+				for (Fonts::const_iterator i = fnts.cbegin(), e = fnts.cend(); i != e; ++i) {
+					FontFamilies::const_iterator j = fontFamilies[v].constFind(i.value().family);
+					if (j == fontFamilies[v].cend()) {
+						j = fontFamilies[v].insert(i.value().family, fontFamiliesList[v].size());
+						fontFamiliesList[v].push_back(i.value().family);
+					}
+					if (!fontsTableSize[v]++) tcpp << "\n\tconst style::FontInit _fonts" << v << "[] = {\n";
+					tcpp << "\t\t{ &_" << i.key().c_str() << ", " << i.value().size.c_str() << ", " << i.value().flags << ", " << j.value() << " },\n";
+				}
+				if (fontsTableSize[v]) tcpp << "\t};\n";
+
+				Colors &clrs(colors[variant]);
+				for (Colors::const_iterator i = clrs.cbegin(), e = clrs.cend(); i != e; ++i) {
+					bool differ = false;
+					for (int j = 0; j < variantsCount; ++j) {
+						if (variant == variants[j]) continue;
+
+						const Colors &otherClrs(colors[variants[j]]);
+						Colors::const_iterator k = otherClrs.constFind(i.key());
+						if (k == otherClrs.cend() || k.value().color != i.value().color) {
+							differ = true;
+							break;
+						}
+					}
+					if (differ) {
+						if (!colorsTableSize[v]++) tcpp << "\n\tconst style::ColorInit _colors" << v << "[] = {\n";
+						tcpp << "\t\t{ &_" << i.key().c_str() << ", " << i.value().color.c_str() << " },\n";
+					}
+				}
+				if (colorsTableSize[v]) tcpp << "\t};\n";
+			}
+
+			tcpp << "\n\tconst style::ScaleInit _scales[dbisScaleCount] = {\n";
+			tcpp << "\t\t{ 0, 0, 0, 0 }, // dbisAuto\n";
+			for (int v = 0; v < variantsCount; ++v) {
+				tcpp << "\t\t{ ";
+				if (fontsTableSize[v]) {
+					tcpp << "_fonts" << v << ", " << fontsTableSize[v];
+				} else {
+					tcpp << "0, 0";
+				}
+				tcpp << ", ";
+				if (colorsTableSize[v]) {
+					tcpp << "_colors" << v << ", " << colorsTableSize[v];
+				} else {
+					tcpp << "0, 0";
+				}
+				tcpp << " }, // " << variantNames[v] << "\n";
+			}
+			tcpp << "\t};\n";
+			tcpp << "};\n";
+			variant = 0;
+
 			tcpp << "\nnamespace style {\n\n";
 			tcpp << "\tFontFamilies _fontFamilies;\n";
 			tcpp << "\tFontDatas _fontsMap;\n";
@@ -1626,21 +1726,20 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org\n\
 			}
 			tcpp << "\t\t}\n\n";
 
-			Colors &clrs(colors[variant]);
-			for (Colors::const_iterator i = clrs.cbegin(), e = clrs.cend(); i != e; ++i) {
-				bool differ = false;
-				for (int j = 1; j < variantsCount; ++j) {
-					const Colors &otherClrs(colors[variants[j]]);
-					Colors::const_iterator k = otherClrs.constFind(i.key());
-					if (k == otherClrs.cend() || k.value().color != i.value().color) {
-						differ = true;
-						break;
-					}
-				}
-				if (!differ) {
-					tcpp << "\t\t_" << i.key().c_str() << ".init(" << i.value().color.c_str() << ");\n";
-				}
+			if (commonColorsTableSize) {
+				tcpp << "\t\tfor (const ColorInit *i = _colorsCommon, *e = i + " << commonColorsTableSize << "; i != e; ++i) {\n";
+				tcpp << "\t\t\ti->color->init(i->r, i->g, i->b, i->a);\n";
+				tcpp << "\t\t}\n";
 			}
+			tcpp << "\t\tif (cScale() >= 0 && cScale() < dbisScaleCount) {\n";
+			tcpp << "\t\t\tconst ScaleInit &scale(_scales[cScale()]);\n";
+			tcpp << "\t\t\tfor (const FontInit *i = scale.fonts, *e = i + scale.fontsCount; i != e; ++i) {\n";
+			tcpp << "\t\t\t\ti->font->init(i->size, i->flags, i->family, 0);\n";
+			tcpp << "\t\t\t}\n";
+			tcpp << "\t\t\tfor (const ColorInit *i = scale.colors, *e = i + scale.colorsCount; i != e; ++i) {\n";
+			tcpp << "\t\t\t\ti->color->init(i->r, i->g, i->b, i->a);\n";
+			tcpp << "\t\t\t}\n";
+			tcpp << "\t\t}\n";
 
 			for (int i = 0; i < variantsCount; ++i) {
 				variant = variants[i];
@@ -1668,52 +1767,8 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org\n\
 
 				tcpp << "\t\tcase " << varName << ":\n";
 
-				typedef QMap<string, int> FontFamilies;
-				FontFamilies fontFamilies;
-				int familyIndex = 0;
-				ByName::const_iterator j = scalarsMap.constFind("defaultFontFamily");
-				if (j != scalarsMap.cend()) {
-					if (scalars[j.value()].second.first == scString) {
-						if (scalars[j.value()].second.second.empty()) {
-							throw Exception(QString("Unexpected empty string in defaultFontFamily!").arg(token.c_str()));
-						}
-						string v = findScalarVariant(scalars[j.value()].second.second, variant);
-						tcpp << "\t\t\t_fontFamilies.push_back" << v.c_str() << ";\n";
-						fontFamilies.insert(v, familyIndex++);
-					} else {
-						throw Exception(QString("defaultFontFamily has bad type!"));
-					}
-				} else {
-					throw Exception(QString("defaultFontFamily not found!"));
-				}
-
-				Fonts &fnts(fonts[variant]);
-				for (Fonts::const_iterator i = fnts.cbegin(), e = fnts.cend(); i != e; ++i) {
-					FontFamilies::const_iterator j = fontFamilies.constFind(i.value().family);
-					if (j == fontFamilies.cend()) {
-						tcpp << "\n\t\t\t_fontFamilies.push_back" << i.value().family.c_str() << ";\n";
-						j = fontFamilies.insert(i.value().family, familyIndex++);
-					}
-					tcpp << "\t\t\t_" << i.key().c_str() << ".init(" << i.value().size.c_str() << ", " << i.value().flags << ", " << j.value() << ", 0);\n";
-				}
-
-				Colors &clrs(colors[variant]);
-				if (!clrs.empty()) tcpp << "\n";
-				for (Colors::const_iterator i = clrs.cbegin(), e = clrs.cend(); i != e; ++i) {
-					bool differ = false;
-					for (int j = 0; j < variantsCount; ++j) {
-						if (variant == variants[j]) continue;
-
-						const Colors &otherClrs(colors[variants[j]]);
-						Colors::const_iterator k = otherClrs.constFind(i.key());
-						if (k == otherClrs.cend() || k.value().color != i.value().color) {
-							differ = true;
-							break;
-						}
-					}
-					if (differ) {
-						tcpp << "\t\t\t_" << i.key().c_str() << ".init(" << i.value().color.c_str() << ");\n";
-					}
+				for (int j = 0, l = fontFamiliesList[i].size(); j < l; ++j) {
+					tcpp << "\t\t\t_fontFamilies.push_back" << fontFamiliesList[i][j].c_str() << ";\n";
 				}
 
 				Named &nmd(named[variant]);
@@ -88,9 +88,9 @@ void ApiWrap::requestFullPeer(PeerData *peer) {
 	if (_fullRequests.contains(peer)) return;
 	mtpRequestId req;
 	if (peer->chat) {
-		req = MTP::send(MTPmessages_GetFullChat(MTP_int(App::chatFromPeer(peer->id))), rpcDone(&ApiWrap::gotChatFull, peer), rpcFail(&ApiWrap::gotPeerFailed, peer));
+		req = MTP::sendBatched(MTPmessages_GetFullChat(MTP_int(App::chatFromPeer(peer->id))), rpcDone(&ApiWrap::gotChatFull, peer), rpcFail(&ApiWrap::gotPeerFailed, peer));
 	} else {
-		req = MTP::send(MTPusers_GetFullUser(peer->asUser()->inputUser), rpcDone(&ApiWrap::gotUserFull, peer), rpcFail(&ApiWrap::gotPeerFailed, peer));
+		req = MTP::sendBatched(MTPusers_GetFullUser(peer->asUser()->inputUser), rpcDone(&ApiWrap::gotUserFull, peer), rpcFail(&ApiWrap::gotPeerFailed, peer));
 	}
 	_fullRequests.insert(peer, req);
 }
@@ -165,7 +165,7 @@ void ApiWrap::resolveReplyTo() {
 		}
 	}
 	if (!ids.isEmpty()) {
-		mtpRequestId req = MTP::send(MTPmessages_GetMessages(MTP_vector<MTPint>(ids)), rpcDone(&ApiWrap::gotReplyTo));
+		mtpRequestId req = MTP::sendBatched(MTPmessages_GetMessages(MTP_vector<MTPint>(ids)), rpcDone(&ApiWrap::gotReplyTo));
 		for (ReplyToRequests::iterator i = _replyToRequests.begin(), e = _replyToRequests.end(); i != e; ++i) {
 			i.value().req = req;
 		}
@@ -189,7 +189,7 @@ void ApiWrap::resolveWebPages() {
 		}
 	}
 	if (!ids.isEmpty()) {
-		mtpRequestId req = MTP::send(MTPmessages_GetMessages(MTP_vector<MTPint>(ids)), rpcDone(&ApiWrap::gotWebPages));
+		mtpRequestId req = MTP::sendBatched(MTPmessages_GetMessages(MTP_vector<MTPint>(ids)), rpcDone(&ApiWrap::gotWebPages));
 		for (WebPagesPending::iterator i = _webPagesPending.begin(); i != _webPagesPending.cend(); ++i) {
 			if (i.value()) continue;
 			if (i.key()->pendingTill <= t) {
@@ -73,11 +73,17 @@ namespace {
 
 	HistoryItem *hoveredItem = 0, *pressedItem = 0, *hoveredLinkItem = 0, *pressedLinkItem = 0, *contextItem = 0, *mousedItem = 0;
 
-	QPixmap *sprite = 0, *emojis = 0;
-
-	typedef QMap<uint32, QPixmap> EmojisMap;
-	EmojisMap mainEmojisMap;
-	QMap<int32, EmojisMap> otherEmojisMap;
+	QPixmap *sprite = 0, *emojis[EmojiTilesCount] = { 0 };
+	StickerDecoder *stickerDecoder = 0;
+
+	typedef QLinkedList<uint64> EmojiSinglesList; // font height << 32 | emoji code, least recently used first
+	struct EmojiSingle {
+		QPixmap pix;
+		EmojiSinglesList::iterator inList;
+	};
+	typedef QHash<uint64, EmojiSingle> EmojiSinglesMap;
+	EmojiSinglesList emojiSinglesList;
+	EmojiSinglesMap emojiSinglesMap;
 
 	int32 serviceImageCacheSize = 0;
 
@@ -438,6 +444,8 @@ namespace App {
 				App::main()->removeContact(data);
 			}
 
+			History *h = App::historyLoaded(data->id);
+			if (h) h->dialogChanged(); // photo or name could change
 			if (App::main()) App::main()->peerUpdated(data);
 		}
 
@@ -468,6 +476,7 @@ namespace App {
 				if (data->version < d.vversion.v) {
 					data->version = d.vversion.v;
 					data->participants = ChatData::Participants();
+					data->mentionIndexInvalidate();
 				}
 			} break;
 			case mtpc_chatForbidden: {
@@ -509,6 +518,8 @@ namespace App {
 			data->loaded = true;
 			data->updateName(title.trimmed(), QString(), QString());
 
+			History *h = App::historyLoaded(data->id);
+			if (h) h->dialogChanged(); // photo or name could change
 			if (App::main()) App::main()->peerUpdated(data);
 		}
 		return data;
@@ -553,6 +564,7 @@ namespace App {
 						}
 					}
 				}
+				chat->mentionIndexInvalidate();
 				if (App::main()) App::main()->peerUpdated(chat);
 			}
 		} break;
@@ -569,6 +581,7 @@ namespace App {
 					chat->count++;
 				} else if (chat->participants.find(user) == chat->participants.end()) {
 					chat->participants[user] = (chat->participants.isEmpty() ? 1 : chat->participants.begin().value());
+					chat->mentionIndexAdd(user);
 					if (d.vinviter_id.v == MTP::authedId()) {
 						chat->cankick[user] = true;
 					} else {
@@ -578,6 +591,7 @@ namespace App {
 				}
 			} else {
 				chat->participants = ChatData::Participants();
+				chat->mentionIndexInvalidate();
 				chat->count++;
 			}
 			if (App::main()) App::main()->peerUpdated(chat);
@@ -596,11 +610,13 @@ namespace App {
 					ChatData::Participants::iterator i = chat->participants.find(user);
 					if (i != chat->participants.end()) {
 						chat->participants.erase(i);
+						chat->mentionIndexRemove(user);
 						chat->count--;
 					}
 				}
 			} else {
 				chat->participants = ChatData::Participants();
+				chat->mentionIndexInvalidate();
 				chat->count--;
 			}
 			if (App::main()) App::main()->peerUpdated(chat);
@@ -1036,6 +1052,11 @@ namespace App {
 		return result;
 	}
 
+	PhotoData *photoLoaded(const PhotoId &photo) {
+		PhotosData::const_iterator i = photosData.constFind(photo);
+		return (i == photosData.cend()) ? 0 : i.value();
+	}
+
 	VideoData *video(const VideoId &video, VideoData *convert, const uint64 &access, int32 user, int32 date, int32 duration, int32 w, int32 h, const ImagePtr &thumb, int32 dc, int32 size) {
 		if (convert) {
 			if (convert->id != video) {
@@ -1521,6 +1542,7 @@ namespace App {
 		audioInit();
 
 		if (!::sprite) {
+			STARTUP_TRACE("sprite");
 			if (rtl()) {
 				::sprite = new QPixmap(QPixmap::fromImage(QImage(st::spriteFile).mirrored(true, false)));
 			} else {
@@ -1528,11 +1550,10 @@ namespace App {
 			}
             if (cRetina()) ::sprite->setDevicePixelRatio(cRetinaFactor());
 		}
-		if (!::emojis) {
-			::emojis = new QPixmap(st::emojisFile);
-            if (cRetina()) ::emojis->setDevicePixelRatio(cRetinaFactor());
+		{
+			STARTUP_TRACE("initEmoji");
+			initEmoji();
 		}
-		initEmoji();
 	}
 	
 	void deinitMedia(bool completely) {
@@ -1546,13 +1567,21 @@ namespace App {
 
 			delete ::sprite;
 			::sprite = 0;
-			delete ::emojis;
-			::emojis = 0;
-			mainEmojisMap.clear();
-			otherEmojisMap.clear();
+			for (int32 i = 0; i < EmojiTilesCount; ++i) {
+				delete ::emojis[i];
+				::emojis[i] = 0;
+			}
+			emojiSinglesList.clear();
+			emojiSinglesMap.clear();
+			myGrabClear();
+			dialogRowsCacheClear();
+
+			delete ::stickerDecoder;
+			::stickerDecoder = 0;
 
 			clearAllImages();
 		} else {
+			if (::stickerDecoder) ::stickerDecoder->clear();
 			clearStorageImages();
 			cSetServerBackgrounds(WallPapers());
 		}
@@ -1612,25 +1641,46 @@ namespace App {
 		return *::sprite;
 	}
 
-	const QPixmap &emojis() {
-		return *::emojis;
+	const QPixmap &emojis(int32 tile) {
+		if (!::emojis[tile]) { // decoded when the first emoji of its category is painted, not at startup
+			::emojis[tile] = new QPixmap(st::emojisFile + QString("_%1.png").arg(tile));
+			if (cRetina()) ::emojis[tile]->setDevicePixelRatio(cRetinaFactor());
+		}
+		return *::emojis[tile];
+	}
+
+	StickerDecoder *stickerDecoder() {
+		if (!::stickerDecoder) {
+			::stickerDecoder = new StickerDecoder();
+		}
+		return ::stickerDecoder;
 	}
 
 	const QPixmap &emojiSingle(const EmojiData *emoji, int32 fontHeight) {
-		EmojisMap *map = &(fontHeight == st::taDefFlat.font->height ? mainEmojisMap : otherEmojisMap[fontHeight]);
-		EmojisMap::const_iterator i = map->constFind(emoji->code);
-		if (i == map->cend()) {
+		uint64 key = (uint64(uint32(fontHeight)) << 32) | uint64(emoji->code);
+		EmojiSinglesMap::iterator i = emojiSinglesMap.find(key);
+		if (i != emojiSinglesMap.end()) {
+			emojiSinglesList.erase(i.value().inList); // move to back
+			i.value().inList = emojiSinglesList.insert(emojiSinglesList.end(), key);
+		} else {
+			if (emojiSinglesMap.size() >= EmojiSinglesCacheSize) {
+				emojiSinglesMap.remove(emojiSinglesList.front());
+				emojiSinglesList.pop_front();
+			}
 			QImage img(st::emojiImgSize + st::emojiPadding * cIntRetinaFactor() * 2, fontHeight * cIntRetinaFactor(), QImage::Format_ARGB32_Premultiplied);
             if (cRetina()) img.setDevicePixelRatio(cRetinaFactor());
 			{
 				QPainter p(&img);
 				p.setCompositionMode(QPainter::CompositionMode_Source);
 				p.fillRect(0, 0, img.width(), img.height(), Qt::transparent);
-				p.drawPixmap(QPoint(st::emojiPadding * cIntRetinaFactor(), (fontHeight * cIntRetinaFactor() - st::emojiImgSize) / 2), App::emojis(), QRect(emoji->x, emoji->y, st::emojiImgSize, st::emojiImgSize));
+				p.drawPixmap(QPoint(st::emojiPadding * cIntRetinaFactor(), (fontHeight * cIntRetinaFactor() - st::emojiImgSize) / 2), App::emojis(emoji->tile), QRect(emoji->x, emoji->y, st::emojiImgSize, st::emojiImgSize));
 			}
-			i = map->insert(emoji->code, QPixmap::fromImage(img, Qt::ColorOnly));
+			EmojiSingle single;
+			single.pix = QPixmap::fromImage(img, Qt::ColorOnly);
+			single.inList = emojiSinglesList.insert(emojiSinglesList.end(), key);
+			i = emojiSinglesMap.insert(key, single);
 		}
-		return i.value();
+		return i.value().pix;
 	}
 
 	void playSound() {
@@ -27,6 +27,7 @@ class ApiWrap;
 class Font;
 class Color;
 class FileUploader;
+class StickerDecoder;
 
 #include "history.h"
 
@@ -115,6 +116,7 @@ namespace App {
 	ChatData *chat(int32 chat);
 	QString peerName(const PeerData *peer, bool forDialogs = false);
 	PhotoData *photo(const PhotoId &photo, PhotoData *convert = 0, const uint64 &access = 0, int32 user = 0, int32 date = 0, const ImagePtr &thumb = ImagePtr(), const ImagePtr &medium = ImagePtr(), const ImagePtr &full = ImagePtr());
+	PhotoData *photoLoaded(const PhotoId &photo);
 	VideoData *video(const VideoId &video, VideoData *convert = 0, const uint64 &access = 0, int32 user = 0, int32 date = 0, int32 duration = 0, int32 w = 0, int32 h = 0, const ImagePtr &thumb = ImagePtr(), int32 dc = 0, int32 size = 0);
 	AudioData *audio(const AudioId &audio, AudioData *convert = 0, const uint64 &access = 0, int32 user = 0, int32 date = 0, const QString &mime = QString(), int32 duration = 0, int32 dc = 0, int32 size = 0);
 	DocumentData *document(const DocumentId &document, DocumentData *convert = 0, const uint64 &access = 0, int32 date = 0, const QVector<MTPDocumentAttribute> &attributes = QVector<MTPDocumentAttribute>(), const QString &mime = QString(), const ImagePtr &thumb = ImagePtr(), int32 dc = 0, int32 size = 0);
@@ -155,8 +157,9 @@ namespace App {
 	HistoryItem *mousedItem();
 
 	const QPixmap &sprite();
-	const QPixmap &emojis();
+	const QPixmap &emojis(int32 tile); // atlas tile of an emoji category, EmojiData::tile
 	const QPixmap &emojiSingle(const EmojiData *emoji, int32 fontHeight);
+	StickerDecoder *stickerDecoder();
 
 	void initMedia();
 	void deinitMedia(bool completely = true);
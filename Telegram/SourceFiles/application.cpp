@@ -79,6 +79,7 @@ namespace {
 Application::Application(int &argc, char **argv) : PsApplication(argc, argv),
     serverName(psServerPrefix() + cGUIDStr()), closing(false),
 	updateRequestId(0), updateReply(0), updateThread(0), updateDownloader(0), _translator(0) {
+	STARTUP_TRACE("Application");
 
 	DEBUG_LOG(("Application Info: creation.."));
 
@@ -97,9 +98,12 @@ Application::Application(int &argc, char **argv) : PsApplication(argc, argv),
 		installEventFilter(new EventFilterForMac(this));
 	}
 
-    QFontDatabase::addApplicationFont(qsl(":/gui/art/fonts/OpenSans-Regular.ttf"));
-    QFontDatabase::addApplicationFont(qsl(":/gui/art/fonts/OpenSans-Bold.ttf"));
-    QFontDatabase::addApplicationFont(qsl(":/gui/art/fonts/OpenSans-Semibold.ttf"));
+	{
+		STARTUP_TRACE("fonts");
+		QFontDatabase::addApplicationFont(qsl(":/gui/art/fonts/OpenSans-Regular.ttf"));
+		QFontDatabase::addApplicationFont(qsl(":/gui/art/fonts/OpenSans-Bold.ttf"));
+		QFontDatabase::addApplicationFont(qsl(":/gui/art/fonts/OpenSans-Semibold.ttf"));
+	}
 
 	float64 dpi = primaryScreen()->logicalDotsPerInch();
 	if (dpi <= 108) { // 0-96-108
@@ -123,36 +127,45 @@ Application::Application(int &argc, char **argv) : PsApplication(argc, argv),
 	if (cLang() < languageTest) {
 		cSetLang(languageId());
 	}
-	if (cLang() == languageTest) {
-		if (QFileInfo(cLangFile()).exists()) {
-			LangLoaderPlain loader(cLangFile());
-			cSetLangErrors(loader.errors());
-			if (!cLangErrors().isEmpty()) {
-				LOG(("Lang load errors: %1").arg(cLangErrors()));
+	{
+		STARTUP_TRACE("language");
+		if (cLang() == languageTest) {
+			if (QFileInfo(cLangFile()).exists()) {
+				LangLoaderPlain loader(cLangFile());
+				cSetLangErrors(loader.errors());
+				if (!cLangErrors().isEmpty()) {
+					LOG(("Lang load errors: %1").arg(cLangErrors()));
+				} else if (!loader.warnings().isEmpty()) {
+					LOG(("Lang load warnings: %1").arg(loader.warnings()));
+				}
+			} else {
+				cSetLang(languageDefault);
+			}
+		} else if (cLang() > languageDefault && cLang() < languageCount) {
+			LangLoaderPlain loader(qsl(":/langs/lang_") + LanguageCodes[cLang()] + qsl(".strings"));
+			if (!loader.errors().isEmpty()) {
+				LOG(("Lang load errors: %1").arg(loader.errors()));
 			} else if (!loader.warnings().isEmpty()) {
 				LOG(("Lang load warnings: %1").arg(loader.warnings()));
 			}
-		} else {
-			cSetLang(languageDefault);
-		}
-	} else if (cLang() > languageDefault && cLang() < languageCount) {
-		LangLoaderPlain loader(qsl(":/langs/lang_") + LanguageCodes[cLang()] + qsl(".strings"));
-		if (!loader.errors().isEmpty()) {
-			LOG(("Lang load errors: %1").arg(loader.errors()));
-		} else if (!loader.warnings().isEmpty()) {
-			LOG(("Lang load warnings: %1").arg(loader.warnings()));
 		}
 	}
 
 	installTranslator(_translator = new Translator());
 
-	style::startManager();
+	{
+		STARTUP_TRACE("style::startManager");
+		style::startManager();
+	}
 	anim::startManager();
 	historyInit();
 
 	DEBUG_LOG(("Application Info: inited.."));
 
-    window = new Window();
+	{
+		STARTUP_TRACE("Window");
+		window = new Window();
+	}
 
 	psInstallEventFilter();
 
@@ -682,20 +695,31 @@ void Application::startApp() {
 
 	QMimeDatabase().mimeTypeForName(qsl("text/plain")); // create mime database
 
-	window->createWinId();
-	window->init();
+	{
+		STARTUP_TRACE("Window::init");
+		window->createWinId();
+		window->init();
+	}
 
 	DEBUG_LOG(("Application Info: window created.."));
 
 	initImageLinkManager();
-	App::initMedia();
+	{
+		STARTUP_TRACE("App::initMedia");
+		App::initMedia();
+	}
 
-	Local::ReadMapState state = Local::readMap(QByteArray());
+	Local::ReadMapState state;
+	{
+		STARTUP_TRACE("Local::readMap");
+		state = Local::readMap(QByteArray());
+	}
 	if (state == Local::ReadMapPassNeeded) {
 		cSetHasPasscode(true);
 		DEBUG_LOG(("Application Info: passcode nneded.."));
 	} else {
 		DEBUG_LOG(("Application Info: local map read.."));
+		STARTUP_TRACE("MTP::start");
 		MTP::start();
 	}
 
@@ -705,16 +729,22 @@ void Application::startApp() {
 	DEBUG_LOG(("Application Info: MTP started.."));
 
 	DEBUG_LOG(("Application Info: showing."));
-	if (state == Local::ReadMapPassNeeded) {
-		window->setupPasscode(false);
-	} else {
-		if (MTP::authedId()) {
-			window->setupMain(false);
+	{
+		STARTUP_TRACE("Window::setup");
+		if (state == Local::ReadMapPassNeeded) {
+			window->setupPasscode(false);
 		} else {
-			window->setupIntro(false);
+			if (MTP::authedId()) {
+				window->setupMain(false);
+			} else {
+				window->setupIntro(false);
+			}
 		}
 	}
-	window->firstShow();
+	{
+		STARTUP_TRACE("Window::firstShow");
+		window->firstShow();
+	}
 
 	if (cStartToSettings()) {
 		window->showSettings();
@@ -727,6 +757,17 @@ void Application::startApp() {
 	}
 
 	window->updateIsActive(cOnlineFocusTimeout());
+
+	if (cStartupTrace()) {
+		QTimer::singleShot(0, this, SLOT(onStartupTraced())); // after the first event loop iteration
+	}
+}
+
+void Application::onStartupTraced() {
+	startupTraceFinish();
+	if (cStartupTraceQuit()) {
+		App::quit();
+	}
 }
 
 void Application::socketDisconnected() {
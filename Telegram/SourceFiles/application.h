@@ -113,6 +113,8 @@ public slots:
 	void killDownloadSessions();
 	void onAppStateChanged(Qt::ApplicationState state);
 
+	void onStartupTraced();
+
 private:
 
 	QMap<MsgId, PeerId> photoUpdates;
@@ -30,7 +30,7 @@ AbstractBox::AbstractBox() : _maxHeight(0), _hiding(false), a_opacity(0, 1) {
 
 void AbstractBox::prepare() {
 	showAll();
-	_cache = myGrab(this, rect());
+	_cache = myGrab(this, rect(), false);
 	hideAll();
 }
 
@@ -125,7 +125,7 @@ void AbstractBox::onClose() {
 void AbstractBox::startHide() {
 	_hiding = true;
 	if (_cache.isNull()) {
-		_cache = myGrab(this, rect());
+		_cache = myGrab(this, rect(), false);
 		hideAll();
 	}
 	a_opacity.start(0);
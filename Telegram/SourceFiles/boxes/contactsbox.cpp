@@ -23,11 +23,41 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 #include "mainwidget.h"
 #include "window.h"
 
+namespace {
+	bool _contactMatchesFilter(const PeerData *peer, const QStringList &filter) {
+		const PeerData::Names &names(peer->names);
+		PeerData::Names::const_iterator nb = names.cbegin(), ne = names.cend(), ni;
+		for (QStringList::const_iterator fi = filter.cbegin(), fe = filter.cend(); fi != fe; ++fi) {
+			for (ni = nb; ni != ne; ++ni) {
+				if (ni->startsWith(*fi)) {
+					break;
+				}
+			}
+			if (ni == ne) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool _filterNarrows(const QStringList &was, const QStringList &now) { // every match of now is a match of was
+		for (QStringList::const_iterator i = was.cbegin(), e = was.cend(); i != e; ++i) {
+			QStringList::const_iterator j = now.cbegin(), end = now.cend();
+			for (; j != end; ++j) {
+				if (j->startsWith(*i)) break;
+			}
+			if (j == end) return false;
+		}
+		return true;
+	}
+}
+
 ContactsInner::ContactsInner(bool creatingChat, bool secretChat) : _chat(0), _creatingChat(creatingChat),
 _secretChat(secretChat),
 _contacts(&App::main()->contactsList()),
 _sel(0),
 _filteredSel(-1),
+_filteredFromCount(-1),
 _mouseSel(false),
 _selCount(0),
 _searching(false),
@@ -41,6 +71,7 @@ _secretChat(false),
 _contacts(&App::main()->contactsList()),
 _sel(0),
 _filteredSel(-1),
+_filteredFromCount(-1),
 _mouseSel(false),
 _selCount(0),
 _searching(false),
@@ -84,6 +115,7 @@ void ContactsInner::peerUpdated(PeerData *peer) {
 			}
 		}
 	} else if (!peer->chat) {
+		_filteredFromCount = -1; // name could change, next filter update rescans
 		ContactsData::iterator i = _contactsData.find(peer->asUser());
 		if (i != _contactsData.cend()) {
 			for (DialogRow *row = _contacts->list.begin; row->next; row = row->next) {
@@ -113,10 +145,11 @@ void ContactsInner::loadProfilePhotos(int32 yFrom) {
 	if (_filter.isEmpty()) {
 		if (_contacts->list.count) {
 			_contacts->list.adjustCurrent(yFrom, rh);
+			DialogRow *preloadFrom = _contacts->list.current;
 			for (
-				DialogRow *preloadFrom = _contacts->list.current;
-				preloadFrom != _contacts->list.end && preloadFrom->pos * rh < yTo;
-				preloadFrom = preloadFrom->next
+				int32 pos = preloadFrom->pos();
+				preloadFrom != _contacts->list.end && pos * rh < yTo;
+				preloadFrom = preloadFrom->next, ++pos
 			) {
 				preloadFrom->history->peer->photo->load();
 			}
@@ -144,8 +177,7 @@ ContactsInner::ContactData *ContactsInner::contactData(DialogRow *row) {
 			_contactsData.insert(user, data = new ContactData());
 			data->inchat = _chat ? _chat->participants.contains(user) : false;
 			data->check = false;
-			data->name.setText(st::profileListNameFont, user->name, _textNameOptions);
-			data->online = App::onlineText(user, _time);
+			data->prepared = false;
 		} else {
 			data = i.value();
 		}
@@ -154,8 +186,15 @@ ContactsInner::ContactData *ContactsInner::contactData(DialogRow *row) {
 	return data;
 }
 
+void ContactsInner::prepareContactData(UserData *user, ContactData *data) {
+	data->name.setText(st::profileListNameFont, user->name, _textNameOptions);
+	data->online = App::onlineText(user, _time);
+	data->prepared = true;
+}
+
 void ContactsInner::paintDialog(QPainter &p, UserData *user, ContactData *data, bool sel) {
 	int32 left = st::profileListPadding.width();
+	if (!data->prepared) prepareContactData(user, data);
 
 	if (data->inchat || data->check || _selCount + (_chat ? _chat->count : 0) >= cMaxGroupCount()) {
 		sel = false;
@@ -224,11 +263,13 @@ void ContactsInner::paintEvent(QPaintEvent *e) {
 				_contacts->list.adjustCurrent(yFrom, rh);
 
 				DialogRow *drawFrom = _contacts->list.current;
-				p.translate(0, drawFrom->pos * rh);
-				while (drawFrom != _contacts->list.end && drawFrom->pos * rh < yTo) {
+				int32 pos = drawFrom->pos();
+				p.translate(0, pos * rh);
+				while (drawFrom != _contacts->list.end && pos * rh < yTo) {
 					paintDialog(p, drawFrom->history->peer->asUser(), contactData(drawFrom), (drawFrom == _sel));
 					p.translate(0, rh);
 					drawFrom = drawFrom->next;
+					++pos;
 				}
 			}
 			if (!_byUsername.isEmpty()) {
@@ -466,6 +507,7 @@ void ContactsInner::updateFilter(QString filter) {
 	}
 	if (_filter != filter) {
 		int32 rh = (st::profileListPhotoSize + st::profileListPadding.height() * 2);
+		bool narrow = !_filter.isEmpty() && !f.isEmpty() && _filteredFromCount == _contacts->list.count && _filterNarrows(_filter.split(' '), f);
 		_filter = filter;
 
 		_byUsernameFiltered.clear();
@@ -497,8 +539,19 @@ void ContactsInner::updateFilter(QString filter) {
 			if (!_addContactLnk.isHidden()) _addContactLnk.hide();
 			QStringList::const_iterator fb = f.cbegin(), fe = f.cend(), fi;
 
-			_filtered.clear();
-			if (!f.isEmpty()) {
+			if (narrow) { // typed more, filter the previous results instead of the index
+				FilteredDialogs narrowed;
+				narrowed.reserve(_filtered.size());
+				for (FilteredDialogs::const_iterator i = _filtered.cbegin(), e = _filtered.cend(); i != e; ++i) {
+					if (_contactMatchesFilter((*i)->history->peer, f)) {
+						narrowed.push_back(*i);
+					}
+				}
+				_filtered = narrowed;
+			} else if (!f.isEmpty()) {
+				_filtered.clear();
+				_filteredFromCount = _contacts->list.count;
+
 				DialogsList *dialogsToFilter = 0;
 				if (_contacts->list.count) {
 					for (fi = fb; fi != fe; ++fi) {
@@ -515,43 +568,21 @@ void ContactsInner::updateFilter(QString filter) {
 				if (dialogsToFilter && dialogsToFilter->count) {
 					_filtered.reserve(dialogsToFilter->count);
 					for (DialogRow *i = dialogsToFilter->begin, *e = dialogsToFilter->end; i != e; i = i->next) {
-						const PeerData::Names &names(i->history->peer->names);
-						PeerData::Names::const_iterator nb = names.cbegin(), ne = names.cend(), ni;
-						for (fi = fb; fi != fe; ++fi) {
-							QString filterName(*fi);
-							for (ni = nb; ni != ne; ++ni) {
-								if (ni->startsWith(*fi)) {
-									break;
-								}
-							}
-							if (ni == ne) {
-								break;
-							}
-						}
-						if (fi == fe) {
+						if (_contactMatchesFilter(i->history->peer, f)) {
 							i->attached = 0;
 							_filtered.push_back(i);
 						}
 					}
 				}
+			} else {
+				_filtered.clear();
+			}
 
+			if (!f.isEmpty()) {
 				_byUsernameFiltered.reserve(_byUsername.size());
 				d_byUsernameFiltered.reserve(d_byUsername.size());
 				for (int32 i = 0, l = _byUsername.size(); i < l; ++i) {
-					const PeerData::Names &names(_byUsername[i]->names);
-					PeerData::Names::const_iterator nb = names.cbegin(), ne = names.cend(), ni;
-					for (fi = fb; fi != fe; ++fi) {
-						QString filterName(*fi);
-						for (ni = nb; ni != ne; ++ni) {
-							if (ni->startsWith(*fi)) {
-								break;
-							}
-						}
-						if (ni == ne) {
-							break;
-						}
-					}
-					if (fi == fe) {
+					if (_contactMatchesFilter(_byUsername[i], f)) {
 						_byUsernameFiltered.push_back(_byUsername[i]);
 						d_byUsernameFiltered.push_back(d_byUsername[i]);
 					}
@@ -630,6 +661,7 @@ void ContactsInner::peopleReceived(const QString &query, const QVector<MTPContac
 			d->check = false;
 			d->name.setText(st::profileListNameFont, u->name, _textNameOptions);
 			d->online = '@' + u->username;
+			d->prepared = true;
 
 			_byUsernameFiltered.push_back(u);
 			d_byUsernameFiltered.push_back(d);
@@ -746,7 +778,7 @@ void ContactsInner::selectSkip(int32 dir) {
 			}
 		}
 		if (_sel) {
-			emit mustScrollTo(_sel->pos * rh, (_sel->pos + 1) * rh);
+			emit mustScrollTo(_sel->pos() * rh, (_sel->pos() + 1) * rh);
 		} else if (_byUsernameSel >= 0) {
 			emit mustScrollTo((_contacts->list.count + _byUsernameSel) * rh + st::searchedBarHeight, (_contacts->list.count + _byUsernameSel + 1) * rh + st::searchedBarHeight);
 		}
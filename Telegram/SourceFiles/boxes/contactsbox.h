@@ -90,7 +90,7 @@ private:
 	QString _filter;
 	typedef QVector<DialogRow*> FilteredDialogs;
 	FilteredDialogs _filtered;
-	int32 _filteredSel;
+	int32 _filteredSel, _filteredFromCount; // contacts count when _filtered was built, -1 if it must be rebuilt
 	bool _mouseSel;
 
 	int32 _selCount;
@@ -100,11 +100,13 @@ private:
 		QString online;
 		bool inchat;
 		bool check;
+		bool prepared; // name and online are prepared only when the row is painted
 	};
 	typedef QMap<UserData*, ContactData*> ContactsData;
 	ContactsData _contactsData;
 
 	ContactData *contactData(DialogRow *row);
+	void prepareContactData(UserData *user, ContactData *data);
 
 	bool _searching;
 	QString _lastQuery;
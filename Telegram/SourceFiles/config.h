@@ -31,6 +31,11 @@ static const wchar_t *AppFile = L"Telegram";
 
 enum {
 	MTPShortBufferSize = 65535, // of ints, 256 kb
+	MTPBufferPoolSize = 4, // handled received packets kept for reuse, each up to MTPShortBufferSize
+	MTPFutureSaltsCount = 32, // get_future_salts request count, each salt is valid for about an hour
+	MTPFutureSaltsRefresh = 3600, // request future salts when the stored ones expire in less than an hour
+	MTPFutureSaltsRetry = 60, // but not more often than once a minute
+	MTPServerSaltReserve = 60, // dont use a stored salt that expires in less than a minute
 	MTPPacketSizeMax = 67108864, // 64 mb
 	MTPIdsBufferSize = 400, // received msgIds and wereAcked msgIds count stored
 	MTPCheckResendTimeout = 10000, // how much time passed from send till we resend request or check it's state, in ms
@@ -42,6 +47,10 @@ enum {
 	MTPMaxReceiveDelay = 64000, // 64 seconds
 	MTPConnectionOldTimeout = 192000, // 192 seconds
 	MTPTcpConnectionWaitTimeout = 3000, // 3 seconds waiting for tcp, until we accept http
+	MTPConnectionRaceStagger = 300, // 300 ms before trying the next dc address in parallel
+	MTPContainerSizeMax = 1400, // about one tcp segment of requests in one container, the rest is sent right after
+	MTPBatchRttShare = 8, // requests sent with MTP::sendBatched() are coalesced for 1/8 of the median rtt
+	MTPBatchWaitMax = 30, // but no more than 30 ms
 	MTPMillerRabinIterCount = 30, // 30 Miller-Rabin iterations for dh_prime primality check
 
 	MTPUploadSessionsCount = 4, // max 4 upload sessions is created
@@ -71,6 +80,11 @@ enum {
 	LocalEncryptKeySize = 256, // 2048 bit
 
 	AnimationTimerDelta = 7,
+	GrabPoolSize = 4, // myGrab() renders animation caches into pooled pixmaps of the same size, released when no animation runs
+
+	SlabSize = 64 * 1024, // history items, media and text blocks are allocated in 64 Kb slabs, one size class in each
+	SlabMaxObjectSize = 1024, // bigger objects are allocated by the system allocator
+	SlabAlignment = 8,
 
 	SaveRecentEmojisTimeout = 3000, // 3 secs
 	SaveWindowPositionTimeout = 1000, // 1 sec
@@ -80,6 +94,11 @@ enum {
 	SearchManyPerPage = 100,
 	MediaOverviewStartPerPage = 5,
 	MediaOverviewPreloadCount = 4,
+	MediaOverviewPreloadTime = 1000, // overview preloads photo thumbs for the distance it will scroll in 1 sec at the current speed
+	MediaOverviewPreloadScreensMin = 1, // but at least one screen ahead and behind
+	MediaOverviewPreloadScreensMax = 8, // and not more than eight screens ahead
+	MediaOverviewPreloadMetaScreens = 5, // request more media when preload window is less than five screens from the top
+	MediaOverviewScrollSpeedReset = 300, // scroll speed is measured anew after a 300ms pause
 
 	AudioVoiceMsgSimultaneously = 4,
 	AudioCheckPositionTimeout = 100, // 100ms per check audio pos
@@ -95,14 +114,20 @@ enum {
 
 	StickerInMemory = 256 * 1024, // 128 Kb stickers hold in memory, auto loaded and displayed inline
 	StickerMaxSize = 2048, // 2048x2048 is a max image size for sticker
+	StickerDecodeThreads = 2, // webp stickers are decoded and scaled by these workers, not in paint
+	StickerDecodedCacheSize = 24 * 1024 * 1024, // decoded and scaled sticker pixmaps kept in memory
 
 	MediaViewImageSizeLimit = 100 * 1024 * 1024, // show up to 100mb jpg/png/gif docs in app
+	MediaViewPredecodeCount = 4, // current photo and up to three neighbours are kept decoded at screen size
+	MediaViewPredecodeAhead = 2, // photos predecoded in the direction the user keeps flipping
 	MaxZoomLevel = 7, // x8
 	ZoomToScreenLevel = 1024, // just constant
 
 	PreloadHeightsCount = 3, // when 3 screens to scroll left make a preload request
 	EmojiPadPerRow = 7,
 	EmojiPadRowsPerPage = 6,
+	EmojiTilesCount = 5, // MetaEmoji writes the emoji atlas in a tile for each category
+	EmojiSinglesCacheSize = 256, // single emoji pixmaps prepared for text fields of different font heights, least recently used are dropped
 	StickerPadPerRow = 3,
 	StickersUpdateTimeout = 3600000, // update not more than once in an hour
 
@@ -113,6 +138,14 @@ enum {
 
 	MaxMessageSize = 4096,
 	MaxHttpRedirects = 5, // when getting external data/images
+	ImageLinkFetchesMax = 4, // image links fetched from external services at the same time
+	ImageLinkExpireDefault = 7 * 86400, // cached image link is revalidated after a week if server did not tell max-age
+	ImageLinkExpireMin = 3600,
+	ImageLinkExpireMax = 30 * 86400,
+
+	SaveUpdatesStateTimeout = 5000, // checkpoint pts / qts / date / seq of applied live updates not more often than that
+	UpdatesStateMaxAge = 7 * 86400, // older saved state is dropped and the current one is requested with getState
+	DifferenceSlicesQueued = 3, // next getDifference slice is requested while applying the previous ones, if there are less than this queued
 
 	WriteMapTimeout = 1000,
 	SaveDraftTimeout = 1000, // save draft after 1 secs of not changing text
@@ -259,6 +292,7 @@ enum {
 
 	DialogsFirstLoad = 20, // first dialogs part size requested
 	DialogsPerPage = 40, // next dialogs part size
+	DialogRowsCacheSize = 64, // pre-rendered dialog rows, a few screens of the dialogs list, least recently painted are dropped
 
 	MessagesFirstLoad = 30, // first history part size requested
 	MessagesPerPage = 50, // next history part size
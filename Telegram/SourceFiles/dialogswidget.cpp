@@ -352,7 +352,7 @@ void DialogsListWidget::createDialogAtTop(History *history, int32 unreadCount) {
 	history->updateNameText();
 
 	History::DialogLinks links = dialogs.addToEnd(history);
-	int32 movedFrom = links[0]->pos * st::dlgHeight;
+	int32 movedFrom = links[0]->pos() * st::dlgHeight;
 	dialogs.bringToTop(links);
 	history->dialogs = links;
 
@@ -398,8 +398,9 @@ void DialogsListWidget::removeContact(UserData *user) {
 }
 
 void DialogsListWidget::dlgUpdated(DialogRow *row) {
+	row->history->dialogChanged();
 	if (_state == DefaultState) {
-		update(0, row->pos * st::dlgHeight, width(), st::dlgHeight);
+		update(0, row->pos() * st::dlgHeight, width(), st::dlgHeight);
 	} else if (_state == FilteredState || _state == SearchedState) {
 		int32 cnt = 0;
 		for (FilteredDialogs::const_iterator i = filterResults.cbegin(), e = filterResults.cend(); i != e; ++i) {
@@ -413,15 +414,16 @@ void DialogsListWidget::dlgUpdated(DialogRow *row) {
 }
 
 void DialogsListWidget::dlgUpdated(History *history) {
+	history->dialogChanged();
 	if (_state == DefaultState) {
 		DialogRow *row = 0;
 		DialogsList::RowByPeer::iterator i = dialogs.list.rowByPeer.find(history->peer->id);
 		if (i != dialogs.list.rowByPeer.cend()) {
-			update(0, i.value()->pos * st::dlgHeight, width(), st::dlgHeight);
+			update(0, i.value()->pos() * st::dlgHeight, width(), st::dlgHeight);
 		} else {
 			i = contactsNoDialogs.list.rowByPeer.find(history->peer->id);
 			if (i != contactsNoDialogs.list.rowByPeer.cend()) {
-				update(0, (dialogs.list.count + i.value()->pos) * st::dlgHeight, width(), st::dlgHeight);
+				update(0, (dialogs.list.count + i.value()->pos()) * st::dlgHeight, width(), st::dlgHeight);
 			}
 		}
 	} else if (_state == FilteredState || _state == SearchedState) {
@@ -481,7 +483,7 @@ void DialogsListWidget::onParentGeometryChanged() {
 }
 
 void DialogsListWidget::onDialogToTop(const History::DialogLinks &links) {
-	int32 movedFrom = links[0]->pos * st::dlgHeight;
+	int32 movedFrom = links[0]->pos() * st::dlgHeight;
 	dialogs.bringToTop(links);
 	emit dialogToTopFrom(movedFrom);
 	emit App::main()->dialogsUpdated();
@@ -686,6 +688,72 @@ void DialogsListWidget::dialogsReceived(const QVector<MTPDialog> &added) {
 	refresh();
 }
 
+void DialogsListWidget::dialogsSnapshotReceived(const QVector<MTPDialog> &added) {
+	dialogsReceived(added);
+	for (QVector<MTPDialog>::const_iterator i = added.cbegin(), e = added.cend(); i != e; ++i) {
+		if (i->type() == mtpc_dialog) {
+			const MTPDdialog &d(i->c_dialog());
+			_snapshotPeers.insert(App::peerFromMTP(d.vpeer), d.vtop_message.v);
+		}
+	}
+}
+
+void DialogsListWidget::dialogsSnapshotDrop(const QVector<MTPDialog> &received) {
+	if (_snapshotPeers.isEmpty()) return;
+
+	typedef QMap<PeerId, const MTPDdialog*> ReceivedDialogs;
+	ReceivedDialogs receivedDialogs;
+	QMap<MsgId, bool> receivedTops;
+	for (QVector<MTPDialog>::const_iterator i = received.cbegin(), e = received.cend(); i != e; ++i) {
+		if (i->type() != mtpc_dialog) continue;
+
+		const MTPDdialog &d(i->c_dialog());
+		receivedDialogs.insert(App::peerFromMTP(d.vpeer), &d);
+		receivedTops.insert(d.vtop_message.v, true);
+	}
+
+	// snapshot top messages that are not top messages anymore are removed,
+	// they could be deleted since the snapshot and nothing would reconcile them
+	for (SnapshotPeers::const_iterator i = _snapshotPeers.cbegin(), e = _snapshotPeers.cend(); i != e; ++i) {
+		if (!i.value() || receivedTops.contains(i.value())) continue;
+
+		HistoryItem *item = App::histItemById(i.value());
+		if (item && item->history()->peer->id == i.key()) {
+			item->destroy();
+		}
+	}
+
+	// unread counts were read from the snapshot, received dialogs could be read on another device
+	// since it and dropped ones get their counts again in unreadCountsReceived() of the later pages
+	for (SnapshotPeers::const_iterator i = _snapshotPeers.cbegin(), e = _snapshotPeers.cend(); i != e; ++i) {
+		History *history = App::historyLoaded(i.key());
+		if (!history) continue;
+
+		ReceivedDialogs::const_iterator j = receivedDialogs.constFind(i.key());
+		history->setUnreadCount((j == receivedDialogs.cend()) ? 0 : j.value()->vunread_count.v, false);
+	}
+
+	// remove the snapshot rows, received ones are added again in the server order
+	for (SnapshotPeers::const_iterator i = _snapshotPeers.cbegin(), e = _snapshotPeers.cend(); i != e; ++i) {
+		if (dialogs.list.rowByPeer.constFind(i.key()) == dialogs.list.rowByPeer.cend()) continue;
+
+		History *history = App::history(i.key());
+		if (sel && sel->history == history) {
+			sel = 0;
+		}
+		dialogs.del(history->peer);
+		history->dialogs = History::DialogLinks();
+		if (contacts.list.rowByPeer.constFind(i.key()) != contacts.list.rowByPeer.cend()) {
+			contactsNoDialogs.addByName(history);
+		}
+	}
+	_snapshotPeers.clear();
+
+	if (_state != DefaultState) {
+		onFilterUpdate(filter, true);
+	}
+}
+
 void DialogsListWidget::searchReceived(const QVector<MTPMessage> &messages, bool fromStart, int32 fullCount) {
 	if (fromStart) {
 		clearSearchResults(false);
@@ -747,13 +815,13 @@ int32 DialogsListWidget::addNewContact(int32 uid, bool select) {
 			contactSel = true;
 		}
 		if (contactsNoDialogs.list.count == 1 && !dialogs.list.count) refresh();
-		return added ? ((dialogs.list.count + added->pos) * st::dlgHeight) : -1;
+		return added ? ((dialogs.list.count + added->pos()) * st::dlgHeight) : -1;
 	}
 	if (select) {
 		sel = i.value();
 		contactSel = false;
 	}
-	return i.value()->pos * st::dlgHeight;
+	return i.value()->pos() * st::dlgHeight;
 }
 
 void DialogsListWidget::refresh(bool toTop) {
@@ -868,7 +936,7 @@ void DialogsListWidget::selectSkip(int32 direction) {
 				contactSel = false;
 			}
 		}
-		int32 fromY = (sel->pos + (contactSel ? dialogs.list.count : 0)) * st::dlgHeight;
+		int32 fromY = (sel->pos() + (contactSel ? dialogs.list.count : 0)) * st::dlgHeight;
 		emit mustScrollTo(fromY, fromY + st::dlgHeight);
 	} else if (_state == FilteredState || _state == SearchedState) {
 		if (hashtagResults.isEmpty() && filterResults.isEmpty() && peopleResults.isEmpty() && searchResults.isEmpty()) return;
@@ -920,11 +988,11 @@ void DialogsListWidget::scrollToPeer(const PeerId &peer, MsgId msgId) {
 	if (_state == DefaultState) {
 		DialogsList::RowByPeer::const_iterator i = dialogs.list.rowByPeer.constFind(peer);
 		if (i != dialogs.list.rowByPeer.cend()) {
-			fromY = i.value()->pos * st::dlgHeight;
+			fromY = i.value()->pos() * st::dlgHeight;
 		} else {
 			i = contactsNoDialogs.list.rowByPeer.constFind(peer);
 			if (i != contactsNoDialogs.list.rowByPeer.cend()) {
-				fromY = (i.value()->pos + dialogs.list.count) * st::dlgHeight;
+				fromY = (i.value()->pos() + dialogs.list.count) * st::dlgHeight;
 			}
 		}
 	} else if (_state == FilteredState || _state == SearchedState) {
@@ -985,7 +1053,7 @@ void DialogsListWidget::selectSkipPage(int32 pixels, int32 direction) {
 				contactSel = false;
 			}
 		}
-		int32 fromY = (sel->pos + (contactSel ? dialogs.list.count : 0)) * st::dlgHeight;
+		int32 fromY = (sel->pos() + (contactSel ? dialogs.list.count : 0)) * st::dlgHeight;
 		emit mustScrollTo(fromY, fromY + st::dlgHeight);
 	} else {
 		return selectSkip(direction * toSkip);
@@ -1000,7 +1068,8 @@ void DialogsListWidget::loadPeerPhotos(int32 yFrom) {
 		int32 otherStart = dialogs.list.count * st::dlgHeight;
 		if (yFrom < otherStart) {
 			dialogs.list.adjustCurrent(yFrom, st::dlgHeight);
-			for (DialogRow *row = dialogs.list.current; row != dialogs.list.end && (row->pos * st::dlgHeight) < yTo; row = row->next) {
+			DialogRow *row = dialogs.list.current;
+			for (int32 pos = row->pos(); row != dialogs.list.end && (pos * st::dlgHeight) < yTo; row = row->next, ++pos) {
 				row->history->peer->photo->load();
 			}
 			yFrom = 0;
@@ -1010,7 +1079,8 @@ void DialogsListWidget::loadPeerPhotos(int32 yFrom) {
 		yTo -= otherStart;
 		if (yTo > 0) {
 			contactsNoDialogs.list.adjustCurrent(yFrom, st::dlgHeight);
-			for (DialogRow *row = contactsNoDialogs.list.current; row != contactsNoDialogs.list.end && (row->pos * st::dlgHeight) < yTo; row = row->next) {
+			DialogRow *row = contactsNoDialogs.list.current;
+			for (int32 pos = row->pos(); row != contactsNoDialogs.list.end && (pos * st::dlgHeight) < yTo; row = row->next, ++pos) {
 				row->history->peer->photo->load();
 			}
 		}
@@ -1147,6 +1217,7 @@ void DialogsListWidget::destroyData() {
 	contacts.clear();
 	contactsNoDialogs.clear();
 	dialogs.clear();
+	_snapshotPeers.clear();
 }
 
 void DialogsListWidget::peerBefore(const PeerData *inPeer, MsgId inMsg, PeerData *&outPeer, MsgId &outMsg) const {
@@ -1480,31 +1551,59 @@ void DialogsWidget::unreadCountsReceived(const QVector<MTPDialog> &dialogs) {
 	if (App::wnd()) App::wnd()->updateCounter();
 }
 
-void DialogsWidget::dialogsReceived(const MTPmessages_Dialogs &dialogs) {
-	const QVector<MTPDialog> *dlgList = 0;
+const QVector<MTPDialog> *DialogsWidget::feedDialogs(const MTPmessages_Dialogs &dialogs, int32 &count) {
 	switch (dialogs.type()) {
 	case mtpc_messages_dialogs: {
 		const MTPDmessages_dialogs &data(dialogs.c_messages_dialogs());
 		App::feedUsers(data.vusers);
 		App::feedChats(data.vchats);
 		App::feedMsgs(data.vmessages);
-		dlgList = &data.vdialogs.c_vector().v;
-		dlgCount = dlgList->size();
+		count = data.vdialogs.c_vector().v.size();
+		return &data.vdialogs.c_vector().v;
 	} break;
 	case mtpc_messages_dialogsSlice: {
 		const MTPDmessages_dialogsSlice &data(dialogs.c_messages_dialogsSlice());
 		App::feedUsers(data.vusers);
 		App::feedChats(data.vchats);
 		App::feedMsgs(data.vmessages);
-		dlgList = &data.vdialogs.c_vector().v;
-		dlgCount = data.vcount.v;
+		count = data.vcount.v;
+		return &data.vdialogs.c_vector().v;
 	} break;
 	}
+	return 0;
+}
 
-	unreadCountsReceived(*dlgList);
+void DialogsWidget::loadCachedDialogs() {
+	MTPmessages_Dialogs dialogs;
+	if (Local::readDialogs(dialogs)) {
+		int32 count = 0;
+		const QVector<MTPDialog> *dlgList = feedDialogs(dialogs, count);
+		if (dlgList) {
+			list.dialogsSnapshotReceived(*dlgList);
+			list.loadPeerPhotos(scroll.scrollTop());
+		}
+	}
+
+	MTPcontacts_Contacts contacts;
+	if (Local::readContacts(contacts) && contacts.type() == mtpc_contacts_contacts) {
+		const MTPDcontacts_contacts &d(contacts.c_contacts_contacts());
+		App::feedUsers(d.vusers);
+		contactsApply(d.vcontacts.c_vector().v);
+	}
+}
+
+void DialogsWidget::dialogsReceived(const MTPmessages_Dialogs &dialogs) {
+	const QVector<MTPDialog> *dlgList = feedDialogs(dialogs, dlgCount);
+	if (dlgList) {
+		unreadCountsReceived(*dlgList);
+		if (!dlgOffset) {
+			list.dialogsSnapshotDrop(*dlgList);
+			Local::writeDialogs(dialogs);
+		}
+	}
 
 	if (!contactsRequest) {
-		contactsRequest = MTP::send(MTPcontacts_GetContacts(MTP_string("")), rpcDone(&DialogsWidget::contactsReceived), rpcFail(&DialogsWidget::contactsFailed));
+		contactsRequest = MTP::send(MTPcontacts_GetContacts(MTP_string(_contactsHash)), rpcDone(&DialogsWidget::contactsReceived), rpcFail(&DialogsWidget::contactsFailed));
 	}
 
 	if (dlgList) {
@@ -1615,11 +1714,42 @@ void DialogsWidget::loadDialogs() {
 	dlgPreloading = MTP::send(MTPmessages_GetDialogs(MTP_int(dlgOffset), MTP_int(0), MTP_int(loadCount)), rpcDone(&DialogsWidget::dialogsReceived), rpcFail(&DialogsWidget::dialogsFailed));
 }
 
+void DialogsWidget::contactsApply(const QVector<MTPContact> &contacts) {
+	QVector<int32> ids;
+	ids.reserve(contacts.size());
+	for (QVector<MTPContact>::const_iterator i = contacts.cbegin(), e = contacts.cend(); i != e; ++i) {
+		ids.push_back(i->c_contact().vuser_id.v);
+	}
+	qSort(ids);
+
+	for (QVector<int32>::const_iterator i = _contactsIds.cbegin(), e = _contactsIds.cend(); i != e; ++i) {
+		if (qBinaryFind(ids, *i) != ids.cend()) continue;
+
+		UserData *user = App::userLoaded(*i);
+		if (user) list.removeContact(user);
+	}
+	list.contactsReceived(contacts);
+
+	// md5 of the comma separated ascending ids, the server replies contactsNotModified if it matches
+	QStringList idsList;
+	idsList.reserve(ids.size());
+	for (QVector<int32>::const_iterator i = ids.cbegin(), e = ids.cend(); i != e; ++i) {
+		idsList.push_back(QString::number(*i));
+	}
+	QByteArray idsStr = idsList.join(',').toLatin1();
+	char hash[32];
+	hashMd5Hex(idsStr.constData(), idsStr.size(), hash);
+
+	_contactsHash = QString::fromLatin1(hash, 32);
+	_contactsIds = ids;
+}
+
 void DialogsWidget::contactsReceived(const MTPcontacts_Contacts &contacts) {
 	if (contacts.type() == mtpc_contacts_contacts) {
 		const MTPDcontacts_contacts &d(contacts.c_contacts_contacts());
 		App::feedUsers(d.vusers);
-		list.contactsReceived(d.vcontacts.c_vector().v);
+		contactsApply(d.vcontacts.c_vector().v);
+		Local::writeContacts(contacts);
 	}
 }
 
@@ -27,6 +27,8 @@ public:
 	DialogsListWidget(QWidget *parent, MainWidget *main);
 
 	void dialogsReceived(const QVector<MTPDialog> &dialogs);
+	void dialogsSnapshotReceived(const QVector<MTPDialog> &dialogs);
+	void dialogsSnapshotDrop(const QVector<MTPDialog> &received);
 	void searchReceived(const QVector<MTPMessage> &messages, bool fromStart, int32 fullCount);
 	void peopleReceived(const QString &query, const QVector<MTPContactFound> &people);
 	void showMore(int32 pixels);
@@ -147,6 +149,9 @@ private:
 
 	MsgId _lastSearchId;
 
+	typedef QMap<PeerId, MsgId> SnapshotPeers;
+	SnapshotPeers _snapshotPeers; // dialogs with their top messages shown from the local snapshot until the first page is received
+
 	State _state;
 
 	QPoint lastMousePos;
@@ -176,6 +181,7 @@ public:
 	void paintEvent(QPaintEvent *e);
 
 	void loadDialogs();
+	void loadCachedDialogs();
 	void createDialogAtTop(History *history, int32 unreadCount);
 	void dlgUpdated(DialogRow *row);
 	void dlgUpdated(History *row);
@@ -233,6 +239,8 @@ private:
 	bool _drawShadow;
 
 	void unreadCountsReceived(const QVector<MTPDialog> &dialogs);
+	const QVector<MTPDialog> *feedDialogs(const MTPmessages_Dialogs &dialogs, int32 &count);
+	void contactsApply(const QVector<MTPContact> &contacts);
 	bool dialogsFailed(const RPCError &error);
 	bool contactsFailed(const RPCError &error);
 	bool searchFailed(const RPCError &error, mtpRequestId req);
@@ -241,6 +249,8 @@ private:
 	int32 dlgOffset, dlgCount;
 	mtpRequestId dlgPreloading;
 	mtpRequestId contactsRequest;
+	QString _contactsHash; // of the last received contacts list, sent in getContacts
+	QVector<int32> _contactsIds; // sorted
 
 	FlatInput _filter;
     IconedButton _newGroup, _newSecretChat, _addContact, _cancelSearch;
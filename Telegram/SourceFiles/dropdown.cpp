@@ -449,6 +449,11 @@ EmojiPanInner::EmojiPanInner(QWidget *parent) : QWidget(parent), _tab(cEmojiTab(
 
 	_saveConfigTimer.setSingleShot(true);
 	connect(&_saveConfigTimer, SIGNAL(timeout()), this, SLOT(onSaveConfig()));
+	connect(App::stickerDecoder(), SIGNAL(decoded(DocumentData*)), this, SLOT(onStickerDecoded()));
+}
+
+void EmojiPanInner::onStickerDecoded() {
+	if (_tab == dbietStickers) update();
 }
 
 void EmojiPanInner::paintEvent(QPaintEvent *e) {
@@ -482,24 +487,17 @@ void EmojiPanInner::paintEvent(QPaintEvent *e) {
 				if (!sticker->loader && sticker->status != FileFailed && !already && !hasdata) {
 					sticker->save(QString());
 				}
-				if (sticker->sticker->isNull() && (already || hasdata)) {
-					if (already) {
-						sticker->sticker = ImagePtr(sticker->already());
-					} else {
-						sticker->sticker = ImagePtr(sticker->data);
-					}
-				}
-
 				float64 coef = qMin((stickerWidth - st::stickerPanPadding * 2) / float64(sticker->dimensions.width()), (stickerSize - st::stickerPanPadding * 2) / float64(sticker->dimensions.height()));
 				if (coef > 1) coef = 1;
 				int32 w = qRound(coef * sticker->dimensions.width()), h = qRound(coef * sticker->dimensions.height());
 				if (w < 1) w = 1;
 				if (h < 1) h = 1;
 				QPoint ppos = pos + QPoint((stickerSize - w) / 2, (stickerSize - h) / 2);
-				if (sticker->sticker->isNull()) {
+				const QPixmap *decoded = (already || hasdata) ? App::stickerDecoder()->pix(sticker, w, h) : 0;
+				if (!decoded) {
 					p.drawPixmap(ppos, sticker->thumb->pix(w, h));
 				} else {
-					p.drawPixmap(ppos, sticker->sticker->pix(w, h));
+					p.drawPixmap(ppos, *decoded);
 				}
 
 				if (hover > 0 && _isUserGen[index]) {
@@ -532,7 +530,7 @@ void EmojiPanInner::paintEvent(QPaintEvent *e) {
 					p.setOpacity(1);
 				}
 				QRect r(_emojis[index]->x, _emojis[index]->y, st::emojiImgSize, st::emojiImgSize);
-				p.drawPixmap(w + QPoint((st::emojiPanSize.width() - st::emojiSize) / 2, (st::emojiPanSize.height() - st::emojiSize) / 2), App::emojis(), r);
+				p.drawPixmap(w + QPoint((st::emojiPanSize.width() - st::emojiSize) / 2, (st::emojiPanSize.height() - st::emojiSize) / 2), App::emojis(_emojis[index]->tile), r);
 			}
 		}
 	}
@@ -899,7 +897,7 @@ bool EmojiPan::animStep(float64 ms) {
 void EmojiPan::hideStart() {
 	if (_cache.isNull()) {
 		showAll();
-		_cache = myGrab(this, rect().marginsRemoved(st::dropdownDef.padding));
+		_cache = myGrab(this, rect().marginsRemoved(st::dropdownDef.padding), false);
 	}
 	hideAll();
 	_hiding = true;
@@ -919,7 +917,7 @@ void EmojiPan::showStart() {
 	}
 	if (_cache.isNull()) {
 		showAll();
-		_cache = myGrab(this, rect().marginsRemoved(st::dropdownDef.padding));
+		_cache = myGrab(this, rect().marginsRemoved(st::dropdownDef.padding), false);
 	}
 	hideAll();
 	_hiding = false;
@@ -1222,11 +1220,11 @@ void MentionsDropdown::updateFiltered(bool toDown) {
 				App::api()->requestFullPeer(_chat);
 			}
 		} else {
-			for (ChatData::Participants::const_iterator i = _chat->participants.cbegin(), e = _chat->participants.cend(); i != e; ++i) {
-				UserData *user = i.key();
-				if (user->username.isEmpty()) continue;
-				if (_filter.size() > 1 && (!user->username.startsWith(_filter.midRef(1), Qt::CaseInsensitive) || user->username.size() + 1 == _filter.size())) continue;
-				ordered.insertMulti(App::onlineForSort(user->onlineTill, now), user);
+			QString prefix = _filter.mid(1); // _filter is lowercase already
+			const ChatData::MentionIndex &index(_chat->mentionIndex());
+			for (ChatData::MentionIndex::const_iterator i = index.lowerBound(prefix), e = index.cend(); i != e && i.key().startsWith(prefix); ++i) {
+				if (!prefix.isEmpty() && i.key().size() == prefix.size()) continue;
+				ordered.insertMulti(App::onlineForSort(i.value()->onlineTill, now), i.value());
 			}
 		}
 		for (MentionRows::const_iterator i = _chat->lastAuthors.cbegin(), e = _chat->lastAuthors.cend(); i != e; ++i) {
@@ -1316,7 +1314,7 @@ void MentionsDropdown::hideStart() {
 	if (!_hiding) {
 		if (_cache.isNull()) {
 			_scroll.show();
-			_cache = myGrab(this, rect());
+			_cache = myGrab(this, rect(), false);
 		}
 		_scroll.hide();
 		_hiding = true;
@@ -1338,7 +1336,7 @@ void MentionsDropdown::showStart() {
 	}
 	if (_cache.isNull()) {
 		_scroll.show();
-		_cache = myGrab(this, rect());
+		_cache = myGrab(this, rect(), false);
 	}
 	_scroll.hide();
 	_hiding = false;
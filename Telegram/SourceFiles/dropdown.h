@@ -156,6 +156,7 @@ public slots:
 
 	void updateSelected();
 	void onSaveConfig();
+	void onStickerDecoded();
 
 signals:
 
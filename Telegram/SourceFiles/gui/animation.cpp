@@ -102,6 +102,11 @@ namespace anim {
 
 }
 
+void AnimationManager::finished() {
+	timer.stop();
+	myGrabTrim();
+}
+
 bool AnimatedGif::animStep(float64 ms) {
 	int32 f = frame;
 	while (f < frames.size() && ms > delays[f]) {
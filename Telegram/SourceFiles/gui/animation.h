@@ -259,7 +259,7 @@ public:
 			if (!obj->animStep(ms - obj->animStarted)) {
 				objs.erase(i);
 				if (!objs.size()) {
-					timer.stop();
+					finished();
 				}
 				obj->animInProcess = false;
 			}
@@ -277,7 +277,7 @@ public:
 			if (i != objs.cend()) {
 				objs.erase(i);
 				if (!objs.size()) {
-					timer.stop();
+					finished();
 				}
 			}
 		}
@@ -311,12 +311,14 @@ public slots:
 			toStop.clear();
 		}
 		if (!objs.size()) {
-			timer.stop();
+			finished();
 		}
 	}
 
 private:
 
+	void finished(); // the last animation stopped
+
 	typedef QSet<Animated*> AnimObjs;
 	AnimObjs objs;
 	AnimObjs toStart;
@@ -461,7 +461,7 @@ void CountrySelect::prepareAnimation(int to) {
 		a_coord.start(0);
 		af_coord = st::countriesShowFunc;
 	}
-	_cache = myGrab(this, QRect(_innerLeft, _innerTop, _innerWidth, _innerHeight));
+	_cache = myGrab(this, QRect(_innerLeft, _innerTop, _innerWidth, _innerHeight), false);
 	_scroll.hide();
 	_doneButton.hide();
 	_cancelButton.hide();
@@ -30,3401 +30,3401 @@ namespace {
 void initEmojiOne() {
 	EmojiData *toFill = emojis = (EmojiData*)emojisData;
 
-	new (toFill++) EmojiData(108, 342, 0xA9U, 0x0U, 1);
-	new (toFill++) EmojiData(126, 342, 0xAEU, 0x0U, 1);
-	new (toFill++) EmojiData(180, 342, 0x203CU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(198, 342, 0x2049U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(144, 342, 0x2122U, 0x0U, 1);
-	new (toFill++) EmojiData(540, 288, 0x2139U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(378, 288, 0x2194U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(396, 288, 0x2195U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(324, 288, 0x2196U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(306, 288, 0x2197U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(342, 288, 0x2198U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(360, 288, 0x2199U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(504, 288, 0x21A9U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(522, 288, 0x21AAU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(612, 144, 0x231AU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(576, 144, 0x231BU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(576, 288, 0x23E9U, 0x0U, 1);
-	new (toFill++) EmojiData(558, 288, 0x23EAU, 0x0U, 1);
-	new (toFill++) EmojiData(594, 288, 0x23EBU, 0x0U, 1);
-	new (toFill++) EmojiData(612, 288, 0x23ECU, 0x0U, 1);
-	new (toFill++) EmojiData(594, 144, 0x23F0U, 0x0U, 1);
-	new (toFill++) EmojiData(558, 144, 0x23F3U, 0x0U, 1);
-	new (toFill++) EmojiData(576, 306, 0x24C2U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(522, 360, 0x25AAU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(540, 360, 0x25ABU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(450, 288, 0x25B6U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(432, 288, 0x25C0U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(468, 360, 0x25FBU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(450, 360, 0x25FCU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(504, 360, 0x25FDU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(486, 360, 0x25FEU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(252, 126, 0x2600U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(288, 126, 0x2601U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(288, 144, 0x260EU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(324, 360, 0x2611U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(324, 126, 0x2614U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(648, 198, 0x2615U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(0, 54, 0x261DU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(72, 0, 0x263AU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(504, 324, 0x2648U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(522, 324, 0x2649U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(540, 324, 0x264AU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(558, 324, 0x264BU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(576, 324, 0x264CU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(594, 324, 0x264DU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(612, 324, 0x264EU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(630, 324, 0x264FU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(648, 324, 0x2650U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(666, 324, 0x2651U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(684, 324, 0x2652U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(702, 324, 0x2653U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(198, 360, 0x2660U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(234, 360, 0x2663U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(216, 360, 0x2665U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(252, 360, 0x2666U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(360, 270, 0x2668U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(486, 324, 0x267BU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(486, 306, 0x267FU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(198, 252, 0x2693U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(252, 270, 0x26A0U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(306, 126, 0x26A1U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(630, 360, 0x26AAU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(612, 360, 0x26ABU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(342, 198, 0x26BDU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(360, 198, 0x26BEU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(360, 126, 0x26C4U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(270, 126, 0x26C5U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(0, 342, 0x26CEU, 0x0U, 1);
-	new (toFill++) EmojiData(198, 324, 0x26D4U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(468, 234, 0x26EAU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(90, 252, 0x26F2U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(450, 198, 0x26F3U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(144, 252, 0x26F5U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(594, 234, 0x26FAU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(306, 270, 0x26FDU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(306, 180, 0x2702U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(270, 324, 0x2705U, 0x0U, 1);
-	new (toFill++) EmojiData(234, 252, 0x2708U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(594, 162, 0x2709U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(522, 36, 0x270AU, 0x0U, 1);
-	new (toFill++) EmojiData(576, 36, 0x270BU, 0x0U, 1);
-	new (toFill++) EmojiData(540, 36, 0x270CU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(378, 180, 0x270FU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(360, 180, 0x2712U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(306, 360, 0x2714U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(126, 360, 0x2716U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(198, 36, 0x2728U, 0x0U, 1);
-	new (toFill++) EmojiData(216, 324, 0x2733U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(288, 324, 0x2734U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(342, 126, 0x2744U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(234, 324, 0x2747U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(162, 342, 0x274CU, 0x0U, 1);
-	new (toFill++) EmojiData(252, 324, 0x274EU, 0x0U, 1);
-	new (toFill++) EmojiData(234, 342, 0x2753U, 0x0U, 1);
-	new (toFill++) EmojiData(270, 342, 0x2754U, 0x0U, 1);
-	new (toFill++) EmojiData(252, 342, 0x2755U, 0x0U, 1);
-	new (toFill++) EmojiData(216, 342, 0x2757U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(216, 72, 0x2764U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(144, 360, 0x2795U, 0x0U, 1);
-	new (toFill++) EmojiData(162, 360, 0x2796U, 0x0U, 1);
-	new (toFill++) EmojiData(180, 360, 0x2797U, 0x0U, 1);
-	new (toFill++) EmojiData(234, 288, 0x27A1U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(378, 360, 0x27B0U, 0x0U, 1);
-	new (toFill++) EmojiData(468, 324, 0x27BFU, 0x0U, 1);
-	new (toFill++) EmojiData(648, 288, 0x2934U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(630, 288, 0x2935U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(216, 288, 0x2B05U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(180, 288, 0x2B06U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(198, 288, 0x2B07U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(0, 378, 0x2B1BU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(702, 360, 0x2B1CU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(234, 126, 0x2B50U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(288, 342, 0x2B55U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(396, 360, 0x3030U, 0x0U, 1);
-	new (toFill++) EmojiData(414, 360, 0x303DU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(702, 306, 0x3297U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(684, 306, 0x3299U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(144, 288, 0x2320E3U, 0x0U, 2);
-	new (toFill++) EmojiData(90, 288, 0x3020E3U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 270, 0x3120E3U, 0x0U, 2);
-	new (toFill++) EmojiData(666, 270, 0x3220E3U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 270, 0x3320E3U, 0x0U, 2);
-	new (toFill++) EmojiData(702, 270, 0x3420E3U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 288, 0x3520E3U, 0x0U, 2);
-	new (toFill++) EmojiData(18, 288, 0x3620E3U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 288, 0x3720E3U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 288, 0x3820E3U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 288, 0x3920E3U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 198, 0xD83CDC04U, 0x0U, 2, 0xFE0F);
-	new (toFill++) EmojiData(216, 198, 0xD83CDCCFU, 0x0U, 2);
-	new (toFill++) EmojiData(378, 324, 0xD83CDD70U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 324, 0xD83CDD71U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 324, 0xD83CDD7EU, 0x0U, 2);
-	new (toFill++) EmojiData(468, 306, 0xD83CDD7FU, 0x0U, 2, 0xFE0F);
-	new (toFill++) EmojiData(414, 324, 0xD83CDD8EU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 324, 0xD83CDD91U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 306, 0xD83CDD92U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 306, 0xD83CDD93U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 324, 0xD83CDD94U, 0x0U, 2);
-	new (toFill++) EmojiData(18, 306, 0xD83CDD95U, 0x0U, 2);
-	new (toFill++) EmojiData(90, 306, 0xD83CDD96U, 0x0U, 2);
-	new (toFill++) EmojiData(666, 288, 0xD83CDD97U, 0x0U, 2);
-	new (toFill++) EmojiData(18, 324, 0xD83CDD98U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 306, 0xD83CDD99U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 324, 0xD83CDD9AU, 0x0U, 2);
-	new (toFill++) EmojiData(522, 270, 0xD83CDDE8U, 0xD83CDDF3U, 4);
-	new (toFill++) EmojiData(504, 270, 0xD83CDDE9U, 0xD83CDDEAU, 4);
-	new (toFill++) EmojiData(576, 270, 0xD83CDDEAU, 0xD83CDDF8U, 4);
-	new (toFill++) EmojiData(558, 270, 0xD83CDDEBU, 0xD83CDDF7U, 4);
-	new (toFill++) EmojiData(630, 270, 0xD83CDDECU, 0xD83CDDE7U, 4);
-	new (toFill++) EmojiData(594, 270, 0xD83CDDEEU, 0xD83CDDF9U, 4);
-	new (toFill++) EmojiData(468, 270, 0xD83CDDEFU, 0xD83CDDF5U, 4);
-	new (toFill++) EmojiData(486, 270, 0xD83CDDF0U, 0xD83CDDF7U, 4);
-	new (toFill++) EmojiData(612, 270, 0xD83CDDF7U, 0xD83CDDFAU, 4);
-	new (toFill++) EmojiData(540, 270, 0xD83CDDFAU, 0xD83CDDF8U, 4);
-	new (toFill++) EmojiData(144, 306, 0xD83CDE01U, 0x0U, 2);
-	new (toFill++) EmojiData(558, 306, 0xD83CDE02U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 306, 0xD83CDE1AU, 0x0U, 2, 0xFE0F);
-	new (toFill++) EmojiData(162, 306, 0xD83CDE2FU, 0x0U, 2, 0xFE0F);
-	new (toFill++) EmojiData(234, 306, 0xD83CDE32U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 306, 0xD83CDE33U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 306, 0xD83CDE34U, 0x0U, 2);
-	new (toFill++) EmojiData(198, 306, 0xD83CDE35U, 0x0U, 2);
-	new (toFill++) EmojiData(306, 306, 0xD83CDE36U, 0x0U, 2);
-	new (toFill++) EmojiData(522, 306, 0xD83CDE37U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 306, 0xD83CDE38U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 306, 0xD83CDE39U, 0x0U, 2);
-	new (toFill++) EmojiData(288, 306, 0xD83CDE3AU, 0x0U, 2);
-	new (toFill++) EmojiData(252, 306, 0xD83CDE50U, 0x0U, 2);
-	new (toFill++) EmojiData(666, 306, 0xD83CDE51U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 126, 0xD83CDF00U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 126, 0xD83CDF01U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 72, 0xD83CDF02U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 252, 0xD83CDF03U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 234, 0xD83CDF04U, 0x0U, 2);
-	new (toFill++) EmojiData(702, 234, 0xD83CDF05U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 234, 0xD83CDF06U, 0x0U, 2);
-	new (toFill++) EmojiData(522, 234, 0xD83CDF07U, 0x0U, 2);
-	new (toFill++) EmojiData(414, 126, 0xD83CDF08U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 252, 0xD83CDF09U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 126, 0xD83CDF0AU, 0x0U, 2);
-	new (toFill++) EmojiData(180, 126, 0xD83CDF0BU, 0x0U, 2);
-	new (toFill++) EmojiData(198, 126, 0xD83CDF0CU, 0x0U, 2);
-	new (toFill++) EmojiData(126, 126, 0xD83CDF0DU, 0x0U, 2);
-	new (toFill++) EmojiData(144, 126, 0xD83CDF0EU, 0x0U, 2);
-	new (toFill++) EmojiData(162, 126, 0xD83CDF0FU, 0x0U, 2);
-	new (toFill++) EmojiData(576, 108, 0xD83CDF10U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 108, 0xD83CDF11U, 0x0U, 2);
-	new (toFill++) EmojiData(666, 108, 0xD83CDF12U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 108, 0xD83CDF13U, 0x0U, 2);
-	new (toFill++) EmojiData(702, 108, 0xD83CDF14U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 126, 0xD83CDF15U, 0x0U, 2);
-	new (toFill++) EmojiData(18, 126, 0xD83CDF16U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 126, 0xD83CDF17U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 126, 0xD83CDF18U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 126, 0xD83CDF19U, 0x0U, 2);
-	new (toFill++) EmojiData(630, 108, 0xD83CDF1AU, 0x0U, 2);
-	new (toFill++) EmojiData(90, 126, 0xD83CDF1BU, 0x0U, 2);
-	new (toFill++) EmojiData(72, 126, 0xD83CDF1CU, 0x0U, 2);
-	new (toFill++) EmojiData(612, 108, 0xD83CDF1DU, 0x0U, 2);
-	new (toFill++) EmojiData(594, 108, 0xD83CDF1EU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 36, 0xD83CDF1FU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 126, 0xD83CDF20U, 0x0U, 2);
-	new (toFill++) EmojiData(522, 108, 0xD83CDF30U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 108, 0xD83CDF31U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 108, 0xD83CDF32U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 108, 0xD83CDF33U, 0x0U, 2);
-	new (toFill++) EmojiData(468, 108, 0xD83CDF34U, 0x0U, 2);
-	new (toFill++) EmojiData(450, 108, 0xD83CDF35U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 108, 0xD83CDF37U, 0x0U, 2);
-	new (toFill++) EmojiData(234, 108, 0xD83CDF38U, 0x0U, 2);
-	new (toFill++) EmojiData(288, 108, 0xD83CDF39U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 108, 0xD83CDF3AU, 0x0U, 2);
-	new (toFill++) EmojiData(306, 108, 0xD83CDF3BU, 0x0U, 2);
-	new (toFill++) EmojiData(558, 108, 0xD83CDF3CU, 0x0U, 2);
-	new (toFill++) EmojiData(252, 234, 0xD83CDF3DU, 0x0U, 2);
-	new (toFill++) EmojiData(414, 108, 0xD83CDF3EU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 108, 0xD83CDF3FU, 0x0U, 2);
-	new (toFill++) EmojiData(270, 108, 0xD83CDF40U, 0x0U, 2);
-	new (toFill++) EmojiData(342, 108, 0xD83CDF41U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 108, 0xD83CDF42U, 0x0U, 2);
-	new (toFill++) EmojiData(360, 108, 0xD83CDF43U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 108, 0xD83CDF44U, 0x0U, 2);
-	new (toFill++) EmojiData(234, 234, 0xD83CDF45U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 234, 0xD83CDF46U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 234, 0xD83CDF47U, 0x0U, 2);
-	new (toFill++) EmojiData(126, 234, 0xD83CDF48U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 234, 0xD83CDF49U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 234, 0xD83CDF4AU, 0x0U, 2);
-	new (toFill++) EmojiData(18, 234, 0xD83CDF4BU, 0x0U, 2);
-	new (toFill++) EmojiData(144, 234, 0xD83CDF4CU, 0x0U, 2);
-	new (toFill++) EmojiData(180, 234, 0xD83CDF4DU, 0x0U, 2);
-	new (toFill++) EmojiData(684, 216, 0xD83CDF4EU, 0x0U, 2);
-	new (toFill++) EmojiData(702, 216, 0xD83CDF4FU, 0x0U, 2);
-	new (toFill++) EmojiData(162, 234, 0xD83CDF50U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 234, 0xD83CDF51U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 234, 0xD83CDF52U, 0x0U, 2);
-	new (toFill++) EmojiData(90, 234, 0xD83CDF53U, 0x0U, 2);
-	new (toFill++) EmojiData(126, 216, 0xD83CDF54U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 216, 0xD83CDF55U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 216, 0xD83CDF56U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 216, 0xD83CDF57U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 216, 0xD83CDF58U, 0x0U, 2);
-	new (toFill++) EmojiData(306, 216, 0xD83CDF59U, 0x0U, 2);
-	new (toFill++) EmojiData(342, 216, 0xD83CDF5AU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 216, 0xD83CDF5BU, 0x0U, 2);
-	new (toFill++) EmojiData(360, 216, 0xD83CDF5CU, 0x0U, 2);
-	new (toFill++) EmojiData(198, 216, 0xD83CDF5DU, 0x0U, 2);
-	new (toFill++) EmojiData(450, 216, 0xD83CDF5EU, 0x0U, 2);
-	new (toFill++) EmojiData(144, 216, 0xD83CDF5FU, 0x0U, 2);
-	new (toFill++) EmojiData(198, 234, 0xD83CDF60U, 0x0U, 2);
-	new (toFill++) EmojiData(414, 216, 0xD83CDF61U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 216, 0xD83CDF62U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 216, 0xD83CDF63U, 0x0U, 2);
-	new (toFill++) EmojiData(234, 216, 0xD83CDF64U, 0x0U, 2);
-	new (toFill++) EmojiData(288, 216, 0xD83CDF65U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 216, 0xD83CDF66U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 216, 0xD83CDF67U, 0x0U, 2);
-	new (toFill++) EmojiData(522, 216, 0xD83CDF68U, 0x0U, 2);
-	new (toFill++) EmojiData(468, 216, 0xD83CDF69U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 216, 0xD83CDF6AU, 0x0U, 2);
-	new (toFill++) EmojiData(612, 216, 0xD83CDF6BU, 0x0U, 2);
-	new (toFill++) EmojiData(630, 216, 0xD83CDF6CU, 0x0U, 2);
-	new (toFill++) EmojiData(648, 216, 0xD83CDF6DU, 0x0U, 2);
-	new (toFill++) EmojiData(486, 216, 0xD83CDF6EU, 0x0U, 2);
-	new (toFill++) EmojiData(666, 216, 0xD83CDF6FU, 0x0U, 2);
-	new (toFill++) EmojiData(576, 216, 0xD83CDF70U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 216, 0xD83CDF71U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 216, 0xD83CDF72U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 216, 0xD83CDF73U, 0x0U, 2);
-	new (toFill++) EmojiData(90, 216, 0xD83CDF74U, 0x0U, 2);
-	new (toFill++) EmojiData(666, 198, 0xD83CDF75U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 198, 0xD83CDF76U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 216, 0xD83CDF77U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 216, 0xD83CDF78U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 216, 0xD83CDF79U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 216, 0xD83CDF7AU, 0x0U, 2);
-	new (toFill++) EmojiData(18, 216, 0xD83CDF7BU, 0x0U, 2);
-	new (toFill++) EmojiData(702, 198, 0xD83CDF7CU, 0x0U, 2);
-	new (toFill++) EmojiData(90, 72, 0xD83CDF80U, 0x0U, 2);
-	new (toFill++) EmojiData(702, 126, 0xD83CDF81U, 0x0U, 2);
-	new (toFill++) EmojiData(558, 216, 0xD83CDF82U, 0x0U, 2);
-	new (toFill++) EmojiData(630, 126, 0xD83CDF83U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 126, 0xD83CDF84U, 0x0U, 2);
-	new (toFill++) EmojiData(666, 126, 0xD83CDF85U, 0x0U, 2);
-	new (toFill++) EmojiData(558, 126, 0xD83CDF86U, 0x0U, 2);
-	new (toFill++) EmojiData(576, 126, 0xD83CDF87U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 144, 0xD83CDF88U, 0x0U, 2);
-	new (toFill++) EmojiData(18, 144, 0xD83CDF89U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 144, 0xD83CDF8AU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 144, 0xD83CDF8BU, 0x0U, 2);
-	new (toFill++) EmojiData(72, 144, 0xD83CDF8CU, 0x0U, 2);
-	new (toFill++) EmojiData(450, 126, 0xD83CDF8DU, 0x0U, 2);
-	new (toFill++) EmojiData(486, 126, 0xD83CDF8EU, 0x0U, 2);
-	new (toFill++) EmojiData(540, 126, 0xD83CDF8FU, 0x0U, 2);
-	new (toFill++) EmojiData(594, 126, 0xD83CDF90U, 0x0U, 2);
-	new (toFill++) EmojiData(612, 126, 0xD83CDF91U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 126, 0xD83CDF92U, 0x0U, 2);
-	new (toFill++) EmojiData(522, 126, 0xD83CDF93U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 252, 0xD83CDFA0U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 252, 0xD83CDFA1U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 252, 0xD83CDFA2U, 0x0U, 2);
-	new (toFill++) EmojiData(630, 198, 0xD83CDFA3U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 198, 0xD83CDFA4U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 144, 0xD83CDFA5U, 0x0U, 2);
-	new (toFill++) EmojiData(126, 306, 0xD83CDFA6U, 0x0U, 2);
-	new (toFill++) EmojiData(18, 198, 0xD83CDFA7U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 180, 0xD83CDFA8U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 54, 0xD83CDFA9U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 270, 0xD83CDFAAU, 0x0U, 2);
-	new (toFill++) EmojiData(198, 270, 0xD83CDFABU, 0x0U, 2);
-	new (toFill++) EmojiData(702, 180, 0xD83CDFACU, 0x0U, 2);
-	new (toFill++) EmojiData(414, 270, 0xD83CDFADU, 0x0U, 2);
-	new (toFill++) EmojiData(198, 198, 0xD83CDFAEU, 0x0U, 2);
-	new (toFill++) EmojiData(288, 198, 0xD83CDFAFU, 0x0U, 2);
-	new (toFill++) EmojiData(342, 270, 0xD83CDFB0U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 198, 0xD83CDFB1U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 198, 0xD83CDFB2U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 198, 0xD83CDFB3U, 0x0U, 2);
-	new (toFill++) EmojiData(234, 198, 0xD83CDFB4U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 198, 0xD83CDFB5U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 198, 0xD83CDFB6U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 198, 0xD83CDFB7U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 198, 0xD83CDFB8U, 0x0U, 2);
-	new (toFill++) EmojiData(90, 198, 0xD83CDFB9U, 0x0U, 2);
-	new (toFill++) EmojiData(126, 198, 0xD83CDFBAU, 0x0U, 2);
-	new (toFill++) EmojiData(108, 198, 0xD83CDFBBU, 0x0U, 2);
-	new (toFill++) EmojiData(36, 198, 0xD83CDFBCU, 0x0U, 2);
-	new (toFill++) EmojiData(648, 54, 0xD83CDFBDU, 0x0U, 2);
-	new (toFill++) EmojiData(378, 198, 0xD83CDFBEU, 0x0U, 2);
-	new (toFill++) EmojiData(558, 198, 0xD83CDFBFU, 0x0U, 2);
-	new (toFill++) EmojiData(324, 198, 0xD83CDFC0U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 198, 0xD83CDFC1U, 0x0U, 2);
-	new (toFill++) EmojiData(576, 198, 0xD83CDFC2U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 54, 0xD83CDFC3U, 0x0U, 2);
-	new (toFill++) EmojiData(612, 198, 0xD83CDFC4U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 198, 0xD83CDFC6U, 0x0U, 2);
-	new (toFill++) EmojiData(522, 198, 0xD83CDFC7U, 0x0U, 2);
-	new (toFill++) EmojiData(306, 198, 0xD83CDFC8U, 0x0U, 2);
-	new (toFill++) EmojiData(414, 198, 0xD83CDFC9U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 198, 0xD83CDFCAU, 0x0U, 2);
-	new (toFill++) EmojiData(270, 234, 0xD83CDFE0U, 0x0U, 2);
-	new (toFill++) EmojiData(288, 234, 0xD83CDFE1U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 234, 0xD83CDFE2U, 0x0U, 2);
-	new (toFill++) EmojiData(342, 234, 0xD83CDFE3U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 234, 0xD83CDFE4U, 0x0U, 2);
-	new (toFill++) EmojiData(360, 234, 0xD83CDFE5U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 234, 0xD83CDFE6U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 342, 0xD83CDFE7U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 234, 0xD83CDFE8U, 0x0U, 2);
-	new (toFill++) EmojiData(414, 234, 0xD83CDFE9U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 234, 0xD83CDFEAU, 0x0U, 2);
-	new (toFill++) EmojiData(306, 234, 0xD83CDFEBU, 0x0U, 2);
-	new (toFill++) EmojiData(486, 234, 0xD83CDFECU, 0x0U, 2);
-	new (toFill++) EmojiData(612, 234, 0xD83CDFEDU, 0x0U, 2);
-	new (toFill++) EmojiData(324, 270, 0xD83CDFEEU, 0x0U, 2);
-	new (toFill++) EmojiData(558, 234, 0xD83CDFEFU, 0x0U, 2);
-	new (toFill++) EmojiData(576, 234, 0xD83CDFF0U, 0x0U, 2);
-	new (toFill++) EmojiData(558, 90, 0xD83DDC00U, 0x0U, 2);
-	new (toFill++) EmojiData(18, 108, 0xD83DDC01U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 108, 0xD83DDC02U, 0x0U, 2);
-	new (toFill++) EmojiData(576, 90, 0xD83DDC03U, 0x0U, 2);
-	new (toFill++) EmojiData(522, 90, 0xD83DDC04U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 90, 0xD83DDC05U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 108, 0xD83DDC06U, 0x0U, 2);
-	new (toFill++) EmojiData(612, 90, 0xD83DDC07U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 108, 0xD83DDC08U, 0x0U, 2);
-	new (toFill++) EmojiData(630, 90, 0xD83DDC09U, 0x0U, 2);
-	new (toFill++) EmojiData(90, 108, 0xD83DDC0AU, 0x0U, 2);
-	new (toFill++) EmojiData(504, 90, 0xD83DDC0BU, 0x0U, 2);
-	new (toFill++) EmojiData(378, 90, 0xD83DDC0CU, 0x0U, 2);
-	new (toFill++) EmojiData(270, 90, 0xD83DDC0DU, 0x0U, 2);
-	new (toFill++) EmojiData(648, 90, 0xD83DDC0EU, 0x0U, 2);
-	new (toFill++) EmojiData(540, 90, 0xD83DDC0FU, 0x0U, 2);
-	new (toFill++) EmojiData(666, 90, 0xD83DDC10U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 90, 0xD83DDC11U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 90, 0xD83DDC12U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 90, 0xD83DDC13U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 90, 0xD83DDC14U, 0x0U, 2);
-	new (toFill++) EmojiData(702, 90, 0xD83DDC15U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 108, 0xD83DDC16U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 90, 0xD83DDC17U, 0x0U, 2);
-	new (toFill++) EmojiData(126, 90, 0xD83DDC18U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 90, 0xD83DDC19U, 0x0U, 2);
-	new (toFill++) EmojiData(414, 90, 0xD83DDC1AU, 0x0U, 2);
-	new (toFill++) EmojiData(306, 90, 0xD83DDC1BU, 0x0U, 2);
-	new (toFill++) EmojiData(342, 90, 0xD83DDC1CU, 0x0U, 2);
-	new (toFill++) EmojiData(324, 90, 0xD83DDC1DU, 0x0U, 2);
-	new (toFill++) EmojiData(360, 90, 0xD83DDC1EU, 0x0U, 2);
-	new (toFill++) EmojiData(450, 90, 0xD83DDC1FU, 0x0U, 2);
-	new (toFill++) EmojiData(432, 90, 0xD83DDC20U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 108, 0xD83DDC21U, 0x0U, 2);
-	new (toFill++) EmojiData(288, 90, 0xD83DDC22U, 0x0U, 2);
-	new (toFill++) EmojiData(234, 90, 0xD83DDC23U, 0x0U, 2);
-	new (toFill++) EmojiData(198, 90, 0xD83DDC24U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 90, 0xD83DDC25U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 90, 0xD83DDC26U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 90, 0xD83DDC27U, 0x0U, 2);
-	new (toFill++) EmojiData(666, 72, 0xD83DDC28U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 108, 0xD83DDC29U, 0x0U, 2);
-	new (toFill++) EmojiData(126, 108, 0xD83DDC2AU, 0x0U, 2);
-	new (toFill++) EmojiData(108, 108, 0xD83DDC2BU, 0x0U, 2);
-	new (toFill++) EmojiData(468, 90, 0xD83DDC2CU, 0x0U, 2);
-	new (toFill++) EmojiData(576, 72, 0xD83DDC2DU, 0x0U, 2);
-	new (toFill++) EmojiData(18, 90, 0xD83DDC2EU, 0x0U, 2);
-	new (toFill++) EmojiData(648, 72, 0xD83DDC2FU, 0x0U, 2);
-	new (toFill++) EmojiData(612, 72, 0xD83DDC30U, 0x0U, 2);
-	new (toFill++) EmojiData(558, 72, 0xD83DDC31U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 108, 0xD83DDC32U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 90, 0xD83DDC33U, 0x0U, 2);
-	new (toFill++) EmojiData(90, 90, 0xD83DDC34U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 90, 0xD83DDC35U, 0x0U, 2);
-	new (toFill++) EmojiData(522, 72, 0xD83DDC36U, 0x0U, 2);
-	new (toFill++) EmojiData(702, 72, 0xD83DDC37U, 0x0U, 2);
-	new (toFill++) EmojiData(630, 72, 0xD83DDC38U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 72, 0xD83DDC39U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 72, 0xD83DDC3AU, 0x0U, 2);
-	new (toFill++) EmojiData(684, 72, 0xD83DDC3BU, 0x0U, 2);
-	new (toFill++) EmojiData(144, 90, 0xD83DDC3CU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 90, 0xD83DDC3DU, 0x0U, 2);
-	new (toFill++) EmojiData(198, 108, 0xD83DDC3EU, 0x0U, 2);
-	new (toFill++) EmojiData(378, 36, 0xD83DDC40U, 0x0U, 2);
-	new (toFill++) EmojiData(360, 36, 0xD83DDC42U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 36, 0xD83DDC43U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 36, 0xD83DDC44U, 0x0U, 2);
-	new (toFill++) EmojiData(414, 36, 0xD83DDC45U, 0x0U, 2);
-	new (toFill++) EmojiData(612, 36, 0xD83DDC46U, 0x0U, 2);
-	new (toFill++) EmojiData(630, 36, 0xD83DDC47U, 0x0U, 2);
-	new (toFill++) EmojiData(666, 36, 0xD83DDC48U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 36, 0xD83DDC49U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 36, 0xD83DDC4AU, 0x0U, 2);
-	new (toFill++) EmojiData(558, 36, 0xD83DDC4BU, 0x0U, 2);
-	new (toFill++) EmojiData(486, 36, 0xD83DDC4CU, 0x0U, 2);
-	new (toFill++) EmojiData(450, 36, 0xD83DDC4DU, 0x0U, 2);
-	new (toFill++) EmojiData(468, 36, 0xD83DDC4EU, 0x0U, 2);
-	new (toFill++) EmojiData(18, 54, 0xD83DDC4FU, 0x0U, 2);
-	new (toFill++) EmojiData(594, 36, 0xD83DDC50U, 0x0U, 2);
-	new (toFill++) EmojiData(450, 54, 0xD83DDC51U, 0x0U, 2);
-	new (toFill++) EmojiData(468, 54, 0xD83DDC52U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 72, 0xD83DDC53U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 54, 0xD83DDC54U, 0x0U, 2);
-	new (toFill++) EmojiData(576, 54, 0xD83DDC55U, 0x0U, 2);
-	new (toFill++) EmojiData(666, 54, 0xD83DDC56U, 0x0U, 2);
-	new (toFill++) EmojiData(630, 54, 0xD83DDC57U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 54, 0xD83DDC58U, 0x0U, 2);
-	new (toFill++) EmojiData(702, 54, 0xD83DDC59U, 0x0U, 2);
-	new (toFill++) EmojiData(612, 54, 0xD83DDC5AU, 0x0U, 2);
-	new (toFill++) EmojiData(54, 72, 0xD83DDC5BU, 0x0U, 2);
-	new (toFill++) EmojiData(18, 72, 0xD83DDC5CU, 0x0U, 2);
-	new (toFill++) EmojiData(36, 72, 0xD83DDC5DU, 0x0U, 2);
-	new (toFill++) EmojiData(504, 54, 0xD83DDC5EU, 0x0U, 2);
-	new (toFill++) EmojiData(486, 54, 0xD83DDC5FU, 0x0U, 2);
-	new (toFill++) EmojiData(540, 54, 0xD83DDC60U, 0x0U, 2);
-	new (toFill++) EmojiData(522, 54, 0xD83DDC61U, 0x0U, 2);
-	new (toFill++) EmojiData(558, 54, 0xD83DDC62U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 72, 0xD83DDC63U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 72, 0xD83DDC64U, 0x0U, 2);
-	new (toFill++) EmojiData(450, 72, 0xD83DDC65U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 18, 0xD83DDC66U, 0x0U, 2);
-	new (toFill++) EmojiData(450, 18, 0xD83DDC67U, 0x0U, 2);
-	new (toFill++) EmojiData(468, 18, 0xD83DDC68U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 18, 0xD83DDC69U, 0x0U, 2);
-	new (toFill++) EmojiData(126, 54, 0xD83DDC6AU, 0x0U, 2);
-	new (toFill++) EmojiData(108, 54, 0xD83DDC6BU, 0x0U, 2);
-	new (toFill++) EmojiData(144, 54, 0xD83DDC6CU, 0x0U, 2);
-	new (toFill++) EmojiData(162, 54, 0xD83DDC6DU, 0x0U, 2);
-	new (toFill++) EmojiData(360, 18, 0xD83DDC6EU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 54, 0xD83DDC6FU, 0x0U, 2);
-	new (toFill++) EmojiData(360, 54, 0xD83DDC70U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 18, 0xD83DDC71U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 18, 0xD83DDC72U, 0x0U, 2);
-	new (toFill++) EmojiData(342, 18, 0xD83DDC73U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 18, 0xD83DDC74U, 0x0U, 2);
-	new (toFill++) EmojiData(522, 18, 0xD83DDC75U, 0x0U, 2);
-	new (toFill++) EmojiData(414, 18, 0xD83DDC76U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 18, 0xD83DDC77U, 0x0U, 2);
-	new (toFill++) EmojiData(576, 18, 0xD83DDC78U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 36, 0xD83DDC79U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 36, 0xD83DDC7AU, 0x0U, 2);
-	new (toFill++) EmojiData(648, 126, 0xD83DDC7BU, 0x0U, 2);
-	new (toFill++) EmojiData(558, 18, 0xD83DDC7CU, 0x0U, 2);
-	new (toFill++) EmojiData(144, 36, 0xD83DDC7DU, 0x0U, 2);
-	new (toFill++) EmojiData(180, 198, 0xD83DDC7EU, 0x0U, 2);
-	new (toFill++) EmojiData(144, 18, 0xD83DDC7FU, 0x0U, 2);
-	new (toFill++) EmojiData(126, 36, 0xD83DDC80U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 54, 0xD83DDC81U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 18, 0xD83DDC82U, 0x0U, 2);
-	new (toFill++) EmojiData(90, 54, 0xD83DDC83U, 0x0U, 2);
-	new (toFill++) EmojiData(126, 72, 0xD83DDC84U, 0x0U, 2);
-	new (toFill++) EmojiData(342, 54, 0xD83DDC85U, 0x0U, 2);
-	new (toFill++) EmojiData(306, 54, 0xD83DDC86U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 54, 0xD83DDC87U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 270, 0xD83DDC88U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 162, 0xD83DDC89U, 0x0U, 2);
-	new (toFill++) EmojiData(360, 162, 0xD83DDC8AU, 0x0U, 2);
-	new (toFill++) EmojiData(378, 72, 0xD83DDC8BU, 0x0U, 2);
-	new (toFill++) EmojiData(360, 72, 0xD83DDC8CU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 72, 0xD83DDC8DU, 0x0U, 2);
-	new (toFill++) EmojiData(414, 72, 0xD83DDC8EU, 0x0U, 2);
-	new (toFill++) EmojiData(180, 54, 0xD83DDC8FU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 108, 0xD83DDC90U, 0x0U, 2);
-	new (toFill++) EmojiData(198, 54, 0xD83DDC91U, 0x0U, 2);
-	new (toFill++) EmojiData(450, 234, 0xD83DDC92U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 72, 0xD83DDC93U, 0x0U, 2);
-	new (toFill++) EmojiData(234, 72, 0xD83DDC94U, 0x0U, 2);
-	new (toFill++) EmojiData(288, 72, 0xD83DDC95U, 0x0U, 2);
-	new (toFill++) EmojiData(306, 72, 0xD83DDC96U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 72, 0xD83DDC97U, 0x0U, 2);
-	new (toFill++) EmojiData(342, 72, 0xD83DDC98U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 72, 0xD83DDC99U, 0x0U, 2);
-	new (toFill++) EmojiData(198, 72, 0xD83DDC9AU, 0x0U, 2);
-	new (toFill++) EmojiData(144, 72, 0xD83DDC9BU, 0x0U, 2);
-	new (toFill++) EmojiData(180, 72, 0xD83DDC9CU, 0x0U, 2);
-	new (toFill++) EmojiData(468, 126, 0xD83DDC9DU, 0x0U, 2);
-	new (toFill++) EmojiData(324, 72, 0xD83DDC9EU, 0x0U, 2);
-	new (toFill++) EmojiData(306, 324, 0xD83DDC9FU, 0x0U, 2);
-	new (toFill++) EmojiData(450, 324, 0xD83DDCA0U, 0x0U, 2);
-	new (toFill++) EmojiData(18, 162, 0xD83DDCA1U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 36, 0xD83DDCA2U, 0x0U, 2);
-	new (toFill++) EmojiData(306, 162, 0xD83DDCA3U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 36, 0xD83DDCA4U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 36, 0xD83DDCA5U, 0x0U, 2);
-	new (toFill++) EmojiData(288, 36, 0xD83DDCA6U, 0x0U, 2);
-	new (toFill++) EmojiData(306, 36, 0xD83DDCA7U, 0x0U, 2);
-	new (toFill++) EmojiData(342, 36, 0xD83DDCA8U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 36, 0xD83DDCA9U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 54, 0xD83DDCAAU, 0x0U, 2);
-	new (toFill++) EmojiData(234, 36, 0xD83DDCABU, 0x0U, 2);
-	new (toFill++) EmojiData(468, 72, 0xD83DDCACU, 0x0U, 2);
-	new (toFill++) EmojiData(504, 72, 0xD83DDCADU, 0x0U, 2);
-	new (toFill++) EmojiData(270, 360, 0xD83DDCAEU, 0x0U, 2);
-	new (toFill++) EmojiData(288, 360, 0xD83DDCAFU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 162, 0xD83DDCB0U, 0x0U, 2);
-	new (toFill++) EmojiData(90, 342, 0xD83DDCB1U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 342, 0xD83DDCB2U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 162, 0xD83DDCB3U, 0x0U, 2);
-	new (toFill++) EmojiData(414, 162, 0xD83DDCB4U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 162, 0xD83DDCB5U, 0x0U, 2);
-	new (toFill++) EmojiData(468, 162, 0xD83DDCB6U, 0x0U, 2);
-	new (toFill++) EmojiData(450, 162, 0xD83DDCB7U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 162, 0xD83DDCB8U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 342, 0xD83DDCB9U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 252, 0xD83DDCBAU, 0x0U, 2);
-	new (toFill++) EmojiData(252, 144, 0xD83DDCBBU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 72, 0xD83DDCBCU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 144, 0xD83DDCBDU, 0x0U, 2);
-	new (toFill++) EmojiData(234, 144, 0xD83DDCBEU, 0x0U, 2);
-	new (toFill++) EmojiData(180, 144, 0xD83DDCBFU, 0x0U, 2);
-	new (toFill++) EmojiData(198, 144, 0xD83DDCC0U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 180, 0xD83DDCC1U, 0x0U, 2);
-	new (toFill++) EmojiData(288, 180, 0xD83DDCC2U, 0x0U, 2);
-	new (toFill++) EmojiData(90, 180, 0xD83DDCC3U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 180, 0xD83DDCC4U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 180, 0xD83DDCC5U, 0x0U, 2);
-	new (toFill++) EmojiData(234, 180, 0xD83DDCC6U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 180, 0xD83DDCC7U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 180, 0xD83DDCC8U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 180, 0xD83DDCC9U, 0x0U, 2);
-	new (toFill++) EmojiData(126, 180, 0xD83DDCCAU, 0x0U, 2);
-	new (toFill++) EmojiData(198, 180, 0xD83DDCCBU, 0x0U, 2);
-	new (toFill++) EmojiData(324, 180, 0xD83DDCCCU, 0x0U, 2);
-	new (toFill++) EmojiData(432, 270, 0xD83DDCCDU, 0x0U, 2);
-	new (toFill++) EmojiData(342, 180, 0xD83DDCCEU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 180, 0xD83DDCCFU, 0x0U, 2);
-	new (toFill++) EmojiData(414, 180, 0xD83DDCD0U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 180, 0xD83DDCD1U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 180, 0xD83DDCD2U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 180, 0xD83DDCD3U, 0x0U, 2);
-	new (toFill++) EmojiData(522, 180, 0xD83DDCD4U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 180, 0xD83DDCD5U, 0x0U, 2);
-	new (toFill++) EmojiData(576, 180, 0xD83DDCD6U, 0x0U, 2);
-	new (toFill++) EmojiData(450, 180, 0xD83DDCD7U, 0x0U, 2);
-	new (toFill++) EmojiData(468, 180, 0xD83DDCD8U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 180, 0xD83DDCD9U, 0x0U, 2);
-	new (toFill++) EmojiData(558, 180, 0xD83DDCDAU, 0x0U, 2);
-	new (toFill++) EmojiData(612, 180, 0xD83DDCDBU, 0x0U, 2);
-	new (toFill++) EmojiData(180, 180, 0xD83DDCDCU, 0x0U, 2);
-	new (toFill++) EmojiData(54, 180, 0xD83DDCDDU, 0x0U, 2);
-	new (toFill++) EmojiData(306, 144, 0xD83DDCDEU, 0x0U, 2);
-	new (toFill++) EmojiData(324, 144, 0xD83DDCDFU, 0x0U, 2);
-	new (toFill++) EmojiData(342, 144, 0xD83DDCE0U, 0x0U, 2);
-	new (toFill++) EmojiData(360, 144, 0xD83DDCE1U, 0x0U, 2);
-	new (toFill++) EmojiData(522, 144, 0xD83DDCE2U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 144, 0xD83DDCE3U, 0x0U, 2);
-	new (toFill++) EmojiData(576, 162, 0xD83DDCE4U, 0x0U, 2);
-	new (toFill++) EmojiData(558, 162, 0xD83DDCE5U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 180, 0xD83DDCE6U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 162, 0xD83DDCE7U, 0x0U, 2);
-	new (toFill++) EmojiData(630, 162, 0xD83DDCE8U, 0x0U, 2);
-	new (toFill++) EmojiData(612, 162, 0xD83DDCE9U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 162, 0xD83DDCEAU, 0x0U, 2);
-	new (toFill++) EmojiData(666, 162, 0xD83DDCEBU, 0x0U, 2);
-	new (toFill++) EmojiData(702, 162, 0xD83DDCECU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 180, 0xD83DDCEDU, 0x0U, 2);
-	new (toFill++) EmojiData(18, 180, 0xD83DDCEEU, 0x0U, 2);
-	new (toFill++) EmojiData(648, 162, 0xD83DDCEFU, 0x0U, 2);
-	new (toFill++) EmojiData(666, 180, 0xD83DDCF0U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 144, 0xD83DDCF1U, 0x0U, 2);
-	new (toFill++) EmojiData(522, 162, 0xD83DDCF2U, 0x0U, 2);
-	new (toFill++) EmojiData(342, 324, 0xD83DDCF3U, 0x0U, 2);
-	new (toFill++) EmojiData(360, 324, 0xD83DDCF4U, 0x0U, 2);
-	new (toFill++) EmojiData(90, 324, 0xD83DDCF5U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 306, 0xD83DDCF6U, 0x0U, 2);
-	new (toFill++) EmojiData(126, 144, 0xD83DDCF7U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 144, 0xD83DDCF9U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 144, 0xD83DDCFAU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 144, 0xD83DDCFBU, 0x0U, 2);
-	new (toFill++) EmojiData(162, 144, 0xD83DDCFCU, 0x0U, 2);
-	new (toFill++) EmojiData(684, 288, 0xD83DDD00U, 0x0U, 2);
-	new (toFill++) EmojiData(702, 288, 0xD83DDD01U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 306, 0xD83DDD02U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 342, 0xD83DDD03U, 0x0U, 2);
-	new (toFill++) EmojiData(414, 288, 0xD83DDD04U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 162, 0xD83DDD05U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 162, 0xD83DDD06U, 0x0U, 2);
-	new (toFill++) EmojiData(468, 144, 0xD83DDD07U, 0x0U, 2);
-	new (toFill++) EmojiData(450, 144, 0xD83DDD08U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 144, 0xD83DDD09U, 0x0U, 2);
-	new (toFill++) EmojiData(414, 144, 0xD83DDD0AU, 0x0U, 2);
-	new (toFill++) EmojiData(108, 162, 0xD83DDD0BU, 0x0U, 2);
-	new (toFill++) EmojiData(90, 162, 0xD83DDD0CU, 0x0U, 2);
-	new (toFill++) EmojiData(126, 162, 0xD83DDD0DU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 162, 0xD83DDD0EU, 0x0U, 2);
-	new (toFill++) EmojiData(666, 144, 0xD83DDD0FU, 0x0U, 2);
-	new (toFill++) EmojiData(684, 144, 0xD83DDD10U, 0x0U, 2);
-	new (toFill++) EmojiData(702, 144, 0xD83DDD11U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 144, 0xD83DDD12U, 0x0U, 2);
-	new (toFill++) EmojiData(630, 144, 0xD83DDD13U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 144, 0xD83DDD14U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 144, 0xD83DDD15U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 180, 0xD83DDD16U, 0x0U, 2);
-	new (toFill++) EmojiData(360, 360, 0xD83DDD17U, 0x0U, 2);
-	new (toFill++) EmojiData(342, 360, 0xD83DDD18U, 0x0U, 2);
-	new (toFill++) EmojiData(342, 342, 0xD83DDD19U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 342, 0xD83DDD1AU, 0x0U, 2);
-	new (toFill++) EmojiData(360, 342, 0xD83DDD1BU, 0x0U, 2);
-	new (toFill++) EmojiData(378, 342, 0xD83DDD1CU, 0x0U, 2);
-	new (toFill++) EmojiData(306, 342, 0xD83DDD1DU, 0x0U, 2);
-	new (toFill++) EmojiData(72, 324, 0xD83DDD1EU, 0x0U, 2);
-	new (toFill++) EmojiData(108, 288, 0xD83DDD1FU, 0x0U, 2);
-	new (toFill++) EmojiData(252, 288, 0xD83DDD20U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 288, 0xD83DDD21U, 0x0U, 2);
-	new (toFill++) EmojiData(126, 288, 0xD83DDD22U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 288, 0xD83DDD23U, 0x0U, 2);
-	new (toFill++) EmojiData(288, 288, 0xD83DDD24U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 36, 0xD83DDD25U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 162, 0xD83DDD26U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 162, 0xD83DDD27U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 162, 0xD83DDD28U, 0x0U, 2);
-	new (toFill++) EmojiData(234, 162, 0xD83DDD29U, 0x0U, 2);
-	new (toFill++) EmojiData(342, 162, 0xD83DDD2AU, 0x0U, 2);
-	new (toFill++) EmojiData(324, 162, 0xD83DDD2BU, 0x0U, 2);
-	new (toFill++) EmojiData(630, 180, 0xD83DDD2CU, 0x0U, 2);
-	new (toFill++) EmojiData(648, 180, 0xD83DDD2DU, 0x0U, 2);
-	new (toFill++) EmojiData(90, 144, 0xD83DDD2EU, 0x0U, 2);
-	new (toFill++) EmojiData(18, 342, 0xD83DDD2FU, 0x0U, 2);
-	new (toFill++) EmojiData(288, 270, 0xD83DDD30U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 360, 0xD83DDD31U, 0x0U, 2);
-	new (toFill++) EmojiData(576, 360, 0xD83DDD32U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 360, 0xD83DDD33U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 360, 0xD83DDD34U, 0x0U, 2);
-	new (toFill++) EmojiData(666, 360, 0xD83DDD35U, 0x0U, 2);
-	new (toFill++) EmojiData(18, 378, 0xD83DDD36U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 378, 0xD83DDD37U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 378, 0xD83DDD38U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 378, 0xD83DDD39U, 0x0U, 2);
-	new (toFill++) EmojiData(558, 360, 0xD83DDD3AU, 0x0U, 2);
-	new (toFill++) EmojiData(684, 360, 0xD83DDD3BU, 0x0U, 2);
-	new (toFill++) EmojiData(468, 288, 0xD83DDD3CU, 0x0U, 2);
-	new (toFill++) EmojiData(486, 288, 0xD83DDD3DU, 0x0U, 2);
-	new (toFill++) EmojiData(450, 342, 0xD83DDD50U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 342, 0xD83DDD51U, 0x0U, 2);
-	new (toFill++) EmojiData(522, 342, 0xD83DDD52U, 0x0U, 2);
-	new (toFill++) EmojiData(558, 342, 0xD83DDD53U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 342, 0xD83DDD54U, 0x0U, 2);
-	new (toFill++) EmojiData(630, 342, 0xD83DDD55U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 342, 0xD83DDD56U, 0x0U, 2);
-	new (toFill++) EmojiData(666, 342, 0xD83DDD57U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 342, 0xD83DDD58U, 0x0U, 2);
-	new (toFill++) EmojiData(702, 342, 0xD83DDD59U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 360, 0xD83DDD5AU, 0x0U, 2);
-	new (toFill++) EmojiData(414, 342, 0xD83DDD5BU, 0x0U, 2);
-	new (toFill++) EmojiData(468, 342, 0xD83DDD5CU, 0x0U, 2);
-	new (toFill++) EmojiData(504, 342, 0xD83DDD5DU, 0x0U, 2);
-	new (toFill++) EmojiData(540, 342, 0xD83DDD5EU, 0x0U, 2);
-	new (toFill++) EmojiData(576, 342, 0xD83DDD5FU, 0x0U, 2);
-	new (toFill++) EmojiData(612, 342, 0xD83DDD60U, 0x0U, 2);
-	new (toFill++) EmojiData(18, 360, 0xD83DDD61U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 360, 0xD83DDD62U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 360, 0xD83DDD63U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 360, 0xD83DDD64U, 0x0U, 2);
-	new (toFill++) EmojiData(90, 360, 0xD83DDD65U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 360, 0xD83DDD66U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 342, 0xD83DDD67U, 0x0U, 2);
-	new (toFill++) EmojiData(666, 234, 0xD83DDDFBU, 0x0U, 2);
-	new (toFill++) EmojiData(630, 234, 0xD83DDDFCU, 0x0U, 2);
-	new (toFill++) EmojiData(18, 252, 0xD83DDDFDU, 0x0U, 2);
-	new (toFill++) EmojiData(648, 234, 0xD83DDDFEU, 0x0U, 2);
-	new (toFill++) EmojiData(378, 270, 0xD83DDDFFU, 0x0U, 2);
-	new (toFill++) EmojiData(36, 0, 0xD83DDE00U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 0, 0xD83DDE01U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 0, 0xD83DDE02U, 0x0U, 2);
-	new (toFill++) EmojiData(18, 0, 0xD83DDE03U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 0, 0xD83DDE04U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 0, 0xD83DDE05U, 0x0U, 2);
-	new (toFill++) EmojiData(666, 0, 0xD83DDE06U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 18, 0xD83DDE07U, 0x0U, 2);
-	new (toFill++) EmojiData(126, 18, 0xD83DDE08U, 0x0U, 2);
-	new (toFill++) EmojiData(90, 0, 0xD83DDE09U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 0, 0xD83DDE0AU, 0x0U, 2);
-	new (toFill++) EmojiData(684, 0, 0xD83DDE0BU, 0x0U, 2);
-	new (toFill++) EmojiData(306, 0, 0xD83DDE0CU, 0x0U, 2);
-	new (toFill++) EmojiData(108, 0, 0xD83DDE0DU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 18, 0xD83DDE0EU, 0x0U, 2);
-	new (toFill++) EmojiData(288, 18, 0xD83DDE0FU, 0x0U, 2);
-	new (toFill++) EmojiData(198, 18, 0xD83DDE10U, 0x0U, 2);
-	new (toFill++) EmojiData(306, 18, 0xD83DDE11U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 0, 0xD83DDE12U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 0, 0xD83DDE13U, 0x0U, 2);
-	new (toFill++) EmojiData(288, 0, 0xD83DDE14U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 18, 0xD83DDE15U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 0, 0xD83DDE16U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 0, 0xD83DDE17U, 0x0U, 2);
-	new (toFill++) EmojiData(126, 0, 0xD83DDE18U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 0, 0xD83DDE19U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 0, 0xD83DDE1AU, 0x0U, 2);
-	new (toFill++) EmojiData(234, 0, 0xD83DDE1BU, 0x0U, 2);
-	new (toFill++) EmojiData(198, 0, 0xD83DDE1CU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 0, 0xD83DDE1DU, 0x0U, 2);
-	new (toFill++) EmojiData(342, 0, 0xD83DDE1EU, 0x0U, 2);
-	new (toFill++) EmojiData(72, 18, 0xD83DDE1FU, 0x0U, 2);
-	new (toFill++) EmojiData(594, 0, 0xD83DDE20U, 0x0U, 2);
-	new (toFill++) EmojiData(612, 0, 0xD83DDE21U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 0, 0xD83DDE22U, 0x0U, 2);
-	new (toFill++) EmojiData(360, 0, 0xD83DDE23U, 0x0U, 2);
-	new (toFill++) EmojiData(630, 0, 0xD83DDE24U, 0x0U, 2);
-	new (toFill++) EmojiData(450, 0, 0xD83DDE25U, 0x0U, 2);
-	new (toFill++) EmojiData(90, 18, 0xD83DDE26U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 18, 0xD83DDE27U, 0x0U, 2);
-	new (toFill++) EmojiData(558, 0, 0xD83DDE28U, 0x0U, 2);
-	new (toFill++) EmojiData(522, 0, 0xD83DDE29U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 0, 0xD83DDE2AU, 0x0U, 2);
-	new (toFill++) EmojiData(540, 0, 0xD83DDE2BU, 0x0U, 2);
-	new (toFill++) EmojiData(180, 18, 0xD83DDE2CU, 0x0U, 2);
-	new (toFill++) EmojiData(414, 0, 0xD83DDE2DU, 0x0U, 2);
-	new (toFill++) EmojiData(162, 18, 0xD83DDE2EU, 0x0U, 2);
-	new (toFill++) EmojiData(234, 18, 0xD83DDE2FU, 0x0U, 2);
-	new (toFill++) EmojiData(468, 0, 0xD83DDE30U, 0x0U, 2);
-	new (toFill++) EmojiData(576, 0, 0xD83DDE31U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 18, 0xD83DDE32U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 0, 0xD83DDE33U, 0x0U, 2);
-	new (toFill++) EmojiData(18, 18, 0xD83DDE34U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 18, 0xD83DDE35U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 18, 0xD83DDE36U, 0x0U, 2);
-	new (toFill++) EmojiData(702, 0, 0xD83DDE37U, 0x0U, 2);
-	new (toFill++) EmojiData(612, 18, 0xD83DDE38U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 36, 0xD83DDE39U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 18, 0xD83DDE3AU, 0x0U, 2);
-	new (toFill++) EmojiData(630, 18, 0xD83DDE3BU, 0x0U, 2);
-	new (toFill++) EmojiData(666, 18, 0xD83DDE3CU, 0x0U, 2);
-	new (toFill++) EmojiData(648, 18, 0xD83DDE3DU, 0x0U, 2);
-	new (toFill++) EmojiData(18, 36, 0xD83DDE3EU, 0x0U, 2);
-	new (toFill++) EmojiData(702, 18, 0xD83DDE3FU, 0x0U, 2);
-	new (toFill++) EmojiData(684, 18, 0xD83DDE40U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 54, 0xD83DDE45U, 0x0U, 2);
-	new (toFill++) EmojiData(234, 54, 0xD83DDE46U, 0x0U, 2);
-	new (toFill++) EmojiData(414, 54, 0xD83DDE47U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 36, 0xD83DDE48U, 0x0U, 2);
-	new (toFill++) EmojiData(90, 36, 0xD83DDE49U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 36, 0xD83DDE4AU, 0x0U, 2);
-	new (toFill++) EmojiData(288, 54, 0xD83DDE4BU, 0x0U, 2);
-	new (toFill++) EmojiData(684, 36, 0xD83DDE4CU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 54, 0xD83DDE4DU, 0x0U, 2);
-	new (toFill++) EmojiData(378, 54, 0xD83DDE4EU, 0x0U, 2);
-	new (toFill++) EmojiData(702, 36, 0xD83DDE4FU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 252, 0xD83DDE80U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 252, 0xD83DDE81U, 0x0U, 2);
-	new (toFill++) EmojiData(288, 252, 0xD83DDE82U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 252, 0xD83DDE83U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 252, 0xD83DDE84U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 252, 0xD83DDE85U, 0x0U, 2);
-	new (toFill++) EmojiData(360, 252, 0xD83DDE86U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 252, 0xD83DDE87U, 0x0U, 2);
-	new (toFill++) EmojiData(414, 252, 0xD83DDE88U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 252, 0xD83DDE89U, 0x0U, 2);
-	new (toFill++) EmojiData(306, 252, 0xD83DDE8AU, 0x0U, 2);
-	new (toFill++) EmojiData(468, 252, 0xD83DDE8BU, 0x0U, 2);
-	new (toFill++) EmojiData(522, 252, 0xD83DDE8CU, 0x0U, 2);
-	new (toFill++) EmojiData(540, 252, 0xD83DDE8DU, 0x0U, 2);
-	new (toFill++) EmojiData(504, 252, 0xD83DDE8EU, 0x0U, 2);
-	new (toFill++) EmojiData(180, 270, 0xD83DDE8FU, 0x0U, 2);
-	new (toFill++) EmojiData(54, 270, 0xD83DDE90U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 270, 0xD83DDE91U, 0x0U, 2);
-	new (toFill++) EmojiData(18, 270, 0xD83DDE92U, 0x0U, 2);
-	new (toFill++) EmojiData(702, 252, 0xD83DDE93U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 270, 0xD83DDE94U, 0x0U, 2);
-	new (toFill++) EmojiData(612, 252, 0xD83DDE95U, 0x0U, 2);
-	new (toFill++) EmojiData(630, 252, 0xD83DDE96U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 252, 0xD83DDE97U, 0x0U, 2);
-	new (toFill++) EmojiData(576, 252, 0xD83DDE98U, 0x0U, 2);
-	new (toFill++) EmojiData(558, 252, 0xD83DDE99U, 0x0U, 2);
-	new (toFill++) EmojiData(666, 252, 0xD83DDE9AU, 0x0U, 2);
-	new (toFill++) EmojiData(648, 252, 0xD83DDE9BU, 0x0U, 2);
-	new (toFill++) EmojiData(144, 270, 0xD83DDE9CU, 0x0U, 2);
-	new (toFill++) EmojiData(450, 252, 0xD83DDE9DU, 0x0U, 2);
-	new (toFill++) EmojiData(342, 252, 0xD83DDE9EU, 0x0U, 2);
-	new (toFill++) EmojiData(108, 270, 0xD83DDE9FU, 0x0U, 2);
-	new (toFill++) EmojiData(126, 270, 0xD83DDEA0U, 0x0U, 2);
-	new (toFill++) EmojiData(90, 270, 0xD83DDEA1U, 0x0U, 2);
-	new (toFill++) EmojiData(126, 252, 0xD83DDEA2U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 252, 0xD83DDEA3U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 252, 0xD83DDEA4U, 0x0U, 2);
-	new (toFill++) EmojiData(234, 270, 0xD83DDEA5U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 270, 0xD83DDEA6U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 270, 0xD83DDEA7U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 252, 0xD83DDEA8U, 0x0U, 2);
-	new (toFill++) EmojiData(450, 270, 0xD83DDEA9U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 162, 0xD83DDEAAU, 0x0U, 2);
-	new (toFill++) EmojiData(54, 324, 0xD83DDEABU, 0x0U, 2);
-	new (toFill++) EmojiData(288, 162, 0xD83DDEACU, 0x0U, 2);
-	new (toFill++) EmojiData(504, 306, 0xD83DDEADU, 0x0U, 2);
-	new (toFill++) EmojiData(450, 306, 0xD83DDEAEU, 0x0U, 2);
-	new (toFill++) EmojiData(108, 324, 0xD83DDEAFU, 0x0U, 2);
-	new (toFill++) EmojiData(432, 306, 0xD83DDEB0U, 0x0U, 2);
-	new (toFill++) EmojiData(126, 324, 0xD83DDEB1U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 270, 0xD83DDEB2U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 324, 0xD83DDEB3U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 198, 0xD83DDEB4U, 0x0U, 2);
-	new (toFill++) EmojiData(468, 198, 0xD83DDEB5U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 54, 0xD83DDEB6U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 324, 0xD83DDEB7U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 324, 0xD83DDEB8U, 0x0U, 2);
-	new (toFill++) EmojiData(360, 306, 0xD83DDEB9U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 306, 0xD83DDEBAU, 0x0U, 2);
-	new (toFill++) EmojiData(342, 306, 0xD83DDEBBU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 306, 0xD83DDEBCU, 0x0U, 2);
-	new (toFill++) EmojiData(198, 162, 0xD83DDEBDU, 0x0U, 2);
-	new (toFill++) EmojiData(414, 306, 0xD83DDEBEU, 0x0U, 2);
-	new (toFill++) EmojiData(180, 162, 0xD83DDEBFU, 0x0U, 2);
-	new (toFill++) EmojiData(162, 162, 0xD83DDEC0U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 162, 0xD83DDEC1U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 306, 0xD83DDEC2U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 306, 0xD83DDEC3U, 0x0U, 2);
-	new (toFill++) EmojiData(612, 306, 0xD83DDEC4U, 0x0U, 2);
-	new (toFill++) EmojiData(630, 306, 0xD83DDEC5U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 54, 4, 0xA9U, 0x0U, 1);
+	new (toFill++) EmojiData(198, 54, 4, 0xAEU, 0x0U, 1);
+	new (toFill++) EmojiData(252, 54, 4, 0x203CU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(270, 54, 4, 0x2049U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(216, 54, 4, 0x2122U, 0x0U, 1);
+	new (toFill++) EmojiData(612, 0, 4, 0x2139U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(450, 0, 4, 0x2194U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(468, 0, 4, 0x2195U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(396, 0, 4, 0x2196U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(378, 0, 4, 0x2197U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(414, 0, 4, 0x2198U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(432, 0, 4, 0x2199U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(576, 0, 4, 0x21A9U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(594, 0, 4, 0x21AAU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(162, 18, 2, 0x231AU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(126, 18, 2, 0x231BU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(648, 0, 4, 0x23E9U, 0x0U, 1);
+	new (toFill++) EmojiData(630, 0, 4, 0x23EAU, 0x0U, 1);
+	new (toFill++) EmojiData(666, 0, 4, 0x23EBU, 0x0U, 1);
+	new (toFill++) EmojiData(684, 0, 4, 0x23ECU, 0x0U, 1);
+	new (toFill++) EmojiData(144, 18, 2, 0x23F0U, 0x0U, 1);
+	new (toFill++) EmojiData(108, 18, 2, 0x23F3U, 0x0U, 1);
+	new (toFill++) EmojiData(648, 18, 4, 0x24C2U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(594, 72, 4, 0x25AAU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(612, 72, 4, 0x25ABU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(522, 0, 4, 0x25B6U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(504, 0, 4, 0x25C0U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(540, 72, 4, 0x25FBU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(522, 72, 4, 0x25FCU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(576, 72, 4, 0x25FDU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(558, 72, 4, 0x25FEU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(450, 36, 1, 0x2600U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(486, 36, 1, 0x2601U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(558, 0, 2, 0x260EU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(396, 72, 4, 0x2611U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(522, 36, 1, 0x2614U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(198, 72, 2, 0x2615U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(0, 54, 0, 0x261DU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(72, 0, 0, 0x263AU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(576, 36, 4, 0x2648U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(594, 36, 4, 0x2649U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(612, 36, 4, 0x264AU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(630, 36, 4, 0x264BU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(648, 36, 4, 0x264CU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(666, 36, 4, 0x264DU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(684, 36, 4, 0x264EU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(702, 36, 4, 0x264FU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(0, 54, 4, 0x2650U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(18, 54, 4, 0x2651U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(36, 54, 4, 0x2652U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(54, 54, 4, 0x2653U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(270, 72, 4, 0x2660U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(306, 72, 4, 0x2663U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(288, 72, 4, 0x2665U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(324, 72, 4, 0x2666U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(90, 36, 3, 0x2668U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(558, 36, 4, 0x267BU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(558, 18, 4, 0x267FU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(648, 0, 3, 0x2693U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(702, 18, 3, 0x26A0U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(504, 36, 1, 0x26A1U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(702, 72, 4, 0x26AAU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(684, 72, 4, 0x26ABU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(612, 54, 2, 0x26BDU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(630, 54, 2, 0x26BEU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(558, 36, 1, 0x26C4U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(468, 36, 1, 0x26C5U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(72, 54, 4, 0x26CEU, 0x0U, 1);
+	new (toFill++) EmojiData(270, 36, 4, 0x26D4U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(198, 0, 3, 0x26EAU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(540, 0, 3, 0x26F2U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(0, 72, 2, 0x26F3U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(594, 0, 3, 0x26F5U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(324, 0, 3, 0x26FAU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(36, 36, 3, 0x26FDU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(576, 36, 2, 0x2702U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(342, 36, 4, 0x2705U, 0x0U, 1);
+	new (toFill++) EmojiData(684, 0, 3, 0x2708U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(144, 36, 2, 0x2709U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(522, 36, 0, 0x270AU, 0x0U, 1);
+	new (toFill++) EmojiData(576, 36, 0, 0x270BU, 0x0U, 1);
+	new (toFill++) EmojiData(540, 36, 0, 0x270CU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(648, 36, 2, 0x270FU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(630, 36, 2, 0x2712U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(378, 72, 4, 0x2714U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(198, 72, 4, 0x2716U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(198, 36, 0, 0x2728U, 0x0U, 1);
+	new (toFill++) EmojiData(288, 36, 4, 0x2733U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(360, 36, 4, 0x2734U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(540, 36, 1, 0x2744U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(306, 36, 4, 0x2747U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(234, 54, 4, 0x274CU, 0x0U, 1);
+	new (toFill++) EmojiData(324, 36, 4, 0x274EU, 0x0U, 1);
+	new (toFill++) EmojiData(306, 54, 4, 0x2753U, 0x0U, 1);
+	new (toFill++) EmojiData(342, 54, 4, 0x2754U, 0x0U, 1);
+	new (toFill++) EmojiData(324, 54, 4, 0x2755U, 0x0U, 1);
+	new (toFill++) EmojiData(288, 54, 4, 0x2757U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(216, 72, 0, 0x2764U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(216, 72, 4, 0x2795U, 0x0U, 1);
+	new (toFill++) EmojiData(234, 72, 4, 0x2796U, 0x0U, 1);
+	new (toFill++) EmojiData(252, 72, 4, 0x2797U, 0x0U, 1);
+	new (toFill++) EmojiData(306, 0, 4, 0x27A1U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(450, 72, 4, 0x27B0U, 0x0U, 1);
+	new (toFill++) EmojiData(540, 36, 4, 0x27BFU, 0x0U, 1);
+	new (toFill++) EmojiData(0, 18, 4, 0x2934U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(702, 0, 4, 0x2935U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(288, 0, 4, 0x2B05U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(252, 0, 4, 0x2B06U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(270, 0, 4, 0x2B07U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(72, 90, 4, 0x2B1BU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(54, 90, 4, 0x2B1CU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(432, 36, 1, 0x2B50U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(360, 54, 4, 0x2B55U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(468, 72, 4, 0x3030U, 0x0U, 1);
+	new (toFill++) EmojiData(486, 72, 4, 0x303DU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(54, 36, 4, 0x3297U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(36, 36, 4, 0x3299U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(216, 0, 4, 0x2320E3U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 0, 4, 0x3020E3U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 0, 4, 0x3120E3U, 0x0U, 2);
+	new (toFill++) EmojiData(18, 0, 4, 0x3220E3U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 0, 4, 0x3320E3U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 0, 4, 0x3420E3U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 0, 4, 0x3520E3U, 0x0U, 2);
+	new (toFill++) EmojiData(90, 0, 4, 0x3620E3U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 0, 4, 0x3720E3U, 0x0U, 2);
+	new (toFill++) EmojiData(126, 0, 4, 0x3820E3U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 0, 4, 0x3920E3U, 0x0U, 2);
+	new (toFill++) EmojiData(522, 54, 2, 0xD83CDC04U, 0x0U, 2, 0xFE0F);
+	new (toFill++) EmojiData(486, 54, 2, 0xD83CDCCFU, 0x0U, 2);
+	new (toFill++) EmojiData(450, 36, 4, 0xD83CDD70U, 0x0U, 2);
+	new (toFill++) EmojiData(468, 36, 4, 0xD83CDD71U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 36, 4, 0xD83CDD7EU, 0x0U, 2);
+	new (toFill++) EmojiData(540, 18, 4, 0xD83CDD7FU, 0x0U, 2, 0xFE0F);
+	new (toFill++) EmojiData(486, 36, 4, 0xD83CDD8EU, 0x0U, 2);
+	new (toFill++) EmojiData(72, 36, 4, 0xD83CDD91U, 0x0U, 2);
+	new (toFill++) EmojiData(126, 18, 4, 0xD83CDD92U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 18, 4, 0xD83CDD93U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 36, 4, 0xD83CDD94U, 0x0U, 2);
+	new (toFill++) EmojiData(90, 18, 4, 0xD83CDD95U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 18, 4, 0xD83CDD96U, 0x0U, 2);
+	new (toFill++) EmojiData(18, 18, 4, 0xD83CDD97U, 0x0U, 2);
+	new (toFill++) EmojiData(90, 36, 4, 0xD83CDD98U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 18, 4, 0xD83CDD99U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 36, 4, 0xD83CDD9AU, 0x0U, 2);
+	new (toFill++) EmojiData(252, 36, 3, 0xD83CDDE8U, 0xD83CDDF3U, 4);
+	new (toFill++) EmojiData(234, 36, 3, 0xD83CDDE9U, 0xD83CDDEAU, 4);
+	new (toFill++) EmojiData(306, 36, 3, 0xD83CDDEAU, 0xD83CDDF8U, 4);
+	new (toFill++) EmojiData(288, 36, 3, 0xD83CDDEBU, 0xD83CDDF7U, 4);
+	new (toFill++) EmojiData(360, 36, 3, 0xD83CDDECU, 0xD83CDDE7U, 4);
+	new (toFill++) EmojiData(324, 36, 3, 0xD83CDDEEU, 0xD83CDDF9U, 4);
+	new (toFill++) EmojiData(198, 36, 3, 0xD83CDDEFU, 0xD83CDDF5U, 4);
+	new (toFill++) EmojiData(216, 36, 3, 0xD83CDDF0U, 0xD83CDDF7U, 4);
+	new (toFill++) EmojiData(342, 36, 3, 0xD83CDDF7U, 0xD83CDDFAU, 4);
+	new (toFill++) EmojiData(270, 36, 3, 0xD83CDDFAU, 0xD83CDDF8U, 4);
+	new (toFill++) EmojiData(216, 18, 4, 0xD83CDE01U, 0x0U, 2);
+	new (toFill++) EmojiData(630, 18, 4, 0xD83CDE02U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 18, 4, 0xD83CDE1AU, 0x0U, 2, 0xFE0F);
+	new (toFill++) EmojiData(234, 18, 4, 0xD83CDE2FU, 0x0U, 2, 0xFE0F);
+	new (toFill++) EmojiData(306, 18, 4, 0xD83CDE32U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 18, 4, 0xD83CDE33U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 18, 4, 0xD83CDE34U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 18, 4, 0xD83CDE35U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 18, 4, 0xD83CDE36U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 18, 4, 0xD83CDE37U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 18, 4, 0xD83CDE38U, 0x0U, 2);
+	new (toFill++) EmojiData(342, 18, 4, 0xD83CDE39U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 18, 4, 0xD83CDE3AU, 0x0U, 2);
+	new (toFill++) EmojiData(324, 18, 4, 0xD83CDE50U, 0x0U, 2);
+	new (toFill++) EmojiData(18, 36, 4, 0xD83CDE51U, 0x0U, 2);
+	new (toFill++) EmojiData(576, 36, 1, 0xD83CDF00U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 36, 1, 0xD83CDF01U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 72, 0, 0xD83CDF02U, 0x0U, 2);
+	new (toFill++) EmojiData(450, 0, 3, 0xD83CDF03U, 0x0U, 2);
+	new (toFill++) EmojiData(414, 0, 3, 0xD83CDF04U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 0, 3, 0xD83CDF05U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 0, 3, 0xD83CDF06U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 0, 3, 0xD83CDF07U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 36, 1, 0xD83CDF08U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 0, 3, 0xD83CDF09U, 0x0U, 2);
+	new (toFill++) EmojiData(630, 36, 1, 0xD83CDF0AU, 0x0U, 2);
+	new (toFill++) EmojiData(378, 36, 1, 0xD83CDF0BU, 0x0U, 2);
+	new (toFill++) EmojiData(396, 36, 1, 0xD83CDF0CU, 0x0U, 2);
+	new (toFill++) EmojiData(324, 36, 1, 0xD83CDF0DU, 0x0U, 2);
+	new (toFill++) EmojiData(342, 36, 1, 0xD83CDF0EU, 0x0U, 2);
+	new (toFill++) EmojiData(360, 36, 1, 0xD83CDF0FU, 0x0U, 2);
+	new (toFill++) EmojiData(54, 36, 1, 0xD83CDF10U, 0x0U, 2);
+	new (toFill++) EmojiData(126, 36, 1, 0xD83CDF11U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 36, 1, 0xD83CDF12U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 36, 1, 0xD83CDF13U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 36, 1, 0xD83CDF14U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 36, 1, 0xD83CDF15U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 36, 1, 0xD83CDF16U, 0x0U, 2);
+	new (toFill++) EmojiData(234, 36, 1, 0xD83CDF17U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 36, 1, 0xD83CDF18U, 0x0U, 2);
+	new (toFill++) EmojiData(306, 36, 1, 0xD83CDF19U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 36, 1, 0xD83CDF1AU, 0x0U, 2);
+	new (toFill++) EmojiData(288, 36, 1, 0xD83CDF1BU, 0x0U, 2);
+	new (toFill++) EmojiData(270, 36, 1, 0xD83CDF1CU, 0x0U, 2);
+	new (toFill++) EmojiData(90, 36, 1, 0xD83CDF1DU, 0x0U, 2);
+	new (toFill++) EmojiData(72, 36, 1, 0xD83CDF1EU, 0x0U, 2);
+	new (toFill++) EmojiData(216, 36, 0, 0xD83CDF1FU, 0x0U, 2);
+	new (toFill++) EmojiData(414, 36, 1, 0xD83CDF20U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 36, 1, 0xD83CDF30U, 0x0U, 2);
+	new (toFill++) EmojiData(18, 36, 1, 0xD83CDF31U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 18, 1, 0xD83CDF32U, 0x0U, 2);
+	new (toFill++) EmojiData(702, 18, 1, 0xD83CDF33U, 0x0U, 2);
+	new (toFill++) EmojiData(666, 18, 1, 0xD83CDF34U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 18, 1, 0xD83CDF35U, 0x0U, 2);
+	new (toFill++) EmojiData(450, 18, 1, 0xD83CDF37U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 18, 1, 0xD83CDF38U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 18, 1, 0xD83CDF39U, 0x0U, 2);
+	new (toFill++) EmojiData(522, 18, 1, 0xD83CDF3AU, 0x0U, 2);
+	new (toFill++) EmojiData(504, 18, 1, 0xD83CDF3BU, 0x0U, 2);
+	new (toFill++) EmojiData(36, 36, 1, 0xD83CDF3CU, 0x0U, 2);
+	new (toFill++) EmojiData(522, 90, 2, 0xD83CDF3DU, 0x0U, 2);
+	new (toFill++) EmojiData(612, 18, 1, 0xD83CDF3EU, 0x0U, 2);
+	new (toFill++) EmojiData(594, 18, 1, 0xD83CDF3FU, 0x0U, 2);
+	new (toFill++) EmojiData(468, 18, 1, 0xD83CDF40U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 18, 1, 0xD83CDF41U, 0x0U, 2);
+	new (toFill++) EmojiData(576, 18, 1, 0xD83CDF42U, 0x0U, 2);
+	new (toFill++) EmojiData(558, 18, 1, 0xD83CDF43U, 0x0U, 2);
+	new (toFill++) EmojiData(630, 18, 1, 0xD83CDF44U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 90, 2, 0xD83CDF45U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 90, 2, 0xD83CDF46U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 90, 2, 0xD83CDF47U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 90, 2, 0xD83CDF48U, 0x0U, 2);
+	new (toFill++) EmojiData(342, 90, 2, 0xD83CDF49U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 90, 2, 0xD83CDF4AU, 0x0U, 2);
+	new (toFill++) EmojiData(288, 90, 2, 0xD83CDF4BU, 0x0U, 2);
+	new (toFill++) EmojiData(414, 90, 2, 0xD83CDF4CU, 0x0U, 2);
+	new (toFill++) EmojiData(450, 90, 2, 0xD83CDF4DU, 0x0U, 2);
+	new (toFill++) EmojiData(234, 90, 2, 0xD83CDF4EU, 0x0U, 2);
+	new (toFill++) EmojiData(252, 90, 2, 0xD83CDF4FU, 0x0U, 2);
+	new (toFill++) EmojiData(432, 90, 2, 0xD83CDF50U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 90, 2, 0xD83CDF51U, 0x0U, 2);
+	new (toFill++) EmojiData(306, 90, 2, 0xD83CDF52U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 90, 2, 0xD83CDF53U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 72, 2, 0xD83CDF54U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 72, 2, 0xD83CDF55U, 0x0U, 2);
+	new (toFill++) EmojiData(450, 72, 2, 0xD83CDF56U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 72, 2, 0xD83CDF57U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 72, 2, 0xD83CDF58U, 0x0U, 2);
+	new (toFill++) EmojiData(576, 72, 2, 0xD83CDF59U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 72, 2, 0xD83CDF5AU, 0x0U, 2);
+	new (toFill++) EmojiData(486, 72, 2, 0xD83CDF5BU, 0x0U, 2);
+	new (toFill++) EmojiData(630, 72, 2, 0xD83CDF5CU, 0x0U, 2);
+	new (toFill++) EmojiData(468, 72, 2, 0xD83CDF5DU, 0x0U, 2);
+	new (toFill++) EmojiData(0, 90, 2, 0xD83CDF5EU, 0x0U, 2);
+	new (toFill++) EmojiData(414, 72, 2, 0xD83CDF5FU, 0x0U, 2);
+	new (toFill++) EmojiData(468, 90, 2, 0xD83CDF60U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 72, 2, 0xD83CDF61U, 0x0U, 2);
+	new (toFill++) EmojiData(666, 72, 2, 0xD83CDF62U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 72, 2, 0xD83CDF63U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 72, 2, 0xD83CDF64U, 0x0U, 2);
+	new (toFill++) EmojiData(558, 72, 2, 0xD83CDF65U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 90, 2, 0xD83CDF66U, 0x0U, 2);
+	new (toFill++) EmojiData(90, 90, 2, 0xD83CDF67U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 90, 2, 0xD83CDF68U, 0x0U, 2);
+	new (toFill++) EmojiData(18, 90, 2, 0xD83CDF69U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 90, 2, 0xD83CDF6AU, 0x0U, 2);
+	new (toFill++) EmojiData(162, 90, 2, 0xD83CDF6BU, 0x0U, 2);
+	new (toFill++) EmojiData(180, 90, 2, 0xD83CDF6CU, 0x0U, 2);
+	new (toFill++) EmojiData(198, 90, 2, 0xD83CDF6DU, 0x0U, 2);
+	new (toFill++) EmojiData(36, 90, 2, 0xD83CDF6EU, 0x0U, 2);
+	new (toFill++) EmojiData(216, 90, 2, 0xD83CDF6FU, 0x0U, 2);
+	new (toFill++) EmojiData(126, 90, 2, 0xD83CDF70U, 0x0U, 2);
+	new (toFill++) EmojiData(522, 72, 2, 0xD83CDF71U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 72, 2, 0xD83CDF72U, 0x0U, 2);
+	new (toFill++) EmojiData(702, 72, 2, 0xD83CDF73U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 72, 2, 0xD83CDF74U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 72, 2, 0xD83CDF75U, 0x0U, 2);
+	new (toFill++) EmojiData(234, 72, 2, 0xD83CDF76U, 0x0U, 2);
+	new (toFill++) EmojiData(342, 72, 2, 0xD83CDF77U, 0x0U, 2);
+	new (toFill++) EmojiData(306, 72, 2, 0xD83CDF78U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 72, 2, 0xD83CDF79U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 72, 2, 0xD83CDF7AU, 0x0U, 2);
+	new (toFill++) EmojiData(288, 72, 2, 0xD83CDF7BU, 0x0U, 2);
+	new (toFill++) EmojiData(252, 72, 2, 0xD83CDF7CU, 0x0U, 2);
+	new (toFill++) EmojiData(90, 72, 0, 0xD83CDF80U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 0, 2, 0xD83CDF81U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 90, 2, 0xD83CDF82U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 0, 2, 0xD83CDF83U, 0x0U, 2);
+	new (toFill++) EmojiData(234, 0, 2, 0xD83CDF84U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 0, 2, 0xD83CDF85U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 0, 2, 0xD83CDF86U, 0x0U, 2);
+	new (toFill++) EmojiData(126, 0, 2, 0xD83CDF87U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 0, 2, 0xD83CDF88U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 0, 2, 0xD83CDF89U, 0x0U, 2);
+	new (toFill++) EmojiData(306, 0, 2, 0xD83CDF8AU, 0x0U, 2);
+	new (toFill++) EmojiData(270, 0, 2, 0xD83CDF8BU, 0x0U, 2);
+	new (toFill++) EmojiData(342, 0, 2, 0xD83CDF8CU, 0x0U, 2);
+	new (toFill++) EmojiData(0, 0, 2, 0xD83CDF8DU, 0x0U, 2);
+	new (toFill++) EmojiData(36, 0, 2, 0xD83CDF8EU, 0x0U, 2);
+	new (toFill++) EmojiData(90, 0, 2, 0xD83CDF8FU, 0x0U, 2);
+	new (toFill++) EmojiData(144, 0, 2, 0xD83CDF90U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 0, 2, 0xD83CDF91U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 0, 2, 0xD83CDF92U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 0, 2, 0xD83CDF93U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 0, 3, 0xD83CDFA0U, 0x0U, 2);
+	new (toFill++) EmojiData(522, 0, 3, 0xD83CDFA1U, 0x0U, 2);
+	new (toFill++) EmojiData(558, 0, 3, 0xD83CDFA2U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 72, 2, 0xD83CDFA3U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 54, 2, 0xD83CDFA4U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 0, 2, 0xD83CDFA5U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 18, 4, 0xD83CDFA6U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 54, 2, 0xD83CDFA7U, 0x0U, 2);
+	new (toFill++) EmojiData(234, 54, 2, 0xD83CDFA8U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 54, 0, 0xD83CDFA9U, 0x0U, 2);
+	new (toFill++) EmojiData(126, 36, 3, 0xD83CDFAAU, 0x0U, 2);
+	new (toFill++) EmojiData(648, 18, 3, 0xD83CDFABU, 0x0U, 2);
+	new (toFill++) EmojiData(252, 54, 2, 0xD83CDFACU, 0x0U, 2);
+	new (toFill++) EmojiData(144, 36, 3, 0xD83CDFADU, 0x0U, 2);
+	new (toFill++) EmojiData(468, 54, 2, 0xD83CDFAEU, 0x0U, 2);
+	new (toFill++) EmojiData(558, 54, 2, 0xD83CDFAFU, 0x0U, 2);
+	new (toFill++) EmojiData(72, 36, 3, 0xD83CDFB0U, 0x0U, 2);
+	new (toFill++) EmojiData(666, 54, 2, 0xD83CDFB1U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 54, 2, 0xD83CDFB2U, 0x0U, 2);
+	new (toFill++) EmojiData(702, 54, 2, 0xD83CDFB3U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 54, 2, 0xD83CDFB4U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 54, 2, 0xD83CDFB5U, 0x0U, 2);
+	new (toFill++) EmojiData(342, 54, 2, 0xD83CDFB6U, 0x0U, 2);
+	new (toFill++) EmojiData(414, 54, 2, 0xD83CDFB7U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 54, 2, 0xD83CDFB8U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 54, 2, 0xD83CDFB9U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 54, 2, 0xD83CDFBAU, 0x0U, 2);
+	new (toFill++) EmojiData(378, 54, 2, 0xD83CDFBBU, 0x0U, 2);
+	new (toFill++) EmojiData(306, 54, 2, 0xD83CDFBCU, 0x0U, 2);
+	new (toFill++) EmojiData(648, 54, 0, 0xD83CDFBDU, 0x0U, 2);
+	new (toFill++) EmojiData(648, 54, 2, 0xD83CDFBEU, 0x0U, 2);
+	new (toFill++) EmojiData(108, 72, 2, 0xD83CDFBFU, 0x0U, 2);
+	new (toFill++) EmojiData(594, 54, 2, 0xD83CDFC0U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 72, 2, 0xD83CDFC1U, 0x0U, 2);
+	new (toFill++) EmojiData(126, 72, 2, 0xD83CDFC2U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 54, 0, 0xD83CDFC3U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 72, 2, 0xD83CDFC4U, 0x0U, 2);
+	new (toFill++) EmojiData(90, 72, 2, 0xD83CDFC6U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 72, 2, 0xD83CDFC7U, 0x0U, 2);
+	new (toFill++) EmojiData(576, 54, 2, 0xD83CDFC8U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 54, 2, 0xD83CDFC9U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 72, 2, 0xD83CDFCAU, 0x0U, 2);
+	new (toFill++) EmojiData(0, 0, 3, 0xD83CDFE0U, 0x0U, 2);
+	new (toFill++) EmojiData(18, 0, 3, 0xD83CDFE1U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 0, 3, 0xD83CDFE2U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 0, 3, 0xD83CDFE3U, 0x0U, 2);
+	new (toFill++) EmojiData(234, 0, 3, 0xD83CDFE4U, 0x0U, 2);
+	new (toFill++) EmojiData(90, 0, 3, 0xD83CDFE5U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 0, 3, 0xD83CDFE6U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 54, 4, 0xD83CDFE7U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 0, 3, 0xD83CDFE8U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 0, 3, 0xD83CDFE9U, 0x0U, 2);
+	new (toFill++) EmojiData(126, 0, 3, 0xD83CDFEAU, 0x0U, 2);
+	new (toFill++) EmojiData(36, 0, 3, 0xD83CDFEBU, 0x0U, 2);
+	new (toFill++) EmojiData(216, 0, 3, 0xD83CDFECU, 0x0U, 2);
+	new (toFill++) EmojiData(342, 0, 3, 0xD83CDFEDU, 0x0U, 2);
+	new (toFill++) EmojiData(54, 36, 3, 0xD83CDFEEU, 0x0U, 2);
+	new (toFill++) EmojiData(288, 0, 3, 0xD83CDFEFU, 0x0U, 2);
+	new (toFill++) EmojiData(306, 0, 3, 0xD83CDFF0U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 18, 1, 0xD83DDC00U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 18, 1, 0xD83DDC01U, 0x0U, 2);
+	new (toFill++) EmojiData(234, 18, 1, 0xD83DDC02U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 18, 1, 0xD83DDC03U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 18, 1, 0xD83DDC04U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 18, 1, 0xD83DDC05U, 0x0U, 2);
+	new (toFill++) EmojiData(342, 18, 1, 0xD83DDC06U, 0x0U, 2);
+	new (toFill++) EmojiData(90, 18, 1, 0xD83DDC07U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 18, 1, 0xD83DDC08U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 18, 1, 0xD83DDC09U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 18, 1, 0xD83DDC0AU, 0x0U, 2);
+	new (toFill++) EmojiData(702, 0, 1, 0xD83DDC0BU, 0x0U, 2);
+	new (toFill++) EmojiData(576, 0, 1, 0xD83DDC0CU, 0x0U, 2);
+	new (toFill++) EmojiData(468, 0, 1, 0xD83DDC0DU, 0x0U, 2);
+	new (toFill++) EmojiData(126, 18, 1, 0xD83DDC0EU, 0x0U, 2);
+	new (toFill++) EmojiData(18, 18, 1, 0xD83DDC0FU, 0x0U, 2);
+	new (toFill++) EmojiData(144, 18, 1, 0xD83DDC10U, 0x0U, 2);
+	new (toFill++) EmojiData(306, 0, 1, 0xD83DDC11U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 0, 1, 0xD83DDC12U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 18, 1, 0xD83DDC13U, 0x0U, 2);
+	new (toFill++) EmojiData(450, 0, 1, 0xD83DDC14U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 18, 1, 0xD83DDC15U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 18, 1, 0xD83DDC16U, 0x0U, 2);
+	new (toFill++) EmojiData(234, 0, 1, 0xD83DDC17U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 0, 1, 0xD83DDC18U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 0, 1, 0xD83DDC19U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 0, 1, 0xD83DDC1AU, 0x0U, 2);
+	new (toFill++) EmojiData(504, 0, 1, 0xD83DDC1BU, 0x0U, 2);
+	new (toFill++) EmojiData(540, 0, 1, 0xD83DDC1CU, 0x0U, 2);
+	new (toFill++) EmojiData(522, 0, 1, 0xD83DDC1DU, 0x0U, 2);
+	new (toFill++) EmojiData(558, 0, 1, 0xD83DDC1EU, 0x0U, 2);
+	new (toFill++) EmojiData(648, 0, 1, 0xD83DDC1FU, 0x0U, 2);
+	new (toFill++) EmojiData(630, 0, 1, 0xD83DDC20U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 18, 1, 0xD83DDC21U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 0, 1, 0xD83DDC22U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 0, 1, 0xD83DDC23U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 0, 1, 0xD83DDC24U, 0x0U, 2);
+	new (toFill++) EmojiData(414, 0, 1, 0xD83DDC25U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 0, 1, 0xD83DDC26U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 0, 1, 0xD83DDC27U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 0, 1, 0xD83DDC28U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 18, 1, 0xD83DDC29U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 18, 1, 0xD83DDC2AU, 0x0U, 2);
+	new (toFill++) EmojiData(306, 18, 1, 0xD83DDC2BU, 0x0U, 2);
+	new (toFill++) EmojiData(666, 0, 1, 0xD83DDC2CU, 0x0U, 2);
+	new (toFill++) EmojiData(54, 0, 1, 0xD83DDC2DU, 0x0U, 2);
+	new (toFill++) EmojiData(216, 0, 1, 0xD83DDC2EU, 0x0U, 2);
+	new (toFill++) EmojiData(126, 0, 1, 0xD83DDC2FU, 0x0U, 2);
+	new (toFill++) EmojiData(90, 0, 1, 0xD83DDC30U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 0, 1, 0xD83DDC31U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 18, 1, 0xD83DDC32U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 0, 1, 0xD83DDC33U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 0, 1, 0xD83DDC34U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 0, 1, 0xD83DDC35U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 0, 1, 0xD83DDC36U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 0, 1, 0xD83DDC37U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 0, 1, 0xD83DDC38U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 0, 1, 0xD83DDC39U, 0x0U, 2);
+	new (toFill++) EmojiData(18, 0, 1, 0xD83DDC3AU, 0x0U, 2);
+	new (toFill++) EmojiData(162, 0, 1, 0xD83DDC3BU, 0x0U, 2);
+	new (toFill++) EmojiData(342, 0, 1, 0xD83DDC3CU, 0x0U, 2);
+	new (toFill++) EmojiData(198, 0, 1, 0xD83DDC3DU, 0x0U, 2);
+	new (toFill++) EmojiData(396, 18, 1, 0xD83DDC3EU, 0x0U, 2);
+	new (toFill++) EmojiData(378, 36, 0, 0xD83DDC40U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 36, 0, 0xD83DDC42U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 36, 0, 0xD83DDC43U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 36, 0, 0xD83DDC44U, 0x0U, 2);
+	new (toFill++) EmojiData(414, 36, 0, 0xD83DDC45U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 36, 0, 0xD83DDC46U, 0x0U, 2);
+	new (toFill++) EmojiData(630, 36, 0, 0xD83DDC47U, 0x0U, 2);
+	new (toFill++) EmojiData(666, 36, 0, 0xD83DDC48U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 36, 0, 0xD83DDC49U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 36, 0, 0xD83DDC4AU, 0x0U, 2);
+	new (toFill++) EmojiData(558, 36, 0, 0xD83DDC4BU, 0x0U, 2);
+	new (toFill++) EmojiData(486, 36, 0, 0xD83DDC4CU, 0x0U, 2);
+	new (toFill++) EmojiData(450, 36, 0, 0xD83DDC4DU, 0x0U, 2);
+	new (toFill++) EmojiData(468, 36, 0, 0xD83DDC4EU, 0x0U, 2);
+	new (toFill++) EmojiData(18, 54, 0, 0xD83DDC4FU, 0x0U, 2);
+	new (toFill++) EmojiData(594, 36, 0, 0xD83DDC50U, 0x0U, 2);
+	new (toFill++) EmojiData(450, 54, 0, 0xD83DDC51U, 0x0U, 2);
+	new (toFill++) EmojiData(468, 54, 0, 0xD83DDC52U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 72, 0, 0xD83DDC53U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 54, 0, 0xD83DDC54U, 0x0U, 2);
+	new (toFill++) EmojiData(576, 54, 0, 0xD83DDC55U, 0x0U, 2);
+	new (toFill++) EmojiData(666, 54, 0, 0xD83DDC56U, 0x0U, 2);
+	new (toFill++) EmojiData(630, 54, 0, 0xD83DDC57U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 54, 0, 0xD83DDC58U, 0x0U, 2);
+	new (toFill++) EmojiData(702, 54, 0, 0xD83DDC59U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 54, 0, 0xD83DDC5AU, 0x0U, 2);
+	new (toFill++) EmojiData(54, 72, 0, 0xD83DDC5BU, 0x0U, 2);
+	new (toFill++) EmojiData(18, 72, 0, 0xD83DDC5CU, 0x0U, 2);
+	new (toFill++) EmojiData(36, 72, 0, 0xD83DDC5DU, 0x0U, 2);
+	new (toFill++) EmojiData(504, 54, 0, 0xD83DDC5EU, 0x0U, 2);
+	new (toFill++) EmojiData(486, 54, 0, 0xD83DDC5FU, 0x0U, 2);
+	new (toFill++) EmojiData(540, 54, 0, 0xD83DDC60U, 0x0U, 2);
+	new (toFill++) EmojiData(522, 54, 0, 0xD83DDC61U, 0x0U, 2);
+	new (toFill++) EmojiData(558, 54, 0, 0xD83DDC62U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 72, 0, 0xD83DDC63U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 72, 0, 0xD83DDC64U, 0x0U, 2);
+	new (toFill++) EmojiData(450, 72, 0, 0xD83DDC65U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 18, 0, 0xD83DDC66U, 0x0U, 2);
+	new (toFill++) EmojiData(450, 18, 0, 0xD83DDC67U, 0x0U, 2);
+	new (toFill++) EmojiData(468, 18, 0, 0xD83DDC68U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 18, 0, 0xD83DDC69U, 0x0U, 2);
+	new (toFill++) EmojiData(126, 54, 0, 0xD83DDC6AU, 0x0U, 2);
+	new (toFill++) EmojiData(108, 54, 0, 0xD83DDC6BU, 0x0U, 2);
+	new (toFill++) EmojiData(144, 54, 0, 0xD83DDC6CU, 0x0U, 2);
+	new (toFill++) EmojiData(162, 54, 0, 0xD83DDC6DU, 0x0U, 2);
+	new (toFill++) EmojiData(360, 18, 0, 0xD83DDC6EU, 0x0U, 2);
+	new (toFill++) EmojiData(216, 54, 0, 0xD83DDC6FU, 0x0U, 2);
+	new (toFill++) EmojiData(360, 54, 0, 0xD83DDC70U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 18, 0, 0xD83DDC71U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 18, 0, 0xD83DDC72U, 0x0U, 2);
+	new (toFill++) EmojiData(342, 18, 0, 0xD83DDC73U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 18, 0, 0xD83DDC74U, 0x0U, 2);
+	new (toFill++) EmojiData(522, 18, 0, 0xD83DDC75U, 0x0U, 2);
+	new (toFill++) EmojiData(414, 18, 0, 0xD83DDC76U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 18, 0, 0xD83DDC77U, 0x0U, 2);
+	new (toFill++) EmojiData(576, 18, 0, 0xD83DDC78U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 36, 0, 0xD83DDC79U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 36, 0, 0xD83DDC7AU, 0x0U, 2);
+	new (toFill++) EmojiData(198, 0, 2, 0xD83DDC7BU, 0x0U, 2);
+	new (toFill++) EmojiData(558, 18, 0, 0xD83DDC7CU, 0x0U, 2);
+	new (toFill++) EmojiData(144, 36, 0, 0xD83DDC7DU, 0x0U, 2);
+	new (toFill++) EmojiData(450, 54, 2, 0xD83DDC7EU, 0x0U, 2);
+	new (toFill++) EmojiData(144, 18, 0, 0xD83DDC7FU, 0x0U, 2);
+	new (toFill++) EmojiData(126, 36, 0, 0xD83DDC80U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 54, 0, 0xD83DDC81U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 18, 0, 0xD83DDC82U, 0x0U, 2);
+	new (toFill++) EmojiData(90, 54, 0, 0xD83DDC83U, 0x0U, 2);
+	new (toFill++) EmojiData(126, 72, 0, 0xD83DDC84U, 0x0U, 2);
+	new (toFill++) EmojiData(342, 54, 0, 0xD83DDC85U, 0x0U, 2);
+	new (toFill++) EmojiData(306, 54, 0, 0xD83DDC86U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 54, 0, 0xD83DDC87U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 18, 3, 0xD83DDC88U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 18, 2, 0xD83DDC89U, 0x0U, 2);
+	new (toFill++) EmojiData(630, 18, 2, 0xD83DDC8AU, 0x0U, 2);
+	new (toFill++) EmojiData(378, 72, 0, 0xD83DDC8BU, 0x0U, 2);
+	new (toFill++) EmojiData(360, 72, 0, 0xD83DDC8CU, 0x0U, 2);
+	new (toFill++) EmojiData(396, 72, 0, 0xD83DDC8DU, 0x0U, 2);
+	new (toFill++) EmojiData(414, 72, 0, 0xD83DDC8EU, 0x0U, 2);
+	new (toFill++) EmojiData(180, 54, 0, 0xD83DDC8FU, 0x0U, 2);
+	new (toFill++) EmojiData(414, 18, 1, 0xD83DDC90U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 54, 0, 0xD83DDC91U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 0, 3, 0xD83DDC92U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 72, 0, 0xD83DDC93U, 0x0U, 2);
+	new (toFill++) EmojiData(234, 72, 0, 0xD83DDC94U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 72, 0, 0xD83DDC95U, 0x0U, 2);
+	new (toFill++) EmojiData(306, 72, 0, 0xD83DDC96U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 72, 0, 0xD83DDC97U, 0x0U, 2);
+	new (toFill++) EmojiData(342, 72, 0, 0xD83DDC98U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 72, 0, 0xD83DDC99U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 72, 0, 0xD83DDC9AU, 0x0U, 2);
+	new (toFill++) EmojiData(144, 72, 0, 0xD83DDC9BU, 0x0U, 2);
+	new (toFill++) EmojiData(180, 72, 0, 0xD83DDC9CU, 0x0U, 2);
+	new (toFill++) EmojiData(18, 0, 2, 0xD83DDC9DU, 0x0U, 2);
+	new (toFill++) EmojiData(324, 72, 0, 0xD83DDC9EU, 0x0U, 2);
+	new (toFill++) EmojiData(378, 36, 4, 0xD83DDC9FU, 0x0U, 2);
+	new (toFill++) EmojiData(522, 36, 4, 0xD83DDCA0U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 18, 2, 0xD83DDCA1U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 36, 0, 0xD83DDCA2U, 0x0U, 2);
+	new (toFill++) EmojiData(576, 18, 2, 0xD83DDCA3U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 36, 0, 0xD83DDCA4U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 36, 0, 0xD83DDCA5U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 36, 0, 0xD83DDCA6U, 0x0U, 2);
+	new (toFill++) EmojiData(306, 36, 0, 0xD83DDCA7U, 0x0U, 2);
+	new (toFill++) EmojiData(342, 36, 0, 0xD83DDCA8U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 36, 0, 0xD83DDCA9U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 54, 0, 0xD83DDCAAU, 0x0U, 2);
+	new (toFill++) EmojiData(234, 36, 0, 0xD83DDCABU, 0x0U, 2);
+	new (toFill++) EmojiData(468, 72, 0, 0xD83DDCACU, 0x0U, 2);
+	new (toFill++) EmojiData(504, 72, 0, 0xD83DDCADU, 0x0U, 2);
+	new (toFill++) EmojiData(342, 72, 4, 0xD83DDCAEU, 0x0U, 2);
+	new (toFill++) EmojiData(360, 72, 4, 0xD83DDCAFU, 0x0U, 2);
+	new (toFill++) EmojiData(666, 18, 2, 0xD83DDCB0U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 54, 4, 0xD83DDCB1U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 54, 4, 0xD83DDCB2U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 36, 2, 0xD83DDCB3U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 18, 2, 0xD83DDCB4U, 0x0U, 2);
+	new (toFill++) EmojiData(702, 18, 2, 0xD83DDCB5U, 0x0U, 2);
+	new (toFill++) EmojiData(18, 36, 2, 0xD83DDCB6U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 36, 2, 0xD83DDCB7U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 36, 2, 0xD83DDCB8U, 0x0U, 2);
+	new (toFill++) EmojiData(126, 54, 4, 0xD83DDCB9U, 0x0U, 2);
+	new (toFill++) EmojiData(702, 0, 3, 0xD83DDCBAU, 0x0U, 2);
+	new (toFill++) EmojiData(522, 0, 2, 0xD83DDCBBU, 0x0U, 2);
+	new (toFill++) EmojiData(0, 72, 0, 0xD83DDCBCU, 0x0U, 2);
+	new (toFill++) EmojiData(486, 0, 2, 0xD83DDCBDU, 0x0U, 2);
+	new (toFill++) EmojiData(504, 0, 2, 0xD83DDCBEU, 0x0U, 2);
+	new (toFill++) EmojiData(450, 0, 2, 0xD83DDCBFU, 0x0U, 2);
+	new (toFill++) EmojiData(468, 0, 2, 0xD83DDCC0U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 36, 2, 0xD83DDCC1U, 0x0U, 2);
+	new (toFill++) EmojiData(558, 36, 2, 0xD83DDCC2U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 36, 2, 0xD83DDCC3U, 0x0U, 2);
+	new (toFill++) EmojiData(342, 36, 2, 0xD83DDCC4U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 36, 2, 0xD83DDCC5U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 36, 2, 0xD83DDCC6U, 0x0U, 2);
+	new (toFill++) EmojiData(522, 36, 2, 0xD83DDCC7U, 0x0U, 2);
+	new (toFill++) EmojiData(414, 36, 2, 0xD83DDCC8U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 36, 2, 0xD83DDCC9U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 36, 2, 0xD83DDCCAU, 0x0U, 2);
+	new (toFill++) EmojiData(468, 36, 2, 0xD83DDCCBU, 0x0U, 2);
+	new (toFill++) EmojiData(594, 36, 2, 0xD83DDCCCU, 0x0U, 2);
+	new (toFill++) EmojiData(162, 36, 3, 0xD83DDCCDU, 0x0U, 2);
+	new (toFill++) EmojiData(612, 36, 2, 0xD83DDCCEU, 0x0U, 2);
+	new (toFill++) EmojiData(666, 36, 2, 0xD83DDCCFU, 0x0U, 2);
+	new (toFill++) EmojiData(684, 36, 2, 0xD83DDCD0U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 36, 2, 0xD83DDCD1U, 0x0U, 2);
+	new (toFill++) EmojiData(90, 54, 2, 0xD83DDCD2U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 54, 2, 0xD83DDCD3U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 54, 2, 0xD83DDCD4U, 0x0U, 2);
+	new (toFill++) EmojiData(702, 36, 2, 0xD83DDCD5U, 0x0U, 2);
+	new (toFill++) EmojiData(126, 54, 2, 0xD83DDCD6U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 54, 2, 0xD83DDCD7U, 0x0U, 2);
+	new (toFill++) EmojiData(18, 54, 2, 0xD83DDCD8U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 54, 2, 0xD83DDCD9U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 54, 2, 0xD83DDCDAU, 0x0U, 2);
+	new (toFill++) EmojiData(162, 54, 2, 0xD83DDCDBU, 0x0U, 2);
+	new (toFill++) EmojiData(450, 36, 2, 0xD83DDCDCU, 0x0U, 2);
+	new (toFill++) EmojiData(324, 36, 2, 0xD83DDCDDU, 0x0U, 2);
+	new (toFill++) EmojiData(576, 0, 2, 0xD83DDCDEU, 0x0U, 2);
+	new (toFill++) EmojiData(594, 0, 2, 0xD83DDCDFU, 0x0U, 2);
+	new (toFill++) EmojiData(612, 0, 2, 0xD83DDCE0U, 0x0U, 2);
+	new (toFill++) EmojiData(630, 0, 2, 0xD83DDCE1U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 18, 2, 0xD83DDCE2U, 0x0U, 2);
+	new (toFill++) EmojiData(90, 18, 2, 0xD83DDCE3U, 0x0U, 2);
+	new (toFill++) EmojiData(126, 36, 2, 0xD83DDCE4U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 36, 2, 0xD83DDCE5U, 0x0U, 2);
+	new (toFill++) EmojiData(306, 36, 2, 0xD83DDCE6U, 0x0U, 2);
+	new (toFill++) EmojiData(90, 36, 2, 0xD83DDCE7U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 36, 2, 0xD83DDCE8U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 36, 2, 0xD83DDCE9U, 0x0U, 2);
+	new (toFill++) EmojiData(234, 36, 2, 0xD83DDCEAU, 0x0U, 2);
+	new (toFill++) EmojiData(216, 36, 2, 0xD83DDCEBU, 0x0U, 2);
+	new (toFill++) EmojiData(252, 36, 2, 0xD83DDCECU, 0x0U, 2);
+	new (toFill++) EmojiData(270, 36, 2, 0xD83DDCEDU, 0x0U, 2);
+	new (toFill++) EmojiData(288, 36, 2, 0xD83DDCEEU, 0x0U, 2);
+	new (toFill++) EmojiData(198, 36, 2, 0xD83DDCEFU, 0x0U, 2);
+	new (toFill++) EmojiData(216, 54, 2, 0xD83DDCF0U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 0, 2, 0xD83DDCF1U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 36, 2, 0xD83DDCF2U, 0x0U, 2);
+	new (toFill++) EmojiData(414, 36, 4, 0xD83DDCF3U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 36, 4, 0xD83DDCF4U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 36, 4, 0xD83DDCF5U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 18, 4, 0xD83DDCF6U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 0, 2, 0xD83DDCF7U, 0x0U, 2);
+	new (toFill++) EmojiData(414, 0, 2, 0xD83DDCF9U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 0, 2, 0xD83DDCFAU, 0x0U, 2);
+	new (toFill++) EmojiData(666, 0, 2, 0xD83DDCFBU, 0x0U, 2);
+	new (toFill++) EmojiData(432, 0, 2, 0xD83DDCFCU, 0x0U, 2);
+	new (toFill++) EmojiData(36, 18, 4, 0xD83DDD00U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 18, 4, 0xD83DDD01U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 18, 4, 0xD83DDD02U, 0x0U, 2);
+	new (toFill++) EmojiData(468, 54, 4, 0xD83DDD03U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 0, 4, 0xD83DDD04U, 0x0U, 2);
+	new (toFill++) EmojiData(342, 18, 2, 0xD83DDD05U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 18, 2, 0xD83DDD06U, 0x0U, 2);
+	new (toFill++) EmojiData(18, 18, 2, 0xD83DDD07U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 18, 2, 0xD83DDD08U, 0x0U, 2);
+	new (toFill++) EmojiData(702, 0, 2, 0xD83DDD09U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 0, 2, 0xD83DDD0AU, 0x0U, 2);
+	new (toFill++) EmojiData(378, 18, 2, 0xD83DDD0BU, 0x0U, 2);
+	new (toFill++) EmojiData(360, 18, 2, 0xD83DDD0CU, 0x0U, 2);
+	new (toFill++) EmojiData(396, 18, 2, 0xD83DDD0DU, 0x0U, 2);
+	new (toFill++) EmojiData(270, 18, 2, 0xD83DDD0EU, 0x0U, 2);
+	new (toFill++) EmojiData(216, 18, 2, 0xD83DDD0FU, 0x0U, 2);
+	new (toFill++) EmojiData(234, 18, 2, 0xD83DDD10U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 18, 2, 0xD83DDD11U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 18, 2, 0xD83DDD12U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 18, 2, 0xD83DDD13U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 18, 2, 0xD83DDD14U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 18, 2, 0xD83DDD15U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 54, 2, 0xD83DDD16U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 72, 4, 0xD83DDD17U, 0x0U, 2);
+	new (toFill++) EmojiData(414, 72, 4, 0xD83DDD18U, 0x0U, 2);
+	new (toFill++) EmojiData(414, 54, 4, 0xD83DDD19U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 54, 4, 0xD83DDD1AU, 0x0U, 2);
+	new (toFill++) EmojiData(432, 54, 4, 0xD83DDD1BU, 0x0U, 2);
+	new (toFill++) EmojiData(450, 54, 4, 0xD83DDD1CU, 0x0U, 2);
+	new (toFill++) EmojiData(378, 54, 4, 0xD83DDD1DU, 0x0U, 2);
+	new (toFill++) EmojiData(144, 36, 4, 0xD83DDD1EU, 0x0U, 2);
+	new (toFill++) EmojiData(180, 0, 4, 0xD83DDD1FU, 0x0U, 2);
+	new (toFill++) EmojiData(324, 0, 4, 0xD83DDD20U, 0x0U, 2);
+	new (toFill++) EmojiData(342, 0, 4, 0xD83DDD21U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 0, 4, 0xD83DDD22U, 0x0U, 2);
+	new (toFill++) EmojiData(234, 0, 4, 0xD83DDD23U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 0, 4, 0xD83DDD24U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 36, 0, 0xD83DDD25U, 0x0U, 2);
+	new (toFill++) EmojiData(306, 18, 2, 0xD83DDD26U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 18, 2, 0xD83DDD27U, 0x0U, 2);
+	new (toFill++) EmojiData(522, 18, 2, 0xD83DDD28U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 18, 2, 0xD83DDD29U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 18, 2, 0xD83DDD2AU, 0x0U, 2);
+	new (toFill++) EmojiData(594, 18, 2, 0xD83DDD2BU, 0x0U, 2);
+	new (toFill++) EmojiData(180, 54, 2, 0xD83DDD2CU, 0x0U, 2);
+	new (toFill++) EmojiData(198, 54, 2, 0xD83DDD2DU, 0x0U, 2);
+	new (toFill++) EmojiData(360, 0, 2, 0xD83DDD2EU, 0x0U, 2);
+	new (toFill++) EmojiData(90, 54, 4, 0xD83DDD2FU, 0x0U, 2);
+	new (toFill++) EmojiData(18, 36, 3, 0xD83DDD30U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 72, 4, 0xD83DDD31U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 72, 4, 0xD83DDD32U, 0x0U, 2);
+	new (toFill++) EmojiData(666, 72, 4, 0xD83DDD33U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 90, 4, 0xD83DDD34U, 0x0U, 2);
+	new (toFill++) EmojiData(18, 90, 4, 0xD83DDD35U, 0x0U, 2);
+	new (toFill++) EmojiData(90, 90, 4, 0xD83DDD36U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 90, 4, 0xD83DDD37U, 0x0U, 2);
+	new (toFill++) EmojiData(126, 90, 4, 0xD83DDD38U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 90, 4, 0xD83DDD39U, 0x0U, 2);
+	new (toFill++) EmojiData(630, 72, 4, 0xD83DDD3AU, 0x0U, 2);
+	new (toFill++) EmojiData(36, 90, 4, 0xD83DDD3BU, 0x0U, 2);
+	new (toFill++) EmojiData(540, 0, 4, 0xD83DDD3CU, 0x0U, 2);
+	new (toFill++) EmojiData(558, 0, 4, 0xD83DDD3DU, 0x0U, 2);
+	new (toFill++) EmojiData(522, 54, 4, 0xD83DDD50U, 0x0U, 2);
+	new (toFill++) EmojiData(558, 54, 4, 0xD83DDD51U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 54, 4, 0xD83DDD52U, 0x0U, 2);
+	new (toFill++) EmojiData(630, 54, 4, 0xD83DDD53U, 0x0U, 2);
+	new (toFill++) EmojiData(666, 54, 4, 0xD83DDD54U, 0x0U, 2);
+	new (toFill++) EmojiData(702, 54, 4, 0xD83DDD55U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 72, 4, 0xD83DDD56U, 0x0U, 2);
+	new (toFill++) EmojiData(18, 72, 4, 0xD83DDD57U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 72, 4, 0xD83DDD58U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 72, 4, 0xD83DDD59U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 72, 4, 0xD83DDD5AU, 0x0U, 2);
+	new (toFill++) EmojiData(486, 54, 4, 0xD83DDD5BU, 0x0U, 2);
+	new (toFill++) EmojiData(540, 54, 4, 0xD83DDD5CU, 0x0U, 2);
+	new (toFill++) EmojiData(576, 54, 4, 0xD83DDD5DU, 0x0U, 2);
+	new (toFill++) EmojiData(612, 54, 4, 0xD83DDD5EU, 0x0U, 2);
+	new (toFill++) EmojiData(648, 54, 4, 0xD83DDD5FU, 0x0U, 2);
+	new (toFill++) EmojiData(684, 54, 4, 0xD83DDD60U, 0x0U, 2);
+	new (toFill++) EmojiData(90, 72, 4, 0xD83DDD61U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 72, 4, 0xD83DDD62U, 0x0U, 2);
+	new (toFill++) EmojiData(126, 72, 4, 0xD83DDD63U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 72, 4, 0xD83DDD64U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 72, 4, 0xD83DDD65U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 72, 4, 0xD83DDD66U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 54, 4, 0xD83DDD67U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 0, 3, 0xD83DDDFBU, 0x0U, 2);
+	new (toFill++) EmojiData(360, 0, 3, 0xD83DDDFCU, 0x0U, 2);
+	new (toFill++) EmojiData(468, 0, 3, 0xD83DDDFDU, 0x0U, 2);
+	new (toFill++) EmojiData(378, 0, 3, 0xD83DDDFEU, 0x0U, 2);
+	new (toFill++) EmojiData(108, 36, 3, 0xD83DDDFFU, 0x0U, 2);
+	new (toFill++) EmojiData(36, 0, 0, 0xD83DDE00U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 0, 0, 0xD83DDE01U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 0, 0, 0xD83DDE02U, 0x0U, 2);
+	new (toFill++) EmojiData(18, 0, 0, 0xD83DDE03U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 0, 0, 0xD83DDE04U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 0, 0, 0xD83DDE05U, 0x0U, 2);
+	new (toFill++) EmojiData(666, 0, 0, 0xD83DDE06U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 18, 0, 0xD83DDE07U, 0x0U, 2);
+	new (toFill++) EmojiData(126, 18, 0, 0xD83DDE08U, 0x0U, 2);
+	new (toFill++) EmojiData(90, 0, 0, 0xD83DDE09U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 0, 0, 0xD83DDE0AU, 0x0U, 2);
+	new (toFill++) EmojiData(684, 0, 0, 0xD83DDE0BU, 0x0U, 2);
+	new (toFill++) EmojiData(306, 0, 0, 0xD83DDE0CU, 0x0U, 2);
+	new (toFill++) EmojiData(108, 0, 0, 0xD83DDE0DU, 0x0U, 2);
+	new (toFill++) EmojiData(0, 18, 0, 0xD83DDE0EU, 0x0U, 2);
+	new (toFill++) EmojiData(288, 18, 0, 0xD83DDE0FU, 0x0U, 2);
+	new (toFill++) EmojiData(198, 18, 0, 0xD83DDE10U, 0x0U, 2);
+	new (toFill++) EmojiData(306, 18, 0, 0xD83DDE11U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 0, 0, 0xD83DDE12U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 0, 0, 0xD83DDE13U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 0, 0, 0xD83DDE14U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 18, 0, 0xD83DDE15U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 0, 0, 0xD83DDE16U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 0, 0, 0xD83DDE17U, 0x0U, 2);
+	new (toFill++) EmojiData(126, 0, 0, 0xD83DDE18U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 0, 0, 0xD83DDE19U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 0, 0, 0xD83DDE1AU, 0x0U, 2);
+	new (toFill++) EmojiData(234, 0, 0, 0xD83DDE1BU, 0x0U, 2);
+	new (toFill++) EmojiData(198, 0, 0, 0xD83DDE1CU, 0x0U, 2);
+	new (toFill++) EmojiData(216, 0, 0, 0xD83DDE1DU, 0x0U, 2);
+	new (toFill++) EmojiData(342, 0, 0, 0xD83DDE1EU, 0x0U, 2);
+	new (toFill++) EmojiData(72, 18, 0, 0xD83DDE1FU, 0x0U, 2);
+	new (toFill++) EmojiData(594, 0, 0, 0xD83DDE20U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 0, 0, 0xD83DDE21U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 0, 0, 0xD83DDE22U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 0, 0, 0xD83DDE23U, 0x0U, 2);
+	new (toFill++) EmojiData(630, 0, 0, 0xD83DDE24U, 0x0U, 2);
+	new (toFill++) EmojiData(450, 0, 0, 0xD83DDE25U, 0x0U, 2);
+	new (toFill++) EmojiData(90, 18, 0, 0xD83DDE26U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 18, 0, 0xD83DDE27U, 0x0U, 2);
+	new (toFill++) EmojiData(558, 0, 0, 0xD83DDE28U, 0x0U, 2);
+	new (toFill++) EmojiData(522, 0, 0, 0xD83DDE29U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 0, 0, 0xD83DDE2AU, 0x0U, 2);
+	new (toFill++) EmojiData(540, 0, 0, 0xD83DDE2BU, 0x0U, 2);
+	new (toFill++) EmojiData(180, 18, 0, 0xD83DDE2CU, 0x0U, 2);
+	new (toFill++) EmojiData(414, 0, 0, 0xD83DDE2DU, 0x0U, 2);
+	new (toFill++) EmojiData(162, 18, 0, 0xD83DDE2EU, 0x0U, 2);
+	new (toFill++) EmojiData(234, 18, 0, 0xD83DDE2FU, 0x0U, 2);
+	new (toFill++) EmojiData(468, 0, 0, 0xD83DDE30U, 0x0U, 2);
+	new (toFill++) EmojiData(576, 0, 0, 0xD83DDE31U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 18, 0, 0xD83DDE32U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 0, 0, 0xD83DDE33U, 0x0U, 2);
+	new (toFill++) EmojiData(18, 18, 0, 0xD83DDE34U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 18, 0, 0xD83DDE35U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 18, 0, 0xD83DDE36U, 0x0U, 2);
+	new (toFill++) EmojiData(702, 0, 0, 0xD83DDE37U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 18, 0, 0xD83DDE38U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 36, 0, 0xD83DDE39U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 18, 0, 0xD83DDE3AU, 0x0U, 2);
+	new (toFill++) EmojiData(630, 18, 0, 0xD83DDE3BU, 0x0U, 2);
+	new (toFill++) EmojiData(666, 18, 0, 0xD83DDE3CU, 0x0U, 2);
+	new (toFill++) EmojiData(648, 18, 0, 0xD83DDE3DU, 0x0U, 2);
+	new (toFill++) EmojiData(18, 36, 0, 0xD83DDE3EU, 0x0U, 2);
+	new (toFill++) EmojiData(702, 18, 0, 0xD83DDE3FU, 0x0U, 2);
+	new (toFill++) EmojiData(684, 18, 0, 0xD83DDE40U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 54, 0, 0xD83DDE45U, 0x0U, 2);
+	new (toFill++) EmojiData(234, 54, 0, 0xD83DDE46U, 0x0U, 2);
+	new (toFill++) EmojiData(414, 54, 0, 0xD83DDE47U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 36, 0, 0xD83DDE48U, 0x0U, 2);
+	new (toFill++) EmojiData(90, 36, 0, 0xD83DDE49U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 36, 0, 0xD83DDE4AU, 0x0U, 2);
+	new (toFill++) EmojiData(288, 54, 0, 0xD83DDE4BU, 0x0U, 2);
+	new (toFill++) EmojiData(684, 36, 0, 0xD83DDE4CU, 0x0U, 2);
+	new (toFill++) EmojiData(396, 54, 0, 0xD83DDE4DU, 0x0U, 2);
+	new (toFill++) EmojiData(378, 54, 0, 0xD83DDE4EU, 0x0U, 2);
+	new (toFill++) EmojiData(702, 36, 0, 0xD83DDE4FU, 0x0U, 2);
+	new (toFill++) EmojiData(666, 0, 3, 0xD83DDE80U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 18, 3, 0xD83DDE81U, 0x0U, 2);
+	new (toFill++) EmojiData(18, 18, 3, 0xD83DDE82U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 18, 3, 0xD83DDE83U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 18, 3, 0xD83DDE84U, 0x0U, 2);
+	new (toFill++) EmojiData(126, 18, 3, 0xD83DDE85U, 0x0U, 2);
+	new (toFill++) EmojiData(90, 18, 3, 0xD83DDE86U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 18, 3, 0xD83DDE87U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 18, 3, 0xD83DDE88U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 18, 3, 0xD83DDE89U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 18, 3, 0xD83DDE8AU, 0x0U, 2);
+	new (toFill++) EmojiData(198, 18, 3, 0xD83DDE8BU, 0x0U, 2);
+	new (toFill++) EmojiData(252, 18, 3, 0xD83DDE8CU, 0x0U, 2);
+	new (toFill++) EmojiData(270, 18, 3, 0xD83DDE8DU, 0x0U, 2);
+	new (toFill++) EmojiData(234, 18, 3, 0xD83DDE8EU, 0x0U, 2);
+	new (toFill++) EmojiData(630, 18, 3, 0xD83DDE8FU, 0x0U, 2);
+	new (toFill++) EmojiData(504, 18, 3, 0xD83DDE90U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 18, 3, 0xD83DDE91U, 0x0U, 2);
+	new (toFill++) EmojiData(468, 18, 3, 0xD83DDE92U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 18, 3, 0xD83DDE93U, 0x0U, 2);
+	new (toFill++) EmojiData(450, 18, 3, 0xD83DDE94U, 0x0U, 2);
+	new (toFill++) EmojiData(342, 18, 3, 0xD83DDE95U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 18, 3, 0xD83DDE96U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 18, 3, 0xD83DDE97U, 0x0U, 2);
+	new (toFill++) EmojiData(306, 18, 3, 0xD83DDE98U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 18, 3, 0xD83DDE99U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 18, 3, 0xD83DDE9AU, 0x0U, 2);
+	new (toFill++) EmojiData(378, 18, 3, 0xD83DDE9BU, 0x0U, 2);
+	new (toFill++) EmojiData(594, 18, 3, 0xD83DDE9CU, 0x0U, 2);
+	new (toFill++) EmojiData(180, 18, 3, 0xD83DDE9DU, 0x0U, 2);
+	new (toFill++) EmojiData(72, 18, 3, 0xD83DDE9EU, 0x0U, 2);
+	new (toFill++) EmojiData(558, 18, 3, 0xD83DDE9FU, 0x0U, 2);
+	new (toFill++) EmojiData(576, 18, 3, 0xD83DDEA0U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 18, 3, 0xD83DDEA1U, 0x0U, 2);
+	new (toFill++) EmojiData(576, 0, 3, 0xD83DDEA2U, 0x0U, 2);
+	new (toFill++) EmojiData(630, 0, 3, 0xD83DDEA3U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 0, 3, 0xD83DDEA4U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 18, 3, 0xD83DDEA5U, 0x0U, 2);
+	new (toFill++) EmojiData(666, 18, 3, 0xD83DDEA6U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 36, 3, 0xD83DDEA7U, 0x0U, 2);
+	new (toFill++) EmojiData(414, 18, 3, 0xD83DDEA8U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 36, 3, 0xD83DDEA9U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 18, 2, 0xD83DDEAAU, 0x0U, 2);
+	new (toFill++) EmojiData(126, 36, 4, 0xD83DDEABU, 0x0U, 2);
+	new (toFill++) EmojiData(558, 18, 2, 0xD83DDEACU, 0x0U, 2);
+	new (toFill++) EmojiData(576, 18, 4, 0xD83DDEADU, 0x0U, 2);
+	new (toFill++) EmojiData(522, 18, 4, 0xD83DDEAEU, 0x0U, 2);
+	new (toFill++) EmojiData(180, 36, 4, 0xD83DDEAFU, 0x0U, 2);
+	new (toFill++) EmojiData(504, 18, 4, 0xD83DDEB0U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 36, 4, 0xD83DDEB1U, 0x0U, 2);
+	new (toFill++) EmojiData(522, 18, 3, 0xD83DDEB2U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 36, 4, 0xD83DDEB3U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 72, 2, 0xD83DDEB4U, 0x0U, 2);
+	new (toFill++) EmojiData(18, 72, 2, 0xD83DDEB5U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 54, 0, 0xD83DDEB6U, 0x0U, 2);
+	new (toFill++) EmojiData(234, 36, 4, 0xD83DDEB7U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 36, 4, 0xD83DDEB8U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 18, 4, 0xD83DDEB9U, 0x0U, 2);
+	new (toFill++) EmojiData(450, 18, 4, 0xD83DDEBAU, 0x0U, 2);
+	new (toFill++) EmojiData(414, 18, 4, 0xD83DDEBBU, 0x0U, 2);
+	new (toFill++) EmojiData(468, 18, 4, 0xD83DDEBCU, 0x0U, 2);
+	new (toFill++) EmojiData(468, 18, 2, 0xD83DDEBDU, 0x0U, 2);
+	new (toFill++) EmojiData(486, 18, 4, 0xD83DDEBEU, 0x0U, 2);
+	new (toFill++) EmojiData(450, 18, 2, 0xD83DDEBFU, 0x0U, 2);
+	new (toFill++) EmojiData(432, 18, 2, 0xD83DDEC0U, 0x0U, 2);
+	new (toFill++) EmojiData(414, 18, 2, 0xD83DDEC1U, 0x0U, 2);
+	new (toFill++) EmojiData(666, 18, 4, 0xD83DDEC2U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 36, 4, 0xD83DDEC3U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 18, 4, 0xD83DDEC4U, 0x0U, 2);
+	new (toFill++) EmojiData(702, 18, 4, 0xD83DDEC5U, 0x0U, 2);
 }
 
 void initEmojiOneAndQuarter() {
 	EmojiData *toFill = emojis = (EmojiData*)emojisData;
 
-	new (toFill++) EmojiData(132, 418, 0xA9U, 0x0U, 1);
-	new (toFill++) EmojiData(154, 418, 0xAEU, 0x0U, 1);
-	new (toFill++) EmojiData(220, 418, 0x203CU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(242, 418, 0x2049U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(176, 418, 0x2122U, 0x0U, 1);
-	new (toFill++) EmojiData(660, 352, 0x2139U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(462, 352, 0x2194U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(484, 352, 0x2195U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(396, 352, 0x2196U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(374, 352, 0x2197U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(418, 352, 0x2198U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(440, 352, 0x2199U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(616, 352, 0x21A9U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(638, 352, 0x21AAU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(748, 176, 0x231AU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(704, 176, 0x231BU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(704, 352, 0x23E9U, 0x0U, 1);
-	new (toFill++) EmojiData(682, 352, 0x23EAU, 0x0U, 1);
-	new (toFill++) EmojiData(726, 352, 0x23EBU, 0x0U, 1);
-	new (toFill++) EmojiData(748, 352, 0x23ECU, 0x0U, 1);
-	new (toFill++) EmojiData(726, 176, 0x23F0U, 0x0U, 1);
-	new (toFill++) EmojiData(682, 176, 0x23F3U, 0x0U, 1);
-	new (toFill++) EmojiData(704, 374, 0x24C2U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(638, 440, 0x25AAU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(660, 440, 0x25ABU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(550, 352, 0x25B6U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(528, 352, 0x25C0U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(572, 440, 0x25FBU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(550, 440, 0x25FCU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(616, 440, 0x25FDU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(594, 440, 0x25FEU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(308, 154, 0x2600U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(352, 154, 0x2601U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(352, 176, 0x260EU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(396, 440, 0x2611U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(396, 154, 0x2614U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(792, 242, 0x2615U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(0, 66, 0x261DU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(88, 0, 0x263AU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(616, 396, 0x2648U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(638, 396, 0x2649U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(660, 396, 0x264AU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(682, 396, 0x264BU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(704, 396, 0x264CU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(726, 396, 0x264DU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(748, 396, 0x264EU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(770, 396, 0x264FU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(792, 396, 0x2650U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(814, 396, 0x2651U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(836, 396, 0x2652U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(858, 396, 0x2653U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(242, 440, 0x2660U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(286, 440, 0x2663U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(264, 440, 0x2665U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(308, 440, 0x2666U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(440, 330, 0x2668U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(594, 396, 0x267BU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(594, 374, 0x267FU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(242, 308, 0x2693U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(308, 330, 0x26A0U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(374, 154, 0x26A1U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(770, 440, 0x26AAU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(748, 440, 0x26ABU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(418, 242, 0x26BDU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(440, 242, 0x26BEU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(440, 154, 0x26C4U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(330, 154, 0x26C5U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(0, 418, 0x26CEU, 0x0U, 1);
-	new (toFill++) EmojiData(242, 396, 0x26D4U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(572, 286, 0x26EAU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(110, 308, 0x26F2U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(550, 242, 0x26F3U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(176, 308, 0x26F5U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(726, 286, 0x26FAU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(374, 330, 0x26FDU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(374, 220, 0x2702U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(330, 396, 0x2705U, 0x0U, 1);
-	new (toFill++) EmojiData(286, 308, 0x2708U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(726, 198, 0x2709U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(638, 44, 0x270AU, 0x0U, 1);
-	new (toFill++) EmojiData(704, 44, 0x270BU, 0x0U, 1);
-	new (toFill++) EmojiData(660, 44, 0x270CU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(462, 220, 0x270FU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(440, 220, 0x2712U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(374, 440, 0x2714U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(154, 440, 0x2716U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(242, 44, 0x2728U, 0x0U, 1);
-	new (toFill++) EmojiData(264, 396, 0x2733U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(352, 396, 0x2734U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(418, 154, 0x2744U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(286, 396, 0x2747U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(198, 418, 0x274CU, 0x0U, 1);
-	new (toFill++) EmojiData(308, 396, 0x274EU, 0x0U, 1);
-	new (toFill++) EmojiData(286, 418, 0x2753U, 0x0U, 1);
-	new (toFill++) EmojiData(330, 418, 0x2754U, 0x0U, 1);
-	new (toFill++) EmojiData(308, 418, 0x2755U, 0x0U, 1);
-	new (toFill++) EmojiData(264, 418, 0x2757U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(264, 88, 0x2764U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(176, 440, 0x2795U, 0x0U, 1);
-	new (toFill++) EmojiData(198, 440, 0x2796U, 0x0U, 1);
-	new (toFill++) EmojiData(220, 440, 0x2797U, 0x0U, 1);
-	new (toFill++) EmojiData(286, 352, 0x27A1U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(462, 440, 0x27B0U, 0x0U, 1);
-	new (toFill++) EmojiData(572, 396, 0x27BFU, 0x0U, 1);
-	new (toFill++) EmojiData(792, 352, 0x2934U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(770, 352, 0x2935U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(264, 352, 0x2B05U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(220, 352, 0x2B06U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(242, 352, 0x2B07U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(0, 462, 0x2B1BU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(858, 440, 0x2B1CU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(286, 154, 0x2B50U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(352, 418, 0x2B55U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(484, 440, 0x3030U, 0x0U, 1);
-	new (toFill++) EmojiData(506, 440, 0x303DU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(858, 374, 0x3297U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(836, 374, 0x3299U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(176, 352, 0x2320E3U, 0x0U, 2);
-	new (toFill++) EmojiData(110, 352, 0x3020E3U, 0x0U, 2);
-	new (toFill++) EmojiData(792, 330, 0x3120E3U, 0x0U, 2);
-	new (toFill++) EmojiData(814, 330, 0x3220E3U, 0x0U, 2);
-	new (toFill++) EmojiData(836, 330, 0x3320E3U, 0x0U, 2);
-	new (toFill++) EmojiData(858, 330, 0x3420E3U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 352, 0x3520E3U, 0x0U, 2);
-	new (toFill++) EmojiData(22, 352, 0x3620E3U, 0x0U, 2);
-	new (toFill++) EmojiData(44, 352, 0x3720E3U, 0x0U, 2);
-	new (toFill++) EmojiData(66, 352, 0x3820E3U, 0x0U, 2);
-	new (toFill++) EmojiData(88, 352, 0x3920E3U, 0x0U, 2);
-	new (toFill++) EmojiData(308, 242, 0xD83CDC04U, 0x0U, 2, 0xFE0F);
-	new (toFill++) EmojiData(264, 242, 0xD83CDCCFU, 0x0U, 2);
-	new (toFill++) EmojiData(462, 396, 0xD83CDD70U, 0x0U, 2);
-	new (toFill++) EmojiData(484, 396, 0xD83CDD71U, 0x0U, 2);
-	new (toFill++) EmojiData(528, 396, 0xD83CDD7EU, 0x0U, 2);
-	new (toFill++) EmojiData(572, 374, 0xD83CDD7FU, 0x0U, 2, 0xFE0F);
-	new (toFill++) EmojiData(506, 396, 0xD83CDD8EU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 396, 0xD83CDD91U, 0x0U, 2);
-	new (toFill++) EmojiData(66, 374, 0xD83CDD92U, 0x0U, 2);
-	new (toFill++) EmojiData(88, 374, 0xD83CDD93U, 0x0U, 2);
-	new (toFill++) EmojiData(44, 396, 0xD83CDD94U, 0x0U, 2);
-	new (toFill++) EmojiData(22, 374, 0xD83CDD95U, 0x0U, 2);
-	new (toFill++) EmojiData(110, 374, 0xD83CDD96U, 0x0U, 2);
-	new (toFill++) EmojiData(814, 352, 0xD83CDD97U, 0x0U, 2);
-	new (toFill++) EmojiData(22, 396, 0xD83CDD98U, 0x0U, 2);
-	new (toFill++) EmojiData(44, 374, 0xD83CDD99U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 396, 0xD83CDD9AU, 0x0U, 2);
-	new (toFill++) EmojiData(638, 330, 0xD83CDDE8U, 0xD83CDDF3U, 4);
-	new (toFill++) EmojiData(616, 330, 0xD83CDDE9U, 0xD83CDDEAU, 4);
-	new (toFill++) EmojiData(704, 330, 0xD83CDDEAU, 0xD83CDDF8U, 4);
-	new (toFill++) EmojiData(682, 330, 0xD83CDDEBU, 0xD83CDDF7U, 4);
-	new (toFill++) EmojiData(770, 330, 0xD83CDDECU, 0xD83CDDE7U, 4);
-	new (toFill++) EmojiData(726, 330, 0xD83CDDEEU, 0xD83CDDF9U, 4);
-	new (toFill++) EmojiData(572, 330, 0xD83CDDEFU, 0xD83CDDF5U, 4);
-	new (toFill++) EmojiData(594, 330, 0xD83CDDF0U, 0xD83CDDF7U, 4);
-	new (toFill++) EmojiData(748, 330, 0xD83CDDF7U, 0xD83CDDFAU, 4);
-	new (toFill++) EmojiData(660, 330, 0xD83CDDFAU, 0xD83CDDF8U, 4);
-	new (toFill++) EmojiData(176, 374, 0xD83CDE01U, 0x0U, 2);
-	new (toFill++) EmojiData(682, 374, 0xD83CDE02U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 374, 0xD83CDE1AU, 0x0U, 2, 0xFE0F);
-	new (toFill++) EmojiData(198, 374, 0xD83CDE2FU, 0x0U, 2, 0xFE0F);
-	new (toFill++) EmojiData(286, 374, 0xD83CDE32U, 0x0U, 2);
-	new (toFill++) EmojiData(220, 374, 0xD83CDE33U, 0x0U, 2);
-	new (toFill++) EmojiData(264, 374, 0xD83CDE34U, 0x0U, 2);
-	new (toFill++) EmojiData(242, 374, 0xD83CDE35U, 0x0U, 2);
-	new (toFill++) EmojiData(374, 374, 0xD83CDE36U, 0x0U, 2);
-	new (toFill++) EmojiData(638, 374, 0xD83CDE37U, 0x0U, 2);
-	new (toFill++) EmojiData(660, 374, 0xD83CDE38U, 0x0U, 2);
-	new (toFill++) EmojiData(330, 374, 0xD83CDE39U, 0x0U, 2);
-	new (toFill++) EmojiData(352, 374, 0xD83CDE3AU, 0x0U, 2);
-	new (toFill++) EmojiData(308, 374, 0xD83CDE50U, 0x0U, 2);
-	new (toFill++) EmojiData(814, 374, 0xD83CDE51U, 0x0U, 2);
-	new (toFill++) EmojiData(462, 154, 0xD83CDF00U, 0x0U, 2);
-	new (toFill++) EmojiData(484, 154, 0xD83CDF01U, 0x0U, 2);
-	new (toFill++) EmojiData(132, 88, 0xD83CDF02U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 308, 0xD83CDF03U, 0x0U, 2);
-	new (toFill++) EmojiData(836, 286, 0xD83CDF04U, 0x0U, 2);
-	new (toFill++) EmojiData(858, 286, 0xD83CDF05U, 0x0U, 2);
-	new (toFill++) EmojiData(660, 286, 0xD83CDF06U, 0x0U, 2);
-	new (toFill++) EmojiData(638, 286, 0xD83CDF07U, 0x0U, 2);
-	new (toFill++) EmojiData(506, 154, 0xD83CDF08U, 0x0U, 2);
-	new (toFill++) EmojiData(44, 308, 0xD83CDF09U, 0x0U, 2);
-	new (toFill++) EmojiData(528, 154, 0xD83CDF0AU, 0x0U, 2);
-	new (toFill++) EmojiData(220, 154, 0xD83CDF0BU, 0x0U, 2);
-	new (toFill++) EmojiData(242, 154, 0xD83CDF0CU, 0x0U, 2);
-	new (toFill++) EmojiData(154, 154, 0xD83CDF0DU, 0x0U, 2);
-	new (toFill++) EmojiData(176, 154, 0xD83CDF0EU, 0x0U, 2);
-	new (toFill++) EmojiData(198, 154, 0xD83CDF0FU, 0x0U, 2);
-	new (toFill++) EmojiData(704, 132, 0xD83CDF10U, 0x0U, 2);
-	new (toFill++) EmojiData(792, 132, 0xD83CDF11U, 0x0U, 2);
-	new (toFill++) EmojiData(814, 132, 0xD83CDF12U, 0x0U, 2);
-	new (toFill++) EmojiData(836, 132, 0xD83CDF13U, 0x0U, 2);
-	new (toFill++) EmojiData(858, 132, 0xD83CDF14U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 154, 0xD83CDF15U, 0x0U, 2);
-	new (toFill++) EmojiData(22, 154, 0xD83CDF16U, 0x0U, 2);
-	new (toFill++) EmojiData(44, 154, 0xD83CDF17U, 0x0U, 2);
-	new (toFill++) EmojiData(66, 154, 0xD83CDF18U, 0x0U, 2);
-	new (toFill++) EmojiData(132, 154, 0xD83CDF19U, 0x0U, 2);
-	new (toFill++) EmojiData(770, 132, 0xD83CDF1AU, 0x0U, 2);
-	new (toFill++) EmojiData(110, 154, 0xD83CDF1BU, 0x0U, 2);
-	new (toFill++) EmojiData(88, 154, 0xD83CDF1CU, 0x0U, 2);
-	new (toFill++) EmojiData(748, 132, 0xD83CDF1DU, 0x0U, 2);
-	new (toFill++) EmojiData(726, 132, 0xD83CDF1EU, 0x0U, 2);
-	new (toFill++) EmojiData(264, 44, 0xD83CDF1FU, 0x0U, 2);
-	new (toFill++) EmojiData(264, 154, 0xD83CDF20U, 0x0U, 2);
-	new (toFill++) EmojiData(638, 132, 0xD83CDF30U, 0x0U, 2);
-	new (toFill++) EmojiData(660, 132, 0xD83CDF31U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 132, 0xD83CDF32U, 0x0U, 2);
-	new (toFill++) EmojiData(616, 132, 0xD83CDF33U, 0x0U, 2);
-	new (toFill++) EmojiData(572, 132, 0xD83CDF34U, 0x0U, 2);
-	new (toFill++) EmojiData(550, 132, 0xD83CDF35U, 0x0U, 2);
-	new (toFill++) EmojiData(308, 132, 0xD83CDF37U, 0x0U, 2);
-	new (toFill++) EmojiData(286, 132, 0xD83CDF38U, 0x0U, 2);
-	new (toFill++) EmojiData(352, 132, 0xD83CDF39U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 132, 0xD83CDF3AU, 0x0U, 2);
-	new (toFill++) EmojiData(374, 132, 0xD83CDF3BU, 0x0U, 2);
-	new (toFill++) EmojiData(682, 132, 0xD83CDF3CU, 0x0U, 2);
-	new (toFill++) EmojiData(308, 286, 0xD83CDF3DU, 0x0U, 2);
-	new (toFill++) EmojiData(506, 132, 0xD83CDF3EU, 0x0U, 2);
-	new (toFill++) EmojiData(484, 132, 0xD83CDF3FU, 0x0U, 2);
-	new (toFill++) EmojiData(330, 132, 0xD83CDF40U, 0x0U, 2);
-	new (toFill++) EmojiData(418, 132, 0xD83CDF41U, 0x0U, 2);
-	new (toFill++) EmojiData(462, 132, 0xD83CDF42U, 0x0U, 2);
-	new (toFill++) EmojiData(440, 132, 0xD83CDF43U, 0x0U, 2);
-	new (toFill++) EmojiData(528, 132, 0xD83CDF44U, 0x0U, 2);
-	new (toFill++) EmojiData(286, 286, 0xD83CDF45U, 0x0U, 2);
-	new (toFill++) EmojiData(264, 286, 0xD83CDF46U, 0x0U, 2);
-	new (toFill++) EmojiData(66, 286, 0xD83CDF47U, 0x0U, 2);
-	new (toFill++) EmojiData(154, 286, 0xD83CDF48U, 0x0U, 2);
-	new (toFill++) EmojiData(88, 286, 0xD83CDF49U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 286, 0xD83CDF4AU, 0x0U, 2);
-	new (toFill++) EmojiData(22, 286, 0xD83CDF4BU, 0x0U, 2);
-	new (toFill++) EmojiData(176, 286, 0xD83CDF4CU, 0x0U, 2);
-	new (toFill++) EmojiData(220, 286, 0xD83CDF4DU, 0x0U, 2);
-	new (toFill++) EmojiData(836, 264, 0xD83CDF4EU, 0x0U, 2);
-	new (toFill++) EmojiData(858, 264, 0xD83CDF4FU, 0x0U, 2);
-	new (toFill++) EmojiData(198, 286, 0xD83CDF50U, 0x0U, 2);
-	new (toFill++) EmojiData(132, 286, 0xD83CDF51U, 0x0U, 2);
-	new (toFill++) EmojiData(44, 286, 0xD83CDF52U, 0x0U, 2);
-	new (toFill++) EmojiData(110, 286, 0xD83CDF53U, 0x0U, 2);
-	new (toFill++) EmojiData(154, 264, 0xD83CDF54U, 0x0U, 2);
-	new (toFill++) EmojiData(132, 264, 0xD83CDF55U, 0x0U, 2);
-	new (toFill++) EmojiData(220, 264, 0xD83CDF56U, 0x0U, 2);
-	new (toFill++) EmojiData(198, 264, 0xD83CDF57U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 264, 0xD83CDF58U, 0x0U, 2);
-	new (toFill++) EmojiData(374, 264, 0xD83CDF59U, 0x0U, 2);
-	new (toFill++) EmojiData(418, 264, 0xD83CDF5AU, 0x0U, 2);
-	new (toFill++) EmojiData(264, 264, 0xD83CDF5BU, 0x0U, 2);
-	new (toFill++) EmojiData(440, 264, 0xD83CDF5CU, 0x0U, 2);
-	new (toFill++) EmojiData(242, 264, 0xD83CDF5DU, 0x0U, 2);
-	new (toFill++) EmojiData(550, 264, 0xD83CDF5EU, 0x0U, 2);
-	new (toFill++) EmojiData(176, 264, 0xD83CDF5FU, 0x0U, 2);
-	new (toFill++) EmojiData(242, 286, 0xD83CDF60U, 0x0U, 2);
-	new (toFill++) EmojiData(506, 264, 0xD83CDF61U, 0x0U, 2);
-	new (toFill++) EmojiData(484, 264, 0xD83CDF62U, 0x0U, 2);
-	new (toFill++) EmojiData(330, 264, 0xD83CDF63U, 0x0U, 2);
-	new (toFill++) EmojiData(286, 264, 0xD83CDF64U, 0x0U, 2);
-	new (toFill++) EmojiData(352, 264, 0xD83CDF65U, 0x0U, 2);
-	new (toFill++) EmojiData(616, 264, 0xD83CDF66U, 0x0U, 2);
-	new (toFill++) EmojiData(660, 264, 0xD83CDF67U, 0x0U, 2);
-	new (toFill++) EmojiData(638, 264, 0xD83CDF68U, 0x0U, 2);
-	new (toFill++) EmojiData(572, 264, 0xD83CDF69U, 0x0U, 2);
-	new (toFill++) EmojiData(726, 264, 0xD83CDF6AU, 0x0U, 2);
-	new (toFill++) EmojiData(748, 264, 0xD83CDF6BU, 0x0U, 2);
-	new (toFill++) EmojiData(770, 264, 0xD83CDF6CU, 0x0U, 2);
-	new (toFill++) EmojiData(792, 264, 0xD83CDF6DU, 0x0U, 2);
-	new (toFill++) EmojiData(594, 264, 0xD83CDF6EU, 0x0U, 2);
-	new (toFill++) EmojiData(814, 264, 0xD83CDF6FU, 0x0U, 2);
-	new (toFill++) EmojiData(704, 264, 0xD83CDF70U, 0x0U, 2);
-	new (toFill++) EmojiData(308, 264, 0xD83CDF71U, 0x0U, 2);
-	new (toFill++) EmojiData(462, 264, 0xD83CDF72U, 0x0U, 2);
-	new (toFill++) EmojiData(528, 264, 0xD83CDF73U, 0x0U, 2);
-	new (toFill++) EmojiData(110, 264, 0xD83CDF74U, 0x0U, 2);
-	new (toFill++) EmojiData(814, 242, 0xD83CDF75U, 0x0U, 2);
-	new (toFill++) EmojiData(836, 242, 0xD83CDF76U, 0x0U, 2);
-	new (toFill++) EmojiData(88, 264, 0xD83CDF77U, 0x0U, 2);
-	new (toFill++) EmojiData(44, 264, 0xD83CDF78U, 0x0U, 2);
-	new (toFill++) EmojiData(66, 264, 0xD83CDF79U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 264, 0xD83CDF7AU, 0x0U, 2);
-	new (toFill++) EmojiData(22, 264, 0xD83CDF7BU, 0x0U, 2);
-	new (toFill++) EmojiData(858, 242, 0xD83CDF7CU, 0x0U, 2);
-	new (toFill++) EmojiData(110, 88, 0xD83CDF80U, 0x0U, 2);
-	new (toFill++) EmojiData(858, 154, 0xD83CDF81U, 0x0U, 2);
-	new (toFill++) EmojiData(682, 264, 0xD83CDF82U, 0x0U, 2);
-	new (toFill++) EmojiData(770, 154, 0xD83CDF83U, 0x0U, 2);
-	new (toFill++) EmojiData(836, 154, 0xD83CDF84U, 0x0U, 2);
-	new (toFill++) EmojiData(814, 154, 0xD83CDF85U, 0x0U, 2);
-	new (toFill++) EmojiData(682, 154, 0xD83CDF86U, 0x0U, 2);
-	new (toFill++) EmojiData(704, 154, 0xD83CDF87U, 0x0U, 2);
-	new (toFill++) EmojiData(66, 176, 0xD83CDF88U, 0x0U, 2);
-	new (toFill++) EmojiData(22, 176, 0xD83CDF89U, 0x0U, 2);
-	new (toFill++) EmojiData(44, 176, 0xD83CDF8AU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 176, 0xD83CDF8BU, 0x0U, 2);
-	new (toFill++) EmojiData(88, 176, 0xD83CDF8CU, 0x0U, 2);
-	new (toFill++) EmojiData(550, 154, 0xD83CDF8DU, 0x0U, 2);
-	new (toFill++) EmojiData(594, 154, 0xD83CDF8EU, 0x0U, 2);
-	new (toFill++) EmojiData(660, 154, 0xD83CDF8FU, 0x0U, 2);
-	new (toFill++) EmojiData(726, 154, 0xD83CDF90U, 0x0U, 2);
-	new (toFill++) EmojiData(748, 154, 0xD83CDF91U, 0x0U, 2);
-	new (toFill++) EmojiData(616, 154, 0xD83CDF92U, 0x0U, 2);
-	new (toFill++) EmojiData(638, 154, 0xD83CDF93U, 0x0U, 2);
-	new (toFill++) EmojiData(66, 308, 0xD83CDFA0U, 0x0U, 2);
-	new (toFill++) EmojiData(88, 308, 0xD83CDFA1U, 0x0U, 2);
-	new (toFill++) EmojiData(132, 308, 0xD83CDFA2U, 0x0U, 2);
-	new (toFill++) EmojiData(770, 242, 0xD83CDFA3U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 242, 0xD83CDFA4U, 0x0U, 2);
-	new (toFill++) EmojiData(132, 176, 0xD83CDFA5U, 0x0U, 2);
-	new (toFill++) EmojiData(154, 374, 0xD83CDFA6U, 0x0U, 2);
-	new (toFill++) EmojiData(22, 242, 0xD83CDFA7U, 0x0U, 2);
-	new (toFill++) EmojiData(836, 220, 0xD83CDFA8U, 0x0U, 2);
-	new (toFill++) EmojiData(528, 66, 0xD83CDFA9U, 0x0U, 2);
-	new (toFill++) EmojiData(484, 330, 0xD83CDFAAU, 0x0U, 2);
-	new (toFill++) EmojiData(242, 330, 0xD83CDFABU, 0x0U, 2);
-	new (toFill++) EmojiData(858, 220, 0xD83CDFACU, 0x0U, 2);
-	new (toFill++) EmojiData(506, 330, 0xD83CDFADU, 0x0U, 2);
-	new (toFill++) EmojiData(242, 242, 0xD83CDFAEU, 0x0U, 2);
-	new (toFill++) EmojiData(352, 242, 0xD83CDFAFU, 0x0U, 2);
-	new (toFill++) EmojiData(418, 330, 0xD83CDFB0U, 0x0U, 2);
-	new (toFill++) EmojiData(484, 242, 0xD83CDFB1U, 0x0U, 2);
-	new (toFill++) EmojiData(330, 242, 0xD83CDFB2U, 0x0U, 2);
-	new (toFill++) EmojiData(528, 242, 0xD83CDFB3U, 0x0U, 2);
-	new (toFill++) EmojiData(286, 242, 0xD83CDFB4U, 0x0U, 2);
-	new (toFill++) EmojiData(66, 242, 0xD83CDFB5U, 0x0U, 2);
-	new (toFill++) EmojiData(88, 242, 0xD83CDFB6U, 0x0U, 2);
-	new (toFill++) EmojiData(176, 242, 0xD83CDFB7U, 0x0U, 2);
-	new (toFill++) EmojiData(198, 242, 0xD83CDFB8U, 0x0U, 2);
-	new (toFill++) EmojiData(110, 242, 0xD83CDFB9U, 0x0U, 2);
-	new (toFill++) EmojiData(154, 242, 0xD83CDFBAU, 0x0U, 2);
-	new (toFill++) EmojiData(132, 242, 0xD83CDFBBU, 0x0U, 2);
-	new (toFill++) EmojiData(44, 242, 0xD83CDFBCU, 0x0U, 2);
-	new (toFill++) EmojiData(792, 66, 0xD83CDFBDU, 0x0U, 2);
-	new (toFill++) EmojiData(462, 242, 0xD83CDFBEU, 0x0U, 2);
-	new (toFill++) EmojiData(682, 242, 0xD83CDFBFU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 242, 0xD83CDFC0U, 0x0U, 2);
-	new (toFill++) EmojiData(616, 242, 0xD83CDFC1U, 0x0U, 2);
-	new (toFill++) EmojiData(704, 242, 0xD83CDFC2U, 0x0U, 2);
-	new (toFill++) EmojiData(88, 66, 0xD83CDFC3U, 0x0U, 2);
-	new (toFill++) EmojiData(748, 242, 0xD83CDFC4U, 0x0U, 2);
-	new (toFill++) EmojiData(660, 242, 0xD83CDFC6U, 0x0U, 2);
-	new (toFill++) EmojiData(638, 242, 0xD83CDFC7U, 0x0U, 2);
-	new (toFill++) EmojiData(374, 242, 0xD83CDFC8U, 0x0U, 2);
-	new (toFill++) EmojiData(506, 242, 0xD83CDFC9U, 0x0U, 2);
-	new (toFill++) EmojiData(726, 242, 0xD83CDFCAU, 0x0U, 2);
-	new (toFill++) EmojiData(330, 286, 0xD83CDFE0U, 0x0U, 2);
-	new (toFill++) EmojiData(352, 286, 0xD83CDFE1U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 286, 0xD83CDFE2U, 0x0U, 2);
-	new (toFill++) EmojiData(418, 286, 0xD83CDFE3U, 0x0U, 2);
-	new (toFill++) EmojiData(616, 286, 0xD83CDFE4U, 0x0U, 2);
-	new (toFill++) EmojiData(440, 286, 0xD83CDFE5U, 0x0U, 2);
-	new (toFill++) EmojiData(462, 286, 0xD83CDFE6U, 0x0U, 2);
-	new (toFill++) EmojiData(44, 418, 0xD83CDFE7U, 0x0U, 2);
-	new (toFill++) EmojiData(528, 286, 0xD83CDFE8U, 0x0U, 2);
-	new (toFill++) EmojiData(506, 286, 0xD83CDFE9U, 0x0U, 2);
-	new (toFill++) EmojiData(484, 286, 0xD83CDFEAU, 0x0U, 2);
-	new (toFill++) EmojiData(374, 286, 0xD83CDFEBU, 0x0U, 2);
-	new (toFill++) EmojiData(594, 286, 0xD83CDFECU, 0x0U, 2);
-	new (toFill++) EmojiData(748, 286, 0xD83CDFEDU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 330, 0xD83CDFEEU, 0x0U, 2);
-	new (toFill++) EmojiData(682, 286, 0xD83CDFEFU, 0x0U, 2);
-	new (toFill++) EmojiData(704, 286, 0xD83CDFF0U, 0x0U, 2);
-	new (toFill++) EmojiData(682, 110, 0xD83DDC00U, 0x0U, 2);
-	new (toFill++) EmojiData(22, 132, 0xD83DDC01U, 0x0U, 2);
-	new (toFill++) EmojiData(44, 132, 0xD83DDC02U, 0x0U, 2);
-	new (toFill++) EmojiData(704, 110, 0xD83DDC03U, 0x0U, 2);
-	new (toFill++) EmojiData(638, 110, 0xD83DDC04U, 0x0U, 2);
-	new (toFill++) EmojiData(726, 110, 0xD83DDC05U, 0x0U, 2);
-	new (toFill++) EmojiData(176, 132, 0xD83DDC06U, 0x0U, 2);
-	new (toFill++) EmojiData(748, 110, 0xD83DDC07U, 0x0U, 2);
-	new (toFill++) EmojiData(198, 132, 0xD83DDC08U, 0x0U, 2);
-	new (toFill++) EmojiData(770, 110, 0xD83DDC09U, 0x0U, 2);
-	new (toFill++) EmojiData(110, 132, 0xD83DDC0AU, 0x0U, 2);
-	new (toFill++) EmojiData(616, 110, 0xD83DDC0BU, 0x0U, 2);
-	new (toFill++) EmojiData(462, 110, 0xD83DDC0CU, 0x0U, 2);
-	new (toFill++) EmojiData(330, 110, 0xD83DDC0DU, 0x0U, 2);
-	new (toFill++) EmojiData(792, 110, 0xD83DDC0EU, 0x0U, 2);
-	new (toFill++) EmojiData(660, 110, 0xD83DDC0FU, 0x0U, 2);
-	new (toFill++) EmojiData(814, 110, 0xD83DDC10U, 0x0U, 2);
-	new (toFill++) EmojiData(132, 110, 0xD83DDC11U, 0x0U, 2);
-	new (toFill++) EmojiData(88, 110, 0xD83DDC12U, 0x0U, 2);
-	new (toFill++) EmojiData(836, 110, 0xD83DDC13U, 0x0U, 2);
-	new (toFill++) EmojiData(308, 110, 0xD83DDC14U, 0x0U, 2);
-	new (toFill++) EmojiData(858, 110, 0xD83DDC15U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 132, 0xD83DDC16U, 0x0U, 2);
-	new (toFill++) EmojiData(44, 110, 0xD83DDC17U, 0x0U, 2);
-	new (toFill++) EmojiData(154, 110, 0xD83DDC18U, 0x0U, 2);
-	new (toFill++) EmojiData(484, 110, 0xD83DDC19U, 0x0U, 2);
-	new (toFill++) EmojiData(506, 110, 0xD83DDC1AU, 0x0U, 2);
-	new (toFill++) EmojiData(374, 110, 0xD83DDC1BU, 0x0U, 2);
-	new (toFill++) EmojiData(418, 110, 0xD83DDC1CU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 110, 0xD83DDC1DU, 0x0U, 2);
-	new (toFill++) EmojiData(440, 110, 0xD83DDC1EU, 0x0U, 2);
-	new (toFill++) EmojiData(550, 110, 0xD83DDC1FU, 0x0U, 2);
-	new (toFill++) EmojiData(528, 110, 0xD83DDC20U, 0x0U, 2);
-	new (toFill++) EmojiData(88, 132, 0xD83DDC21U, 0x0U, 2);
-	new (toFill++) EmojiData(352, 110, 0xD83DDC22U, 0x0U, 2);
-	new (toFill++) EmojiData(286, 110, 0xD83DDC23U, 0x0U, 2);
-	new (toFill++) EmojiData(242, 110, 0xD83DDC24U, 0x0U, 2);
-	new (toFill++) EmojiData(264, 110, 0xD83DDC25U, 0x0U, 2);
-	new (toFill++) EmojiData(220, 110, 0xD83DDC26U, 0x0U, 2);
-	new (toFill++) EmojiData(198, 110, 0xD83DDC27U, 0x0U, 2);
-	new (toFill++) EmojiData(814, 88, 0xD83DDC28U, 0x0U, 2);
-	new (toFill++) EmojiData(220, 132, 0xD83DDC29U, 0x0U, 2);
-	new (toFill++) EmojiData(154, 132, 0xD83DDC2AU, 0x0U, 2);
-	new (toFill++) EmojiData(132, 132, 0xD83DDC2BU, 0x0U, 2);
-	new (toFill++) EmojiData(572, 110, 0xD83DDC2CU, 0x0U, 2);
-	new (toFill++) EmojiData(704, 88, 0xD83DDC2DU, 0x0U, 2);
-	new (toFill++) EmojiData(22, 110, 0xD83DDC2EU, 0x0U, 2);
-	new (toFill++) EmojiData(792, 88, 0xD83DDC2FU, 0x0U, 2);
-	new (toFill++) EmojiData(748, 88, 0xD83DDC30U, 0x0U, 2);
-	new (toFill++) EmojiData(682, 88, 0xD83DDC31U, 0x0U, 2);
-	new (toFill++) EmojiData(66, 132, 0xD83DDC32U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 110, 0xD83DDC33U, 0x0U, 2);
-	new (toFill++) EmojiData(110, 110, 0xD83DDC34U, 0x0U, 2);
-	new (toFill++) EmojiData(66, 110, 0xD83DDC35U, 0x0U, 2);
-	new (toFill++) EmojiData(638, 88, 0xD83DDC36U, 0x0U, 2);
-	new (toFill++) EmojiData(858, 88, 0xD83DDC37U, 0x0U, 2);
-	new (toFill++) EmojiData(770, 88, 0xD83DDC38U, 0x0U, 2);
-	new (toFill++) EmojiData(726, 88, 0xD83DDC39U, 0x0U, 2);
-	new (toFill++) EmojiData(660, 88, 0xD83DDC3AU, 0x0U, 2);
-	new (toFill++) EmojiData(836, 88, 0xD83DDC3BU, 0x0U, 2);
-	new (toFill++) EmojiData(176, 110, 0xD83DDC3CU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 110, 0xD83DDC3DU, 0x0U, 2);
-	new (toFill++) EmojiData(242, 132, 0xD83DDC3EU, 0x0U, 2);
-	new (toFill++) EmojiData(462, 44, 0xD83DDC40U, 0x0U, 2);
-	new (toFill++) EmojiData(440, 44, 0xD83DDC42U, 0x0U, 2);
-	new (toFill++) EmojiData(484, 44, 0xD83DDC43U, 0x0U, 2);
-	new (toFill++) EmojiData(528, 44, 0xD83DDC44U, 0x0U, 2);
-	new (toFill++) EmojiData(506, 44, 0xD83DDC45U, 0x0U, 2);
-	new (toFill++) EmojiData(748, 44, 0xD83DDC46U, 0x0U, 2);
-	new (toFill++) EmojiData(770, 44, 0xD83DDC47U, 0x0U, 2);
-	new (toFill++) EmojiData(814, 44, 0xD83DDC48U, 0x0U, 2);
-	new (toFill++) EmojiData(792, 44, 0xD83DDC49U, 0x0U, 2);
-	new (toFill++) EmojiData(616, 44, 0xD83DDC4AU, 0x0U, 2);
-	new (toFill++) EmojiData(682, 44, 0xD83DDC4BU, 0x0U, 2);
-	new (toFill++) EmojiData(594, 44, 0xD83DDC4CU, 0x0U, 2);
-	new (toFill++) EmojiData(550, 44, 0xD83DDC4DU, 0x0U, 2);
-	new (toFill++) EmojiData(572, 44, 0xD83DDC4EU, 0x0U, 2);
-	new (toFill++) EmojiData(22, 66, 0xD83DDC4FU, 0x0U, 2);
-	new (toFill++) EmojiData(726, 44, 0xD83DDC50U, 0x0U, 2);
-	new (toFill++) EmojiData(550, 66, 0xD83DDC51U, 0x0U, 2);
-	new (toFill++) EmojiData(572, 66, 0xD83DDC52U, 0x0U, 2);
-	new (toFill++) EmojiData(88, 88, 0xD83DDC53U, 0x0U, 2);
-	new (toFill++) EmojiData(726, 66, 0xD83DDC54U, 0x0U, 2);
-	new (toFill++) EmojiData(704, 66, 0xD83DDC55U, 0x0U, 2);
-	new (toFill++) EmojiData(814, 66, 0xD83DDC56U, 0x0U, 2);
-	new (toFill++) EmojiData(770, 66, 0xD83DDC57U, 0x0U, 2);
-	new (toFill++) EmojiData(836, 66, 0xD83DDC58U, 0x0U, 2);
-	new (toFill++) EmojiData(858, 66, 0xD83DDC59U, 0x0U, 2);
-	new (toFill++) EmojiData(748, 66, 0xD83DDC5AU, 0x0U, 2);
-	new (toFill++) EmojiData(66, 88, 0xD83DDC5BU, 0x0U, 2);
-	new (toFill++) EmojiData(22, 88, 0xD83DDC5CU, 0x0U, 2);
-	new (toFill++) EmojiData(44, 88, 0xD83DDC5DU, 0x0U, 2);
-	new (toFill++) EmojiData(616, 66, 0xD83DDC5EU, 0x0U, 2);
-	new (toFill++) EmojiData(594, 66, 0xD83DDC5FU, 0x0U, 2);
-	new (toFill++) EmojiData(660, 66, 0xD83DDC60U, 0x0U, 2);
-	new (toFill++) EmojiData(638, 66, 0xD83DDC61U, 0x0U, 2);
-	new (toFill++) EmojiData(682, 66, 0xD83DDC62U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 88, 0xD83DDC63U, 0x0U, 2);
-	new (toFill++) EmojiData(528, 88, 0xD83DDC64U, 0x0U, 2);
-	new (toFill++) EmojiData(550, 88, 0xD83DDC65U, 0x0U, 2);
-	new (toFill++) EmojiData(528, 22, 0xD83DDC66U, 0x0U, 2);
-	new (toFill++) EmojiData(550, 22, 0xD83DDC67U, 0x0U, 2);
-	new (toFill++) EmojiData(572, 22, 0xD83DDC68U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 22, 0xD83DDC69U, 0x0U, 2);
-	new (toFill++) EmojiData(154, 66, 0xD83DDC6AU, 0x0U, 2);
-	new (toFill++) EmojiData(132, 66, 0xD83DDC6BU, 0x0U, 2);
-	new (toFill++) EmojiData(176, 66, 0xD83DDC6CU, 0x0U, 2);
-	new (toFill++) EmojiData(198, 66, 0xD83DDC6DU, 0x0U, 2);
-	new (toFill++) EmojiData(440, 22, 0xD83DDC6EU, 0x0U, 2);
-	new (toFill++) EmojiData(264, 66, 0xD83DDC6FU, 0x0U, 2);
-	new (toFill++) EmojiData(440, 66, 0xD83DDC70U, 0x0U, 2);
-	new (toFill++) EmojiData(660, 22, 0xD83DDC71U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 22, 0xD83DDC72U, 0x0U, 2);
-	new (toFill++) EmojiData(418, 22, 0xD83DDC73U, 0x0U, 2);
-	new (toFill++) EmojiData(616, 22, 0xD83DDC74U, 0x0U, 2);
-	new (toFill++) EmojiData(638, 22, 0xD83DDC75U, 0x0U, 2);
-	new (toFill++) EmojiData(506, 22, 0xD83DDC76U, 0x0U, 2);
-	new (toFill++) EmojiData(462, 22, 0xD83DDC77U, 0x0U, 2);
-	new (toFill++) EmojiData(704, 22, 0xD83DDC78U, 0x0U, 2);
-	new (toFill++) EmojiData(44, 44, 0xD83DDC79U, 0x0U, 2);
-	new (toFill++) EmojiData(66, 44, 0xD83DDC7AU, 0x0U, 2);
-	new (toFill++) EmojiData(792, 154, 0xD83DDC7BU, 0x0U, 2);
-	new (toFill++) EmojiData(682, 22, 0xD83DDC7CU, 0x0U, 2);
-	new (toFill++) EmojiData(176, 44, 0xD83DDC7DU, 0x0U, 2);
-	new (toFill++) EmojiData(220, 242, 0xD83DDC7EU, 0x0U, 2);
-	new (toFill++) EmojiData(176, 22, 0xD83DDC7FU, 0x0U, 2);
-	new (toFill++) EmojiData(154, 44, 0xD83DDC80U, 0x0U, 2);
-	new (toFill++) EmojiData(330, 66, 0xD83DDC81U, 0x0U, 2);
-	new (toFill++) EmojiData(484, 22, 0xD83DDC82U, 0x0U, 2);
-	new (toFill++) EmojiData(110, 66, 0xD83DDC83U, 0x0U, 2);
-	new (toFill++) EmojiData(154, 88, 0xD83DDC84U, 0x0U, 2);
-	new (toFill++) EmojiData(418, 66, 0xD83DDC85U, 0x0U, 2);
-	new (toFill++) EmojiData(374, 66, 0xD83DDC86U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 66, 0xD83DDC87U, 0x0U, 2);
-	new (toFill++) EmojiData(198, 330, 0xD83DDC88U, 0x0U, 2);
-	new (toFill++) EmojiData(462, 198, 0xD83DDC89U, 0x0U, 2);
-	new (toFill++) EmojiData(440, 198, 0xD83DDC8AU, 0x0U, 2);
-	new (toFill++) EmojiData(462, 88, 0xD83DDC8BU, 0x0U, 2);
-	new (toFill++) EmojiData(440, 88, 0xD83DDC8CU, 0x0U, 2);
-	new (toFill++) EmojiData(484, 88, 0xD83DDC8DU, 0x0U, 2);
-	new (toFill++) EmojiData(506, 88, 0xD83DDC8EU, 0x0U, 2);
-	new (toFill++) EmojiData(220, 66, 0xD83DDC8FU, 0x0U, 2);
-	new (toFill++) EmojiData(264, 132, 0xD83DDC90U, 0x0U, 2);
-	new (toFill++) EmojiData(242, 66, 0xD83DDC91U, 0x0U, 2);
-	new (toFill++) EmojiData(550, 286, 0xD83DDC92U, 0x0U, 2);
-	new (toFill++) EmojiData(330, 88, 0xD83DDC93U, 0x0U, 2);
-	new (toFill++) EmojiData(286, 88, 0xD83DDC94U, 0x0U, 2);
-	new (toFill++) EmojiData(352, 88, 0xD83DDC95U, 0x0U, 2);
-	new (toFill++) EmojiData(374, 88, 0xD83DDC96U, 0x0U, 2);
-	new (toFill++) EmojiData(308, 88, 0xD83DDC97U, 0x0U, 2);
-	new (toFill++) EmojiData(418, 88, 0xD83DDC98U, 0x0U, 2);
-	new (toFill++) EmojiData(198, 88, 0xD83DDC99U, 0x0U, 2);
-	new (toFill++) EmojiData(242, 88, 0xD83DDC9AU, 0x0U, 2);
-	new (toFill++) EmojiData(176, 88, 0xD83DDC9BU, 0x0U, 2);
-	new (toFill++) EmojiData(220, 88, 0xD83DDC9CU, 0x0U, 2);
-	new (toFill++) EmojiData(572, 154, 0xD83DDC9DU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 88, 0xD83DDC9EU, 0x0U, 2);
-	new (toFill++) EmojiData(374, 396, 0xD83DDC9FU, 0x0U, 2);
-	new (toFill++) EmojiData(550, 396, 0xD83DDCA0U, 0x0U, 2);
-	new (toFill++) EmojiData(22, 198, 0xD83DDCA1U, 0x0U, 2);
-	new (toFill++) EmojiData(330, 44, 0xD83DDCA2U, 0x0U, 2);
-	new (toFill++) EmojiData(374, 198, 0xD83DDCA3U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 44, 0xD83DDCA4U, 0x0U, 2);
-	new (toFill++) EmojiData(308, 44, 0xD83DDCA5U, 0x0U, 2);
-	new (toFill++) EmojiData(352, 44, 0xD83DDCA6U, 0x0U, 2);
-	new (toFill++) EmojiData(374, 44, 0xD83DDCA7U, 0x0U, 2);
-	new (toFill++) EmojiData(418, 44, 0xD83DDCA8U, 0x0U, 2);
-	new (toFill++) EmojiData(198, 44, 0xD83DDCA9U, 0x0U, 2);
-	new (toFill++) EmojiData(44, 66, 0xD83DDCAAU, 0x0U, 2);
-	new (toFill++) EmojiData(286, 44, 0xD83DDCABU, 0x0U, 2);
-	new (toFill++) EmojiData(572, 88, 0xD83DDCACU, 0x0U, 2);
-	new (toFill++) EmojiData(616, 88, 0xD83DDCADU, 0x0U, 2);
-	new (toFill++) EmojiData(330, 440, 0xD83DDCAEU, 0x0U, 2);
-	new (toFill++) EmojiData(352, 440, 0xD83DDCAFU, 0x0U, 2);
-	new (toFill++) EmojiData(484, 198, 0xD83DDCB0U, 0x0U, 2);
-	new (toFill++) EmojiData(110, 418, 0xD83DDCB1U, 0x0U, 2);
-	new (toFill++) EmojiData(88, 418, 0xD83DDCB2U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 198, 0xD83DDCB3U, 0x0U, 2);
-	new (toFill++) EmojiData(506, 198, 0xD83DDCB4U, 0x0U, 2);
-	new (toFill++) EmojiData(528, 198, 0xD83DDCB5U, 0x0U, 2);
-	new (toFill++) EmojiData(572, 198, 0xD83DDCB6U, 0x0U, 2);
-	new (toFill++) EmojiData(550, 198, 0xD83DDCB7U, 0x0U, 2);
-	new (toFill++) EmojiData(616, 198, 0xD83DDCB8U, 0x0U, 2);
-	new (toFill++) EmojiData(66, 418, 0xD83DDCB9U, 0x0U, 2);
-	new (toFill++) EmojiData(308, 308, 0xD83DDCBAU, 0x0U, 2);
-	new (toFill++) EmojiData(308, 176, 0xD83DDCBBU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 88, 0xD83DDCBCU, 0x0U, 2);
-	new (toFill++) EmojiData(264, 176, 0xD83DDCBDU, 0x0U, 2);
-	new (toFill++) EmojiData(286, 176, 0xD83DDCBEU, 0x0U, 2);
-	new (toFill++) EmojiData(220, 176, 0xD83DDCBFU, 0x0U, 2);
-	new (toFill++) EmojiData(242, 176, 0xD83DDCC0U, 0x0U, 2);
-	new (toFill++) EmojiData(330, 220, 0xD83DDCC1U, 0x0U, 2);
-	new (toFill++) EmojiData(352, 220, 0xD83DDCC2U, 0x0U, 2);
-	new (toFill++) EmojiData(110, 220, 0xD83DDCC3U, 0x0U, 2);
-	new (toFill++) EmojiData(88, 220, 0xD83DDCC4U, 0x0U, 2);
-	new (toFill++) EmojiData(264, 220, 0xD83DDCC5U, 0x0U, 2);
-	new (toFill++) EmojiData(286, 220, 0xD83DDCC6U, 0x0U, 2);
-	new (toFill++) EmojiData(308, 220, 0xD83DDCC7U, 0x0U, 2);
-	new (toFill++) EmojiData(176, 220, 0xD83DDCC8U, 0x0U, 2);
-	new (toFill++) EmojiData(198, 220, 0xD83DDCC9U, 0x0U, 2);
-	new (toFill++) EmojiData(154, 220, 0xD83DDCCAU, 0x0U, 2);
-	new (toFill++) EmojiData(242, 220, 0xD83DDCCBU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 220, 0xD83DDCCCU, 0x0U, 2);
-	new (toFill++) EmojiData(528, 330, 0xD83DDCCDU, 0x0U, 2);
-	new (toFill++) EmojiData(418, 220, 0xD83DDCCEU, 0x0U, 2);
-	new (toFill++) EmojiData(484, 220, 0xD83DDCCFU, 0x0U, 2);
-	new (toFill++) EmojiData(506, 220, 0xD83DDCD0U, 0x0U, 2);
-	new (toFill++) EmojiData(132, 220, 0xD83DDCD1U, 0x0U, 2);
-	new (toFill++) EmojiData(660, 220, 0xD83DDCD2U, 0x0U, 2);
-	new (toFill++) EmojiData(616, 220, 0xD83DDCD3U, 0x0U, 2);
-	new (toFill++) EmojiData(638, 220, 0xD83DDCD4U, 0x0U, 2);
-	new (toFill++) EmojiData(528, 220, 0xD83DDCD5U, 0x0U, 2);
-	new (toFill++) EmojiData(704, 220, 0xD83DDCD6U, 0x0U, 2);
-	new (toFill++) EmojiData(550, 220, 0xD83DDCD7U, 0x0U, 2);
-	new (toFill++) EmojiData(572, 220, 0xD83DDCD8U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 220, 0xD83DDCD9U, 0x0U, 2);
-	new (toFill++) EmojiData(682, 220, 0xD83DDCDAU, 0x0U, 2);
-	new (toFill++) EmojiData(748, 220, 0xD83DDCDBU, 0x0U, 2);
-	new (toFill++) EmojiData(220, 220, 0xD83DDCDCU, 0x0U, 2);
-	new (toFill++) EmojiData(66, 220, 0xD83DDCDDU, 0x0U, 2);
-	new (toFill++) EmojiData(374, 176, 0xD83DDCDEU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 176, 0xD83DDCDFU, 0x0U, 2);
-	new (toFill++) EmojiData(418, 176, 0xD83DDCE0U, 0x0U, 2);
-	new (toFill++) EmojiData(440, 176, 0xD83DDCE1U, 0x0U, 2);
-	new (toFill++) EmojiData(638, 176, 0xD83DDCE2U, 0x0U, 2);
-	new (toFill++) EmojiData(660, 176, 0xD83DDCE3U, 0x0U, 2);
-	new (toFill++) EmojiData(704, 198, 0xD83DDCE4U, 0x0U, 2);
-	new (toFill++) EmojiData(682, 198, 0xD83DDCE5U, 0x0U, 2);
-	new (toFill++) EmojiData(44, 220, 0xD83DDCE6U, 0x0U, 2);
-	new (toFill++) EmojiData(660, 198, 0xD83DDCE7U, 0x0U, 2);
-	new (toFill++) EmojiData(770, 198, 0xD83DDCE8U, 0x0U, 2);
-	new (toFill++) EmojiData(748, 198, 0xD83DDCE9U, 0x0U, 2);
-	new (toFill++) EmojiData(836, 198, 0xD83DDCEAU, 0x0U, 2);
-	new (toFill++) EmojiData(814, 198, 0xD83DDCEBU, 0x0U, 2);
-	new (toFill++) EmojiData(858, 198, 0xD83DDCECU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 220, 0xD83DDCEDU, 0x0U, 2);
-	new (toFill++) EmojiData(22, 220, 0xD83DDCEEU, 0x0U, 2);
-	new (toFill++) EmojiData(792, 198, 0xD83DDCEFU, 0x0U, 2);
-	new (toFill++) EmojiData(814, 220, 0xD83DDCF0U, 0x0U, 2);
-	new (toFill++) EmojiData(330, 176, 0xD83DDCF1U, 0x0U, 2);
-	new (toFill++) EmojiData(638, 198, 0xD83DDCF2U, 0x0U, 2);
-	new (toFill++) EmojiData(418, 396, 0xD83DDCF3U, 0x0U, 2);
-	new (toFill++) EmojiData(440, 396, 0xD83DDCF4U, 0x0U, 2);
-	new (toFill++) EmojiData(110, 396, 0xD83DDCF5U, 0x0U, 2);
-	new (toFill++) EmojiData(132, 374, 0xD83DDCF6U, 0x0U, 2);
-	new (toFill++) EmojiData(154, 176, 0xD83DDCF7U, 0x0U, 2);
-	new (toFill++) EmojiData(176, 176, 0xD83DDCF9U, 0x0U, 2);
-	new (toFill++) EmojiData(462, 176, 0xD83DDCFAU, 0x0U, 2);
-	new (toFill++) EmojiData(484, 176, 0xD83DDCFBU, 0x0U, 2);
-	new (toFill++) EmojiData(198, 176, 0xD83DDCFCU, 0x0U, 2);
-	new (toFill++) EmojiData(836, 352, 0xD83DDD00U, 0x0U, 2);
-	new (toFill++) EmojiData(858, 352, 0xD83DDD01U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 374, 0xD83DDD02U, 0x0U, 2);
-	new (toFill++) EmojiData(484, 418, 0xD83DDD03U, 0x0U, 2);
-	new (toFill++) EmojiData(506, 352, 0xD83DDD04U, 0x0U, 2);
-	new (toFill++) EmojiData(88, 198, 0xD83DDD05U, 0x0U, 2);
-	new (toFill++) EmojiData(66, 198, 0xD83DDD06U, 0x0U, 2);
-	new (toFill++) EmojiData(572, 176, 0xD83DDD07U, 0x0U, 2);
-	new (toFill++) EmojiData(550, 176, 0xD83DDD08U, 0x0U, 2);
-	new (toFill++) EmojiData(528, 176, 0xD83DDD09U, 0x0U, 2);
-	new (toFill++) EmojiData(506, 176, 0xD83DDD0AU, 0x0U, 2);
-	new (toFill++) EmojiData(132, 198, 0xD83DDD0BU, 0x0U, 2);
-	new (toFill++) EmojiData(110, 198, 0xD83DDD0CU, 0x0U, 2);
-	new (toFill++) EmojiData(154, 198, 0xD83DDD0DU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 198, 0xD83DDD0EU, 0x0U, 2);
-	new (toFill++) EmojiData(814, 176, 0xD83DDD0FU, 0x0U, 2);
-	new (toFill++) EmojiData(836, 176, 0xD83DDD10U, 0x0U, 2);
-	new (toFill++) EmojiData(858, 176, 0xD83DDD11U, 0x0U, 2);
-	new (toFill++) EmojiData(792, 176, 0xD83DDD12U, 0x0U, 2);
-	new (toFill++) EmojiData(770, 176, 0xD83DDD13U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 176, 0xD83DDD14U, 0x0U, 2);
-	new (toFill++) EmojiData(616, 176, 0xD83DDD15U, 0x0U, 2);
-	new (toFill++) EmojiData(726, 220, 0xD83DDD16U, 0x0U, 2);
-	new (toFill++) EmojiData(440, 440, 0xD83DDD17U, 0x0U, 2);
-	new (toFill++) EmojiData(418, 440, 0xD83DDD18U, 0x0U, 2);
-	new (toFill++) EmojiData(418, 418, 0xD83DDD19U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 418, 0xD83DDD1AU, 0x0U, 2);
-	new (toFill++) EmojiData(440, 418, 0xD83DDD1BU, 0x0U, 2);
-	new (toFill++) EmojiData(462, 418, 0xD83DDD1CU, 0x0U, 2);
-	new (toFill++) EmojiData(374, 418, 0xD83DDD1DU, 0x0U, 2);
-	new (toFill++) EmojiData(88, 396, 0xD83DDD1EU, 0x0U, 2);
-	new (toFill++) EmojiData(132, 352, 0xD83DDD1FU, 0x0U, 2);
-	new (toFill++) EmojiData(308, 352, 0xD83DDD20U, 0x0U, 2);
-	new (toFill++) EmojiData(330, 352, 0xD83DDD21U, 0x0U, 2);
-	new (toFill++) EmojiData(154, 352, 0xD83DDD22U, 0x0U, 2);
-	new (toFill++) EmojiData(198, 352, 0xD83DDD23U, 0x0U, 2);
-	new (toFill++) EmojiData(352, 352, 0xD83DDD24U, 0x0U, 2);
-	new (toFill++) EmojiData(220, 44, 0xD83DDD25U, 0x0U, 2);
-	new (toFill++) EmojiData(44, 198, 0xD83DDD26U, 0x0U, 2);
-	new (toFill++) EmojiData(264, 198, 0xD83DDD27U, 0x0U, 2);
-	new (toFill++) EmojiData(308, 198, 0xD83DDD28U, 0x0U, 2);
-	new (toFill++) EmojiData(286, 198, 0xD83DDD29U, 0x0U, 2);
-	new (toFill++) EmojiData(418, 198, 0xD83DDD2AU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 198, 0xD83DDD2BU, 0x0U, 2);
-	new (toFill++) EmojiData(770, 220, 0xD83DDD2CU, 0x0U, 2);
-	new (toFill++) EmojiData(792, 220, 0xD83DDD2DU, 0x0U, 2);
-	new (toFill++) EmojiData(110, 176, 0xD83DDD2EU, 0x0U, 2);
-	new (toFill++) EmojiData(22, 418, 0xD83DDD2FU, 0x0U, 2);
-	new (toFill++) EmojiData(352, 330, 0xD83DDD30U, 0x0U, 2);
-	new (toFill++) EmojiData(528, 440, 0xD83DDD31U, 0x0U, 2);
-	new (toFill++) EmojiData(704, 440, 0xD83DDD32U, 0x0U, 2);
-	new (toFill++) EmojiData(726, 440, 0xD83DDD33U, 0x0U, 2);
-	new (toFill++) EmojiData(792, 440, 0xD83DDD34U, 0x0U, 2);
-	new (toFill++) EmojiData(814, 440, 0xD83DDD35U, 0x0U, 2);
-	new (toFill++) EmojiData(22, 462, 0xD83DDD36U, 0x0U, 2);
-	new (toFill++) EmojiData(44, 462, 0xD83DDD37U, 0x0U, 2);
-	new (toFill++) EmojiData(66, 462, 0xD83DDD38U, 0x0U, 2);
-	new (toFill++) EmojiData(88, 462, 0xD83DDD39U, 0x0U, 2);
-	new (toFill++) EmojiData(682, 440, 0xD83DDD3AU, 0x0U, 2);
-	new (toFill++) EmojiData(836, 440, 0xD83DDD3BU, 0x0U, 2);
-	new (toFill++) EmojiData(572, 352, 0xD83DDD3CU, 0x0U, 2);
-	new (toFill++) EmojiData(594, 352, 0xD83DDD3DU, 0x0U, 2);
-	new (toFill++) EmojiData(550, 418, 0xD83DDD50U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 418, 0xD83DDD51U, 0x0U, 2);
-	new (toFill++) EmojiData(638, 418, 0xD83DDD52U, 0x0U, 2);
-	new (toFill++) EmojiData(682, 418, 0xD83DDD53U, 0x0U, 2);
-	new (toFill++) EmojiData(726, 418, 0xD83DDD54U, 0x0U, 2);
-	new (toFill++) EmojiData(770, 418, 0xD83DDD55U, 0x0U, 2);
-	new (toFill++) EmojiData(792, 418, 0xD83DDD56U, 0x0U, 2);
-	new (toFill++) EmojiData(814, 418, 0xD83DDD57U, 0x0U, 2);
-	new (toFill++) EmojiData(836, 418, 0xD83DDD58U, 0x0U, 2);
-	new (toFill++) EmojiData(858, 418, 0xD83DDD59U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 440, 0xD83DDD5AU, 0x0U, 2);
-	new (toFill++) EmojiData(506, 418, 0xD83DDD5BU, 0x0U, 2);
-	new (toFill++) EmojiData(572, 418, 0xD83DDD5CU, 0x0U, 2);
-	new (toFill++) EmojiData(616, 418, 0xD83DDD5DU, 0x0U, 2);
-	new (toFill++) EmojiData(660, 418, 0xD83DDD5EU, 0x0U, 2);
-	new (toFill++) EmojiData(704, 418, 0xD83DDD5FU, 0x0U, 2);
-	new (toFill++) EmojiData(748, 418, 0xD83DDD60U, 0x0U, 2);
-	new (toFill++) EmojiData(22, 440, 0xD83DDD61U, 0x0U, 2);
-	new (toFill++) EmojiData(44, 440, 0xD83DDD62U, 0x0U, 2);
-	new (toFill++) EmojiData(66, 440, 0xD83DDD63U, 0x0U, 2);
-	new (toFill++) EmojiData(88, 440, 0xD83DDD64U, 0x0U, 2);
-	new (toFill++) EmojiData(110, 440, 0xD83DDD65U, 0x0U, 2);
-	new (toFill++) EmojiData(132, 440, 0xD83DDD66U, 0x0U, 2);
-	new (toFill++) EmojiData(528, 418, 0xD83DDD67U, 0x0U, 2);
-	new (toFill++) EmojiData(814, 286, 0xD83DDDFBU, 0x0U, 2);
-	new (toFill++) EmojiData(770, 286, 0xD83DDDFCU, 0x0U, 2);
-	new (toFill++) EmojiData(22, 308, 0xD83DDDFDU, 0x0U, 2);
-	new (toFill++) EmojiData(792, 286, 0xD83DDDFEU, 0x0U, 2);
-	new (toFill++) EmojiData(462, 330, 0xD83DDDFFU, 0x0U, 2);
-	new (toFill++) EmojiData(44, 0, 0xD83DDE00U, 0x0U, 2);
-	new (toFill++) EmojiData(330, 0, 0xD83DDE01U, 0x0U, 2);
-	new (toFill++) EmojiData(484, 0, 0xD83DDE02U, 0x0U, 2);
-	new (toFill++) EmojiData(22, 0, 0xD83DDE03U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 0, 0xD83DDE04U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 0, 0xD83DDE05U, 0x0U, 2);
-	new (toFill++) EmojiData(814, 0, 0xD83DDE06U, 0x0U, 2);
-	new (toFill++) EmojiData(330, 22, 0xD83DDE07U, 0x0U, 2);
-	new (toFill++) EmojiData(154, 22, 0xD83DDE08U, 0x0U, 2);
-	new (toFill++) EmojiData(110, 0, 0xD83DDE09U, 0x0U, 2);
-	new (toFill++) EmojiData(66, 0, 0xD83DDE0AU, 0x0U, 2);
-	new (toFill++) EmojiData(836, 0, 0xD83DDE0BU, 0x0U, 2);
-	new (toFill++) EmojiData(374, 0, 0xD83DDE0CU, 0x0U, 2);
-	new (toFill++) EmojiData(132, 0, 0xD83DDE0DU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 22, 0xD83DDE0EU, 0x0U, 2);
-	new (toFill++) EmojiData(352, 22, 0xD83DDE0FU, 0x0U, 2);
-	new (toFill++) EmojiData(242, 22, 0xD83DDE10U, 0x0U, 2);
-	new (toFill++) EmojiData(374, 22, 0xD83DDE11U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 0, 0xD83DDE12U, 0x0U, 2);
-	new (toFill++) EmojiData(616, 0, 0xD83DDE13U, 0x0U, 2);
-	new (toFill++) EmojiData(352, 0, 0xD83DDE14U, 0x0U, 2);
-	new (toFill++) EmojiData(264, 22, 0xD83DDE15U, 0x0U, 2);
-	new (toFill++) EmojiData(792, 0, 0xD83DDE16U, 0x0U, 2);
-	new (toFill++) EmojiData(198, 0, 0xD83DDE17U, 0x0U, 2);
-	new (toFill++) EmojiData(154, 0, 0xD83DDE18U, 0x0U, 2);
-	new (toFill++) EmojiData(220, 0, 0xD83DDE19U, 0x0U, 2);
-	new (toFill++) EmojiData(176, 0, 0xD83DDE1AU, 0x0U, 2);
-	new (toFill++) EmojiData(286, 0, 0xD83DDE1BU, 0x0U, 2);
-	new (toFill++) EmojiData(242, 0, 0xD83DDE1CU, 0x0U, 2);
-	new (toFill++) EmojiData(264, 0, 0xD83DDE1DU, 0x0U, 2);
-	new (toFill++) EmojiData(418, 0, 0xD83DDE1EU, 0x0U, 2);
-	new (toFill++) EmojiData(88, 22, 0xD83DDE1FU, 0x0U, 2);
-	new (toFill++) EmojiData(726, 0, 0xD83DDE20U, 0x0U, 2);
-	new (toFill++) EmojiData(748, 0, 0xD83DDE21U, 0x0U, 2);
-	new (toFill++) EmojiData(462, 0, 0xD83DDE22U, 0x0U, 2);
-	new (toFill++) EmojiData(440, 0, 0xD83DDE23U, 0x0U, 2);
-	new (toFill++) EmojiData(770, 0, 0xD83DDE24U, 0x0U, 2);
-	new (toFill++) EmojiData(550, 0, 0xD83DDE25U, 0x0U, 2);
-	new (toFill++) EmojiData(110, 22, 0xD83DDE26U, 0x0U, 2);
-	new (toFill++) EmojiData(132, 22, 0xD83DDE27U, 0x0U, 2);
-	new (toFill++) EmojiData(682, 0, 0xD83DDE28U, 0x0U, 2);
-	new (toFill++) EmojiData(638, 0, 0xD83DDE29U, 0x0U, 2);
-	new (toFill++) EmojiData(528, 0, 0xD83DDE2AU, 0x0U, 2);
-	new (toFill++) EmojiData(660, 0, 0xD83DDE2BU, 0x0U, 2);
-	new (toFill++) EmojiData(220, 22, 0xD83DDE2CU, 0x0U, 2);
-	new (toFill++) EmojiData(506, 0, 0xD83DDE2DU, 0x0U, 2);
-	new (toFill++) EmojiData(198, 22, 0xD83DDE2EU, 0x0U, 2);
-	new (toFill++) EmojiData(286, 22, 0xD83DDE2FU, 0x0U, 2);
-	new (toFill++) EmojiData(572, 0, 0xD83DDE30U, 0x0U, 2);
-	new (toFill++) EmojiData(704, 0, 0xD83DDE31U, 0x0U, 2);
-	new (toFill++) EmojiData(66, 22, 0xD83DDE32U, 0x0U, 2);
-	new (toFill++) EmojiData(308, 0, 0xD83DDE33U, 0x0U, 2);
-	new (toFill++) EmojiData(22, 22, 0xD83DDE34U, 0x0U, 2);
-	new (toFill++) EmojiData(44, 22, 0xD83DDE35U, 0x0U, 2);
-	new (toFill++) EmojiData(308, 22, 0xD83DDE36U, 0x0U, 2);
-	new (toFill++) EmojiData(858, 0, 0xD83DDE37U, 0x0U, 2);
-	new (toFill++) EmojiData(748, 22, 0xD83DDE38U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 44, 0xD83DDE39U, 0x0U, 2);
-	new (toFill++) EmojiData(726, 22, 0xD83DDE3AU, 0x0U, 2);
-	new (toFill++) EmojiData(770, 22, 0xD83DDE3BU, 0x0U, 2);
-	new (toFill++) EmojiData(814, 22, 0xD83DDE3CU, 0x0U, 2);
-	new (toFill++) EmojiData(792, 22, 0xD83DDE3DU, 0x0U, 2);
-	new (toFill++) EmojiData(22, 44, 0xD83DDE3EU, 0x0U, 2);
-	new (toFill++) EmojiData(858, 22, 0xD83DDE3FU, 0x0U, 2);
-	new (toFill++) EmojiData(836, 22, 0xD83DDE40U, 0x0U, 2);
-	new (toFill++) EmojiData(308, 66, 0xD83DDE45U, 0x0U, 2);
-	new (toFill++) EmojiData(286, 66, 0xD83DDE46U, 0x0U, 2);
-	new (toFill++) EmojiData(506, 66, 0xD83DDE47U, 0x0U, 2);
-	new (toFill++) EmojiData(88, 44, 0xD83DDE48U, 0x0U, 2);
-	new (toFill++) EmojiData(110, 44, 0xD83DDE49U, 0x0U, 2);
-	new (toFill++) EmojiData(132, 44, 0xD83DDE4AU, 0x0U, 2);
-	new (toFill++) EmojiData(352, 66, 0xD83DDE4BU, 0x0U, 2);
-	new (toFill++) EmojiData(836, 44, 0xD83DDE4CU, 0x0U, 2);
-	new (toFill++) EmojiData(484, 66, 0xD83DDE4DU, 0x0U, 2);
-	new (toFill++) EmojiData(462, 66, 0xD83DDE4EU, 0x0U, 2);
-	new (toFill++) EmojiData(858, 44, 0xD83DDE4FU, 0x0U, 2);
-	new (toFill++) EmojiData(264, 308, 0xD83DDE80U, 0x0U, 2);
-	new (toFill++) EmojiData(330, 308, 0xD83DDE81U, 0x0U, 2);
-	new (toFill++) EmojiData(352, 308, 0xD83DDE82U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 308, 0xD83DDE83U, 0x0U, 2);
-	new (toFill++) EmojiData(462, 308, 0xD83DDE84U, 0x0U, 2);
-	new (toFill++) EmojiData(484, 308, 0xD83DDE85U, 0x0U, 2);
-	new (toFill++) EmojiData(440, 308, 0xD83DDE86U, 0x0U, 2);
-	new (toFill++) EmojiData(528, 308, 0xD83DDE87U, 0x0U, 2);
-	new (toFill++) EmojiData(506, 308, 0xD83DDE88U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 308, 0xD83DDE89U, 0x0U, 2);
-	new (toFill++) EmojiData(374, 308, 0xD83DDE8AU, 0x0U, 2);
-	new (toFill++) EmojiData(572, 308, 0xD83DDE8BU, 0x0U, 2);
-	new (toFill++) EmojiData(638, 308, 0xD83DDE8CU, 0x0U, 2);
-	new (toFill++) EmojiData(660, 308, 0xD83DDE8DU, 0x0U, 2);
-	new (toFill++) EmojiData(616, 308, 0xD83DDE8EU, 0x0U, 2);
-	new (toFill++) EmojiData(220, 330, 0xD83DDE8FU, 0x0U, 2);
-	new (toFill++) EmojiData(66, 330, 0xD83DDE90U, 0x0U, 2);
-	new (toFill++) EmojiData(44, 330, 0xD83DDE91U, 0x0U, 2);
-	new (toFill++) EmojiData(22, 330, 0xD83DDE92U, 0x0U, 2);
-	new (toFill++) EmojiData(858, 308, 0xD83DDE93U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 330, 0xD83DDE94U, 0x0U, 2);
-	new (toFill++) EmojiData(748, 308, 0xD83DDE95U, 0x0U, 2);
-	new (toFill++) EmojiData(770, 308, 0xD83DDE96U, 0x0U, 2);
-	new (toFill++) EmojiData(726, 308, 0xD83DDE97U, 0x0U, 2);
-	new (toFill++) EmojiData(704, 308, 0xD83DDE98U, 0x0U, 2);
-	new (toFill++) EmojiData(682, 308, 0xD83DDE99U, 0x0U, 2);
-	new (toFill++) EmojiData(814, 308, 0xD83DDE9AU, 0x0U, 2);
-	new (toFill++) EmojiData(792, 308, 0xD83DDE9BU, 0x0U, 2);
-	new (toFill++) EmojiData(176, 330, 0xD83DDE9CU, 0x0U, 2);
-	new (toFill++) EmojiData(550, 308, 0xD83DDE9DU, 0x0U, 2);
-	new (toFill++) EmojiData(418, 308, 0xD83DDE9EU, 0x0U, 2);
-	new (toFill++) EmojiData(132, 330, 0xD83DDE9FU, 0x0U, 2);
-	new (toFill++) EmojiData(154, 330, 0xD83DDEA0U, 0x0U, 2);
-	new (toFill++) EmojiData(110, 330, 0xD83DDEA1U, 0x0U, 2);
-	new (toFill++) EmojiData(154, 308, 0xD83DDEA2U, 0x0U, 2);
-	new (toFill++) EmojiData(220, 308, 0xD83DDEA3U, 0x0U, 2);
-	new (toFill++) EmojiData(198, 308, 0xD83DDEA4U, 0x0U, 2);
-	new (toFill++) EmojiData(286, 330, 0xD83DDEA5U, 0x0U, 2);
-	new (toFill++) EmojiData(264, 330, 0xD83DDEA6U, 0x0U, 2);
-	new (toFill++) EmojiData(330, 330, 0xD83DDEA7U, 0x0U, 2);
-	new (toFill++) EmojiData(836, 308, 0xD83DDEA8U, 0x0U, 2);
-	new (toFill++) EmojiData(550, 330, 0xD83DDEA9U, 0x0U, 2);
-	new (toFill++) EmojiData(330, 198, 0xD83DDEAAU, 0x0U, 2);
-	new (toFill++) EmojiData(66, 396, 0xD83DDEABU, 0x0U, 2);
-	new (toFill++) EmojiData(352, 198, 0xD83DDEACU, 0x0U, 2);
-	new (toFill++) EmojiData(616, 374, 0xD83DDEADU, 0x0U, 2);
-	new (toFill++) EmojiData(550, 374, 0xD83DDEAEU, 0x0U, 2);
-	new (toFill++) EmojiData(132, 396, 0xD83DDEAFU, 0x0U, 2);
-	new (toFill++) EmojiData(528, 374, 0xD83DDEB0U, 0x0U, 2);
-	new (toFill++) EmojiData(154, 396, 0xD83DDEB1U, 0x0U, 2);
-	new (toFill++) EmojiData(88, 330, 0xD83DDEB2U, 0x0U, 2);
-	new (toFill++) EmojiData(176, 396, 0xD83DDEB3U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 242, 0xD83DDEB4U, 0x0U, 2);
-	new (toFill++) EmojiData(572, 242, 0xD83DDEB5U, 0x0U, 2);
-	new (toFill++) EmojiData(66, 66, 0xD83DDEB6U, 0x0U, 2);
-	new (toFill++) EmojiData(198, 396, 0xD83DDEB7U, 0x0U, 2);
-	new (toFill++) EmojiData(220, 396, 0xD83DDEB8U, 0x0U, 2);
-	new (toFill++) EmojiData(440, 374, 0xD83DDEB9U, 0x0U, 2);
-	new (toFill++) EmojiData(462, 374, 0xD83DDEBAU, 0x0U, 2);
-	new (toFill++) EmojiData(418, 374, 0xD83DDEBBU, 0x0U, 2);
-	new (toFill++) EmojiData(484, 374, 0xD83DDEBCU, 0x0U, 2);
-	new (toFill++) EmojiData(242, 198, 0xD83DDEBDU, 0x0U, 2);
-	new (toFill++) EmojiData(506, 374, 0xD83DDEBEU, 0x0U, 2);
-	new (toFill++) EmojiData(220, 198, 0xD83DDEBFU, 0x0U, 2);
-	new (toFill++) EmojiData(198, 198, 0xD83DDEC0U, 0x0U, 2);
-	new (toFill++) EmojiData(176, 198, 0xD83DDEC1U, 0x0U, 2);
-	new (toFill++) EmojiData(726, 374, 0xD83DDEC2U, 0x0U, 2);
-	new (toFill++) EmojiData(792, 374, 0xD83DDEC3U, 0x0U, 2);
-	new (toFill++) EmojiData(748, 374, 0xD83DDEC4U, 0x0U, 2);
-	new (toFill++) EmojiData(770, 374, 0xD83DDEC5U, 0x0U, 2);
+	new (toFill++) EmojiData(220, 66, 4, 0xA9U, 0x0U, 1);
+	new (toFill++) EmojiData(242, 66, 4, 0xAEU, 0x0U, 1);
+	new (toFill++) EmojiData(308, 66, 4, 0x203CU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(330, 66, 4, 0x2049U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(264, 66, 4, 0x2122U, 0x0U, 1);
+	new (toFill++) EmojiData(748, 0, 4, 0x2139U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(550, 0, 4, 0x2194U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(572, 0, 4, 0x2195U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(484, 0, 4, 0x2196U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(462, 0, 4, 0x2197U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(506, 0, 4, 0x2198U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(528, 0, 4, 0x2199U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(704, 0, 4, 0x21A9U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(726, 0, 4, 0x21AAU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(198, 22, 2, 0x231AU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(154, 22, 2, 0x231BU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(792, 0, 4, 0x23E9U, 0x0U, 1);
+	new (toFill++) EmojiData(770, 0, 4, 0x23EAU, 0x0U, 1);
+	new (toFill++) EmojiData(814, 0, 4, 0x23EBU, 0x0U, 1);
+	new (toFill++) EmojiData(836, 0, 4, 0x23ECU, 0x0U, 1);
+	new (toFill++) EmojiData(176, 22, 2, 0x23F0U, 0x0U, 1);
+	new (toFill++) EmojiData(132, 22, 2, 0x23F3U, 0x0U, 1);
+	new (toFill++) EmojiData(792, 22, 4, 0x24C2U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(726, 88, 4, 0x25AAU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(748, 88, 4, 0x25ABU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(638, 0, 4, 0x25B6U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(616, 0, 4, 0x25C0U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(660, 88, 4, 0x25FBU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(638, 88, 4, 0x25FCU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(704, 88, 4, 0x25FDU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(682, 88, 4, 0x25FEU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(550, 44, 1, 0x2600U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(594, 44, 1, 0x2601U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(682, 0, 2, 0x260EU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(484, 88, 4, 0x2611U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(638, 44, 1, 0x2614U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(242, 88, 2, 0x2615U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(0, 66, 0, 0x261DU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(88, 0, 0, 0x263AU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(704, 44, 4, 0x2648U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(726, 44, 4, 0x2649U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(748, 44, 4, 0x264AU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(770, 44, 4, 0x264BU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(792, 44, 4, 0x264CU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(814, 44, 4, 0x264DU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(836, 44, 4, 0x264EU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(858, 44, 4, 0x264FU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(0, 66, 4, 0x2650U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(22, 66, 4, 0x2651U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(44, 66, 4, 0x2652U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(66, 66, 4, 0x2653U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(330, 88, 4, 0x2660U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(374, 88, 4, 0x2663U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(352, 88, 4, 0x2665U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(396, 88, 4, 0x2666U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(110, 44, 3, 0x2668U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(682, 44, 4, 0x267BU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(682, 22, 4, 0x267FU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(792, 0, 3, 0x2693U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(858, 22, 3, 0x26A0U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(616, 44, 1, 0x26A1U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(858, 88, 4, 0x26AAU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(836, 88, 4, 0x26ABU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(748, 66, 2, 0x26BDU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(770, 66, 2, 0x26BEU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(682, 44, 1, 0x26C4U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(572, 44, 1, 0x26C5U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(88, 66, 4, 0x26CEU, 0x0U, 1);
+	new (toFill++) EmojiData(330, 44, 4, 0x26D4U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(242, 0, 3, 0x26EAU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(660, 0, 3, 0x26F2U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(0, 88, 2, 0x26F3U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(726, 0, 3, 0x26F5U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(396, 0, 3, 0x26FAU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(44, 44, 3, 0x26FDU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(704, 44, 2, 0x2702U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(418, 44, 4, 0x2705U, 0x0U, 1);
+	new (toFill++) EmojiData(836, 0, 3, 0x2708U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(176, 44, 2, 0x2709U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(638, 44, 0, 0x270AU, 0x0U, 1);
+	new (toFill++) EmojiData(704, 44, 0, 0x270BU, 0x0U, 1);
+	new (toFill++) EmojiData(660, 44, 0, 0x270CU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(792, 44, 2, 0x270FU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(770, 44, 2, 0x2712U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(462, 88, 4, 0x2714U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(242, 88, 4, 0x2716U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(242, 44, 0, 0x2728U, 0x0U, 1);
+	new (toFill++) EmojiData(352, 44, 4, 0x2733U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(440, 44, 4, 0x2734U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(660, 44, 1, 0x2744U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(374, 44, 4, 0x2747U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(286, 66, 4, 0x274CU, 0x0U, 1);
+	new (toFill++) EmojiData(396, 44, 4, 0x274EU, 0x0U, 1);
+	new (toFill++) EmojiData(374, 66, 4, 0x2753U, 0x0U, 1);
+	new (toFill++) EmojiData(418, 66, 4, 0x2754U, 0x0U, 1);
+	new (toFill++) EmojiData(396, 66, 4, 0x2755U, 0x0U, 1);
+	new (toFill++) EmojiData(352, 66, 4, 0x2757U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(264, 88, 0, 0x2764U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(264, 88, 4, 0x2795U, 0x0U, 1);
+	new (toFill++) EmojiData(286, 88, 4, 0x2796U, 0x0U, 1);
+	new (toFill++) EmojiData(308, 88, 4, 0x2797U, 0x0U, 1);
+	new (toFill++) EmojiData(374, 0, 4, 0x27A1U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(550, 88, 4, 0x27B0U, 0x0U, 1);
+	new (toFill++) EmojiData(660, 44, 4, 0x27BFU, 0x0U, 1);
+	new (toFill++) EmojiData(0, 22, 4, 0x2934U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(858, 0, 4, 0x2935U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(352, 0, 4, 0x2B05U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(308, 0, 4, 0x2B06U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(330, 0, 4, 0x2B07U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(88, 110, 4, 0x2B1BU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(66, 110, 4, 0x2B1CU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(528, 44, 1, 0x2B50U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(440, 66, 4, 0x2B55U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(572, 88, 4, 0x3030U, 0x0U, 1);
+	new (toFill++) EmojiData(594, 88, 4, 0x303DU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(66, 44, 4, 0x3297U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(44, 44, 4, 0x3299U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(264, 0, 4, 0x2320E3U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 0, 4, 0x3020E3U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 0, 4, 0x3120E3U, 0x0U, 2);
+	new (toFill++) EmojiData(22, 0, 4, 0x3220E3U, 0x0U, 2);
+	new (toFill++) EmojiData(44, 0, 4, 0x3320E3U, 0x0U, 2);
+	new (toFill++) EmojiData(66, 0, 4, 0x3420E3U, 0x0U, 2);
+	new (toFill++) EmojiData(88, 0, 4, 0x3520E3U, 0x0U, 2);
+	new (toFill++) EmojiData(110, 0, 4, 0x3620E3U, 0x0U, 2);
+	new (toFill++) EmojiData(132, 0, 4, 0x3720E3U, 0x0U, 2);
+	new (toFill++) EmojiData(154, 0, 4, 0x3820E3U, 0x0U, 2);
+	new (toFill++) EmojiData(176, 0, 4, 0x3920E3U, 0x0U, 2);
+	new (toFill++) EmojiData(638, 66, 2, 0xD83CDC04U, 0x0U, 2, 0xFE0F);
+	new (toFill++) EmojiData(594, 66, 2, 0xD83CDCCFU, 0x0U, 2);
+	new (toFill++) EmojiData(550, 44, 4, 0xD83CDD70U, 0x0U, 2);
+	new (toFill++) EmojiData(572, 44, 4, 0xD83CDD71U, 0x0U, 2);
+	new (toFill++) EmojiData(616, 44, 4, 0xD83CDD7EU, 0x0U, 2);
+	new (toFill++) EmojiData(660, 22, 4, 0xD83CDD7FU, 0x0U, 2, 0xFE0F);
+	new (toFill++) EmojiData(594, 44, 4, 0xD83CDD8EU, 0x0U, 2);
+	new (toFill++) EmojiData(88, 44, 4, 0xD83CDD91U, 0x0U, 2);
+	new (toFill++) EmojiData(154, 22, 4, 0xD83CDD92U, 0x0U, 2);
+	new (toFill++) EmojiData(176, 22, 4, 0xD83CDD93U, 0x0U, 2);
+	new (toFill++) EmojiData(132, 44, 4, 0xD83CDD94U, 0x0U, 2);
+	new (toFill++) EmojiData(110, 22, 4, 0xD83CDD95U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 22, 4, 0xD83CDD96U, 0x0U, 2);
+	new (toFill++) EmojiData(22, 22, 4, 0xD83CDD97U, 0x0U, 2);
+	new (toFill++) EmojiData(110, 44, 4, 0xD83CDD98U, 0x0U, 2);
+	new (toFill++) EmojiData(132, 22, 4, 0xD83CDD99U, 0x0U, 2);
+	new (toFill++) EmojiData(484, 44, 4, 0xD83CDD9AU, 0x0U, 2);
+	new (toFill++) EmojiData(308, 44, 3, 0xD83CDDE8U, 0xD83CDDF3U, 4);
+	new (toFill++) EmojiData(286, 44, 3, 0xD83CDDE9U, 0xD83CDDEAU, 4);
+	new (toFill++) EmojiData(374, 44, 3, 0xD83CDDEAU, 0xD83CDDF8U, 4);
+	new (toFill++) EmojiData(352, 44, 3, 0xD83CDDEBU, 0xD83CDDF7U, 4);
+	new (toFill++) EmojiData(440, 44, 3, 0xD83CDDECU, 0xD83CDDE7U, 4);
+	new (toFill++) EmojiData(396, 44, 3, 0xD83CDDEEU, 0xD83CDDF9U, 4);
+	new (toFill++) EmojiData(242, 44, 3, 0xD83CDDEFU, 0xD83CDDF5U, 4);
+	new (toFill++) EmojiData(264, 44, 3, 0xD83CDDF0U, 0xD83CDDF7U, 4);
+	new (toFill++) EmojiData(418, 44, 3, 0xD83CDDF7U, 0xD83CDDFAU, 4);
+	new (toFill++) EmojiData(330, 44, 3, 0xD83CDDFAU, 0xD83CDDF8U, 4);
+	new (toFill++) EmojiData(264, 22, 4, 0xD83CDE01U, 0x0U, 2);
+	new (toFill++) EmojiData(770, 22, 4, 0xD83CDE02U, 0x0U, 2);
+	new (toFill++) EmojiData(484, 22, 4, 0xD83CDE1AU, 0x0U, 2, 0xFE0F);
+	new (toFill++) EmojiData(286, 22, 4, 0xD83CDE2FU, 0x0U, 2, 0xFE0F);
+	new (toFill++) EmojiData(374, 22, 4, 0xD83CDE32U, 0x0U, 2);
+	new (toFill++) EmojiData(308, 22, 4, 0xD83CDE33U, 0x0U, 2);
+	new (toFill++) EmojiData(352, 22, 4, 0xD83CDE34U, 0x0U, 2);
+	new (toFill++) EmojiData(330, 22, 4, 0xD83CDE35U, 0x0U, 2);
+	new (toFill++) EmojiData(462, 22, 4, 0xD83CDE36U, 0x0U, 2);
+	new (toFill++) EmojiData(726, 22, 4, 0xD83CDE37U, 0x0U, 2);
+	new (toFill++) EmojiData(748, 22, 4, 0xD83CDE38U, 0x0U, 2);
+	new (toFill++) EmojiData(418, 22, 4, 0xD83CDE39U, 0x0U, 2);
+	new (toFill++) EmojiData(440, 22, 4, 0xD83CDE3AU, 0x0U, 2);
+	new (toFill++) EmojiData(396, 22, 4, 0xD83CDE50U, 0x0U, 2);
+	new (toFill++) EmojiData(22, 44, 4, 0xD83CDE51U, 0x0U, 2);
+	new (toFill++) EmojiData(704, 44, 1, 0xD83CDF00U, 0x0U, 2);
+	new (toFill++) EmojiData(726, 44, 1, 0xD83CDF01U, 0x0U, 2);
+	new (toFill++) EmojiData(132, 88, 0, 0xD83CDF02U, 0x0U, 2);
+	new (toFill++) EmojiData(550, 0, 3, 0xD83CDF03U, 0x0U, 2);
+	new (toFill++) EmojiData(506, 0, 3, 0xD83CDF04U, 0x0U, 2);
+	new (toFill++) EmojiData(528, 0, 3, 0xD83CDF05U, 0x0U, 2);
+	new (toFill++) EmojiData(330, 0, 3, 0xD83CDF06U, 0x0U, 2);
+	new (toFill++) EmojiData(308, 0, 3, 0xD83CDF07U, 0x0U, 2);
+	new (toFill++) EmojiData(748, 44, 1, 0xD83CDF08U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 0, 3, 0xD83CDF09U, 0x0U, 2);
+	new (toFill++) EmojiData(770, 44, 1, 0xD83CDF0AU, 0x0U, 2);
+	new (toFill++) EmojiData(462, 44, 1, 0xD83CDF0BU, 0x0U, 2);
+	new (toFill++) EmojiData(484, 44, 1, 0xD83CDF0CU, 0x0U, 2);
+	new (toFill++) EmojiData(396, 44, 1, 0xD83CDF0DU, 0x0U, 2);
+	new (toFill++) EmojiData(418, 44, 1, 0xD83CDF0EU, 0x0U, 2);
+	new (toFill++) EmojiData(440, 44, 1, 0xD83CDF0FU, 0x0U, 2);
+	new (toFill++) EmojiData(66, 44, 1, 0xD83CDF10U, 0x0U, 2);
+	new (toFill++) EmojiData(154, 44, 1, 0xD83CDF11U, 0x0U, 2);
+	new (toFill++) EmojiData(176, 44, 1, 0xD83CDF12U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 44, 1, 0xD83CDF13U, 0x0U, 2);
+	new (toFill++) EmojiData(220, 44, 1, 0xD83CDF14U, 0x0U, 2);
+	new (toFill++) EmojiData(242, 44, 1, 0xD83CDF15U, 0x0U, 2);
+	new (toFill++) EmojiData(264, 44, 1, 0xD83CDF16U, 0x0U, 2);
+	new (toFill++) EmojiData(286, 44, 1, 0xD83CDF17U, 0x0U, 2);
+	new (toFill++) EmojiData(308, 44, 1, 0xD83CDF18U, 0x0U, 2);
+	new (toFill++) EmojiData(374, 44, 1, 0xD83CDF19U, 0x0U, 2);
+	new (toFill++) EmojiData(132, 44, 1, 0xD83CDF1AU, 0x0U, 2);
+	new (toFill++) EmojiData(352, 44, 1, 0xD83CDF1BU, 0x0U, 2);
+	new (toFill++) EmojiData(330, 44, 1, 0xD83CDF1CU, 0x0U, 2);
+	new (toFill++) EmojiData(110, 44, 1, 0xD83CDF1DU, 0x0U, 2);
+	new (toFill++) EmojiData(88, 44, 1, 0xD83CDF1EU, 0x0U, 2);
+	new (toFill++) EmojiData(264, 44, 0, 0xD83CDF1FU, 0x0U, 2);
+	new (toFill++) EmojiData(506, 44, 1, 0xD83CDF20U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 44, 1, 0xD83CDF30U, 0x0U, 2);
+	new (toFill++) EmojiData(22, 44, 1, 0xD83CDF31U, 0x0U, 2);
+	new (toFill++) EmojiData(836, 22, 1, 0xD83CDF32U, 0x0U, 2);
+	new (toFill++) EmojiData(858, 22, 1, 0xD83CDF33U, 0x0U, 2);
+	new (toFill++) EmojiData(814, 22, 1, 0xD83CDF34U, 0x0U, 2);
+	new (toFill++) EmojiData(792, 22, 1, 0xD83CDF35U, 0x0U, 2);
+	new (toFill++) EmojiData(550, 22, 1, 0xD83CDF37U, 0x0U, 2);
+	new (toFill++) EmojiData(528, 22, 1, 0xD83CDF38U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 22, 1, 0xD83CDF39U, 0x0U, 2);
+	new (toFill++) EmojiData(638, 22, 1, 0xD83CDF3AU, 0x0U, 2);
+	new (toFill++) EmojiData(616, 22, 1, 0xD83CDF3BU, 0x0U, 2);
+	new (toFill++) EmojiData(44, 44, 1, 0xD83CDF3CU, 0x0U, 2);
+	new (toFill++) EmojiData(638, 110, 2, 0xD83CDF3DU, 0x0U, 2);
+	new (toFill++) EmojiData(748, 22, 1, 0xD83CDF3EU, 0x0U, 2);
+	new (toFill++) EmojiData(726, 22, 1, 0xD83CDF3FU, 0x0U, 2);
+	new (toFill++) EmojiData(572, 22, 1, 0xD83CDF40U, 0x0U, 2);
+	new (toFill++) EmojiData(660, 22, 1, 0xD83CDF41U, 0x0U, 2);
+	new (toFill++) EmojiData(704, 22, 1, 0xD83CDF42U, 0x0U, 2);
+	new (toFill++) EmojiData(682, 22, 1, 0xD83CDF43U, 0x0U, 2);
+	new (toFill++) EmojiData(770, 22, 1, 0xD83CDF44U, 0x0U, 2);
+	new (toFill++) EmojiData(616, 110, 2, 0xD83CDF45U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 110, 2, 0xD83CDF46U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 110, 2, 0xD83CDF47U, 0x0U, 2);
+	new (toFill++) EmojiData(484, 110, 2, 0xD83CDF48U, 0x0U, 2);
+	new (toFill++) EmojiData(418, 110, 2, 0xD83CDF49U, 0x0U, 2);
+	new (toFill++) EmojiData(330, 110, 2, 0xD83CDF4AU, 0x0U, 2);
+	new (toFill++) EmojiData(352, 110, 2, 0xD83CDF4BU, 0x0U, 2);
+	new (toFill++) EmojiData(506, 110, 2, 0xD83CDF4CU, 0x0U, 2);
+	new (toFill++) EmojiData(550, 110, 2, 0xD83CDF4DU, 0x0U, 2);
+	new (toFill++) EmojiData(286, 110, 2, 0xD83CDF4EU, 0x0U, 2);
+	new (toFill++) EmojiData(308, 110, 2, 0xD83CDF4FU, 0x0U, 2);
+	new (toFill++) EmojiData(528, 110, 2, 0xD83CDF50U, 0x0U, 2);
+	new (toFill++) EmojiData(462, 110, 2, 0xD83CDF51U, 0x0U, 2);
+	new (toFill++) EmojiData(374, 110, 2, 0xD83CDF52U, 0x0U, 2);
+	new (toFill++) EmojiData(440, 110, 2, 0xD83CDF53U, 0x0U, 2);
+	new (toFill++) EmojiData(484, 88, 2, 0xD83CDF54U, 0x0U, 2);
+	new (toFill++) EmojiData(462, 88, 2, 0xD83CDF55U, 0x0U, 2);
+	new (toFill++) EmojiData(550, 88, 2, 0xD83CDF56U, 0x0U, 2);
+	new (toFill++) EmojiData(528, 88, 2, 0xD83CDF57U, 0x0U, 2);
+	new (toFill++) EmojiData(726, 88, 2, 0xD83CDF58U, 0x0U, 2);
+	new (toFill++) EmojiData(704, 88, 2, 0xD83CDF59U, 0x0U, 2);
+	new (toFill++) EmojiData(748, 88, 2, 0xD83CDF5AU, 0x0U, 2);
+	new (toFill++) EmojiData(594, 88, 2, 0xD83CDF5BU, 0x0U, 2);
+	new (toFill++) EmojiData(770, 88, 2, 0xD83CDF5CU, 0x0U, 2);
+	new (toFill++) EmojiData(572, 88, 2, 0xD83CDF5DU, 0x0U, 2);
+	new (toFill++) EmojiData(0, 110, 2, 0xD83CDF5EU, 0x0U, 2);
+	new (toFill++) EmojiData(506, 88, 2, 0xD83CDF5FU, 0x0U, 2);
+	new (toFill++) EmojiData(572, 110, 2, 0xD83CDF60U, 0x0U, 2);
+	new (toFill++) EmojiData(836, 88, 2, 0xD83CDF61U, 0x0U, 2);
+	new (toFill++) EmojiData(814, 88, 2, 0xD83CDF62U, 0x0U, 2);
+	new (toFill++) EmojiData(660, 88, 2, 0xD83CDF63U, 0x0U, 2);
+	new (toFill++) EmojiData(616, 88, 2, 0xD83CDF64U, 0x0U, 2);
+	new (toFill++) EmojiData(682, 88, 2, 0xD83CDF65U, 0x0U, 2);
+	new (toFill++) EmojiData(66, 110, 2, 0xD83CDF66U, 0x0U, 2);
+	new (toFill++) EmojiData(110, 110, 2, 0xD83CDF67U, 0x0U, 2);
+	new (toFill++) EmojiData(88, 110, 2, 0xD83CDF68U, 0x0U, 2);
+	new (toFill++) EmojiData(22, 110, 2, 0xD83CDF69U, 0x0U, 2);
+	new (toFill++) EmojiData(176, 110, 2, 0xD83CDF6AU, 0x0U, 2);
+	new (toFill++) EmojiData(198, 110, 2, 0xD83CDF6BU, 0x0U, 2);
+	new (toFill++) EmojiData(220, 110, 2, 0xD83CDF6CU, 0x0U, 2);
+	new (toFill++) EmojiData(242, 110, 2, 0xD83CDF6DU, 0x0U, 2);
+	new (toFill++) EmojiData(44, 110, 2, 0xD83CDF6EU, 0x0U, 2);
+	new (toFill++) EmojiData(264, 110, 2, 0xD83CDF6FU, 0x0U, 2);
+	new (toFill++) EmojiData(154, 110, 2, 0xD83CDF70U, 0x0U, 2);
+	new (toFill++) EmojiData(638, 88, 2, 0xD83CDF71U, 0x0U, 2);
+	new (toFill++) EmojiData(792, 88, 2, 0xD83CDF72U, 0x0U, 2);
+	new (toFill++) EmojiData(858, 88, 2, 0xD83CDF73U, 0x0U, 2);
+	new (toFill++) EmojiData(440, 88, 2, 0xD83CDF74U, 0x0U, 2);
+	new (toFill++) EmojiData(264, 88, 2, 0xD83CDF75U, 0x0U, 2);
+	new (toFill++) EmojiData(286, 88, 2, 0xD83CDF76U, 0x0U, 2);
+	new (toFill++) EmojiData(418, 88, 2, 0xD83CDF77U, 0x0U, 2);
+	new (toFill++) EmojiData(374, 88, 2, 0xD83CDF78U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 88, 2, 0xD83CDF79U, 0x0U, 2);
+	new (toFill++) EmojiData(330, 88, 2, 0xD83CDF7AU, 0x0U, 2);
+	new (toFill++) EmojiData(352, 88, 2, 0xD83CDF7BU, 0x0U, 2);
+	new (toFill++) EmojiData(308, 88, 2, 0xD83CDF7CU, 0x0U, 2);
+	new (toFill++) EmojiData(110, 88, 0, 0xD83CDF80U, 0x0U, 2);
+	new (toFill++) EmojiData(308, 0, 2, 0xD83CDF81U, 0x0U, 2);
+	new (toFill++) EmojiData(132, 110, 2, 0xD83CDF82U, 0x0U, 2);
+	new (toFill++) EmojiData(220, 0, 2, 0xD83CDF83U, 0x0U, 2);
+	new (toFill++) EmojiData(286, 0, 2, 0xD83CDF84U, 0x0U, 2);
+	new (toFill++) EmojiData(264, 0, 2, 0xD83CDF85U, 0x0U, 2);
+	new (toFill++) EmojiData(132, 0, 2, 0xD83CDF86U, 0x0U, 2);
+	new (toFill++) EmojiData(154, 0, 2, 0xD83CDF87U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 0, 2, 0xD83CDF88U, 0x0U, 2);
+	new (toFill++) EmojiData(352, 0, 2, 0xD83CDF89U, 0x0U, 2);
+	new (toFill++) EmojiData(374, 0, 2, 0xD83CDF8AU, 0x0U, 2);
+	new (toFill++) EmojiData(330, 0, 2, 0xD83CDF8BU, 0x0U, 2);
+	new (toFill++) EmojiData(418, 0, 2, 0xD83CDF8CU, 0x0U, 2);
+	new (toFill++) EmojiData(0, 0, 2, 0xD83CDF8DU, 0x0U, 2);
+	new (toFill++) EmojiData(44, 0, 2, 0xD83CDF8EU, 0x0U, 2);
+	new (toFill++) EmojiData(110, 0, 2, 0xD83CDF8FU, 0x0U, 2);
+	new (toFill++) EmojiData(176, 0, 2, 0xD83CDF90U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 0, 2, 0xD83CDF91U, 0x0U, 2);
+	new (toFill++) EmojiData(66, 0, 2, 0xD83CDF92U, 0x0U, 2);
+	new (toFill++) EmojiData(88, 0, 2, 0xD83CDF93U, 0x0U, 2);
+	new (toFill++) EmojiData(616, 0, 3, 0xD83CDFA0U, 0x0U, 2);
+	new (toFill++) EmojiData(638, 0, 3, 0xD83CDFA1U, 0x0U, 2);
+	new (toFill++) EmojiData(682, 0, 3, 0xD83CDFA2U, 0x0U, 2);
+	new (toFill++) EmojiData(220, 88, 2, 0xD83CDFA3U, 0x0U, 2);
+	new (toFill++) EmojiData(330, 66, 2, 0xD83CDFA4U, 0x0U, 2);
+	new (toFill++) EmojiData(462, 0, 2, 0xD83CDFA5U, 0x0U, 2);
+	new (toFill++) EmojiData(242, 22, 4, 0xD83CDFA6U, 0x0U, 2);
+	new (toFill++) EmojiData(352, 66, 2, 0xD83CDFA7U, 0x0U, 2);
+	new (toFill++) EmojiData(286, 66, 2, 0xD83CDFA8U, 0x0U, 2);
+	new (toFill++) EmojiData(528, 66, 0, 0xD83CDFA9U, 0x0U, 2);
+	new (toFill++) EmojiData(154, 44, 3, 0xD83CDFAAU, 0x0U, 2);
+	new (toFill++) EmojiData(792, 22, 3, 0xD83CDFABU, 0x0U, 2);
+	new (toFill++) EmojiData(308, 66, 2, 0xD83CDFACU, 0x0U, 2);
+	new (toFill++) EmojiData(176, 44, 3, 0xD83CDFADU, 0x0U, 2);
+	new (toFill++) EmojiData(572, 66, 2, 0xD83CDFAEU, 0x0U, 2);
+	new (toFill++) EmojiData(682, 66, 2, 0xD83CDFAFU, 0x0U, 2);
+	new (toFill++) EmojiData(88, 44, 3, 0xD83CDFB0U, 0x0U, 2);
+	new (toFill++) EmojiData(814, 66, 2, 0xD83CDFB1U, 0x0U, 2);
+	new (toFill++) EmojiData(660, 66, 2, 0xD83CDFB2U, 0x0U, 2);
+	new (toFill++) EmojiData(858, 66, 2, 0xD83CDFB3U, 0x0U, 2);
+	new (toFill++) EmojiData(616, 66, 2, 0xD83CDFB4U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 66, 2, 0xD83CDFB5U, 0x0U, 2);
+	new (toFill++) EmojiData(418, 66, 2, 0xD83CDFB6U, 0x0U, 2);
+	new (toFill++) EmojiData(506, 66, 2, 0xD83CDFB7U, 0x0U, 2);
+	new (toFill++) EmojiData(528, 66, 2, 0xD83CDFB8U, 0x0U, 2);
+	new (toFill++) EmojiData(440, 66, 2, 0xD83CDFB9U, 0x0U, 2);
+	new (toFill++) EmojiData(484, 66, 2, 0xD83CDFBAU, 0x0U, 2);
+	new (toFill++) EmojiData(462, 66, 2, 0xD83CDFBBU, 0x0U, 2);
+	new (toFill++) EmojiData(374, 66, 2, 0xD83CDFBCU, 0x0U, 2);
+	new (toFill++) EmojiData(792, 66, 0, 0xD83CDFBDU, 0x0U, 2);
+	new (toFill++) EmojiData(792, 66, 2, 0xD83CDFBEU, 0x0U, 2);
+	new (toFill++) EmojiData(132, 88, 2, 0xD83CDFBFU, 0x0U, 2);
+	new (toFill++) EmojiData(726, 66, 2, 0xD83CDFC0U, 0x0U, 2);
+	new (toFill++) EmojiData(66, 88, 2, 0xD83CDFC1U, 0x0U, 2);
+	new (toFill++) EmojiData(154, 88, 2, 0xD83CDFC2U, 0x0U, 2);
+	new (toFill++) EmojiData(88, 66, 0, 0xD83CDFC3U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 88, 2, 0xD83CDFC4U, 0x0U, 2);
+	new (toFill++) EmojiData(110, 88, 2, 0xD83CDFC6U, 0x0U, 2);
+	new (toFill++) EmojiData(88, 88, 2, 0xD83CDFC7U, 0x0U, 2);
+	new (toFill++) EmojiData(704, 66, 2, 0xD83CDFC8U, 0x0U, 2);
+	new (toFill++) EmojiData(836, 66, 2, 0xD83CDFC9U, 0x0U, 2);
+	new (toFill++) EmojiData(176, 88, 2, 0xD83CDFCAU, 0x0U, 2);
+	new (toFill++) EmojiData(0, 0, 3, 0xD83CDFE0U, 0x0U, 2);
+	new (toFill++) EmojiData(22, 0, 3, 0xD83CDFE1U, 0x0U, 2);
+	new (toFill++) EmojiData(66, 0, 3, 0xD83CDFE2U, 0x0U, 2);
+	new (toFill++) EmojiData(88, 0, 3, 0xD83CDFE3U, 0x0U, 2);
+	new (toFill++) EmojiData(286, 0, 3, 0xD83CDFE4U, 0x0U, 2);
+	new (toFill++) EmojiData(110, 0, 3, 0xD83CDFE5U, 0x0U, 2);
+	new (toFill++) EmojiData(132, 0, 3, 0xD83CDFE6U, 0x0U, 2);
+	new (toFill++) EmojiData(132, 66, 4, 0xD83CDFE7U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 0, 3, 0xD83CDFE8U, 0x0U, 2);
+	new (toFill++) EmojiData(176, 0, 3, 0xD83CDFE9U, 0x0U, 2);
+	new (toFill++) EmojiData(154, 0, 3, 0xD83CDFEAU, 0x0U, 2);
+	new (toFill++) EmojiData(44, 0, 3, 0xD83CDFEBU, 0x0U, 2);
+	new (toFill++) EmojiData(264, 0, 3, 0xD83CDFECU, 0x0U, 2);
+	new (toFill++) EmojiData(418, 0, 3, 0xD83CDFEDU, 0x0U, 2);
+	new (toFill++) EmojiData(66, 44, 3, 0xD83CDFEEU, 0x0U, 2);
+	new (toFill++) EmojiData(352, 0, 3, 0xD83CDFEFU, 0x0U, 2);
+	new (toFill++) EmojiData(374, 0, 3, 0xD83CDFF0U, 0x0U, 2);
+	new (toFill++) EmojiData(44, 22, 1, 0xD83DDC00U, 0x0U, 2);
+	new (toFill++) EmojiData(264, 22, 1, 0xD83DDC01U, 0x0U, 2);
+	new (toFill++) EmojiData(286, 22, 1, 0xD83DDC02U, 0x0U, 2);
+	new (toFill++) EmojiData(66, 22, 1, 0xD83DDC03U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 22, 1, 0xD83DDC04U, 0x0U, 2);
+	new (toFill++) EmojiData(88, 22, 1, 0xD83DDC05U, 0x0U, 2);
+	new (toFill++) EmojiData(418, 22, 1, 0xD83DDC06U, 0x0U, 2);
+	new (toFill++) EmojiData(110, 22, 1, 0xD83DDC07U, 0x0U, 2);
+	new (toFill++) EmojiData(440, 22, 1, 0xD83DDC08U, 0x0U, 2);
+	new (toFill++) EmojiData(132, 22, 1, 0xD83DDC09U, 0x0U, 2);
+	new (toFill++) EmojiData(352, 22, 1, 0xD83DDC0AU, 0x0U, 2);
+	new (toFill++) EmojiData(858, 0, 1, 0xD83DDC0BU, 0x0U, 2);
+	new (toFill++) EmojiData(704, 0, 1, 0xD83DDC0CU, 0x0U, 2);
+	new (toFill++) EmojiData(572, 0, 1, 0xD83DDC0DU, 0x0U, 2);
+	new (toFill++) EmojiData(154, 22, 1, 0xD83DDC0EU, 0x0U, 2);
+	new (toFill++) EmojiData(22, 22, 1, 0xD83DDC0FU, 0x0U, 2);
+	new (toFill++) EmojiData(176, 22, 1, 0xD83DDC10U, 0x0U, 2);
+	new (toFill++) EmojiData(374, 0, 1, 0xD83DDC11U, 0x0U, 2);
+	new (toFill++) EmojiData(330, 0, 1, 0xD83DDC12U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 22, 1, 0xD83DDC13U, 0x0U, 2);
+	new (toFill++) EmojiData(550, 0, 1, 0xD83DDC14U, 0x0U, 2);
+	new (toFill++) EmojiData(220, 22, 1, 0xD83DDC15U, 0x0U, 2);
+	new (toFill++) EmojiData(242, 22, 1, 0xD83DDC16U, 0x0U, 2);
+	new (toFill++) EmojiData(286, 0, 1, 0xD83DDC17U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 0, 1, 0xD83DDC18U, 0x0U, 2);
+	new (toFill++) EmojiData(726, 0, 1, 0xD83DDC19U, 0x0U, 2);
+	new (toFill++) EmojiData(748, 0, 1, 0xD83DDC1AU, 0x0U, 2);
+	new (toFill++) EmojiData(616, 0, 1, 0xD83DDC1BU, 0x0U, 2);
+	new (toFill++) EmojiData(660, 0, 1, 0xD83DDC1CU, 0x0U, 2);
+	new (toFill++) EmojiData(638, 0, 1, 0xD83DDC1DU, 0x0U, 2);
+	new (toFill++) EmojiData(682, 0, 1, 0xD83DDC1EU, 0x0U, 2);
+	new (toFill++) EmojiData(792, 0, 1, 0xD83DDC1FU, 0x0U, 2);
+	new (toFill++) EmojiData(770, 0, 1, 0xD83DDC20U, 0x0U, 2);
+	new (toFill++) EmojiData(330, 22, 1, 0xD83DDC21U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 0, 1, 0xD83DDC22U, 0x0U, 2);
+	new (toFill++) EmojiData(528, 0, 1, 0xD83DDC23U, 0x0U, 2);
+	new (toFill++) EmojiData(484, 0, 1, 0xD83DDC24U, 0x0U, 2);
+	new (toFill++) EmojiData(506, 0, 1, 0xD83DDC25U, 0x0U, 2);
+	new (toFill++) EmojiData(462, 0, 1, 0xD83DDC26U, 0x0U, 2);
+	new (toFill++) EmojiData(440, 0, 1, 0xD83DDC27U, 0x0U, 2);
+	new (toFill++) EmojiData(176, 0, 1, 0xD83DDC28U, 0x0U, 2);
+	new (toFill++) EmojiData(462, 22, 1, 0xD83DDC29U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 22, 1, 0xD83DDC2AU, 0x0U, 2);
+	new (toFill++) EmojiData(374, 22, 1, 0xD83DDC2BU, 0x0U, 2);
+	new (toFill++) EmojiData(814, 0, 1, 0xD83DDC2CU, 0x0U, 2);
+	new (toFill++) EmojiData(66, 0, 1, 0xD83DDC2DU, 0x0U, 2);
+	new (toFill++) EmojiData(264, 0, 1, 0xD83DDC2EU, 0x0U, 2);
+	new (toFill++) EmojiData(154, 0, 1, 0xD83DDC2FU, 0x0U, 2);
+	new (toFill++) EmojiData(110, 0, 1, 0xD83DDC30U, 0x0U, 2);
+	new (toFill++) EmojiData(44, 0, 1, 0xD83DDC31U, 0x0U, 2);
+	new (toFill++) EmojiData(308, 22, 1, 0xD83DDC32U, 0x0U, 2);
+	new (toFill++) EmojiData(836, 0, 1, 0xD83DDC33U, 0x0U, 2);
+	new (toFill++) EmojiData(352, 0, 1, 0xD83DDC34U, 0x0U, 2);
+	new (toFill++) EmojiData(308, 0, 1, 0xD83DDC35U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 0, 1, 0xD83DDC36U, 0x0U, 2);
+	new (toFill++) EmojiData(220, 0, 1, 0xD83DDC37U, 0x0U, 2);
+	new (toFill++) EmojiData(132, 0, 1, 0xD83DDC38U, 0x0U, 2);
+	new (toFill++) EmojiData(88, 0, 1, 0xD83DDC39U, 0x0U, 2);
+	new (toFill++) EmojiData(22, 0, 1, 0xD83DDC3AU, 0x0U, 2);
+	new (toFill++) EmojiData(198, 0, 1, 0xD83DDC3BU, 0x0U, 2);
+	new (toFill++) EmojiData(418, 0, 1, 0xD83DDC3CU, 0x0U, 2);
+	new (toFill++) EmojiData(242, 0, 1, 0xD83DDC3DU, 0x0U, 2);
+	new (toFill++) EmojiData(484, 22, 1, 0xD83DDC3EU, 0x0U, 2);
+	new (toFill++) EmojiData(462, 44, 0, 0xD83DDC40U, 0x0U, 2);
+	new (toFill++) EmojiData(440, 44, 0, 0xD83DDC42U, 0x0U, 2);
+	new (toFill++) EmojiData(484, 44, 0, 0xD83DDC43U, 0x0U, 2);
+	new (toFill++) EmojiData(528, 44, 0, 0xD83DDC44U, 0x0U, 2);
+	new (toFill++) EmojiData(506, 44, 0, 0xD83DDC45U, 0x0U, 2);
+	new (toFill++) EmojiData(748, 44, 0, 0xD83DDC46U, 0x0U, 2);
+	new (toFill++) EmojiData(770, 44, 0, 0xD83DDC47U, 0x0U, 2);
+	new (toFill++) EmojiData(814, 44, 0, 0xD83DDC48U, 0x0U, 2);
+	new (toFill++) EmojiData(792, 44, 0, 0xD83DDC49U, 0x0U, 2);
+	new (toFill++) EmojiData(616, 44, 0, 0xD83DDC4AU, 0x0U, 2);
+	new (toFill++) EmojiData(682, 44, 0, 0xD83DDC4BU, 0x0U, 2);
+	new (toFill++) EmojiData(594, 44, 0, 0xD83DDC4CU, 0x0U, 2);
+	new (toFill++) EmojiData(550, 44, 0, 0xD83DDC4DU, 0x0U, 2);
+	new (toFill++) EmojiData(572, 44, 0, 0xD83DDC4EU, 0x0U, 2);
+	new (toFill++) EmojiData(22, 66, 0, 0xD83DDC4FU, 0x0U, 2);
+	new (toFill++) EmojiData(726, 44, 0, 0xD83DDC50U, 0x0U, 2);
+	new (toFill++) EmojiData(550, 66, 0, 0xD83DDC51U, 0x0U, 2);
+	new (toFill++) EmojiData(572, 66, 0, 0xD83DDC52U, 0x0U, 2);
+	new (toFill++) EmojiData(88, 88, 0, 0xD83DDC53U, 0x0U, 2);
+	new (toFill++) EmojiData(726, 66, 0, 0xD83DDC54U, 0x0U, 2);
+	new (toFill++) EmojiData(704, 66, 0, 0xD83DDC55U, 0x0U, 2);
+	new (toFill++) EmojiData(814, 66, 0, 0xD83DDC56U, 0x0U, 2);
+	new (toFill++) EmojiData(770, 66, 0, 0xD83DDC57U, 0x0U, 2);
+	new (toFill++) EmojiData(836, 66, 0, 0xD83DDC58U, 0x0U, 2);
+	new (toFill++) EmojiData(858, 66, 0, 0xD83DDC59U, 0x0U, 2);
+	new (toFill++) EmojiData(748, 66, 0, 0xD83DDC5AU, 0x0U, 2);
+	new (toFill++) EmojiData(66, 88, 0, 0xD83DDC5BU, 0x0U, 2);
+	new (toFill++) EmojiData(22, 88, 0, 0xD83DDC5CU, 0x0U, 2);
+	new (toFill++) EmojiData(44, 88, 0, 0xD83DDC5DU, 0x0U, 2);
+	new (toFill++) EmojiData(616, 66, 0, 0xD83DDC5EU, 0x0U, 2);
+	new (toFill++) EmojiData(594, 66, 0, 0xD83DDC5FU, 0x0U, 2);
+	new (toFill++) EmojiData(660, 66, 0, 0xD83DDC60U, 0x0U, 2);
+	new (toFill++) EmojiData(638, 66, 0, 0xD83DDC61U, 0x0U, 2);
+	new (toFill++) EmojiData(682, 66, 0, 0xD83DDC62U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 88, 0, 0xD83DDC63U, 0x0U, 2);
+	new (toFill++) EmojiData(528, 88, 0, 0xD83DDC64U, 0x0U, 2);
+	new (toFill++) EmojiData(550, 88, 0, 0xD83DDC65U, 0x0U, 2);
+	new (toFill++) EmojiData(528, 22, 0, 0xD83DDC66U, 0x0U, 2);
+	new (toFill++) EmojiData(550, 22, 0, 0xD83DDC67U, 0x0U, 2);
+	new (toFill++) EmojiData(572, 22, 0, 0xD83DDC68U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 22, 0, 0xD83DDC69U, 0x0U, 2);
+	new (toFill++) EmojiData(154, 66, 0, 0xD83DDC6AU, 0x0U, 2);
+	new (toFill++) EmojiData(132, 66, 0, 0xD83DDC6BU, 0x0U, 2);
+	new (toFill++) EmojiData(176, 66, 0, 0xD83DDC6CU, 0x0U, 2);
+	new (toFill++) EmojiData(198, 66, 0, 0xD83DDC6DU, 0x0U, 2);
+	new (toFill++) EmojiData(440, 22, 0, 0xD83DDC6EU, 0x0U, 2);
+	new (toFill++) EmojiData(264, 66, 0, 0xD83DDC6FU, 0x0U, 2);
+	new (toFill++) EmojiData(440, 66, 0, 0xD83DDC70U, 0x0U, 2);
+	new (toFill++) EmojiData(660, 22, 0, 0xD83DDC71U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 22, 0, 0xD83DDC72U, 0x0U, 2);
+	new (toFill++) EmojiData(418, 22, 0, 0xD83DDC73U, 0x0U, 2);
+	new (toFill++) EmojiData(616, 22, 0, 0xD83DDC74U, 0x0U, 2);
+	new (toFill++) EmojiData(638, 22, 0, 0xD83DDC75U, 0x0U, 2);
+	new (toFill++) EmojiData(506, 22, 0, 0xD83DDC76U, 0x0U, 2);
+	new (toFill++) EmojiData(462, 22, 0, 0xD83DDC77U, 0x0U, 2);
+	new (toFill++) EmojiData(704, 22, 0, 0xD83DDC78U, 0x0U, 2);
+	new (toFill++) EmojiData(44, 44, 0, 0xD83DDC79U, 0x0U, 2);
+	new (toFill++) EmojiData(66, 44, 0, 0xD83DDC7AU, 0x0U, 2);
+	new (toFill++) EmojiData(242, 0, 2, 0xD83DDC7BU, 0x0U, 2);
+	new (toFill++) EmojiData(682, 22, 0, 0xD83DDC7CU, 0x0U, 2);
+	new (toFill++) EmojiData(176, 44, 0, 0xD83DDC7DU, 0x0U, 2);
+	new (toFill++) EmojiData(550, 66, 2, 0xD83DDC7EU, 0x0U, 2);
+	new (toFill++) EmojiData(176, 22, 0, 0xD83DDC7FU, 0x0U, 2);
+	new (toFill++) EmojiData(154, 44, 0, 0xD83DDC80U, 0x0U, 2);
+	new (toFill++) EmojiData(330, 66, 0, 0xD83DDC81U, 0x0U, 2);
+	new (toFill++) EmojiData(484, 22, 0, 0xD83DDC82U, 0x0U, 2);
+	new (toFill++) EmojiData(110, 66, 0, 0xD83DDC83U, 0x0U, 2);
+	new (toFill++) EmojiData(154, 88, 0, 0xD83DDC84U, 0x0U, 2);
+	new (toFill++) EmojiData(418, 66, 0, 0xD83DDC85U, 0x0U, 2);
+	new (toFill++) EmojiData(374, 66, 0, 0xD83DDC86U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 66, 0, 0xD83DDC87U, 0x0U, 2);
+	new (toFill++) EmojiData(748, 22, 3, 0xD83DDC88U, 0x0U, 2);
+	new (toFill++) EmojiData(792, 22, 2, 0xD83DDC89U, 0x0U, 2);
+	new (toFill++) EmojiData(770, 22, 2, 0xD83DDC8AU, 0x0U, 2);
+	new (toFill++) EmojiData(462, 88, 0, 0xD83DDC8BU, 0x0U, 2);
+	new (toFill++) EmojiData(440, 88, 0, 0xD83DDC8CU, 0x0U, 2);
+	new (toFill++) EmojiData(484, 88, 0, 0xD83DDC8DU, 0x0U, 2);
+	new (toFill++) EmojiData(506, 88, 0, 0xD83DDC8EU, 0x0U, 2);
+	new (toFill++) EmojiData(220, 66, 0, 0xD83DDC8FU, 0x0U, 2);
+	new (toFill++) EmojiData(506, 22, 1, 0xD83DDC90U, 0x0U, 2);
+	new (toFill++) EmojiData(242, 66, 0, 0xD83DDC91U, 0x0U, 2);
+	new (toFill++) EmojiData(220, 0, 3, 0xD83DDC92U, 0x0U, 2);
+	new (toFill++) EmojiData(330, 88, 0, 0xD83DDC93U, 0x0U, 2);
+	new (toFill++) EmojiData(286, 88, 0, 0xD83DDC94U, 0x0U, 2);
+	new (toFill++) EmojiData(352, 88, 0, 0xD83DDC95U, 0x0U, 2);
+	new (toFill++) EmojiData(374, 88, 0, 0xD83DDC96U, 0x0U, 2);
+	new (toFill++) EmojiData(308, 88, 0, 0xD83DDC97U, 0x0U, 2);
+	new (toFill++) EmojiData(418, 88, 0, 0xD83DDC98U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 88, 0, 0xD83DDC99U, 0x0U, 2);
+	new (toFill++) EmojiData(242, 88, 0, 0xD83DDC9AU, 0x0U, 2);
+	new (toFill++) EmojiData(176, 88, 0, 0xD83DDC9BU, 0x0U, 2);
+	new (toFill++) EmojiData(220, 88, 0, 0xD83DDC9CU, 0x0U, 2);
+	new (toFill++) EmojiData(22, 0, 2, 0xD83DDC9DU, 0x0U, 2);
+	new (toFill++) EmojiData(396, 88, 0, 0xD83DDC9EU, 0x0U, 2);
+	new (toFill++) EmojiData(462, 44, 4, 0xD83DDC9FU, 0x0U, 2);
+	new (toFill++) EmojiData(638, 44, 4, 0xD83DDCA0U, 0x0U, 2);
+	new (toFill++) EmojiData(352, 22, 2, 0xD83DDCA1U, 0x0U, 2);
+	new (toFill++) EmojiData(330, 44, 0, 0xD83DDCA2U, 0x0U, 2);
+	new (toFill++) EmojiData(704, 22, 2, 0xD83DDCA3U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 44, 0, 0xD83DDCA4U, 0x0U, 2);
+	new (toFill++) EmojiData(308, 44, 0, 0xD83DDCA5U, 0x0U, 2);
+	new (toFill++) EmojiData(352, 44, 0, 0xD83DDCA6U, 0x0U, 2);
+	new (toFill++) EmojiData(374, 44, 0, 0xD83DDCA7U, 0x0U, 2);
+	new (toFill++) EmojiData(418, 44, 0, 0xD83DDCA8U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 44, 0, 0xD83DDCA9U, 0x0U, 2);
+	new (toFill++) EmojiData(44, 66, 0, 0xD83DDCAAU, 0x0U, 2);
+	new (toFill++) EmojiData(286, 44, 0, 0xD83DDCABU, 0x0U, 2);
+	new (toFill++) EmojiData(572, 88, 0, 0xD83DDCACU, 0x0U, 2);
+	new (toFill++) EmojiData(616, 88, 0, 0xD83DDCADU, 0x0U, 2);
+	new (toFill++) EmojiData(418, 88, 4, 0xD83DDCAEU, 0x0U, 2);
+	new (toFill++) EmojiData(440, 88, 4, 0xD83DDCAFU, 0x0U, 2);
+	new (toFill++) EmojiData(814, 22, 2, 0xD83DDCB0U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 66, 4, 0xD83DDCB1U, 0x0U, 2);
+	new (toFill++) EmojiData(176, 66, 4, 0xD83DDCB2U, 0x0U, 2);
+	new (toFill++) EmojiData(44, 44, 2, 0xD83DDCB3U, 0x0U, 2);
+	new (toFill++) EmojiData(836, 22, 2, 0xD83DDCB4U, 0x0U, 2);
+	new (toFill++) EmojiData(858, 22, 2, 0xD83DDCB5U, 0x0U, 2);
+	new (toFill++) EmojiData(22, 44, 2, 0xD83DDCB6U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 44, 2, 0xD83DDCB7U, 0x0U, 2);
+	new (toFill++) EmojiData(66, 44, 2, 0xD83DDCB8U, 0x0U, 2);
+	new (toFill++) EmojiData(154, 66, 4, 0xD83DDCB9U, 0x0U, 2);
+	new (toFill++) EmojiData(858, 0, 3, 0xD83DDCBAU, 0x0U, 2);
+	new (toFill++) EmojiData(638, 0, 2, 0xD83DDCBBU, 0x0U, 2);
+	new (toFill++) EmojiData(0, 88, 0, 0xD83DDCBCU, 0x0U, 2);
+	new (toFill++) EmojiData(594, 0, 2, 0xD83DDCBDU, 0x0U, 2);
+	new (toFill++) EmojiData(616, 0, 2, 0xD83DDCBEU, 0x0U, 2);
+	new (toFill++) EmojiData(550, 0, 2, 0xD83DDCBFU, 0x0U, 2);
+	new (toFill++) EmojiData(572, 0, 2, 0xD83DDCC0U, 0x0U, 2);
+	new (toFill++) EmojiData(660, 44, 2, 0xD83DDCC1U, 0x0U, 2);
+	new (toFill++) EmojiData(682, 44, 2, 0xD83DDCC2U, 0x0U, 2);
+	new (toFill++) EmojiData(440, 44, 2, 0xD83DDCC3U, 0x0U, 2);
+	new (toFill++) EmojiData(418, 44, 2, 0xD83DDCC4U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 44, 2, 0xD83DDCC5U, 0x0U, 2);
+	new (toFill++) EmojiData(616, 44, 2, 0xD83DDCC6U, 0x0U, 2);
+	new (toFill++) EmojiData(638, 44, 2, 0xD83DDCC7U, 0x0U, 2);
+	new (toFill++) EmojiData(506, 44, 2, 0xD83DDCC8U, 0x0U, 2);
+	new (toFill++) EmojiData(528, 44, 2, 0xD83DDCC9U, 0x0U, 2);
+	new (toFill++) EmojiData(484, 44, 2, 0xD83DDCCAU, 0x0U, 2);
+	new (toFill++) EmojiData(572, 44, 2, 0xD83DDCCBU, 0x0U, 2);
+	new (toFill++) EmojiData(726, 44, 2, 0xD83DDCCCU, 0x0U, 2);
+	new (toFill++) EmojiData(198, 44, 3, 0xD83DDCCDU, 0x0U, 2);
+	new (toFill++) EmojiData(748, 44, 2, 0xD83DDCCEU, 0x0U, 2);
+	new (toFill++) EmojiData(814, 44, 2, 0xD83DDCCFU, 0x0U, 2);
+	new (toFill++) EmojiData(836, 44, 2, 0xD83DDCD0U, 0x0U, 2);
+	new (toFill++) EmojiData(462, 44, 2, 0xD83DDCD1U, 0x0U, 2);
+	new (toFill++) EmojiData(110, 66, 2, 0xD83DDCD2U, 0x0U, 2);
+	new (toFill++) EmojiData(66, 66, 2, 0xD83DDCD3U, 0x0U, 2);
+	new (toFill++) EmojiData(88, 66, 2, 0xD83DDCD4U, 0x0U, 2);
+	new (toFill++) EmojiData(858, 44, 2, 0xD83DDCD5U, 0x0U, 2);
+	new (toFill++) EmojiData(154, 66, 2, 0xD83DDCD6U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 66, 2, 0xD83DDCD7U, 0x0U, 2);
+	new (toFill++) EmojiData(22, 66, 2, 0xD83DDCD8U, 0x0U, 2);
+	new (toFill++) EmojiData(44, 66, 2, 0xD83DDCD9U, 0x0U, 2);
+	new (toFill++) EmojiData(132, 66, 2, 0xD83DDCDAU, 0x0U, 2);
+	new (toFill++) EmojiData(198, 66, 2, 0xD83DDCDBU, 0x0U, 2);
+	new (toFill++) EmojiData(550, 44, 2, 0xD83DDCDCU, 0x0U, 2);
+	new (toFill++) EmojiData(396, 44, 2, 0xD83DDCDDU, 0x0U, 2);
+	new (toFill++) EmojiData(704, 0, 2, 0xD83DDCDEU, 0x0U, 2);
+	new (toFill++) EmojiData(726, 0, 2, 0xD83DDCDFU, 0x0U, 2);
+	new (toFill++) EmojiData(748, 0, 2, 0xD83DDCE0U, 0x0U, 2);
+	new (toFill++) EmojiData(770, 0, 2, 0xD83DDCE1U, 0x0U, 2);
+	new (toFill++) EmojiData(88, 22, 2, 0xD83DDCE2U, 0x0U, 2);
+	new (toFill++) EmojiData(110, 22, 2, 0xD83DDCE3U, 0x0U, 2);
+	new (toFill++) EmojiData(154, 44, 2, 0xD83DDCE4U, 0x0U, 2);
+	new (toFill++) EmojiData(132, 44, 2, 0xD83DDCE5U, 0x0U, 2);
+	new (toFill++) EmojiData(374, 44, 2, 0xD83DDCE6U, 0x0U, 2);
+	new (toFill++) EmojiData(110, 44, 2, 0xD83DDCE7U, 0x0U, 2);
+	new (toFill++) EmojiData(220, 44, 2, 0xD83DDCE8U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 44, 2, 0xD83DDCE9U, 0x0U, 2);
+	new (toFill++) EmojiData(286, 44, 2, 0xD83DDCEAU, 0x0U, 2);
+	new (toFill++) EmojiData(264, 44, 2, 0xD83DDCEBU, 0x0U, 2);
+	new (toFill++) EmojiData(308, 44, 2, 0xD83DDCECU, 0x0U, 2);
+	new (toFill++) EmojiData(330, 44, 2, 0xD83DDCEDU, 0x0U, 2);
+	new (toFill++) EmojiData(352, 44, 2, 0xD83DDCEEU, 0x0U, 2);
+	new (toFill++) EmojiData(242, 44, 2, 0xD83DDCEFU, 0x0U, 2);
+	new (toFill++) EmojiData(264, 66, 2, 0xD83DDCF0U, 0x0U, 2);
+	new (toFill++) EmojiData(660, 0, 2, 0xD83DDCF1U, 0x0U, 2);
+	new (toFill++) EmojiData(88, 44, 2, 0xD83DDCF2U, 0x0U, 2);
+	new (toFill++) EmojiData(506, 44, 4, 0xD83DDCF3U, 0x0U, 2);
+	new (toFill++) EmojiData(528, 44, 4, 0xD83DDCF4U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 44, 4, 0xD83DDCF5U, 0x0U, 2);
+	new (toFill++) EmojiData(220, 22, 4, 0xD83DDCF6U, 0x0U, 2);
+	new (toFill++) EmojiData(484, 0, 2, 0xD83DDCF7U, 0x0U, 2);
+	new (toFill++) EmojiData(506, 0, 2, 0xD83DDCF9U, 0x0U, 2);
+	new (toFill++) EmojiData(792, 0, 2, 0xD83DDCFAU, 0x0U, 2);
+	new (toFill++) EmojiData(814, 0, 2, 0xD83DDCFBU, 0x0U, 2);
+	new (toFill++) EmojiData(528, 0, 2, 0xD83DDCFCU, 0x0U, 2);
+	new (toFill++) EmojiData(44, 22, 4, 0xD83DDD00U, 0x0U, 2);
+	new (toFill++) EmojiData(66, 22, 4, 0xD83DDD01U, 0x0U, 2);
+	new (toFill++) EmojiData(88, 22, 4, 0xD83DDD02U, 0x0U, 2);
+	new (toFill++) EmojiData(572, 66, 4, 0xD83DDD03U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 0, 4, 0xD83DDD04U, 0x0U, 2);
+	new (toFill++) EmojiData(418, 22, 2, 0xD83DDD05U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 22, 2, 0xD83DDD06U, 0x0U, 2);
+	new (toFill++) EmojiData(22, 22, 2, 0xD83DDD07U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 22, 2, 0xD83DDD08U, 0x0U, 2);
+	new (toFill++) EmojiData(858, 0, 2, 0xD83DDD09U, 0x0U, 2);
+	new (toFill++) EmojiData(836, 0, 2, 0xD83DDD0AU, 0x0U, 2);
+	new (toFill++) EmojiData(462, 22, 2, 0xD83DDD0BU, 0x0U, 2);
+	new (toFill++) EmojiData(440, 22, 2, 0xD83DDD0CU, 0x0U, 2);
+	new (toFill++) EmojiData(484, 22, 2, 0xD83DDD0DU, 0x0U, 2);
+	new (toFill++) EmojiData(330, 22, 2, 0xD83DDD0EU, 0x0U, 2);
+	new (toFill++) EmojiData(264, 22, 2, 0xD83DDD0FU, 0x0U, 2);
+	new (toFill++) EmojiData(286, 22, 2, 0xD83DDD10U, 0x0U, 2);
+	new (toFill++) EmojiData(308, 22, 2, 0xD83DDD11U, 0x0U, 2);
+	new (toFill++) EmojiData(242, 22, 2, 0xD83DDD12U, 0x0U, 2);
+	new (toFill++) EmojiData(220, 22, 2, 0xD83DDD13U, 0x0U, 2);
+	new (toFill++) EmojiData(44, 22, 2, 0xD83DDD14U, 0x0U, 2);
+	new (toFill++) EmojiData(66, 22, 2, 0xD83DDD15U, 0x0U, 2);
+	new (toFill++) EmojiData(176, 66, 2, 0xD83DDD16U, 0x0U, 2);
+	new (toFill++) EmojiData(528, 88, 4, 0xD83DDD17U, 0x0U, 2);
+	new (toFill++) EmojiData(506, 88, 4, 0xD83DDD18U, 0x0U, 2);
+	new (toFill++) EmojiData(506, 66, 4, 0xD83DDD19U, 0x0U, 2);
+	new (toFill++) EmojiData(484, 66, 4, 0xD83DDD1AU, 0x0U, 2);
+	new (toFill++) EmojiData(528, 66, 4, 0xD83DDD1BU, 0x0U, 2);
+	new (toFill++) EmojiData(550, 66, 4, 0xD83DDD1CU, 0x0U, 2);
+	new (toFill++) EmojiData(462, 66, 4, 0xD83DDD1DU, 0x0U, 2);
+	new (toFill++) EmojiData(176, 44, 4, 0xD83DDD1EU, 0x0U, 2);
+	new (toFill++) EmojiData(220, 0, 4, 0xD83DDD1FU, 0x0U, 2);
+	new (toFill++) EmojiData(396, 0, 4, 0xD83DDD20U, 0x0U, 2);
+	new (toFill++) EmojiData(418, 0, 4, 0xD83DDD21U, 0x0U, 2);
+	new (toFill++) EmojiData(242, 0, 4, 0xD83DDD22U, 0x0U, 2);
+	new (toFill++) EmojiData(286, 0, 4, 0xD83DDD23U, 0x0U, 2);
+	new (toFill++) EmojiData(440, 0, 4, 0xD83DDD24U, 0x0U, 2);
+	new (toFill++) EmojiData(220, 44, 0, 0xD83DDD25U, 0x0U, 2);
+	new (toFill++) EmojiData(374, 22, 2, 0xD83DDD26U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 22, 2, 0xD83DDD27U, 0x0U, 2);
+	new (toFill++) EmojiData(638, 22, 2, 0xD83DDD28U, 0x0U, 2);
+	new (toFill++) EmojiData(616, 22, 2, 0xD83DDD29U, 0x0U, 2);
+	new (toFill++) EmojiData(748, 22, 2, 0xD83DDD2AU, 0x0U, 2);
+	new (toFill++) EmojiData(726, 22, 2, 0xD83DDD2BU, 0x0U, 2);
+	new (toFill++) EmojiData(220, 66, 2, 0xD83DDD2CU, 0x0U, 2);
+	new (toFill++) EmojiData(242, 66, 2, 0xD83DDD2DU, 0x0U, 2);
+	new (toFill++) EmojiData(440, 0, 2, 0xD83DDD2EU, 0x0U, 2);
+	new (toFill++) EmojiData(110, 66, 4, 0xD83DDD2FU, 0x0U, 2);
+	new (toFill++) EmojiData(22, 44, 3, 0xD83DDD30U, 0x0U, 2);
+	new (toFill++) EmojiData(616, 88, 4, 0xD83DDD31U, 0x0U, 2);
+	new (toFill++) EmojiData(792, 88, 4, 0xD83DDD32U, 0x0U, 2);
+	new (toFill++) EmojiData(814, 88, 4, 0xD83DDD33U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 110, 4, 0xD83DDD34U, 0x0U, 2);
+	new (toFill++) EmojiData(22, 110, 4, 0xD83DDD35U, 0x0U, 2);
+	new (toFill++) EmojiData(110, 110, 4, 0xD83DDD36U, 0x0U, 2);
+	new (toFill++) EmojiData(132, 110, 4, 0xD83DDD37U, 0x0U, 2);
+	new (toFill++) EmojiData(154, 110, 4, 0xD83DDD38U, 0x0U, 2);
+	new (toFill++) EmojiData(176, 110, 4, 0xD83DDD39U, 0x0U, 2);
+	new (toFill++) EmojiData(770, 88, 4, 0xD83DDD3AU, 0x0U, 2);
+	new (toFill++) EmojiData(44, 110, 4, 0xD83DDD3BU, 0x0U, 2);
+	new (toFill++) EmojiData(660, 0, 4, 0xD83DDD3CU, 0x0U, 2);
+	new (toFill++) EmojiData(682, 0, 4, 0xD83DDD3DU, 0x0U, 2);
+	new (toFill++) EmojiData(638, 66, 4, 0xD83DDD50U, 0x0U, 2);
+	new (toFill++) EmojiData(682, 66, 4, 0xD83DDD51U, 0x0U, 2);
+	new (toFill++) EmojiData(726, 66, 4, 0xD83DDD52U, 0x0U, 2);
+	new (toFill++) EmojiData(770, 66, 4, 0xD83DDD53U, 0x0U, 2);
+	new (toFill++) EmojiData(814, 66, 4, 0xD83DDD54U, 0x0U, 2);
+	new (toFill++) EmojiData(858, 66, 4, 0xD83DDD55U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 88, 4, 0xD83DDD56U, 0x0U, 2);
+	new (toFill++) EmojiData(22, 88, 4, 0xD83DDD57U, 0x0U, 2);
+	new (toFill++) EmojiData(44, 88, 4, 0xD83DDD58U, 0x0U, 2);
+	new (toFill++) EmojiData(66, 88, 4, 0xD83DDD59U, 0x0U, 2);
+	new (toFill++) EmojiData(88, 88, 4, 0xD83DDD5AU, 0x0U, 2);
+	new (toFill++) EmojiData(594, 66, 4, 0xD83DDD5BU, 0x0U, 2);
+	new (toFill++) EmojiData(660, 66, 4, 0xD83DDD5CU, 0x0U, 2);
+	new (toFill++) EmojiData(704, 66, 4, 0xD83DDD5DU, 0x0U, 2);
+	new (toFill++) EmojiData(748, 66, 4, 0xD83DDD5EU, 0x0U, 2);
+	new (toFill++) EmojiData(792, 66, 4, 0xD83DDD5FU, 0x0U, 2);
+	new (toFill++) EmojiData(836, 66, 4, 0xD83DDD60U, 0x0U, 2);
+	new (toFill++) EmojiData(110, 88, 4, 0xD83DDD61U, 0x0U, 2);
+	new (toFill++) EmojiData(132, 88, 4, 0xD83DDD62U, 0x0U, 2);
+	new (toFill++) EmojiData(154, 88, 4, 0xD83DDD63U, 0x0U, 2);
+	new (toFill++) EmojiData(176, 88, 4, 0xD83DDD64U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 88, 4, 0xD83DDD65U, 0x0U, 2);
+	new (toFill++) EmojiData(220, 88, 4, 0xD83DDD66U, 0x0U, 2);
+	new (toFill++) EmojiData(616, 66, 4, 0xD83DDD67U, 0x0U, 2);
+	new (toFill++) EmojiData(484, 0, 3, 0xD83DDDFBU, 0x0U, 2);
+	new (toFill++) EmojiData(440, 0, 3, 0xD83DDDFCU, 0x0U, 2);
+	new (toFill++) EmojiData(572, 0, 3, 0xD83DDDFDU, 0x0U, 2);
+	new (toFill++) EmojiData(462, 0, 3, 0xD83DDDFEU, 0x0U, 2);
+	new (toFill++) EmojiData(132, 44, 3, 0xD83DDDFFU, 0x0U, 2);
+	new (toFill++) EmojiData(44, 0, 0, 0xD83DDE00U, 0x0U, 2);
+	new (toFill++) EmojiData(330, 0, 0, 0xD83DDE01U, 0x0U, 2);
+	new (toFill++) EmojiData(484, 0, 0, 0xD83DDE02U, 0x0U, 2);
+	new (toFill++) EmojiData(22, 0, 0, 0xD83DDE03U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 0, 0, 0xD83DDE04U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 0, 0, 0xD83DDE05U, 0x0U, 2);
+	new (toFill++) EmojiData(814, 0, 0, 0xD83DDE06U, 0x0U, 2);
+	new (toFill++) EmojiData(330, 22, 0, 0xD83DDE07U, 0x0U, 2);
+	new (toFill++) EmojiData(154, 22, 0, 0xD83DDE08U, 0x0U, 2);
+	new (toFill++) EmojiData(110, 0, 0, 0xD83DDE09U, 0x0U, 2);
+	new (toFill++) EmojiData(66, 0, 0, 0xD83DDE0AU, 0x0U, 2);
+	new (toFill++) EmojiData(836, 0, 0, 0xD83DDE0BU, 0x0U, 2);
+	new (toFill++) EmojiData(374, 0, 0, 0xD83DDE0CU, 0x0U, 2);
+	new (toFill++) EmojiData(132, 0, 0, 0xD83DDE0DU, 0x0U, 2);
+	new (toFill++) EmojiData(0, 22, 0, 0xD83DDE0EU, 0x0U, 2);
+	new (toFill++) EmojiData(352, 22, 0, 0xD83DDE0FU, 0x0U, 2);
+	new (toFill++) EmojiData(242, 22, 0, 0xD83DDE10U, 0x0U, 2);
+	new (toFill++) EmojiData(374, 22, 0, 0xD83DDE11U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 0, 0, 0xD83DDE12U, 0x0U, 2);
+	new (toFill++) EmojiData(616, 0, 0, 0xD83DDE13U, 0x0U, 2);
+	new (toFill++) EmojiData(352, 0, 0, 0xD83DDE14U, 0x0U, 2);
+	new (toFill++) EmojiData(264, 22, 0, 0xD83DDE15U, 0x0U, 2);
+	new (toFill++) EmojiData(792, 0, 0, 0xD83DDE16U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 0, 0, 0xD83DDE17U, 0x0U, 2);
+	new (toFill++) EmojiData(154, 0, 0, 0xD83DDE18U, 0x0U, 2);
+	new (toFill++) EmojiData(220, 0, 0, 0xD83DDE19U, 0x0U, 2);
+	new (toFill++) EmojiData(176, 0, 0, 0xD83DDE1AU, 0x0U, 2);
+	new (toFill++) EmojiData(286, 0, 0, 0xD83DDE1BU, 0x0U, 2);
+	new (toFill++) EmojiData(242, 0, 0, 0xD83DDE1CU, 0x0U, 2);
+	new (toFill++) EmojiData(264, 0, 0, 0xD83DDE1DU, 0x0U, 2);
+	new (toFill++) EmojiData(418, 0, 0, 0xD83DDE1EU, 0x0U, 2);
+	new (toFill++) EmojiData(88, 22, 0, 0xD83DDE1FU, 0x0U, 2);
+	new (toFill++) EmojiData(726, 0, 0, 0xD83DDE20U, 0x0U, 2);
+	new (toFill++) EmojiData(748, 0, 0, 0xD83DDE21U, 0x0U, 2);
+	new (toFill++) EmojiData(462, 0, 0, 0xD83DDE22U, 0x0U, 2);
+	new (toFill++) EmojiData(440, 0, 0, 0xD83DDE23U, 0x0U, 2);
+	new (toFill++) EmojiData(770, 0, 0, 0xD83DDE24U, 0x0U, 2);
+	new (toFill++) EmojiData(550, 0, 0, 0xD83DDE25U, 0x0U, 2);
+	new (toFill++) EmojiData(110, 22, 0, 0xD83DDE26U, 0x0U, 2);
+	new (toFill++) EmojiData(132, 22, 0, 0xD83DDE27U, 0x0U, 2);
+	new (toFill++) EmojiData(682, 0, 0, 0xD83DDE28U, 0x0U, 2);
+	new (toFill++) EmojiData(638, 0, 0, 0xD83DDE29U, 0x0U, 2);
+	new (toFill++) EmojiData(528, 0, 0, 0xD83DDE2AU, 0x0U, 2);
+	new (toFill++) EmojiData(660, 0, 0, 0xD83DDE2BU, 0x0U, 2);
+	new (toFill++) EmojiData(220, 22, 0, 0xD83DDE2CU, 0x0U, 2);
+	new (toFill++) EmojiData(506, 0, 0, 0xD83DDE2DU, 0x0U, 2);
+	new (toFill++) EmojiData(198, 22, 0, 0xD83DDE2EU, 0x0U, 2);
+	new (toFill++) EmojiData(286, 22, 0, 0xD83DDE2FU, 0x0U, 2);
+	new (toFill++) EmojiData(572, 0, 0, 0xD83DDE30U, 0x0U, 2);
+	new (toFill++) EmojiData(704, 0, 0, 0xD83DDE31U, 0x0U, 2);
+	new (toFill++) EmojiData(66, 22, 0, 0xD83DDE32U, 0x0U, 2);
+	new (toFill++) EmojiData(308, 0, 0, 0xD83DDE33U, 0x0U, 2);
+	new (toFill++) EmojiData(22, 22, 0, 0xD83DDE34U, 0x0U, 2);
+	new (toFill++) EmojiData(44, 22, 0, 0xD83DDE35U, 0x0U, 2);
+	new (toFill++) EmojiData(308, 22, 0, 0xD83DDE36U, 0x0U, 2);
+	new (toFill++) EmojiData(858, 0, 0, 0xD83DDE37U, 0x0U, 2);
+	new (toFill++) EmojiData(748, 22, 0, 0xD83DDE38U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 44, 0, 0xD83DDE39U, 0x0U, 2);
+	new (toFill++) EmojiData(726, 22, 0, 0xD83DDE3AU, 0x0U, 2);
+	new (toFill++) EmojiData(770, 22, 0, 0xD83DDE3BU, 0x0U, 2);
+	new (toFill++) EmojiData(814, 22, 0, 0xD83DDE3CU, 0x0U, 2);
+	new (toFill++) EmojiData(792, 22, 0, 0xD83DDE3DU, 0x0U, 2);
+	new (toFill++) EmojiData(22, 44, 0, 0xD83DDE3EU, 0x0U, 2);
+	new (toFill++) EmojiData(858, 22, 0, 0xD83DDE3FU, 0x0U, 2);
+	new (toFill++) EmojiData(836, 22, 0, 0xD83DDE40U, 0x0U, 2);
+	new (toFill++) EmojiData(308, 66, 0, 0xD83DDE45U, 0x0U, 2);
+	new (toFill++) EmojiData(286, 66, 0, 0xD83DDE46U, 0x0U, 2);
+	new (toFill++) EmojiData(506, 66, 0, 0xD83DDE47U, 0x0U, 2);
+	new (toFill++) EmojiData(88, 44, 0, 0xD83DDE48U, 0x0U, 2);
+	new (toFill++) EmojiData(110, 44, 0, 0xD83DDE49U, 0x0U, 2);
+	new (toFill++) EmojiData(132, 44, 0, 0xD83DDE4AU, 0x0U, 2);
+	new (toFill++) EmojiData(352, 66, 0, 0xD83DDE4BU, 0x0U, 2);
+	new (toFill++) EmojiData(836, 44, 0, 0xD83DDE4CU, 0x0U, 2);
+	new (toFill++) EmojiData(484, 66, 0, 0xD83DDE4DU, 0x0U, 2);
+	new (toFill++) EmojiData(462, 66, 0, 0xD83DDE4EU, 0x0U, 2);
+	new (toFill++) EmojiData(858, 44, 0, 0xD83DDE4FU, 0x0U, 2);
+	new (toFill++) EmojiData(814, 0, 3, 0xD83DDE80U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 22, 3, 0xD83DDE81U, 0x0U, 2);
+	new (toFill++) EmojiData(22, 22, 3, 0xD83DDE82U, 0x0U, 2);
+	new (toFill++) EmojiData(264, 22, 3, 0xD83DDE83U, 0x0U, 2);
+	new (toFill++) EmojiData(132, 22, 3, 0xD83DDE84U, 0x0U, 2);
+	new (toFill++) EmojiData(154, 22, 3, 0xD83DDE85U, 0x0U, 2);
+	new (toFill++) EmojiData(110, 22, 3, 0xD83DDE86U, 0x0U, 2);
+	new (toFill++) EmojiData(198, 22, 3, 0xD83DDE87U, 0x0U, 2);
+	new (toFill++) EmojiData(176, 22, 3, 0xD83DDE88U, 0x0U, 2);
+	new (toFill++) EmojiData(66, 22, 3, 0xD83DDE89U, 0x0U, 2);
+	new (toFill++) EmojiData(44, 22, 3, 0xD83DDE8AU, 0x0U, 2);
+	new (toFill++) EmojiData(242, 22, 3, 0xD83DDE8BU, 0x0U, 2);
+	new (toFill++) EmojiData(308, 22, 3, 0xD83DDE8CU, 0x0U, 2);
+	new (toFill++) EmojiData(330, 22, 3, 0xD83DDE8DU, 0x0U, 2);
+	new (toFill++) EmojiData(286, 22, 3, 0xD83DDE8EU, 0x0U, 2);
+	new (toFill++) EmojiData(770, 22, 3, 0xD83DDE8FU, 0x0U, 2);
+	new (toFill++) EmojiData(616, 22, 3, 0xD83DDE90U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 22, 3, 0xD83DDE91U, 0x0U, 2);
+	new (toFill++) EmojiData(572, 22, 3, 0xD83DDE92U, 0x0U, 2);
+	new (toFill++) EmojiData(528, 22, 3, 0xD83DDE93U, 0x0U, 2);
+	new (toFill++) EmojiData(550, 22, 3, 0xD83DDE94U, 0x0U, 2);
+	new (toFill++) EmojiData(418, 22, 3, 0xD83DDE95U, 0x0U, 2);
+	new (toFill++) EmojiData(440, 22, 3, 0xD83DDE96U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 22, 3, 0xD83DDE97U, 0x0U, 2);
+	new (toFill++) EmojiData(374, 22, 3, 0xD83DDE98U, 0x0U, 2);
+	new (toFill++) EmojiData(352, 22, 3, 0xD83DDE99U, 0x0U, 2);
+	new (toFill++) EmojiData(484, 22, 3, 0xD83DDE9AU, 0x0U, 2);
+	new (toFill++) EmojiData(462, 22, 3, 0xD83DDE9BU, 0x0U, 2);
+	new (toFill++) EmojiData(726, 22, 3, 0xD83DDE9CU, 0x0U, 2);
+	new (toFill++) EmojiData(220, 22, 3, 0xD83DDE9DU, 0x0U, 2);
+	new (toFill++) EmojiData(88, 22, 3, 0xD83DDE9EU, 0x0U, 2);
+	new (toFill++) EmojiData(682, 22, 3, 0xD83DDE9FU, 0x0U, 2);
+	new (toFill++) EmojiData(704, 22, 3, 0xD83DDEA0U, 0x0U, 2);
+	new (toFill++) EmojiData(660, 22, 3, 0xD83DDEA1U, 0x0U, 2);
+	new (toFill++) EmojiData(704, 0, 3, 0xD83DDEA2U, 0x0U, 2);
+	new (toFill++) EmojiData(770, 0, 3, 0xD83DDEA3U, 0x0U, 2);
+	new (toFill++) EmojiData(748, 0, 3, 0xD83DDEA4U, 0x0U, 2);
+	new (toFill++) EmojiData(836, 22, 3, 0xD83DDEA5U, 0x0U, 2);
+	new (toFill++) EmojiData(814, 22, 3, 0xD83DDEA6U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 44, 3, 0xD83DDEA7U, 0x0U, 2);
+	new (toFill++) EmojiData(506, 22, 3, 0xD83DDEA8U, 0x0U, 2);
+	new (toFill++) EmojiData(220, 44, 3, 0xD83DDEA9U, 0x0U, 2);
+	new (toFill++) EmojiData(660, 22, 2, 0xD83DDEAAU, 0x0U, 2);
+	new (toFill++) EmojiData(154, 44, 4, 0xD83DDEABU, 0x0U, 2);
+	new (toFill++) EmojiData(682, 22, 2, 0xD83DDEACU, 0x0U, 2);
+	new (toFill++) EmojiData(704, 22, 4, 0xD83DDEADU, 0x0U, 2);
+	new (toFill++) EmojiData(638, 22, 4, 0xD83DDEAEU, 0x0U, 2);
+	new (toFill++) EmojiData(220, 44, 4, 0xD83DDEAFU, 0x0U, 2);
+	new (toFill++) EmojiData(616, 22, 4, 0xD83DDEB0U, 0x0U, 2);
+	new (toFill++) EmojiData(242, 44, 4, 0xD83DDEB1U, 0x0U, 2);
+	new (toFill++) EmojiData(638, 22, 3, 0xD83DDEB2U, 0x0U, 2);
+	new (toFill++) EmojiData(264, 44, 4, 0xD83DDEB3U, 0x0U, 2);
+	new (toFill++) EmojiData(44, 88, 2, 0xD83DDEB4U, 0x0U, 2);
+	new (toFill++) EmojiData(22, 88, 2, 0xD83DDEB5U, 0x0U, 2);
+	new (toFill++) EmojiData(66, 66, 0, 0xD83DDEB6U, 0x0U, 2);
+	new (toFill++) EmojiData(286, 44, 4, 0xD83DDEB7U, 0x0U, 2);
+	new (toFill++) EmojiData(308, 44, 4, 0xD83DDEB8U, 0x0U, 2);
+	new (toFill++) EmojiData(528, 22, 4, 0xD83DDEB9U, 0x0U, 2);
+	new (toFill++) EmojiData(550, 22, 4, 0xD83DDEBAU, 0x0U, 2);
+	new (toFill++) EmojiData(506, 22, 4, 0xD83DDEBBU, 0x0U, 2);
+	new (toFill++) EmojiData(572, 22, 4, 0xD83DDEBCU, 0x0U, 2);
+	new (toFill++) EmojiData(572, 22, 2, 0xD83DDEBDU, 0x0U, 2);
+	new (toFill++) EmojiData(594, 22, 4, 0xD83DDEBEU, 0x0U, 2);
+	new (toFill++) EmojiData(550, 22, 2, 0xD83DDEBFU, 0x0U, 2);
+	new (toFill++) EmojiData(528, 22, 2, 0xD83DDEC0U, 0x0U, 2);
+	new (toFill++) EmojiData(506, 22, 2, 0xD83DDEC1U, 0x0U, 2);
+	new (toFill++) EmojiData(814, 22, 4, 0xD83DDEC2U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 44, 4, 0xD83DDEC3U, 0x0U, 2);
+	new (toFill++) EmojiData(836, 22, 4, 0xD83DDEC4U, 0x0U, 2);
+	new (toFill++) EmojiData(858, 22, 4, 0xD83DDEC5U, 0x0U, 2);
 }
 
 void initEmojiOneAndHalf() {
 	EmojiData *toFill = emojis = (EmojiData*)emojisData;
 
-	new (toFill++) EmojiData(162, 513, 0xA9U, 0x0U, 1);
-	new (toFill++) EmojiData(189, 513, 0xAEU, 0x0U, 1);
-	new (toFill++) EmojiData(270, 513, 0x203CU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(297, 513, 0x2049U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(216, 513, 0x2122U, 0x0U, 1);
-	new (toFill++) EmojiData(810, 432, 0x2139U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(567, 432, 0x2194U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(594, 432, 0x2195U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(486, 432, 0x2196U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(459, 432, 0x2197U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(513, 432, 0x2198U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(540, 432, 0x2199U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(756, 432, 0x21A9U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(783, 432, 0x21AAU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(918, 216, 0x231AU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(864, 216, 0x231BU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(864, 432, 0x23E9U, 0x0U, 1);
-	new (toFill++) EmojiData(837, 432, 0x23EAU, 0x0U, 1);
-	new (toFill++) EmojiData(891, 432, 0x23EBU, 0x0U, 1);
-	new (toFill++) EmojiData(918, 432, 0x23ECU, 0x0U, 1);
-	new (toFill++) EmojiData(891, 216, 0x23F0U, 0x0U, 1);
-	new (toFill++) EmojiData(837, 216, 0x23F3U, 0x0U, 1);
-	new (toFill++) EmojiData(864, 459, 0x24C2U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(783, 540, 0x25AAU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(810, 540, 0x25ABU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(675, 432, 0x25B6U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(648, 432, 0x25C0U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(702, 540, 0x25FBU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(675, 540, 0x25FCU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(756, 540, 0x25FDU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(729, 540, 0x25FEU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(378, 189, 0x2600U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(432, 189, 0x2601U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(432, 216, 0x260EU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(486, 540, 0x2611U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(486, 189, 0x2614U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(972, 297, 0x2615U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(0, 81, 0x261DU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(108, 0, 0x263AU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(756, 486, 0x2648U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(783, 486, 0x2649U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(810, 486, 0x264AU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(837, 486, 0x264BU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(864, 486, 0x264CU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(891, 486, 0x264DU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(918, 486, 0x264EU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(945, 486, 0x264FU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(972, 486, 0x2650U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(999, 486, 0x2651U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1026, 486, 0x2652U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1053, 486, 0x2653U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(297, 540, 0x2660U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(351, 540, 0x2663U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(324, 540, 0x2665U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(378, 540, 0x2666U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(540, 405, 0x2668U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(729, 486, 0x267BU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(729, 459, 0x267FU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(297, 378, 0x2693U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(378, 405, 0x26A0U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(459, 189, 0x26A1U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(945, 540, 0x26AAU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(918, 540, 0x26ABU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(513, 297, 0x26BDU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(540, 297, 0x26BEU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(540, 189, 0x26C4U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(405, 189, 0x26C5U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(0, 513, 0x26CEU, 0x0U, 1);
-	new (toFill++) EmojiData(297, 486, 0x26D4U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(702, 351, 0x26EAU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(135, 378, 0x26F2U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(675, 297, 0x26F3U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(216, 378, 0x26F5U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(891, 351, 0x26FAU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(459, 405, 0x26FDU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(459, 270, 0x2702U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(405, 486, 0x2705U, 0x0U, 1);
-	new (toFill++) EmojiData(351, 378, 0x2708U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(891, 243, 0x2709U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(783, 54, 0x270AU, 0x0U, 1);
-	new (toFill++) EmojiData(864, 54, 0x270BU, 0x0U, 1);
-	new (toFill++) EmojiData(810, 54, 0x270CU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(567, 270, 0x270FU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(540, 270, 0x2712U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(459, 540, 0x2714U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(189, 540, 0x2716U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(297, 54, 0x2728U, 0x0U, 1);
-	new (toFill++) EmojiData(324, 486, 0x2733U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(432, 486, 0x2734U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(513, 189, 0x2744U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(351, 486, 0x2747U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(243, 513, 0x274CU, 0x0U, 1);
-	new (toFill++) EmojiData(378, 486, 0x274EU, 0x0U, 1);
-	new (toFill++) EmojiData(351, 513, 0x2753U, 0x0U, 1);
-	new (toFill++) EmojiData(405, 513, 0x2754U, 0x0U, 1);
-	new (toFill++) EmojiData(378, 513, 0x2755U, 0x0U, 1);
-	new (toFill++) EmojiData(324, 513, 0x2757U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(324, 108, 0x2764U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(216, 540, 0x2795U, 0x0U, 1);
-	new (toFill++) EmojiData(243, 540, 0x2796U, 0x0U, 1);
-	new (toFill++) EmojiData(270, 540, 0x2797U, 0x0U, 1);
-	new (toFill++) EmojiData(351, 432, 0x27A1U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(567, 540, 0x27B0U, 0x0U, 1);
-	new (toFill++) EmojiData(702, 486, 0x27BFU, 0x0U, 1);
-	new (toFill++) EmojiData(972, 432, 0x2934U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(945, 432, 0x2935U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(324, 432, 0x2B05U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(270, 432, 0x2B06U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(297, 432, 0x2B07U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(0, 567, 0x2B1BU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1053, 540, 0x2B1CU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(351, 189, 0x2B50U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(432, 513, 0x2B55U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(594, 540, 0x3030U, 0x0U, 1);
-	new (toFill++) EmojiData(621, 540, 0x303DU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1053, 459, 0x3297U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1026, 459, 0x3299U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(216, 432, 0x2320E3U, 0x0U, 2);
-	new (toFill++) EmojiData(135, 432, 0x3020E3U, 0x0U, 2);
-	new (toFill++) EmojiData(972, 405, 0x3120E3U, 0x0U, 2);
-	new (toFill++) EmojiData(999, 405, 0x3220E3U, 0x0U, 2);
-	new (toFill++) EmojiData(1026, 405, 0x3320E3U, 0x0U, 2);
-	new (toFill++) EmojiData(1053, 405, 0x3420E3U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 432, 0x3520E3U, 0x0U, 2);
-	new (toFill++) EmojiData(27, 432, 0x3620E3U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 432, 0x3720E3U, 0x0U, 2);
-	new (toFill++) EmojiData(81, 432, 0x3820E3U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 432, 0x3920E3U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 297, 0xD83CDC04U, 0x0U, 2, 0xFE0F);
-	new (toFill++) EmojiData(324, 297, 0xD83CDCCFU, 0x0U, 2);
-	new (toFill++) EmojiData(567, 486, 0xD83CDD70U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 486, 0xD83CDD71U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 486, 0xD83CDD7EU, 0x0U, 2);
-	new (toFill++) EmojiData(702, 459, 0xD83CDD7FU, 0x0U, 2, 0xFE0F);
-	new (toFill++) EmojiData(621, 486, 0xD83CDD8EU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 486, 0xD83CDD91U, 0x0U, 2);
-	new (toFill++) EmojiData(81, 459, 0xD83CDD92U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 459, 0xD83CDD93U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 486, 0xD83CDD94U, 0x0U, 2);
-	new (toFill++) EmojiData(27, 459, 0xD83CDD95U, 0x0U, 2);
-	new (toFill++) EmojiData(135, 459, 0xD83CDD96U, 0x0U, 2);
-	new (toFill++) EmojiData(999, 432, 0xD83CDD97U, 0x0U, 2);
-	new (toFill++) EmojiData(27, 486, 0xD83CDD98U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 459, 0xD83CDD99U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 486, 0xD83CDD9AU, 0x0U, 2);
-	new (toFill++) EmojiData(783, 405, 0xD83CDDE8U, 0xD83CDDF3U, 4);
-	new (toFill++) EmojiData(756, 405, 0xD83CDDE9U, 0xD83CDDEAU, 4);
-	new (toFill++) EmojiData(864, 405, 0xD83CDDEAU, 0xD83CDDF8U, 4);
-	new (toFill++) EmojiData(837, 405, 0xD83CDDEBU, 0xD83CDDF7U, 4);
-	new (toFill++) EmojiData(945, 405, 0xD83CDDECU, 0xD83CDDE7U, 4);
-	new (toFill++) EmojiData(891, 405, 0xD83CDDEEU, 0xD83CDDF9U, 4);
-	new (toFill++) EmojiData(702, 405, 0xD83CDDEFU, 0xD83CDDF5U, 4);
-	new (toFill++) EmojiData(729, 405, 0xD83CDDF0U, 0xD83CDDF7U, 4);
-	new (toFill++) EmojiData(918, 405, 0xD83CDDF7U, 0xD83CDDFAU, 4);
-	new (toFill++) EmojiData(810, 405, 0xD83CDDFAU, 0xD83CDDF8U, 4);
-	new (toFill++) EmojiData(216, 459, 0xD83CDE01U, 0x0U, 2);
-	new (toFill++) EmojiData(837, 459, 0xD83CDE02U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 459, 0xD83CDE1AU, 0x0U, 2, 0xFE0F);
-	new (toFill++) EmojiData(243, 459, 0xD83CDE2FU, 0x0U, 2, 0xFE0F);
-	new (toFill++) EmojiData(351, 459, 0xD83CDE32U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 459, 0xD83CDE33U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 459, 0xD83CDE34U, 0x0U, 2);
-	new (toFill++) EmojiData(297, 459, 0xD83CDE35U, 0x0U, 2);
-	new (toFill++) EmojiData(459, 459, 0xD83CDE36U, 0x0U, 2);
-	new (toFill++) EmojiData(783, 459, 0xD83CDE37U, 0x0U, 2);
-	new (toFill++) EmojiData(810, 459, 0xD83CDE38U, 0x0U, 2);
-	new (toFill++) EmojiData(405, 459, 0xD83CDE39U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 459, 0xD83CDE3AU, 0x0U, 2);
-	new (toFill++) EmojiData(378, 459, 0xD83CDE50U, 0x0U, 2);
-	new (toFill++) EmojiData(999, 459, 0xD83CDE51U, 0x0U, 2);
-	new (toFill++) EmojiData(567, 189, 0xD83CDF00U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 189, 0xD83CDF01U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 108, 0xD83CDF02U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 378, 0xD83CDF03U, 0x0U, 2);
-	new (toFill++) EmojiData(1026, 351, 0xD83CDF04U, 0x0U, 2);
-	new (toFill++) EmojiData(1053, 351, 0xD83CDF05U, 0x0U, 2);
-	new (toFill++) EmojiData(810, 351, 0xD83CDF06U, 0x0U, 2);
-	new (toFill++) EmojiData(783, 351, 0xD83CDF07U, 0x0U, 2);
-	new (toFill++) EmojiData(621, 189, 0xD83CDF08U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 378, 0xD83CDF09U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 189, 0xD83CDF0AU, 0x0U, 2);
-	new (toFill++) EmojiData(270, 189, 0xD83CDF0BU, 0x0U, 2);
-	new (toFill++) EmojiData(297, 189, 0xD83CDF0CU, 0x0U, 2);
-	new (toFill++) EmojiData(189, 189, 0xD83CDF0DU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 189, 0xD83CDF0EU, 0x0U, 2);
-	new (toFill++) EmojiData(243, 189, 0xD83CDF0FU, 0x0U, 2);
-	new (toFill++) EmojiData(864, 162, 0xD83CDF10U, 0x0U, 2);
-	new (toFill++) EmojiData(972, 162, 0xD83CDF11U, 0x0U, 2);
-	new (toFill++) EmojiData(999, 162, 0xD83CDF12U, 0x0U, 2);
-	new (toFill++) EmojiData(1026, 162, 0xD83CDF13U, 0x0U, 2);
-	new (toFill++) EmojiData(1053, 162, 0xD83CDF14U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 189, 0xD83CDF15U, 0x0U, 2);
-	new (toFill++) EmojiData(27, 189, 0xD83CDF16U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 189, 0xD83CDF17U, 0x0U, 2);
-	new (toFill++) EmojiData(81, 189, 0xD83CDF18U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 189, 0xD83CDF19U, 0x0U, 2);
-	new (toFill++) EmojiData(945, 162, 0xD83CDF1AU, 0x0U, 2);
-	new (toFill++) EmojiData(135, 189, 0xD83CDF1BU, 0x0U, 2);
-	new (toFill++) EmojiData(108, 189, 0xD83CDF1CU, 0x0U, 2);
-	new (toFill++) EmojiData(918, 162, 0xD83CDF1DU, 0x0U, 2);
-	new (toFill++) EmojiData(891, 162, 0xD83CDF1EU, 0x0U, 2);
-	new (toFill++) EmojiData(324, 54, 0xD83CDF1FU, 0x0U, 2);
-	new (toFill++) EmojiData(324, 189, 0xD83CDF20U, 0x0U, 2);
-	new (toFill++) EmojiData(783, 162, 0xD83CDF30U, 0x0U, 2);
-	new (toFill++) EmojiData(810, 162, 0xD83CDF31U, 0x0U, 2);
-	new (toFill++) EmojiData(729, 162, 0xD83CDF32U, 0x0U, 2);
-	new (toFill++) EmojiData(756, 162, 0xD83CDF33U, 0x0U, 2);
-	new (toFill++) EmojiData(702, 162, 0xD83CDF34U, 0x0U, 2);
-	new (toFill++) EmojiData(675, 162, 0xD83CDF35U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 162, 0xD83CDF37U, 0x0U, 2);
-	new (toFill++) EmojiData(351, 162, 0xD83CDF38U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 162, 0xD83CDF39U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 162, 0xD83CDF3AU, 0x0U, 2);
-	new (toFill++) EmojiData(459, 162, 0xD83CDF3BU, 0x0U, 2);
-	new (toFill++) EmojiData(837, 162, 0xD83CDF3CU, 0x0U, 2);
-	new (toFill++) EmojiData(378, 351, 0xD83CDF3DU, 0x0U, 2);
-	new (toFill++) EmojiData(621, 162, 0xD83CDF3EU, 0x0U, 2);
-	new (toFill++) EmojiData(594, 162, 0xD83CDF3FU, 0x0U, 2);
-	new (toFill++) EmojiData(405, 162, 0xD83CDF40U, 0x0U, 2);
-	new (toFill++) EmojiData(513, 162, 0xD83CDF41U, 0x0U, 2);
-	new (toFill++) EmojiData(567, 162, 0xD83CDF42U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 162, 0xD83CDF43U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 162, 0xD83CDF44U, 0x0U, 2);
-	new (toFill++) EmojiData(351, 351, 0xD83CDF45U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 351, 0xD83CDF46U, 0x0U, 2);
-	new (toFill++) EmojiData(81, 351, 0xD83CDF47U, 0x0U, 2);
-	new (toFill++) EmojiData(189, 351, 0xD83CDF48U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 351, 0xD83CDF49U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 351, 0xD83CDF4AU, 0x0U, 2);
-	new (toFill++) EmojiData(27, 351, 0xD83CDF4BU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 351, 0xD83CDF4CU, 0x0U, 2);
-	new (toFill++) EmojiData(270, 351, 0xD83CDF4DU, 0x0U, 2);
-	new (toFill++) EmojiData(1026, 324, 0xD83CDF4EU, 0x0U, 2);
-	new (toFill++) EmojiData(1053, 324, 0xD83CDF4FU, 0x0U, 2);
-	new (toFill++) EmojiData(243, 351, 0xD83CDF50U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 351, 0xD83CDF51U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 351, 0xD83CDF52U, 0x0U, 2);
-	new (toFill++) EmojiData(135, 351, 0xD83CDF53U, 0x0U, 2);
-	new (toFill++) EmojiData(189, 324, 0xD83CDF54U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 324, 0xD83CDF55U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 324, 0xD83CDF56U, 0x0U, 2);
-	new (toFill++) EmojiData(243, 324, 0xD83CDF57U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 324, 0xD83CDF58U, 0x0U, 2);
-	new (toFill++) EmojiData(459, 324, 0xD83CDF59U, 0x0U, 2);
-	new (toFill++) EmojiData(513, 324, 0xD83CDF5AU, 0x0U, 2);
-	new (toFill++) EmojiData(324, 324, 0xD83CDF5BU, 0x0U, 2);
-	new (toFill++) EmojiData(540, 324, 0xD83CDF5CU, 0x0U, 2);
-	new (toFill++) EmojiData(297, 324, 0xD83CDF5DU, 0x0U, 2);
-	new (toFill++) EmojiData(675, 324, 0xD83CDF5EU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 324, 0xD83CDF5FU, 0x0U, 2);
-	new (toFill++) EmojiData(297, 351, 0xD83CDF60U, 0x0U, 2);
-	new (toFill++) EmojiData(621, 324, 0xD83CDF61U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 324, 0xD83CDF62U, 0x0U, 2);
-	new (toFill++) EmojiData(405, 324, 0xD83CDF63U, 0x0U, 2);
-	new (toFill++) EmojiData(351, 324, 0xD83CDF64U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 324, 0xD83CDF65U, 0x0U, 2);
-	new (toFill++) EmojiData(756, 324, 0xD83CDF66U, 0x0U, 2);
-	new (toFill++) EmojiData(810, 324, 0xD83CDF67U, 0x0U, 2);
-	new (toFill++) EmojiData(783, 324, 0xD83CDF68U, 0x0U, 2);
-	new (toFill++) EmojiData(702, 324, 0xD83CDF69U, 0x0U, 2);
-	new (toFill++) EmojiData(891, 324, 0xD83CDF6AU, 0x0U, 2);
-	new (toFill++) EmojiData(918, 324, 0xD83CDF6BU, 0x0U, 2);
-	new (toFill++) EmojiData(945, 324, 0xD83CDF6CU, 0x0U, 2);
-	new (toFill++) EmojiData(972, 324, 0xD83CDF6DU, 0x0U, 2);
-	new (toFill++) EmojiData(729, 324, 0xD83CDF6EU, 0x0U, 2);
-	new (toFill++) EmojiData(999, 324, 0xD83CDF6FU, 0x0U, 2);
-	new (toFill++) EmojiData(864, 324, 0xD83CDF70U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 324, 0xD83CDF71U, 0x0U, 2);
-	new (toFill++) EmojiData(567, 324, 0xD83CDF72U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 324, 0xD83CDF73U, 0x0U, 2);
-	new (toFill++) EmojiData(135, 324, 0xD83CDF74U, 0x0U, 2);
-	new (toFill++) EmojiData(999, 297, 0xD83CDF75U, 0x0U, 2);
-	new (toFill++) EmojiData(1026, 297, 0xD83CDF76U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 324, 0xD83CDF77U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 324, 0xD83CDF78U, 0x0U, 2);
-	new (toFill++) EmojiData(81, 324, 0xD83CDF79U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 324, 0xD83CDF7AU, 0x0U, 2);
-	new (toFill++) EmojiData(27, 324, 0xD83CDF7BU, 0x0U, 2);
-	new (toFill++) EmojiData(1053, 297, 0xD83CDF7CU, 0x0U, 2);
-	new (toFill++) EmojiData(135, 108, 0xD83CDF80U, 0x0U, 2);
-	new (toFill++) EmojiData(1053, 189, 0xD83CDF81U, 0x0U, 2);
-	new (toFill++) EmojiData(837, 324, 0xD83CDF82U, 0x0U, 2);
-	new (toFill++) EmojiData(945, 189, 0xD83CDF83U, 0x0U, 2);
-	new (toFill++) EmojiData(1026, 189, 0xD83CDF84U, 0x0U, 2);
-	new (toFill++) EmojiData(999, 189, 0xD83CDF85U, 0x0U, 2);
-	new (toFill++) EmojiData(837, 189, 0xD83CDF86U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 189, 0xD83CDF87U, 0x0U, 2);
-	new (toFill++) EmojiData(81, 216, 0xD83CDF88U, 0x0U, 2);
-	new (toFill++) EmojiData(27, 216, 0xD83CDF89U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 216, 0xD83CDF8AU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 216, 0xD83CDF8BU, 0x0U, 2);
-	new (toFill++) EmojiData(108, 216, 0xD83CDF8CU, 0x0U, 2);
-	new (toFill++) EmojiData(675, 189, 0xD83CDF8DU, 0x0U, 2);
-	new (toFill++) EmojiData(729, 189, 0xD83CDF8EU, 0x0U, 2);
-	new (toFill++) EmojiData(810, 189, 0xD83CDF8FU, 0x0U, 2);
-	new (toFill++) EmojiData(891, 189, 0xD83CDF90U, 0x0U, 2);
-	new (toFill++) EmojiData(918, 189, 0xD83CDF91U, 0x0U, 2);
-	new (toFill++) EmojiData(756, 189, 0xD83CDF92U, 0x0U, 2);
-	new (toFill++) EmojiData(783, 189, 0xD83CDF93U, 0x0U, 2);
-	new (toFill++) EmojiData(81, 378, 0xD83CDFA0U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 378, 0xD83CDFA1U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 378, 0xD83CDFA2U, 0x0U, 2);
-	new (toFill++) EmojiData(945, 297, 0xD83CDFA3U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 297, 0xD83CDFA4U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 216, 0xD83CDFA5U, 0x0U, 2);
-	new (toFill++) EmojiData(189, 459, 0xD83CDFA6U, 0x0U, 2);
-	new (toFill++) EmojiData(27, 297, 0xD83CDFA7U, 0x0U, 2);
-	new (toFill++) EmojiData(1026, 270, 0xD83CDFA8U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 81, 0xD83CDFA9U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 405, 0xD83CDFAAU, 0x0U, 2);
-	new (toFill++) EmojiData(297, 405, 0xD83CDFABU, 0x0U, 2);
-	new (toFill++) EmojiData(1053, 270, 0xD83CDFACU, 0x0U, 2);
-	new (toFill++) EmojiData(621, 405, 0xD83CDFADU, 0x0U, 2);
-	new (toFill++) EmojiData(297, 297, 0xD83CDFAEU, 0x0U, 2);
-	new (toFill++) EmojiData(432, 297, 0xD83CDFAFU, 0x0U, 2);
-	new (toFill++) EmojiData(513, 405, 0xD83CDFB0U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 297, 0xD83CDFB1U, 0x0U, 2);
-	new (toFill++) EmojiData(405, 297, 0xD83CDFB2U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 297, 0xD83CDFB3U, 0x0U, 2);
-	new (toFill++) EmojiData(351, 297, 0xD83CDFB4U, 0x0U, 2);
-	new (toFill++) EmojiData(81, 297, 0xD83CDFB5U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 297, 0xD83CDFB6U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 297, 0xD83CDFB7U, 0x0U, 2);
-	new (toFill++) EmojiData(243, 297, 0xD83CDFB8U, 0x0U, 2);
-	new (toFill++) EmojiData(135, 297, 0xD83CDFB9U, 0x0U, 2);
-	new (toFill++) EmojiData(189, 297, 0xD83CDFBAU, 0x0U, 2);
-	new (toFill++) EmojiData(162, 297, 0xD83CDFBBU, 0x0U, 2);
-	new (toFill++) EmojiData(54, 297, 0xD83CDFBCU, 0x0U, 2);
-	new (toFill++) EmojiData(972, 81, 0xD83CDFBDU, 0x0U, 2);
-	new (toFill++) EmojiData(567, 297, 0xD83CDFBEU, 0x0U, 2);
-	new (toFill++) EmojiData(837, 297, 0xD83CDFBFU, 0x0U, 2);
-	new (toFill++) EmojiData(486, 297, 0xD83CDFC0U, 0x0U, 2);
-	new (toFill++) EmojiData(756, 297, 0xD83CDFC1U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 297, 0xD83CDFC2U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 81, 0xD83CDFC3U, 0x0U, 2);
-	new (toFill++) EmojiData(918, 297, 0xD83CDFC4U, 0x0U, 2);
-	new (toFill++) EmojiData(810, 297, 0xD83CDFC6U, 0x0U, 2);
-	new (toFill++) EmojiData(783, 297, 0xD83CDFC7U, 0x0U, 2);
-	new (toFill++) EmojiData(459, 297, 0xD83CDFC8U, 0x0U, 2);
-	new (toFill++) EmojiData(621, 297, 0xD83CDFC9U, 0x0U, 2);
-	new (toFill++) EmojiData(891, 297, 0xD83CDFCAU, 0x0U, 2);
-	new (toFill++) EmojiData(405, 351, 0xD83CDFE0U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 351, 0xD83CDFE1U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 351, 0xD83CDFE2U, 0x0U, 2);
-	new (toFill++) EmojiData(513, 351, 0xD83CDFE3U, 0x0U, 2);
-	new (toFill++) EmojiData(756, 351, 0xD83CDFE4U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 351, 0xD83CDFE5U, 0x0U, 2);
-	new (toFill++) EmojiData(567, 351, 0xD83CDFE6U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 513, 0xD83CDFE7U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 351, 0xD83CDFE8U, 0x0U, 2);
-	new (toFill++) EmojiData(621, 351, 0xD83CDFE9U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 351, 0xD83CDFEAU, 0x0U, 2);
-	new (toFill++) EmojiData(459, 351, 0xD83CDFEBU, 0x0U, 2);
-	new (toFill++) EmojiData(729, 351, 0xD83CDFECU, 0x0U, 2);
-	new (toFill++) EmojiData(918, 351, 0xD83CDFEDU, 0x0U, 2);
-	new (toFill++) EmojiData(486, 405, 0xD83CDFEEU, 0x0U, 2);
-	new (toFill++) EmojiData(837, 351, 0xD83CDFEFU, 0x0U, 2);
-	new (toFill++) EmojiData(864, 351, 0xD83CDFF0U, 0x0U, 2);
-	new (toFill++) EmojiData(837, 135, 0xD83DDC00U, 0x0U, 2);
-	new (toFill++) EmojiData(27, 162, 0xD83DDC01U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 162, 0xD83DDC02U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 135, 0xD83DDC03U, 0x0U, 2);
-	new (toFill++) EmojiData(783, 135, 0xD83DDC04U, 0x0U, 2);
-	new (toFill++) EmojiData(891, 135, 0xD83DDC05U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 162, 0xD83DDC06U, 0x0U, 2);
-	new (toFill++) EmojiData(918, 135, 0xD83DDC07U, 0x0U, 2);
-	new (toFill++) EmojiData(243, 162, 0xD83DDC08U, 0x0U, 2);
-	new (toFill++) EmojiData(945, 135, 0xD83DDC09U, 0x0U, 2);
-	new (toFill++) EmojiData(135, 162, 0xD83DDC0AU, 0x0U, 2);
-	new (toFill++) EmojiData(756, 135, 0xD83DDC0BU, 0x0U, 2);
-	new (toFill++) EmojiData(567, 135, 0xD83DDC0CU, 0x0U, 2);
-	new (toFill++) EmojiData(405, 135, 0xD83DDC0DU, 0x0U, 2);
-	new (toFill++) EmojiData(972, 135, 0xD83DDC0EU, 0x0U, 2);
-	new (toFill++) EmojiData(810, 135, 0xD83DDC0FU, 0x0U, 2);
-	new (toFill++) EmojiData(999, 135, 0xD83DDC10U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 135, 0xD83DDC11U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 135, 0xD83DDC12U, 0x0U, 2);
-	new (toFill++) EmojiData(1026, 135, 0xD83DDC13U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 135, 0xD83DDC14U, 0x0U, 2);
-	new (toFill++) EmojiData(1053, 135, 0xD83DDC15U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 162, 0xD83DDC16U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 135, 0xD83DDC17U, 0x0U, 2);
-	new (toFill++) EmojiData(189, 135, 0xD83DDC18U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 135, 0xD83DDC19U, 0x0U, 2);
-	new (toFill++) EmojiData(621, 135, 0xD83DDC1AU, 0x0U, 2);
-	new (toFill++) EmojiData(459, 135, 0xD83DDC1BU, 0x0U, 2);
-	new (toFill++) EmojiData(513, 135, 0xD83DDC1CU, 0x0U, 2);
-	new (toFill++) EmojiData(486, 135, 0xD83DDC1DU, 0x0U, 2);
-	new (toFill++) EmojiData(540, 135, 0xD83DDC1EU, 0x0U, 2);
-	new (toFill++) EmojiData(675, 135, 0xD83DDC1FU, 0x0U, 2);
-	new (toFill++) EmojiData(648, 135, 0xD83DDC20U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 162, 0xD83DDC21U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 135, 0xD83DDC22U, 0x0U, 2);
-	new (toFill++) EmojiData(351, 135, 0xD83DDC23U, 0x0U, 2);
-	new (toFill++) EmojiData(297, 135, 0xD83DDC24U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 135, 0xD83DDC25U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 135, 0xD83DDC26U, 0x0U, 2);
-	new (toFill++) EmojiData(243, 135, 0xD83DDC27U, 0x0U, 2);
-	new (toFill++) EmojiData(999, 108, 0xD83DDC28U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 162, 0xD83DDC29U, 0x0U, 2);
-	new (toFill++) EmojiData(189, 162, 0xD83DDC2AU, 0x0U, 2);
-	new (toFill++) EmojiData(162, 162, 0xD83DDC2BU, 0x0U, 2);
-	new (toFill++) EmojiData(702, 135, 0xD83DDC2CU, 0x0U, 2);
-	new (toFill++) EmojiData(864, 108, 0xD83DDC2DU, 0x0U, 2);
-	new (toFill++) EmojiData(27, 135, 0xD83DDC2EU, 0x0U, 2);
-	new (toFill++) EmojiData(972, 108, 0xD83DDC2FU, 0x0U, 2);
-	new (toFill++) EmojiData(918, 108, 0xD83DDC30U, 0x0U, 2);
-	new (toFill++) EmojiData(837, 108, 0xD83DDC31U, 0x0U, 2);
-	new (toFill++) EmojiData(81, 162, 0xD83DDC32U, 0x0U, 2);
-	new (toFill++) EmojiData(729, 135, 0xD83DDC33U, 0x0U, 2);
-	new (toFill++) EmojiData(135, 135, 0xD83DDC34U, 0x0U, 2);
-	new (toFill++) EmojiData(81, 135, 0xD83DDC35U, 0x0U, 2);
-	new (toFill++) EmojiData(783, 108, 0xD83DDC36U, 0x0U, 2);
-	new (toFill++) EmojiData(1053, 108, 0xD83DDC37U, 0x0U, 2);
-	new (toFill++) EmojiData(945, 108, 0xD83DDC38U, 0x0U, 2);
-	new (toFill++) EmojiData(891, 108, 0xD83DDC39U, 0x0U, 2);
-	new (toFill++) EmojiData(810, 108, 0xD83DDC3AU, 0x0U, 2);
-	new (toFill++) EmojiData(1026, 108, 0xD83DDC3BU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 135, 0xD83DDC3CU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 135, 0xD83DDC3DU, 0x0U, 2);
-	new (toFill++) EmojiData(297, 162, 0xD83DDC3EU, 0x0U, 2);
-	new (toFill++) EmojiData(567, 54, 0xD83DDC40U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 54, 0xD83DDC42U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 54, 0xD83DDC43U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 54, 0xD83DDC44U, 0x0U, 2);
-	new (toFill++) EmojiData(621, 54, 0xD83DDC45U, 0x0U, 2);
-	new (toFill++) EmojiData(918, 54, 0xD83DDC46U, 0x0U, 2);
-	new (toFill++) EmojiData(945, 54, 0xD83DDC47U, 0x0U, 2);
-	new (toFill++) EmojiData(999, 54, 0xD83DDC48U, 0x0U, 2);
-	new (toFill++) EmojiData(972, 54, 0xD83DDC49U, 0x0U, 2);
-	new (toFill++) EmojiData(756, 54, 0xD83DDC4AU, 0x0U, 2);
-	new (toFill++) EmojiData(837, 54, 0xD83DDC4BU, 0x0U, 2);
-	new (toFill++) EmojiData(729, 54, 0xD83DDC4CU, 0x0U, 2);
-	new (toFill++) EmojiData(675, 54, 0xD83DDC4DU, 0x0U, 2);
-	new (toFill++) EmojiData(702, 54, 0xD83DDC4EU, 0x0U, 2);
-	new (toFill++) EmojiData(27, 81, 0xD83DDC4FU, 0x0U, 2);
-	new (toFill++) EmojiData(891, 54, 0xD83DDC50U, 0x0U, 2);
-	new (toFill++) EmojiData(675, 81, 0xD83DDC51U, 0x0U, 2);
-	new (toFill++) EmojiData(702, 81, 0xD83DDC52U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 108, 0xD83DDC53U, 0x0U, 2);
-	new (toFill++) EmojiData(891, 81, 0xD83DDC54U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 81, 0xD83DDC55U, 0x0U, 2);
-	new (toFill++) EmojiData(999, 81, 0xD83DDC56U, 0x0U, 2);
-	new (toFill++) EmojiData(945, 81, 0xD83DDC57U, 0x0U, 2);
-	new (toFill++) EmojiData(1026, 81, 0xD83DDC58U, 0x0U, 2);
-	new (toFill++) EmojiData(1053, 81, 0xD83DDC59U, 0x0U, 2);
-	new (toFill++) EmojiData(918, 81, 0xD83DDC5AU, 0x0U, 2);
-	new (toFill++) EmojiData(81, 108, 0xD83DDC5BU, 0x0U, 2);
-	new (toFill++) EmojiData(27, 108, 0xD83DDC5CU, 0x0U, 2);
-	new (toFill++) EmojiData(54, 108, 0xD83DDC5DU, 0x0U, 2);
-	new (toFill++) EmojiData(756, 81, 0xD83DDC5EU, 0x0U, 2);
-	new (toFill++) EmojiData(729, 81, 0xD83DDC5FU, 0x0U, 2);
-	new (toFill++) EmojiData(810, 81, 0xD83DDC60U, 0x0U, 2);
-	new (toFill++) EmojiData(783, 81, 0xD83DDC61U, 0x0U, 2);
-	new (toFill++) EmojiData(837, 81, 0xD83DDC62U, 0x0U, 2);
-	new (toFill++) EmojiData(729, 108, 0xD83DDC63U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 108, 0xD83DDC64U, 0x0U, 2);
-	new (toFill++) EmojiData(675, 108, 0xD83DDC65U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 27, 0xD83DDC66U, 0x0U, 2);
-	new (toFill++) EmojiData(675, 27, 0xD83DDC67U, 0x0U, 2);
-	new (toFill++) EmojiData(702, 27, 0xD83DDC68U, 0x0U, 2);
-	new (toFill++) EmojiData(729, 27, 0xD83DDC69U, 0x0U, 2);
-	new (toFill++) EmojiData(189, 81, 0xD83DDC6AU, 0x0U, 2);
-	new (toFill++) EmojiData(162, 81, 0xD83DDC6BU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 81, 0xD83DDC6CU, 0x0U, 2);
-	new (toFill++) EmojiData(243, 81, 0xD83DDC6DU, 0x0U, 2);
-	new (toFill++) EmojiData(540, 27, 0xD83DDC6EU, 0x0U, 2);
-	new (toFill++) EmojiData(324, 81, 0xD83DDC6FU, 0x0U, 2);
-	new (toFill++) EmojiData(540, 81, 0xD83DDC70U, 0x0U, 2);
-	new (toFill++) EmojiData(810, 27, 0xD83DDC71U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 27, 0xD83DDC72U, 0x0U, 2);
-	new (toFill++) EmojiData(513, 27, 0xD83DDC73U, 0x0U, 2);
-	new (toFill++) EmojiData(756, 27, 0xD83DDC74U, 0x0U, 2);
-	new (toFill++) EmojiData(783, 27, 0xD83DDC75U, 0x0U, 2);
-	new (toFill++) EmojiData(621, 27, 0xD83DDC76U, 0x0U, 2);
-	new (toFill++) EmojiData(567, 27, 0xD83DDC77U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 27, 0xD83DDC78U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 54, 0xD83DDC79U, 0x0U, 2);
-	new (toFill++) EmojiData(81, 54, 0xD83DDC7AU, 0x0U, 2);
-	new (toFill++) EmojiData(972, 189, 0xD83DDC7BU, 0x0U, 2);
-	new (toFill++) EmojiData(837, 27, 0xD83DDC7CU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 54, 0xD83DDC7DU, 0x0U, 2);
-	new (toFill++) EmojiData(270, 297, 0xD83DDC7EU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 27, 0xD83DDC7FU, 0x0U, 2);
-	new (toFill++) EmojiData(189, 54, 0xD83DDC80U, 0x0U, 2);
-	new (toFill++) EmojiData(405, 81, 0xD83DDC81U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 27, 0xD83DDC82U, 0x0U, 2);
-	new (toFill++) EmojiData(135, 81, 0xD83DDC83U, 0x0U, 2);
-	new (toFill++) EmojiData(189, 108, 0xD83DDC84U, 0x0U, 2);
-	new (toFill++) EmojiData(513, 81, 0xD83DDC85U, 0x0U, 2);
-	new (toFill++) EmojiData(459, 81, 0xD83DDC86U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 81, 0xD83DDC87U, 0x0U, 2);
-	new (toFill++) EmojiData(243, 405, 0xD83DDC88U, 0x0U, 2);
-	new (toFill++) EmojiData(567, 243, 0xD83DDC89U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 243, 0xD83DDC8AU, 0x0U, 2);
-	new (toFill++) EmojiData(567, 108, 0xD83DDC8BU, 0x0U, 2);
-	new (toFill++) EmojiData(540, 108, 0xD83DDC8CU, 0x0U, 2);
-	new (toFill++) EmojiData(594, 108, 0xD83DDC8DU, 0x0U, 2);
-	new (toFill++) EmojiData(621, 108, 0xD83DDC8EU, 0x0U, 2);
-	new (toFill++) EmojiData(270, 81, 0xD83DDC8FU, 0x0U, 2);
-	new (toFill++) EmojiData(324, 162, 0xD83DDC90U, 0x0U, 2);
-	new (toFill++) EmojiData(297, 81, 0xD83DDC91U, 0x0U, 2);
-	new (toFill++) EmojiData(675, 351, 0xD83DDC92U, 0x0U, 2);
-	new (toFill++) EmojiData(405, 108, 0xD83DDC93U, 0x0U, 2);
-	new (toFill++) EmojiData(351, 108, 0xD83DDC94U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 108, 0xD83DDC95U, 0x0U, 2);
-	new (toFill++) EmojiData(459, 108, 0xD83DDC96U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 108, 0xD83DDC97U, 0x0U, 2);
-	new (toFill++) EmojiData(513, 108, 0xD83DDC98U, 0x0U, 2);
-	new (toFill++) EmojiData(243, 108, 0xD83DDC99U, 0x0U, 2);
-	new (toFill++) EmojiData(297, 108, 0xD83DDC9AU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 108, 0xD83DDC9BU, 0x0U, 2);
-	new (toFill++) EmojiData(270, 108, 0xD83DDC9CU, 0x0U, 2);
-	new (toFill++) EmojiData(702, 189, 0xD83DDC9DU, 0x0U, 2);
-	new (toFill++) EmojiData(486, 108, 0xD83DDC9EU, 0x0U, 2);
-	new (toFill++) EmojiData(459, 486, 0xD83DDC9FU, 0x0U, 2);
-	new (toFill++) EmojiData(675, 486, 0xD83DDCA0U, 0x0U, 2);
-	new (toFill++) EmojiData(27, 243, 0xD83DDCA1U, 0x0U, 2);
-	new (toFill++) EmojiData(405, 54, 0xD83DDCA2U, 0x0U, 2);
-	new (toFill++) EmojiData(459, 243, 0xD83DDCA3U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 54, 0xD83DDCA4U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 54, 0xD83DDCA5U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 54, 0xD83DDCA6U, 0x0U, 2);
-	new (toFill++) EmojiData(459, 54, 0xD83DDCA7U, 0x0U, 2);
-	new (toFill++) EmojiData(513, 54, 0xD83DDCA8U, 0x0U, 2);
-	new (toFill++) EmojiData(243, 54, 0xD83DDCA9U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 81, 0xD83DDCAAU, 0x0U, 2);
-	new (toFill++) EmojiData(351, 54, 0xD83DDCABU, 0x0U, 2);
-	new (toFill++) EmojiData(702, 108, 0xD83DDCACU, 0x0U, 2);
-	new (toFill++) EmojiData(756, 108, 0xD83DDCADU, 0x0U, 2);
-	new (toFill++) EmojiData(405, 540, 0xD83DDCAEU, 0x0U, 2);
-	new (toFill++) EmojiData(432, 540, 0xD83DDCAFU, 0x0U, 2);
-	new (toFill++) EmojiData(594, 243, 0xD83DDCB0U, 0x0U, 2);
-	new (toFill++) EmojiData(135, 513, 0xD83DDCB1U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 513, 0xD83DDCB2U, 0x0U, 2);
-	new (toFill++) EmojiData(729, 243, 0xD83DDCB3U, 0x0U, 2);
-	new (toFill++) EmojiData(621, 243, 0xD83DDCB4U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 243, 0xD83DDCB5U, 0x0U, 2);
-	new (toFill++) EmojiData(702, 243, 0xD83DDCB6U, 0x0U, 2);
-	new (toFill++) EmojiData(675, 243, 0xD83DDCB7U, 0x0U, 2);
-	new (toFill++) EmojiData(756, 243, 0xD83DDCB8U, 0x0U, 2);
-	new (toFill++) EmojiData(81, 513, 0xD83DDCB9U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 378, 0xD83DDCBAU, 0x0U, 2);
-	new (toFill++) EmojiData(378, 216, 0xD83DDCBBU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 108, 0xD83DDCBCU, 0x0U, 2);
-	new (toFill++) EmojiData(324, 216, 0xD83DDCBDU, 0x0U, 2);
-	new (toFill++) EmojiData(351, 216, 0xD83DDCBEU, 0x0U, 2);
-	new (toFill++) EmojiData(270, 216, 0xD83DDCBFU, 0x0U, 2);
-	new (toFill++) EmojiData(297, 216, 0xD83DDCC0U, 0x0U, 2);
-	new (toFill++) EmojiData(405, 270, 0xD83DDCC1U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 270, 0xD83DDCC2U, 0x0U, 2);
-	new (toFill++) EmojiData(135, 270, 0xD83DDCC3U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 270, 0xD83DDCC4U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 270, 0xD83DDCC5U, 0x0U, 2);
-	new (toFill++) EmojiData(351, 270, 0xD83DDCC6U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 270, 0xD83DDCC7U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 270, 0xD83DDCC8U, 0x0U, 2);
-	new (toFill++) EmojiData(243, 270, 0xD83DDCC9U, 0x0U, 2);
-	new (toFill++) EmojiData(189, 270, 0xD83DDCCAU, 0x0U, 2);
-	new (toFill++) EmojiData(297, 270, 0xD83DDCCBU, 0x0U, 2);
-	new (toFill++) EmojiData(486, 270, 0xD83DDCCCU, 0x0U, 2);
-	new (toFill++) EmojiData(648, 405, 0xD83DDCCDU, 0x0U, 2);
-	new (toFill++) EmojiData(513, 270, 0xD83DDCCEU, 0x0U, 2);
-	new (toFill++) EmojiData(594, 270, 0xD83DDCCFU, 0x0U, 2);
-	new (toFill++) EmojiData(621, 270, 0xD83DDCD0U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 270, 0xD83DDCD1U, 0x0U, 2);
-	new (toFill++) EmojiData(810, 270, 0xD83DDCD2U, 0x0U, 2);
-	new (toFill++) EmojiData(756, 270, 0xD83DDCD3U, 0x0U, 2);
-	new (toFill++) EmojiData(783, 270, 0xD83DDCD4U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 270, 0xD83DDCD5U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 270, 0xD83DDCD6U, 0x0U, 2);
-	new (toFill++) EmojiData(675, 270, 0xD83DDCD7U, 0x0U, 2);
-	new (toFill++) EmojiData(702, 270, 0xD83DDCD8U, 0x0U, 2);
-	new (toFill++) EmojiData(729, 270, 0xD83DDCD9U, 0x0U, 2);
-	new (toFill++) EmojiData(837, 270, 0xD83DDCDAU, 0x0U, 2);
-	new (toFill++) EmojiData(918, 270, 0xD83DDCDBU, 0x0U, 2);
-	new (toFill++) EmojiData(270, 270, 0xD83DDCDCU, 0x0U, 2);
-	new (toFill++) EmojiData(81, 270, 0xD83DDCDDU, 0x0U, 2);
-	new (toFill++) EmojiData(459, 216, 0xD83DDCDEU, 0x0U, 2);
-	new (toFill++) EmojiData(486, 216, 0xD83DDCDFU, 0x0U, 2);
-	new (toFill++) EmojiData(513, 216, 0xD83DDCE0U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 216, 0xD83DDCE1U, 0x0U, 2);
-	new (toFill++) EmojiData(783, 216, 0xD83DDCE2U, 0x0U, 2);
-	new (toFill++) EmojiData(810, 216, 0xD83DDCE3U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 243, 0xD83DDCE4U, 0x0U, 2);
-	new (toFill++) EmojiData(837, 243, 0xD83DDCE5U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 270, 0xD83DDCE6U, 0x0U, 2);
-	new (toFill++) EmojiData(810, 243, 0xD83DDCE7U, 0x0U, 2);
-	new (toFill++) EmojiData(945, 243, 0xD83DDCE8U, 0x0U, 2);
-	new (toFill++) EmojiData(918, 243, 0xD83DDCE9U, 0x0U, 2);
-	new (toFill++) EmojiData(1026, 243, 0xD83DDCEAU, 0x0U, 2);
-	new (toFill++) EmojiData(999, 243, 0xD83DDCEBU, 0x0U, 2);
-	new (toFill++) EmojiData(1053, 243, 0xD83DDCECU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 270, 0xD83DDCEDU, 0x0U, 2);
-	new (toFill++) EmojiData(27, 270, 0xD83DDCEEU, 0x0U, 2);
-	new (toFill++) EmojiData(972, 243, 0xD83DDCEFU, 0x0U, 2);
-	new (toFill++) EmojiData(999, 270, 0xD83DDCF0U, 0x0U, 2);
-	new (toFill++) EmojiData(405, 216, 0xD83DDCF1U, 0x0U, 2);
-	new (toFill++) EmojiData(783, 243, 0xD83DDCF2U, 0x0U, 2);
-	new (toFill++) EmojiData(513, 486, 0xD83DDCF3U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 486, 0xD83DDCF4U, 0x0U, 2);
-	new (toFill++) EmojiData(135, 486, 0xD83DDCF5U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 459, 0xD83DDCF6U, 0x0U, 2);
-	new (toFill++) EmojiData(189, 216, 0xD83DDCF7U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 216, 0xD83DDCF9U, 0x0U, 2);
-	new (toFill++) EmojiData(567, 216, 0xD83DDCFAU, 0x0U, 2);
-	new (toFill++) EmojiData(594, 216, 0xD83DDCFBU, 0x0U, 2);
-	new (toFill++) EmojiData(243, 216, 0xD83DDCFCU, 0x0U, 2);
-	new (toFill++) EmojiData(1026, 432, 0xD83DDD00U, 0x0U, 2);
-	new (toFill++) EmojiData(1053, 432, 0xD83DDD01U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 459, 0xD83DDD02U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 513, 0xD83DDD03U, 0x0U, 2);
-	new (toFill++) EmojiData(621, 432, 0xD83DDD04U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 243, 0xD83DDD05U, 0x0U, 2);
-	new (toFill++) EmojiData(81, 243, 0xD83DDD06U, 0x0U, 2);
-	new (toFill++) EmojiData(702, 216, 0xD83DDD07U, 0x0U, 2);
-	new (toFill++) EmojiData(675, 216, 0xD83DDD08U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 216, 0xD83DDD09U, 0x0U, 2);
-	new (toFill++) EmojiData(621, 216, 0xD83DDD0AU, 0x0U, 2);
-	new (toFill++) EmojiData(162, 243, 0xD83DDD0BU, 0x0U, 2);
-	new (toFill++) EmojiData(135, 243, 0xD83DDD0CU, 0x0U, 2);
-	new (toFill++) EmojiData(189, 243, 0xD83DDD0DU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 243, 0xD83DDD0EU, 0x0U, 2);
-	new (toFill++) EmojiData(999, 216, 0xD83DDD0FU, 0x0U, 2);
-	new (toFill++) EmojiData(1026, 216, 0xD83DDD10U, 0x0U, 2);
-	new (toFill++) EmojiData(1053, 216, 0xD83DDD11U, 0x0U, 2);
-	new (toFill++) EmojiData(972, 216, 0xD83DDD12U, 0x0U, 2);
-	new (toFill++) EmojiData(945, 216, 0xD83DDD13U, 0x0U, 2);
-	new (toFill++) EmojiData(729, 216, 0xD83DDD14U, 0x0U, 2);
-	new (toFill++) EmojiData(756, 216, 0xD83DDD15U, 0x0U, 2);
-	new (toFill++) EmojiData(891, 270, 0xD83DDD16U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 540, 0xD83DDD17U, 0x0U, 2);
-	new (toFill++) EmojiData(513, 540, 0xD83DDD18U, 0x0U, 2);
-	new (toFill++) EmojiData(513, 513, 0xD83DDD19U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 513, 0xD83DDD1AU, 0x0U, 2);
-	new (toFill++) EmojiData(540, 513, 0xD83DDD1BU, 0x0U, 2);
-	new (toFill++) EmojiData(567, 513, 0xD83DDD1CU, 0x0U, 2);
-	new (toFill++) EmojiData(459, 513, 0xD83DDD1DU, 0x0U, 2);
-	new (toFill++) EmojiData(108, 486, 0xD83DDD1EU, 0x0U, 2);
-	new (toFill++) EmojiData(162, 432, 0xD83DDD1FU, 0x0U, 2);
-	new (toFill++) EmojiData(378, 432, 0xD83DDD20U, 0x0U, 2);
-	new (toFill++) EmojiData(405, 432, 0xD83DDD21U, 0x0U, 2);
-	new (toFill++) EmojiData(189, 432, 0xD83DDD22U, 0x0U, 2);
-	new (toFill++) EmojiData(243, 432, 0xD83DDD23U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 432, 0xD83DDD24U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 54, 0xD83DDD25U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 243, 0xD83DDD26U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 243, 0xD83DDD27U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 243, 0xD83DDD28U, 0x0U, 2);
-	new (toFill++) EmojiData(351, 243, 0xD83DDD29U, 0x0U, 2);
-	new (toFill++) EmojiData(513, 243, 0xD83DDD2AU, 0x0U, 2);
-	new (toFill++) EmojiData(486, 243, 0xD83DDD2BU, 0x0U, 2);
-	new (toFill++) EmojiData(945, 270, 0xD83DDD2CU, 0x0U, 2);
-	new (toFill++) EmojiData(972, 270, 0xD83DDD2DU, 0x0U, 2);
-	new (toFill++) EmojiData(135, 216, 0xD83DDD2EU, 0x0U, 2);
-	new (toFill++) EmojiData(27, 513, 0xD83DDD2FU, 0x0U, 2);
-	new (toFill++) EmojiData(432, 405, 0xD83DDD30U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 540, 0xD83DDD31U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 540, 0xD83DDD32U, 0x0U, 2);
-	new (toFill++) EmojiData(891, 540, 0xD83DDD33U, 0x0U, 2);
-	new (toFill++) EmojiData(972, 540, 0xD83DDD34U, 0x0U, 2);
-	new (toFill++) EmojiData(999, 540, 0xD83DDD35U, 0x0U, 2);
-	new (toFill++) EmojiData(27, 567, 0xD83DDD36U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 567, 0xD83DDD37U, 0x0U, 2);
-	new (toFill++) EmojiData(81, 567, 0xD83DDD38U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 567, 0xD83DDD39U, 0x0U, 2);
-	new (toFill++) EmojiData(837, 540, 0xD83DDD3AU, 0x0U, 2);
-	new (toFill++) EmojiData(1026, 540, 0xD83DDD3BU, 0x0U, 2);
-	new (toFill++) EmojiData(702, 432, 0xD83DDD3CU, 0x0U, 2);
-	new (toFill++) EmojiData(729, 432, 0xD83DDD3DU, 0x0U, 2);
-	new (toFill++) EmojiData(675, 513, 0xD83DDD50U, 0x0U, 2);
-	new (toFill++) EmojiData(729, 513, 0xD83DDD51U, 0x0U, 2);
-	new (toFill++) EmojiData(783, 513, 0xD83DDD52U, 0x0U, 2);
-	new (toFill++) EmojiData(837, 513, 0xD83DDD53U, 0x0U, 2);
-	new (toFill++) EmojiData(891, 513, 0xD83DDD54U, 0x0U, 2);
-	new (toFill++) EmojiData(945, 513, 0xD83DDD55U, 0x0U, 2);
-	new (toFill++) EmojiData(972, 513, 0xD83DDD56U, 0x0U, 2);
-	new (toFill++) EmojiData(999, 513, 0xD83DDD57U, 0x0U, 2);
-	new (toFill++) EmojiData(1026, 513, 0xD83DDD58U, 0x0U, 2);
-	new (toFill++) EmojiData(1053, 513, 0xD83DDD59U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 540, 0xD83DDD5AU, 0x0U, 2);
-	new (toFill++) EmojiData(621, 513, 0xD83DDD5BU, 0x0U, 2);
-	new (toFill++) EmojiData(702, 513, 0xD83DDD5CU, 0x0U, 2);
-	new (toFill++) EmojiData(756, 513, 0xD83DDD5DU, 0x0U, 2);
-	new (toFill++) EmojiData(810, 513, 0xD83DDD5EU, 0x0U, 2);
-	new (toFill++) EmojiData(864, 513, 0xD83DDD5FU, 0x0U, 2);
-	new (toFill++) EmojiData(918, 513, 0xD83DDD60U, 0x0U, 2);
-	new (toFill++) EmojiData(27, 540, 0xD83DDD61U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 540, 0xD83DDD62U, 0x0U, 2);
-	new (toFill++) EmojiData(81, 540, 0xD83DDD63U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 540, 0xD83DDD64U, 0x0U, 2);
-	new (toFill++) EmojiData(135, 540, 0xD83DDD65U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 540, 0xD83DDD66U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 513, 0xD83DDD67U, 0x0U, 2);
-	new (toFill++) EmojiData(999, 351, 0xD83DDDFBU, 0x0U, 2);
-	new (toFill++) EmojiData(945, 351, 0xD83DDDFCU, 0x0U, 2);
-	new (toFill++) EmojiData(27, 378, 0xD83DDDFDU, 0x0U, 2);
-	new (toFill++) EmojiData(972, 351, 0xD83DDDFEU, 0x0U, 2);
-	new (toFill++) EmojiData(567, 405, 0xD83DDDFFU, 0x0U, 2);
-	new (toFill++) EmojiData(54, 0, 0xD83DDE00U, 0x0U, 2);
-	new (toFill++) EmojiData(405, 0, 0xD83DDE01U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 0, 0xD83DDE02U, 0x0U, 2);
-	new (toFill++) EmojiData(27, 0, 0xD83DDE03U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 0, 0xD83DDE04U, 0x0U, 2);
-	new (toFill++) EmojiData(729, 0, 0xD83DDE05U, 0x0U, 2);
-	new (toFill++) EmojiData(999, 0, 0xD83DDE06U, 0x0U, 2);
-	new (toFill++) EmojiData(405, 27, 0xD83DDE07U, 0x0U, 2);
-	new (toFill++) EmojiData(189, 27, 0xD83DDE08U, 0x0U, 2);
-	new (toFill++) EmojiData(135, 0, 0xD83DDE09U, 0x0U, 2);
-	new (toFill++) EmojiData(81, 0, 0xD83DDE0AU, 0x0U, 2);
-	new (toFill++) EmojiData(1026, 0, 0xD83DDE0BU, 0x0U, 2);
-	new (toFill++) EmojiData(459, 0, 0xD83DDE0CU, 0x0U, 2);
-	new (toFill++) EmojiData(162, 0, 0xD83DDE0DU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 27, 0xD83DDE0EU, 0x0U, 2);
-	new (toFill++) EmojiData(432, 27, 0xD83DDE0FU, 0x0U, 2);
-	new (toFill++) EmojiData(297, 27, 0xD83DDE10U, 0x0U, 2);
-	new (toFill++) EmojiData(459, 27, 0xD83DDE11U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 0, 0xD83DDE12U, 0x0U, 2);
-	new (toFill++) EmojiData(756, 0, 0xD83DDE13U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 0, 0xD83DDE14U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 27, 0xD83DDE15U, 0x0U, 2);
-	new (toFill++) EmojiData(972, 0, 0xD83DDE16U, 0x0U, 2);
-	new (toFill++) EmojiData(243, 0, 0xD83DDE17U, 0x0U, 2);
-	new (toFill++) EmojiData(189, 0, 0xD83DDE18U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 0, 0xD83DDE19U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 0, 0xD83DDE1AU, 0x0U, 2);
-	new (toFill++) EmojiData(351, 0, 0xD83DDE1BU, 0x0U, 2);
-	new (toFill++) EmojiData(297, 0, 0xD83DDE1CU, 0x0U, 2);
-	new (toFill++) EmojiData(324, 0, 0xD83DDE1DU, 0x0U, 2);
-	new (toFill++) EmojiData(513, 0, 0xD83DDE1EU, 0x0U, 2);
-	new (toFill++) EmojiData(108, 27, 0xD83DDE1FU, 0x0U, 2);
-	new (toFill++) EmojiData(891, 0, 0xD83DDE20U, 0x0U, 2);
-	new (toFill++) EmojiData(918, 0, 0xD83DDE21U, 0x0U, 2);
-	new (toFill++) EmojiData(567, 0, 0xD83DDE22U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 0, 0xD83DDE23U, 0x0U, 2);
-	new (toFill++) EmojiData(945, 0, 0xD83DDE24U, 0x0U, 2);
-	new (toFill++) EmojiData(675, 0, 0xD83DDE25U, 0x0U, 2);
-	new (toFill++) EmojiData(135, 27, 0xD83DDE26U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 27, 0xD83DDE27U, 0x0U, 2);
-	new (toFill++) EmojiData(837, 0, 0xD83DDE28U, 0x0U, 2);
-	new (toFill++) EmojiData(783, 0, 0xD83DDE29U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 0, 0xD83DDE2AU, 0x0U, 2);
-	new (toFill++) EmojiData(810, 0, 0xD83DDE2BU, 0x0U, 2);
-	new (toFill++) EmojiData(270, 27, 0xD83DDE2CU, 0x0U, 2);
-	new (toFill++) EmojiData(621, 0, 0xD83DDE2DU, 0x0U, 2);
-	new (toFill++) EmojiData(243, 27, 0xD83DDE2EU, 0x0U, 2);
-	new (toFill++) EmojiData(351, 27, 0xD83DDE2FU, 0x0U, 2);
-	new (toFill++) EmojiData(702, 0, 0xD83DDE30U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 0, 0xD83DDE31U, 0x0U, 2);
-	new (toFill++) EmojiData(81, 27, 0xD83DDE32U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 0, 0xD83DDE33U, 0x0U, 2);
-	new (toFill++) EmojiData(27, 27, 0xD83DDE34U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 27, 0xD83DDE35U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 27, 0xD83DDE36U, 0x0U, 2);
-	new (toFill++) EmojiData(1053, 0, 0xD83DDE37U, 0x0U, 2);
-	new (toFill++) EmojiData(918, 27, 0xD83DDE38U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 54, 0xD83DDE39U, 0x0U, 2);
-	new (toFill++) EmojiData(891, 27, 0xD83DDE3AU, 0x0U, 2);
-	new (toFill++) EmojiData(945, 27, 0xD83DDE3BU, 0x0U, 2);
-	new (toFill++) EmojiData(999, 27, 0xD83DDE3CU, 0x0U, 2);
-	new (toFill++) EmojiData(972, 27, 0xD83DDE3DU, 0x0U, 2);
-	new (toFill++) EmojiData(27, 54, 0xD83DDE3EU, 0x0U, 2);
-	new (toFill++) EmojiData(1053, 27, 0xD83DDE3FU, 0x0U, 2);
-	new (toFill++) EmojiData(1026, 27, 0xD83DDE40U, 0x0U, 2);
-	new (toFill++) EmojiData(378, 81, 0xD83DDE45U, 0x0U, 2);
-	new (toFill++) EmojiData(351, 81, 0xD83DDE46U, 0x0U, 2);
-	new (toFill++) EmojiData(621, 81, 0xD83DDE47U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 54, 0xD83DDE48U, 0x0U, 2);
-	new (toFill++) EmojiData(135, 54, 0xD83DDE49U, 0x0U, 2);
-	new (toFill++) EmojiData(162, 54, 0xD83DDE4AU, 0x0U, 2);
-	new (toFill++) EmojiData(432, 81, 0xD83DDE4BU, 0x0U, 2);
-	new (toFill++) EmojiData(1026, 54, 0xD83DDE4CU, 0x0U, 2);
-	new (toFill++) EmojiData(594, 81, 0xD83DDE4DU, 0x0U, 2);
-	new (toFill++) EmojiData(567, 81, 0xD83DDE4EU, 0x0U, 2);
-	new (toFill++) EmojiData(1053, 54, 0xD83DDE4FU, 0x0U, 2);
-	new (toFill++) EmojiData(324, 378, 0xD83DDE80U, 0x0U, 2);
-	new (toFill++) EmojiData(405, 378, 0xD83DDE81U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 378, 0xD83DDE82U, 0x0U, 2);
-	new (toFill++) EmojiData(729, 378, 0xD83DDE83U, 0x0U, 2);
-	new (toFill++) EmojiData(567, 378, 0xD83DDE84U, 0x0U, 2);
-	new (toFill++) EmojiData(594, 378, 0xD83DDE85U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 378, 0xD83DDE86U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 378, 0xD83DDE87U, 0x0U, 2);
-	new (toFill++) EmojiData(621, 378, 0xD83DDE88U, 0x0U, 2);
-	new (toFill++) EmojiData(486, 378, 0xD83DDE89U, 0x0U, 2);
-	new (toFill++) EmojiData(459, 378, 0xD83DDE8AU, 0x0U, 2);
-	new (toFill++) EmojiData(702, 378, 0xD83DDE8BU, 0x0U, 2);
-	new (toFill++) EmojiData(783, 378, 0xD83DDE8CU, 0x0U, 2);
-	new (toFill++) EmojiData(810, 378, 0xD83DDE8DU, 0x0U, 2);
-	new (toFill++) EmojiData(756, 378, 0xD83DDE8EU, 0x0U, 2);
-	new (toFill++) EmojiData(270, 405, 0xD83DDE8FU, 0x0U, 2);
-	new (toFill++) EmojiData(81, 405, 0xD83DDE90U, 0x0U, 2);
-	new (toFill++) EmojiData(54, 405, 0xD83DDE91U, 0x0U, 2);
-	new (toFill++) EmojiData(27, 405, 0xD83DDE92U, 0x0U, 2);
-	new (toFill++) EmojiData(1053, 378, 0xD83DDE93U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 405, 0xD83DDE94U, 0x0U, 2);
-	new (toFill++) EmojiData(918, 378, 0xD83DDE95U, 0x0U, 2);
-	new (toFill++) EmojiData(945, 378, 0xD83DDE96U, 0x0U, 2);
-	new (toFill++) EmojiData(891, 378, 0xD83DDE97U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 378, 0xD83DDE98U, 0x0U, 2);
-	new (toFill++) EmojiData(837, 378, 0xD83DDE99U, 0x0U, 2);
-	new (toFill++) EmojiData(999, 378, 0xD83DDE9AU, 0x0U, 2);
-	new (toFill++) EmojiData(972, 378, 0xD83DDE9BU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 405, 0xD83DDE9CU, 0x0U, 2);
-	new (toFill++) EmojiData(675, 378, 0xD83DDE9DU, 0x0U, 2);
-	new (toFill++) EmojiData(513, 378, 0xD83DDE9EU, 0x0U, 2);
-	new (toFill++) EmojiData(162, 405, 0xD83DDE9FU, 0x0U, 2);
-	new (toFill++) EmojiData(189, 405, 0xD83DDEA0U, 0x0U, 2);
-	new (toFill++) EmojiData(135, 405, 0xD83DDEA1U, 0x0U, 2);
-	new (toFill++) EmojiData(189, 378, 0xD83DDEA2U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 378, 0xD83DDEA3U, 0x0U, 2);
-	new (toFill++) EmojiData(243, 378, 0xD83DDEA4U, 0x0U, 2);
-	new (toFill++) EmojiData(351, 405, 0xD83DDEA5U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 405, 0xD83DDEA6U, 0x0U, 2);
-	new (toFill++) EmojiData(405, 405, 0xD83DDEA7U, 0x0U, 2);
-	new (toFill++) EmojiData(1026, 378, 0xD83DDEA8U, 0x0U, 2);
-	new (toFill++) EmojiData(675, 405, 0xD83DDEA9U, 0x0U, 2);
-	new (toFill++) EmojiData(405, 243, 0xD83DDEAAU, 0x0U, 2);
-	new (toFill++) EmojiData(81, 486, 0xD83DDEABU, 0x0U, 2);
-	new (toFill++) EmojiData(432, 243, 0xD83DDEACU, 0x0U, 2);
-	new (toFill++) EmojiData(756, 459, 0xD83DDEADU, 0x0U, 2);
-	new (toFill++) EmojiData(675, 459, 0xD83DDEAEU, 0x0U, 2);
-	new (toFill++) EmojiData(162, 486, 0xD83DDEAFU, 0x0U, 2);
-	new (toFill++) EmojiData(648, 459, 0xD83DDEB0U, 0x0U, 2);
-	new (toFill++) EmojiData(189, 486, 0xD83DDEB1U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 405, 0xD83DDEB2U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 486, 0xD83DDEB3U, 0x0U, 2);
-	new (toFill++) EmojiData(729, 297, 0xD83DDEB4U, 0x0U, 2);
-	new (toFill++) EmojiData(702, 297, 0xD83DDEB5U, 0x0U, 2);
-	new (toFill++) EmojiData(81, 81, 0xD83DDEB6U, 0x0U, 2);
-	new (toFill++) EmojiData(243, 486, 0xD83DDEB7U, 0x0U, 2);
-	new (toFill++) EmojiData(270, 486, 0xD83DDEB8U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 459, 0xD83DDEB9U, 0x0U, 2);
-	new (toFill++) EmojiData(567, 459, 0xD83DDEBAU, 0x0U, 2);
-	new (toFill++) EmojiData(513, 459, 0xD83DDEBBU, 0x0U, 2);
-	new (toFill++) EmojiData(594, 459, 0xD83DDEBCU, 0x0U, 2);
-	new (toFill++) EmojiData(297, 243, 0xD83DDEBDU, 0x0U, 2);
-	new (toFill++) EmojiData(621, 459, 0xD83DDEBEU, 0x0U, 2);
-	new (toFill++) EmojiData(270, 243, 0xD83DDEBFU, 0x0U, 2);
-	new (toFill++) EmojiData(243, 243, 0xD83DDEC0U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 243, 0xD83DDEC1U, 0x0U, 2);
-	new (toFill++) EmojiData(891, 459, 0xD83DDEC2U, 0x0U, 2);
-	new (toFill++) EmojiData(972, 459, 0xD83DDEC3U, 0x0U, 2);
-	new (toFill++) EmojiData(918, 459, 0xD83DDEC4U, 0x0U, 2);
-	new (toFill++) EmojiData(945, 459, 0xD83DDEC5U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 81, 4, 0xA9U, 0x0U, 1);
+	new (toFill++) EmojiData(297, 81, 4, 0xAEU, 0x0U, 1);
+	new (toFill++) EmojiData(378, 81, 4, 0x203CU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(405, 81, 4, 0x2049U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(324, 81, 4, 0x2122U, 0x0U, 1);
+	new (toFill++) EmojiData(918, 0, 4, 0x2139U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(675, 0, 4, 0x2194U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(702, 0, 4, 0x2195U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(594, 0, 4, 0x2196U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(567, 0, 4, 0x2197U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(621, 0, 4, 0x2198U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(648, 0, 4, 0x2199U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(864, 0, 4, 0x21A9U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(891, 0, 4, 0x21AAU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(243, 27, 2, 0x231AU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(189, 27, 2, 0x231BU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(972, 0, 4, 0x23E9U, 0x0U, 1);
+	new (toFill++) EmojiData(945, 0, 4, 0x23EAU, 0x0U, 1);
+	new (toFill++) EmojiData(999, 0, 4, 0x23EBU, 0x0U, 1);
+	new (toFill++) EmojiData(1026, 0, 4, 0x23ECU, 0x0U, 1);
+	new (toFill++) EmojiData(216, 27, 2, 0x23F0U, 0x0U, 1);
+	new (toFill++) EmojiData(162, 27, 2, 0x23F3U, 0x0U, 1);
+	new (toFill++) EmojiData(972, 27, 4, 0x24C2U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(891, 108, 4, 0x25AAU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(918, 108, 4, 0x25ABU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(783, 0, 4, 0x25B6U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(756, 0, 4, 0x25C0U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(810, 108, 4, 0x25FBU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(783, 108, 4, 0x25FCU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(864, 108, 4, 0x25FDU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(837, 108, 4, 0x25FEU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(675, 54, 1, 0x2600U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(729, 54, 1, 0x2601U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(837, 0, 2, 0x260EU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(594, 108, 4, 0x2611U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(783, 54, 1, 0x2614U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(297, 108, 2, 0x2615U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(0, 81, 0, 0x261DU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(108, 0, 0, 0x263AU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(864, 54, 4, 0x2648U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(891, 54, 4, 0x2649U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(918, 54, 4, 0x264AU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(945, 54, 4, 0x264BU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(972, 54, 4, 0x264CU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(999, 54, 4, 0x264DU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1026, 54, 4, 0x264EU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1053, 54, 4, 0x264FU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(0, 81, 4, 0x2650U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(27, 81, 4, 0x2651U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(54, 81, 4, 0x2652U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(81, 81, 4, 0x2653U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(405, 108, 4, 0x2660U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(459, 108, 4, 0x2663U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(432, 108, 4, 0x2665U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(486, 108, 4, 0x2666U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(135, 54, 3, 0x2668U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(837, 54, 4, 0x267BU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(837, 27, 4, 0x267FU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(972, 0, 3, 0x2693U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1053, 27, 3, 0x26A0U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(756, 54, 1, 0x26A1U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1053, 108, 4, 0x26AAU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1026, 108, 4, 0x26ABU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(918, 81, 2, 0x26BDU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(945, 81, 2, 0x26BEU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(837, 54, 1, 0x26C4U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(702, 54, 1, 0x26C5U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(108, 81, 4, 0x26CEU, 0x0U, 1);
+	new (toFill++) EmojiData(405, 54, 4, 0x26D4U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(297, 0, 3, 0x26EAU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(810, 0, 3, 0x26F2U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(0, 108, 2, 0x26F3U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(891, 0, 3, 0x26F5U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(486, 0, 3, 0x26FAU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(54, 54, 3, 0x26FDU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(864, 54, 2, 0x2702U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(513, 54, 4, 0x2705U, 0x0U, 1);
+	new (toFill++) EmojiData(1026, 0, 3, 0x2708U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(216, 54, 2, 0x2709U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(783, 54, 0, 0x270AU, 0x0U, 1);
+	new (toFill++) EmojiData(864, 54, 0, 0x270BU, 0x0U, 1);
+	new (toFill++) EmojiData(810, 54, 0, 0x270CU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(972, 54, 2, 0x270FU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(945, 54, 2, 0x2712U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(567, 108, 4, 0x2714U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(297, 108, 4, 0x2716U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(297, 54, 0, 0x2728U, 0x0U, 1);
+	new (toFill++) EmojiData(432, 54, 4, 0x2733U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(540, 54, 4, 0x2734U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(810, 54, 1, 0x2744U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(459, 54, 4, 0x2747U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(351, 81, 4, 0x274CU, 0x0U, 1);
+	new (toFill++) EmojiData(486, 54, 4, 0x274EU, 0x0U, 1);
+	new (toFill++) EmojiData(459, 81, 4, 0x2753U, 0x0U, 1);
+	new (toFill++) EmojiData(513, 81, 4, 0x2754U, 0x0U, 1);
+	new (toFill++) EmojiData(486, 81, 4, 0x2755U, 0x0U, 1);
+	new (toFill++) EmojiData(432, 81, 4, 0x2757U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(324, 108, 0, 0x2764U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(324, 108, 4, 0x2795U, 0x0U, 1);
+	new (toFill++) EmojiData(351, 108, 4, 0x2796U, 0x0U, 1);
+	new (toFill++) EmojiData(378, 108, 4, 0x2797U, 0x0U, 1);
+	new (toFill++) EmojiData(459, 0, 4, 0x27A1U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(675, 108, 4, 0x27B0U, 0x0U, 1);
+	new (toFill++) EmojiData(810, 54, 4, 0x27BFU, 0x0U, 1);
+	new (toFill++) EmojiData(0, 27, 4, 0x2934U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1053, 0, 4, 0x2935U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(432, 0, 4, 0x2B05U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(378, 0, 4, 0x2B06U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(405, 0, 4, 0x2B07U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(108, 135, 4, 0x2B1BU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(81, 135, 4, 0x2B1CU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(648, 54, 1, 0x2B50U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(540, 81, 4, 0x2B55U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(702, 108, 4, 0x3030U, 0x0U, 1);
+	new (toFill++) EmojiData(729, 108, 4, 0x303DU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(81, 54, 4, 0x3297U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(54, 54, 4, 0x3299U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(324, 0, 4, 0x2320E3U, 0x0U, 2);
+	new (toFill++) EmojiData(243, 0, 4, 0x3020E3U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 0, 4, 0x3120E3U, 0x0U, 2);
+	new (toFill++) EmojiData(27, 0, 4, 0x3220E3U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 0, 4, 0x3320E3U, 0x0U, 2);
+	new (toFill++) EmojiData(81, 0, 4, 0x3420E3U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 0, 4, 0x3520E3U, 0x0U, 2);
+	new (toFill++) EmojiData(135, 0, 4, 0x3620E3U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 0, 4, 0x3720E3U, 0x0U, 2);
+	new (toFill++) EmojiData(189, 0, 4, 0x3820E3U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 0, 4, 0x3920E3U, 0x0U, 2);
+	new (toFill++) EmojiData(783, 81, 2, 0xD83CDC04U, 0x0U, 2, 0xFE0F);
+	new (toFill++) EmojiData(729, 81, 2, 0xD83CDCCFU, 0x0U, 2);
+	new (toFill++) EmojiData(675, 54, 4, 0xD83CDD70U, 0x0U, 2);
+	new (toFill++) EmojiData(702, 54, 4, 0xD83CDD71U, 0x0U, 2);
+	new (toFill++) EmojiData(756, 54, 4, 0xD83CDD7EU, 0x0U, 2);
+	new (toFill++) EmojiData(810, 27, 4, 0xD83CDD7FU, 0x0U, 2, 0xFE0F);
+	new (toFill++) EmojiData(729, 54, 4, 0xD83CDD8EU, 0x0U, 2);
+	new (toFill++) EmojiData(108, 54, 4, 0xD83CDD91U, 0x0U, 2);
+	new (toFill++) EmojiData(189, 27, 4, 0xD83CDD92U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 27, 4, 0xD83CDD93U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 54, 4, 0xD83CDD94U, 0x0U, 2);
+	new (toFill++) EmojiData(135, 27, 4, 0xD83CDD95U, 0x0U, 2);
+	new (toFill++) EmojiData(243, 27, 4, 0xD83CDD96U, 0x0U, 2);
+	new (toFill++) EmojiData(27, 27, 4, 0xD83CDD97U, 0x0U, 2);
+	new (toFill++) EmojiData(135, 54, 4, 0xD83CDD98U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 27, 4, 0xD83CDD99U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 54, 4, 0xD83CDD9AU, 0x0U, 2);
+	new (toFill++) EmojiData(378, 54, 3, 0xD83CDDE8U, 0xD83CDDF3U, 4);
+	new (toFill++) EmojiData(351, 54, 3, 0xD83CDDE9U, 0xD83CDDEAU, 4);
+	new (toFill++) EmojiData(459, 54, 3, 0xD83CDDEAU, 0xD83CDDF8U, 4);
+	new (toFill++) EmojiData(432, 54, 3, 0xD83CDDEBU, 0xD83CDDF7U, 4);
+	new (toFill++) EmojiData(540, 54, 3, 0xD83CDDECU, 0xD83CDDE7U, 4);
+	new (toFill++) EmojiData(486, 54, 3, 0xD83CDDEEU, 0xD83CDDF9U, 4);
+	new (toFill++) EmojiData(297, 54, 3, 0xD83CDDEFU, 0xD83CDDF5U, 4);
+	new (toFill++) EmojiData(324, 54, 3, 0xD83CDDF0U, 0xD83CDDF7U, 4);
+	new (toFill++) EmojiData(513, 54, 3, 0xD83CDDF7U, 0xD83CDDFAU, 4);
+	new (toFill++) EmojiData(405, 54, 3, 0xD83CDDFAU, 0xD83CDDF8U, 4);
+	new (toFill++) EmojiData(324, 27, 4, 0xD83CDE01U, 0x0U, 2);
+	new (toFill++) EmojiData(945, 27, 4, 0xD83CDE02U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 27, 4, 0xD83CDE1AU, 0x0U, 2, 0xFE0F);
+	new (toFill++) EmojiData(351, 27, 4, 0xD83CDE2FU, 0x0U, 2, 0xFE0F);
+	new (toFill++) EmojiData(459, 27, 4, 0xD83CDE32U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 27, 4, 0xD83CDE33U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 27, 4, 0xD83CDE34U, 0x0U, 2);
+	new (toFill++) EmojiData(405, 27, 4, 0xD83CDE35U, 0x0U, 2);
+	new (toFill++) EmojiData(567, 27, 4, 0xD83CDE36U, 0x0U, 2);
+	new (toFill++) EmojiData(891, 27, 4, 0xD83CDE37U, 0x0U, 2);
+	new (toFill++) EmojiData(918, 27, 4, 0xD83CDE38U, 0x0U, 2);
+	new (toFill++) EmojiData(513, 27, 4, 0xD83CDE39U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 27, 4, 0xD83CDE3AU, 0x0U, 2);
+	new (toFill++) EmojiData(486, 27, 4, 0xD83CDE50U, 0x0U, 2);
+	new (toFill++) EmojiData(27, 54, 4, 0xD83CDE51U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 54, 1, 0xD83CDF00U, 0x0U, 2);
+	new (toFill++) EmojiData(891, 54, 1, 0xD83CDF01U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 108, 0, 0xD83CDF02U, 0x0U, 2);
+	new (toFill++) EmojiData(675, 0, 3, 0xD83CDF03U, 0x0U, 2);
+	new (toFill++) EmojiData(621, 0, 3, 0xD83CDF04U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 0, 3, 0xD83CDF05U, 0x0U, 2);
+	new (toFill++) EmojiData(405, 0, 3, 0xD83CDF06U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 0, 3, 0xD83CDF07U, 0x0U, 2);
+	new (toFill++) EmojiData(918, 54, 1, 0xD83CDF08U, 0x0U, 2);
+	new (toFill++) EmojiData(729, 0, 3, 0xD83CDF09U, 0x0U, 2);
+	new (toFill++) EmojiData(945, 54, 1, 0xD83CDF0AU, 0x0U, 2);
+	new (toFill++) EmojiData(567, 54, 1, 0xD83CDF0BU, 0x0U, 2);
+	new (toFill++) EmojiData(594, 54, 1, 0xD83CDF0CU, 0x0U, 2);
+	new (toFill++) EmojiData(486, 54, 1, 0xD83CDF0DU, 0x0U, 2);
+	new (toFill++) EmojiData(513, 54, 1, 0xD83CDF0EU, 0x0U, 2);
+	new (toFill++) EmojiData(540, 54, 1, 0xD83CDF0FU, 0x0U, 2);
+	new (toFill++) EmojiData(81, 54, 1, 0xD83CDF10U, 0x0U, 2);
+	new (toFill++) EmojiData(189, 54, 1, 0xD83CDF11U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 54, 1, 0xD83CDF12U, 0x0U, 2);
+	new (toFill++) EmojiData(243, 54, 1, 0xD83CDF13U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 54, 1, 0xD83CDF14U, 0x0U, 2);
+	new (toFill++) EmojiData(297, 54, 1, 0xD83CDF15U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 54, 1, 0xD83CDF16U, 0x0U, 2);
+	new (toFill++) EmojiData(351, 54, 1, 0xD83CDF17U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 54, 1, 0xD83CDF18U, 0x0U, 2);
+	new (toFill++) EmojiData(459, 54, 1, 0xD83CDF19U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 54, 1, 0xD83CDF1AU, 0x0U, 2);
+	new (toFill++) EmojiData(432, 54, 1, 0xD83CDF1BU, 0x0U, 2);
+	new (toFill++) EmojiData(405, 54, 1, 0xD83CDF1CU, 0x0U, 2);
+	new (toFill++) EmojiData(135, 54, 1, 0xD83CDF1DU, 0x0U, 2);
+	new (toFill++) EmojiData(108, 54, 1, 0xD83CDF1EU, 0x0U, 2);
+	new (toFill++) EmojiData(324, 54, 0, 0xD83CDF1FU, 0x0U, 2);
+	new (toFill++) EmojiData(621, 54, 1, 0xD83CDF20U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 54, 1, 0xD83CDF30U, 0x0U, 2);
+	new (toFill++) EmojiData(27, 54, 1, 0xD83CDF31U, 0x0U, 2);
+	new (toFill++) EmojiData(1026, 27, 1, 0xD83CDF32U, 0x0U, 2);
+	new (toFill++) EmojiData(1053, 27, 1, 0xD83CDF33U, 0x0U, 2);
+	new (toFill++) EmojiData(999, 27, 1, 0xD83CDF34U, 0x0U, 2);
+	new (toFill++) EmojiData(972, 27, 1, 0xD83CDF35U, 0x0U, 2);
+	new (toFill++) EmojiData(675, 27, 1, 0xD83CDF37U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 27, 1, 0xD83CDF38U, 0x0U, 2);
+	new (toFill++) EmojiData(729, 27, 1, 0xD83CDF39U, 0x0U, 2);
+	new (toFill++) EmojiData(783, 27, 1, 0xD83CDF3AU, 0x0U, 2);
+	new (toFill++) EmojiData(756, 27, 1, 0xD83CDF3BU, 0x0U, 2);
+	new (toFill++) EmojiData(54, 54, 1, 0xD83CDF3CU, 0x0U, 2);
+	new (toFill++) EmojiData(783, 135, 2, 0xD83CDF3DU, 0x0U, 2);
+	new (toFill++) EmojiData(918, 27, 1, 0xD83CDF3EU, 0x0U, 2);
+	new (toFill++) EmojiData(891, 27, 1, 0xD83CDF3FU, 0x0U, 2);
+	new (toFill++) EmojiData(702, 27, 1, 0xD83CDF40U, 0x0U, 2);
+	new (toFill++) EmojiData(810, 27, 1, 0xD83CDF41U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 27, 1, 0xD83CDF42U, 0x0U, 2);
+	new (toFill++) EmojiData(837, 27, 1, 0xD83CDF43U, 0x0U, 2);
+	new (toFill++) EmojiData(945, 27, 1, 0xD83CDF44U, 0x0U, 2);
+	new (toFill++) EmojiData(756, 135, 2, 0xD83CDF45U, 0x0U, 2);
+	new (toFill++) EmojiData(729, 135, 2, 0xD83CDF46U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 135, 2, 0xD83CDF47U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 135, 2, 0xD83CDF48U, 0x0U, 2);
+	new (toFill++) EmojiData(513, 135, 2, 0xD83CDF49U, 0x0U, 2);
+	new (toFill++) EmojiData(405, 135, 2, 0xD83CDF4AU, 0x0U, 2);
+	new (toFill++) EmojiData(432, 135, 2, 0xD83CDF4BU, 0x0U, 2);
+	new (toFill++) EmojiData(621, 135, 2, 0xD83CDF4CU, 0x0U, 2);
+	new (toFill++) EmojiData(675, 135, 2, 0xD83CDF4DU, 0x0U, 2);
+	new (toFill++) EmojiData(351, 135, 2, 0xD83CDF4EU, 0x0U, 2);
+	new (toFill++) EmojiData(378, 135, 2, 0xD83CDF4FU, 0x0U, 2);
+	new (toFill++) EmojiData(648, 135, 2, 0xD83CDF50U, 0x0U, 2);
+	new (toFill++) EmojiData(567, 135, 2, 0xD83CDF51U, 0x0U, 2);
+	new (toFill++) EmojiData(459, 135, 2, 0xD83CDF52U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 135, 2, 0xD83CDF53U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 108, 2, 0xD83CDF54U, 0x0U, 2);
+	new (toFill++) EmojiData(567, 108, 2, 0xD83CDF55U, 0x0U, 2);
+	new (toFill++) EmojiData(675, 108, 2, 0xD83CDF56U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 108, 2, 0xD83CDF57U, 0x0U, 2);
+	new (toFill++) EmojiData(891, 108, 2, 0xD83CDF58U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 108, 2, 0xD83CDF59U, 0x0U, 2);
+	new (toFill++) EmojiData(918, 108, 2, 0xD83CDF5AU, 0x0U, 2);
+	new (toFill++) EmojiData(729, 108, 2, 0xD83CDF5BU, 0x0U, 2);
+	new (toFill++) EmojiData(945, 108, 2, 0xD83CDF5CU, 0x0U, 2);
+	new (toFill++) EmojiData(702, 108, 2, 0xD83CDF5DU, 0x0U, 2);
+	new (toFill++) EmojiData(0, 135, 2, 0xD83CDF5EU, 0x0U, 2);
+	new (toFill++) EmojiData(621, 108, 2, 0xD83CDF5FU, 0x0U, 2);
+	new (toFill++) EmojiData(702, 135, 2, 0xD83CDF60U, 0x0U, 2);
+	new (toFill++) EmojiData(1026, 108, 2, 0xD83CDF61U, 0x0U, 2);
+	new (toFill++) EmojiData(999, 108, 2, 0xD83CDF62U, 0x0U, 2);
+	new (toFill++) EmojiData(810, 108, 2, 0xD83CDF63U, 0x0U, 2);
+	new (toFill++) EmojiData(756, 108, 2, 0xD83CDF64U, 0x0U, 2);
+	new (toFill++) EmojiData(837, 108, 2, 0xD83CDF65U, 0x0U, 2);
+	new (toFill++) EmojiData(81, 135, 2, 0xD83CDF66U, 0x0U, 2);
+	new (toFill++) EmojiData(135, 135, 2, 0xD83CDF67U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 135, 2, 0xD83CDF68U, 0x0U, 2);
+	new (toFill++) EmojiData(27, 135, 2, 0xD83CDF69U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 135, 2, 0xD83CDF6AU, 0x0U, 2);
+	new (toFill++) EmojiData(243, 135, 2, 0xD83CDF6BU, 0x0U, 2);
+	new (toFill++) EmojiData(270, 135, 2, 0xD83CDF6CU, 0x0U, 2);
+	new (toFill++) EmojiData(297, 135, 2, 0xD83CDF6DU, 0x0U, 2);
+	new (toFill++) EmojiData(54, 135, 2, 0xD83CDF6EU, 0x0U, 2);
+	new (toFill++) EmojiData(324, 135, 2, 0xD83CDF6FU, 0x0U, 2);
+	new (toFill++) EmojiData(189, 135, 2, 0xD83CDF70U, 0x0U, 2);
+	new (toFill++) EmojiData(783, 108, 2, 0xD83CDF71U, 0x0U, 2);
+	new (toFill++) EmojiData(972, 108, 2, 0xD83CDF72U, 0x0U, 2);
+	new (toFill++) EmojiData(1053, 108, 2, 0xD83CDF73U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 108, 2, 0xD83CDF74U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 108, 2, 0xD83CDF75U, 0x0U, 2);
+	new (toFill++) EmojiData(351, 108, 2, 0xD83CDF76U, 0x0U, 2);
+	new (toFill++) EmojiData(513, 108, 2, 0xD83CDF77U, 0x0U, 2);
+	new (toFill++) EmojiData(459, 108, 2, 0xD83CDF78U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 108, 2, 0xD83CDF79U, 0x0U, 2);
+	new (toFill++) EmojiData(405, 108, 2, 0xD83CDF7AU, 0x0U, 2);
+	new (toFill++) EmojiData(432, 108, 2, 0xD83CDF7BU, 0x0U, 2);
+	new (toFill++) EmojiData(378, 108, 2, 0xD83CDF7CU, 0x0U, 2);
+	new (toFill++) EmojiData(135, 108, 0, 0xD83CDF80U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 0, 2, 0xD83CDF81U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 135, 2, 0xD83CDF82U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 0, 2, 0xD83CDF83U, 0x0U, 2);
+	new (toFill++) EmojiData(351, 0, 2, 0xD83CDF84U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 0, 2, 0xD83CDF85U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 0, 2, 0xD83CDF86U, 0x0U, 2);
+	new (toFill++) EmojiData(189, 0, 2, 0xD83CDF87U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 0, 2, 0xD83CDF88U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 0, 2, 0xD83CDF89U, 0x0U, 2);
+	new (toFill++) EmojiData(459, 0, 2, 0xD83CDF8AU, 0x0U, 2);
+	new (toFill++) EmojiData(405, 0, 2, 0xD83CDF8BU, 0x0U, 2);
+	new (toFill++) EmojiData(513, 0, 2, 0xD83CDF8CU, 0x0U, 2);
+	new (toFill++) EmojiData(0, 0, 2, 0xD83CDF8DU, 0x0U, 2);
+	new (toFill++) EmojiData(54, 0, 2, 0xD83CDF8EU, 0x0U, 2);
+	new (toFill++) EmojiData(135, 0, 2, 0xD83CDF8FU, 0x0U, 2);
+	new (toFill++) EmojiData(216, 0, 2, 0xD83CDF90U, 0x0U, 2);
+	new (toFill++) EmojiData(243, 0, 2, 0xD83CDF91U, 0x0U, 2);
+	new (toFill++) EmojiData(81, 0, 2, 0xD83CDF92U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 0, 2, 0xD83CDF93U, 0x0U, 2);
+	new (toFill++) EmojiData(756, 0, 3, 0xD83CDFA0U, 0x0U, 2);
+	new (toFill++) EmojiData(783, 0, 3, 0xD83CDFA1U, 0x0U, 2);
+	new (toFill++) EmojiData(837, 0, 3, 0xD83CDFA2U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 108, 2, 0xD83CDFA3U, 0x0U, 2);
+	new (toFill++) EmojiData(405, 81, 2, 0xD83CDFA4U, 0x0U, 2);
+	new (toFill++) EmojiData(567, 0, 2, 0xD83CDFA5U, 0x0U, 2);
+	new (toFill++) EmojiData(297, 27, 4, 0xD83CDFA6U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 81, 2, 0xD83CDFA7U, 0x0U, 2);
+	new (toFill++) EmojiData(351, 81, 2, 0xD83CDFA8U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 81, 0, 0xD83CDFA9U, 0x0U, 2);
+	new (toFill++) EmojiData(189, 54, 3, 0xD83CDFAAU, 0x0U, 2);
+	new (toFill++) EmojiData(972, 27, 3, 0xD83CDFABU, 0x0U, 2);
+	new (toFill++) EmojiData(378, 81, 2, 0xD83CDFACU, 0x0U, 2);
+	new (toFill++) EmojiData(216, 54, 3, 0xD83CDFADU, 0x0U, 2);
+	new (toFill++) EmojiData(702, 81, 2, 0xD83CDFAEU, 0x0U, 2);
+	new (toFill++) EmojiData(837, 81, 2, 0xD83CDFAFU, 0x0U, 2);
+	new (toFill++) EmojiData(108, 54, 3, 0xD83CDFB0U, 0x0U, 2);
+	new (toFill++) EmojiData(999, 81, 2, 0xD83CDFB1U, 0x0U, 2);
+	new (toFill++) EmojiData(810, 81, 2, 0xD83CDFB2U, 0x0U, 2);
+	new (toFill++) EmojiData(1053, 81, 2, 0xD83CDFB3U, 0x0U, 2);
+	new (toFill++) EmojiData(756, 81, 2, 0xD83CDFB4U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 81, 2, 0xD83CDFB5U, 0x0U, 2);
+	new (toFill++) EmojiData(513, 81, 2, 0xD83CDFB6U, 0x0U, 2);
+	new (toFill++) EmojiData(621, 81, 2, 0xD83CDFB7U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 81, 2, 0xD83CDFB8U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 81, 2, 0xD83CDFB9U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 81, 2, 0xD83CDFBAU, 0x0U, 2);
+	new (toFill++) EmojiData(567, 81, 2, 0xD83CDFBBU, 0x0U, 2);
+	new (toFill++) EmojiData(459, 81, 2, 0xD83CDFBCU, 0x0U, 2);
+	new (toFill++) EmojiData(972, 81, 0, 0xD83CDFBDU, 0x0U, 2);
+	new (toFill++) EmojiData(972, 81, 2, 0xD83CDFBEU, 0x0U, 2);
+	new (toFill++) EmojiData(162, 108, 2, 0xD83CDFBFU, 0x0U, 2);
+	new (toFill++) EmojiData(891, 81, 2, 0xD83CDFC0U, 0x0U, 2);
+	new (toFill++) EmojiData(81, 108, 2, 0xD83CDFC1U, 0x0U, 2);
+	new (toFill++) EmojiData(189, 108, 2, 0xD83CDFC2U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 81, 0, 0xD83CDFC3U, 0x0U, 2);
+	new (toFill++) EmojiData(243, 108, 2, 0xD83CDFC4U, 0x0U, 2);
+	new (toFill++) EmojiData(135, 108, 2, 0xD83CDFC6U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 108, 2, 0xD83CDFC7U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 81, 2, 0xD83CDFC8U, 0x0U, 2);
+	new (toFill++) EmojiData(1026, 81, 2, 0xD83CDFC9U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 108, 2, 0xD83CDFCAU, 0x0U, 2);
+	new (toFill++) EmojiData(0, 0, 3, 0xD83CDFE0U, 0x0U, 2);
+	new (toFill++) EmojiData(27, 0, 3, 0xD83CDFE1U, 0x0U, 2);
+	new (toFill++) EmojiData(81, 0, 3, 0xD83CDFE2U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 0, 3, 0xD83CDFE3U, 0x0U, 2);
+	new (toFill++) EmojiData(351, 0, 3, 0xD83CDFE4U, 0x0U, 2);
+	new (toFill++) EmojiData(135, 0, 3, 0xD83CDFE5U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 0, 3, 0xD83CDFE6U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 81, 4, 0xD83CDFE7U, 0x0U, 2);
+	new (toFill++) EmojiData(243, 0, 3, 0xD83CDFE8U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 0, 3, 0xD83CDFE9U, 0x0U, 2);
+	new (toFill++) EmojiData(189, 0, 3, 0xD83CDFEAU, 0x0U, 2);
+	new (toFill++) EmojiData(54, 0, 3, 0xD83CDFEBU, 0x0U, 2);
+	new (toFill++) EmojiData(324, 0, 3, 0xD83CDFECU, 0x0U, 2);
+	new (toFill++) EmojiData(513, 0, 3, 0xD83CDFEDU, 0x0U, 2);
+	new (toFill++) EmojiData(81, 54, 3, 0xD83CDFEEU, 0x0U, 2);
+	new (toFill++) EmojiData(432, 0, 3, 0xD83CDFEFU, 0x0U, 2);
+	new (toFill++) EmojiData(459, 0, 3, 0xD83CDFF0U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 27, 1, 0xD83DDC00U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 27, 1, 0xD83DDC01U, 0x0U, 2);
+	new (toFill++) EmojiData(351, 27, 1, 0xD83DDC02U, 0x0U, 2);
+	new (toFill++) EmojiData(81, 27, 1, 0xD83DDC03U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 27, 1, 0xD83DDC04U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 27, 1, 0xD83DDC05U, 0x0U, 2);
+	new (toFill++) EmojiData(513, 27, 1, 0xD83DDC06U, 0x0U, 2);
+	new (toFill++) EmojiData(135, 27, 1, 0xD83DDC07U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 27, 1, 0xD83DDC08U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 27, 1, 0xD83DDC09U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 27, 1, 0xD83DDC0AU, 0x0U, 2);
+	new (toFill++) EmojiData(1053, 0, 1, 0xD83DDC0BU, 0x0U, 2);
+	new (toFill++) EmojiData(864, 0, 1, 0xD83DDC0CU, 0x0U, 2);
+	new (toFill++) EmojiData(702, 0, 1, 0xD83DDC0DU, 0x0U, 2);
+	new (toFill++) EmojiData(189, 27, 1, 0xD83DDC0EU, 0x0U, 2);
+	new (toFill++) EmojiData(27, 27, 1, 0xD83DDC0FU, 0x0U, 2);
+	new (toFill++) EmojiData(216, 27, 1, 0xD83DDC10U, 0x0U, 2);
+	new (toFill++) EmojiData(459, 0, 1, 0xD83DDC11U, 0x0U, 2);
+	new (toFill++) EmojiData(405, 0, 1, 0xD83DDC12U, 0x0U, 2);
+	new (toFill++) EmojiData(243, 27, 1, 0xD83DDC13U, 0x0U, 2);
+	new (toFill++) EmojiData(675, 0, 1, 0xD83DDC14U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 27, 1, 0xD83DDC15U, 0x0U, 2);
+	new (toFill++) EmojiData(297, 27, 1, 0xD83DDC16U, 0x0U, 2);
+	new (toFill++) EmojiData(351, 0, 1, 0xD83DDC17U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 0, 1, 0xD83DDC18U, 0x0U, 2);
+	new (toFill++) EmojiData(891, 0, 1, 0xD83DDC19U, 0x0U, 2);
+	new (toFill++) EmojiData(918, 0, 1, 0xD83DDC1AU, 0x0U, 2);
+	new (toFill++) EmojiData(756, 0, 1, 0xD83DDC1BU, 0x0U, 2);
+	new (toFill++) EmojiData(810, 0, 1, 0xD83DDC1CU, 0x0U, 2);
+	new (toFill++) EmojiData(783, 0, 1, 0xD83DDC1DU, 0x0U, 2);
+	new (toFill++) EmojiData(837, 0, 1, 0xD83DDC1EU, 0x0U, 2);
+	new (toFill++) EmojiData(972, 0, 1, 0xD83DDC1FU, 0x0U, 2);
+	new (toFill++) EmojiData(945, 0, 1, 0xD83DDC20U, 0x0U, 2);
+	new (toFill++) EmojiData(405, 27, 1, 0xD83DDC21U, 0x0U, 2);
+	new (toFill++) EmojiData(729, 0, 1, 0xD83DDC22U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 0, 1, 0xD83DDC23U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 0, 1, 0xD83DDC24U, 0x0U, 2);
+	new (toFill++) EmojiData(621, 0, 1, 0xD83DDC25U, 0x0U, 2);
+	new (toFill++) EmojiData(567, 0, 1, 0xD83DDC26U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 0, 1, 0xD83DDC27U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 0, 1, 0xD83DDC28U, 0x0U, 2);
+	new (toFill++) EmojiData(567, 27, 1, 0xD83DDC29U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 27, 1, 0xD83DDC2AU, 0x0U, 2);
+	new (toFill++) EmojiData(459, 27, 1, 0xD83DDC2BU, 0x0U, 2);
+	new (toFill++) EmojiData(999, 0, 1, 0xD83DDC2CU, 0x0U, 2);
+	new (toFill++) EmojiData(81, 0, 1, 0xD83DDC2DU, 0x0U, 2);
+	new (toFill++) EmojiData(324, 0, 1, 0xD83DDC2EU, 0x0U, 2);
+	new (toFill++) EmojiData(189, 0, 1, 0xD83DDC2FU, 0x0U, 2);
+	new (toFill++) EmojiData(135, 0, 1, 0xD83DDC30U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 0, 1, 0xD83DDC31U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 27, 1, 0xD83DDC32U, 0x0U, 2);
+	new (toFill++) EmojiData(1026, 0, 1, 0xD83DDC33U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 0, 1, 0xD83DDC34U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 0, 1, 0xD83DDC35U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 0, 1, 0xD83DDC36U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 0, 1, 0xD83DDC37U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 0, 1, 0xD83DDC38U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 0, 1, 0xD83DDC39U, 0x0U, 2);
+	new (toFill++) EmojiData(27, 0, 1, 0xD83DDC3AU, 0x0U, 2);
+	new (toFill++) EmojiData(243, 0, 1, 0xD83DDC3BU, 0x0U, 2);
+	new (toFill++) EmojiData(513, 0, 1, 0xD83DDC3CU, 0x0U, 2);
+	new (toFill++) EmojiData(297, 0, 1, 0xD83DDC3DU, 0x0U, 2);
+	new (toFill++) EmojiData(594, 27, 1, 0xD83DDC3EU, 0x0U, 2);
+	new (toFill++) EmojiData(567, 54, 0, 0xD83DDC40U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 54, 0, 0xD83DDC42U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 54, 0, 0xD83DDC43U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 54, 0, 0xD83DDC44U, 0x0U, 2);
+	new (toFill++) EmojiData(621, 54, 0, 0xD83DDC45U, 0x0U, 2);
+	new (toFill++) EmojiData(918, 54, 0, 0xD83DDC46U, 0x0U, 2);
+	new (toFill++) EmojiData(945, 54, 0, 0xD83DDC47U, 0x0U, 2);
+	new (toFill++) EmojiData(999, 54, 0, 0xD83DDC48U, 0x0U, 2);
+	new (toFill++) EmojiData(972, 54, 0, 0xD83DDC49U, 0x0U, 2);
+	new (toFill++) EmojiData(756, 54, 0, 0xD83DDC4AU, 0x0U, 2);
+	new (toFill++) EmojiData(837, 54, 0, 0xD83DDC4BU, 0x0U, 2);
+	new (toFill++) EmojiData(729, 54, 0, 0xD83DDC4CU, 0x0U, 2);
+	new (toFill++) EmojiData(675, 54, 0, 0xD83DDC4DU, 0x0U, 2);
+	new (toFill++) EmojiData(702, 54, 0, 0xD83DDC4EU, 0x0U, 2);
+	new (toFill++) EmojiData(27, 81, 0, 0xD83DDC4FU, 0x0U, 2);
+	new (toFill++) EmojiData(891, 54, 0, 0xD83DDC50U, 0x0U, 2);
+	new (toFill++) EmojiData(675, 81, 0, 0xD83DDC51U, 0x0U, 2);
+	new (toFill++) EmojiData(702, 81, 0, 0xD83DDC52U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 108, 0, 0xD83DDC53U, 0x0U, 2);
+	new (toFill++) EmojiData(891, 81, 0, 0xD83DDC54U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 81, 0, 0xD83DDC55U, 0x0U, 2);
+	new (toFill++) EmojiData(999, 81, 0, 0xD83DDC56U, 0x0U, 2);
+	new (toFill++) EmojiData(945, 81, 0, 0xD83DDC57U, 0x0U, 2);
+	new (toFill++) EmojiData(1026, 81, 0, 0xD83DDC58U, 0x0U, 2);
+	new (toFill++) EmojiData(1053, 81, 0, 0xD83DDC59U, 0x0U, 2);
+	new (toFill++) EmojiData(918, 81, 0, 0xD83DDC5AU, 0x0U, 2);
+	new (toFill++) EmojiData(81, 108, 0, 0xD83DDC5BU, 0x0U, 2);
+	new (toFill++) EmojiData(27, 108, 0, 0xD83DDC5CU, 0x0U, 2);
+	new (toFill++) EmojiData(54, 108, 0, 0xD83DDC5DU, 0x0U, 2);
+	new (toFill++) EmojiData(756, 81, 0, 0xD83DDC5EU, 0x0U, 2);
+	new (toFill++) EmojiData(729, 81, 0, 0xD83DDC5FU, 0x0U, 2);
+	new (toFill++) EmojiData(810, 81, 0, 0xD83DDC60U, 0x0U, 2);
+	new (toFill++) EmojiData(783, 81, 0, 0xD83DDC61U, 0x0U, 2);
+	new (toFill++) EmojiData(837, 81, 0, 0xD83DDC62U, 0x0U, 2);
+	new (toFill++) EmojiData(729, 108, 0, 0xD83DDC63U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 108, 0, 0xD83DDC64U, 0x0U, 2);
+	new (toFill++) EmojiData(675, 108, 0, 0xD83DDC65U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 27, 0, 0xD83DDC66U, 0x0U, 2);
+	new (toFill++) EmojiData(675, 27, 0, 0xD83DDC67U, 0x0U, 2);
+	new (toFill++) EmojiData(702, 27, 0, 0xD83DDC68U, 0x0U, 2);
+	new (toFill++) EmojiData(729, 27, 0, 0xD83DDC69U, 0x0U, 2);
+	new (toFill++) EmojiData(189, 81, 0, 0xD83DDC6AU, 0x0U, 2);
+	new (toFill++) EmojiData(162, 81, 0, 0xD83DDC6BU, 0x0U, 2);
+	new (toFill++) EmojiData(216, 81, 0, 0xD83DDC6CU, 0x0U, 2);
+	new (toFill++) EmojiData(243, 81, 0, 0xD83DDC6DU, 0x0U, 2);
+	new (toFill++) EmojiData(540, 27, 0, 0xD83DDC6EU, 0x0U, 2);
+	new (toFill++) EmojiData(324, 81, 0, 0xD83DDC6FU, 0x0U, 2);
+	new (toFill++) EmojiData(540, 81, 0, 0xD83DDC70U, 0x0U, 2);
+	new (toFill++) EmojiData(810, 27, 0, 0xD83DDC71U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 27, 0, 0xD83DDC72U, 0x0U, 2);
+	new (toFill++) EmojiData(513, 27, 0, 0xD83DDC73U, 0x0U, 2);
+	new (toFill++) EmojiData(756, 27, 0, 0xD83DDC74U, 0x0U, 2);
+	new (toFill++) EmojiData(783, 27, 0, 0xD83DDC75U, 0x0U, 2);
+	new (toFill++) EmojiData(621, 27, 0, 0xD83DDC76U, 0x0U, 2);
+	new (toFill++) EmojiData(567, 27, 0, 0xD83DDC77U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 27, 0, 0xD83DDC78U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 54, 0, 0xD83DDC79U, 0x0U, 2);
+	new (toFill++) EmojiData(81, 54, 0, 0xD83DDC7AU, 0x0U, 2);
+	new (toFill++) EmojiData(297, 0, 2, 0xD83DDC7BU, 0x0U, 2);
+	new (toFill++) EmojiData(837, 27, 0, 0xD83DDC7CU, 0x0U, 2);
+	new (toFill++) EmojiData(216, 54, 0, 0xD83DDC7DU, 0x0U, 2);
+	new (toFill++) EmojiData(675, 81, 2, 0xD83DDC7EU, 0x0U, 2);
+	new (toFill++) EmojiData(216, 27, 0, 0xD83DDC7FU, 0x0U, 2);
+	new (toFill++) EmojiData(189, 54, 0, 0xD83DDC80U, 0x0U, 2);
+	new (toFill++) EmojiData(405, 81, 0, 0xD83DDC81U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 27, 0, 0xD83DDC82U, 0x0U, 2);
+	new (toFill++) EmojiData(135, 81, 0, 0xD83DDC83U, 0x0U, 2);
+	new (toFill++) EmojiData(189, 108, 0, 0xD83DDC84U, 0x0U, 2);
+	new (toFill++) EmojiData(513, 81, 0, 0xD83DDC85U, 0x0U, 2);
+	new (toFill++) EmojiData(459, 81, 0, 0xD83DDC86U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 81, 0, 0xD83DDC87U, 0x0U, 2);
+	new (toFill++) EmojiData(918, 27, 3, 0xD83DDC88U, 0x0U, 2);
+	new (toFill++) EmojiData(972, 27, 2, 0xD83DDC89U, 0x0U, 2);
+	new (toFill++) EmojiData(945, 27, 2, 0xD83DDC8AU, 0x0U, 2);
+	new (toFill++) EmojiData(567, 108, 0, 0xD83DDC8BU, 0x0U, 2);
+	new (toFill++) EmojiData(540, 108, 0, 0xD83DDC8CU, 0x0U, 2);
+	new (toFill++) EmojiData(594, 108, 0, 0xD83DDC8DU, 0x0U, 2);
+	new (toFill++) EmojiData(621, 108, 0, 0xD83DDC8EU, 0x0U, 2);
+	new (toFill++) EmojiData(270, 81, 0, 0xD83DDC8FU, 0x0U, 2);
+	new (toFill++) EmojiData(621, 27, 1, 0xD83DDC90U, 0x0U, 2);
+	new (toFill++) EmojiData(297, 81, 0, 0xD83DDC91U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 0, 3, 0xD83DDC92U, 0x0U, 2);
+	new (toFill++) EmojiData(405, 108, 0, 0xD83DDC93U, 0x0U, 2);
+	new (toFill++) EmojiData(351, 108, 0, 0xD83DDC94U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 108, 0, 0xD83DDC95U, 0x0U, 2);
+	new (toFill++) EmojiData(459, 108, 0, 0xD83DDC96U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 108, 0, 0xD83DDC97U, 0x0U, 2);
+	new (toFill++) EmojiData(513, 108, 0, 0xD83DDC98U, 0x0U, 2);
+	new (toFill++) EmojiData(243, 108, 0, 0xD83DDC99U, 0x0U, 2);
+	new (toFill++) EmojiData(297, 108, 0, 0xD83DDC9AU, 0x0U, 2);
+	new (toFill++) EmojiData(216, 108, 0, 0xD83DDC9BU, 0x0U, 2);
+	new (toFill++) EmojiData(270, 108, 0, 0xD83DDC9CU, 0x0U, 2);
+	new (toFill++) EmojiData(27, 0, 2, 0xD83DDC9DU, 0x0U, 2);
+	new (toFill++) EmojiData(486, 108, 0, 0xD83DDC9EU, 0x0U, 2);
+	new (toFill++) EmojiData(567, 54, 4, 0xD83DDC9FU, 0x0U, 2);
+	new (toFill++) EmojiData(783, 54, 4, 0xD83DDCA0U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 27, 2, 0xD83DDCA1U, 0x0U, 2);
+	new (toFill++) EmojiData(405, 54, 0, 0xD83DDCA2U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 27, 2, 0xD83DDCA3U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 54, 0, 0xD83DDCA4U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 54, 0, 0xD83DDCA5U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 54, 0, 0xD83DDCA6U, 0x0U, 2);
+	new (toFill++) EmojiData(459, 54, 0, 0xD83DDCA7U, 0x0U, 2);
+	new (toFill++) EmojiData(513, 54, 0, 0xD83DDCA8U, 0x0U, 2);
+	new (toFill++) EmojiData(243, 54, 0, 0xD83DDCA9U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 81, 0, 0xD83DDCAAU, 0x0U, 2);
+	new (toFill++) EmojiData(351, 54, 0, 0xD83DDCABU, 0x0U, 2);
+	new (toFill++) EmojiData(702, 108, 0, 0xD83DDCACU, 0x0U, 2);
+	new (toFill++) EmojiData(756, 108, 0, 0xD83DDCADU, 0x0U, 2);
+	new (toFill++) EmojiData(513, 108, 4, 0xD83DDCAEU, 0x0U, 2);
+	new (toFill++) EmojiData(540, 108, 4, 0xD83DDCAFU, 0x0U, 2);
+	new (toFill++) EmojiData(999, 27, 2, 0xD83DDCB0U, 0x0U, 2);
+	new (toFill++) EmojiData(243, 81, 4, 0xD83DDCB1U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 81, 4, 0xD83DDCB2U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 54, 2, 0xD83DDCB3U, 0x0U, 2);
+	new (toFill++) EmojiData(1026, 27, 2, 0xD83DDCB4U, 0x0U, 2);
+	new (toFill++) EmojiData(1053, 27, 2, 0xD83DDCB5U, 0x0U, 2);
+	new (toFill++) EmojiData(27, 54, 2, 0xD83DDCB6U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 54, 2, 0xD83DDCB7U, 0x0U, 2);
+	new (toFill++) EmojiData(81, 54, 2, 0xD83DDCB8U, 0x0U, 2);
+	new (toFill++) EmojiData(189, 81, 4, 0xD83DDCB9U, 0x0U, 2);
+	new (toFill++) EmojiData(1053, 0, 3, 0xD83DDCBAU, 0x0U, 2);
+	new (toFill++) EmojiData(783, 0, 2, 0xD83DDCBBU, 0x0U, 2);
+	new (toFill++) EmojiData(0, 108, 0, 0xD83DDCBCU, 0x0U, 2);
+	new (toFill++) EmojiData(729, 0, 2, 0xD83DDCBDU, 0x0U, 2);
+	new (toFill++) EmojiData(756, 0, 2, 0xD83DDCBEU, 0x0U, 2);
+	new (toFill++) EmojiData(675, 0, 2, 0xD83DDCBFU, 0x0U, 2);
+	new (toFill++) EmojiData(702, 0, 2, 0xD83DDCC0U, 0x0U, 2);
+	new (toFill++) EmojiData(810, 54, 2, 0xD83DDCC1U, 0x0U, 2);
+	new (toFill++) EmojiData(837, 54, 2, 0xD83DDCC2U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 54, 2, 0xD83DDCC3U, 0x0U, 2);
+	new (toFill++) EmojiData(513, 54, 2, 0xD83DDCC4U, 0x0U, 2);
+	new (toFill++) EmojiData(729, 54, 2, 0xD83DDCC5U, 0x0U, 2);
+	new (toFill++) EmojiData(756, 54, 2, 0xD83DDCC6U, 0x0U, 2);
+	new (toFill++) EmojiData(783, 54, 2, 0xD83DDCC7U, 0x0U, 2);
+	new (toFill++) EmojiData(621, 54, 2, 0xD83DDCC8U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 54, 2, 0xD83DDCC9U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 54, 2, 0xD83DDCCAU, 0x0U, 2);
+	new (toFill++) EmojiData(702, 54, 2, 0xD83DDCCBU, 0x0U, 2);
+	new (toFill++) EmojiData(891, 54, 2, 0xD83DDCCCU, 0x0U, 2);
+	new (toFill++) EmojiData(243, 54, 3, 0xD83DDCCDU, 0x0U, 2);
+	new (toFill++) EmojiData(918, 54, 2, 0xD83DDCCEU, 0x0U, 2);
+	new (toFill++) EmojiData(999, 54, 2, 0xD83DDCCFU, 0x0U, 2);
+	new (toFill++) EmojiData(1026, 54, 2, 0xD83DDCD0U, 0x0U, 2);
+	new (toFill++) EmojiData(567, 54, 2, 0xD83DDCD1U, 0x0U, 2);
+	new (toFill++) EmojiData(135, 81, 2, 0xD83DDCD2U, 0x0U, 2);
+	new (toFill++) EmojiData(81, 81, 2, 0xD83DDCD3U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 81, 2, 0xD83DDCD4U, 0x0U, 2);
+	new (toFill++) EmojiData(1053, 54, 2, 0xD83DDCD5U, 0x0U, 2);
+	new (toFill++) EmojiData(189, 81, 2, 0xD83DDCD6U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 81, 2, 0xD83DDCD7U, 0x0U, 2);
+	new (toFill++) EmojiData(27, 81, 2, 0xD83DDCD8U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 81, 2, 0xD83DDCD9U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 81, 2, 0xD83DDCDAU, 0x0U, 2);
+	new (toFill++) EmojiData(243, 81, 2, 0xD83DDCDBU, 0x0U, 2);
+	new (toFill++) EmojiData(675, 54, 2, 0xD83DDCDCU, 0x0U, 2);
+	new (toFill++) EmojiData(486, 54, 2, 0xD83DDCDDU, 0x0U, 2);
+	new (toFill++) EmojiData(864, 0, 2, 0xD83DDCDEU, 0x0U, 2);
+	new (toFill++) EmojiData(891, 0, 2, 0xD83DDCDFU, 0x0U, 2);
+	new (toFill++) EmojiData(918, 0, 2, 0xD83DDCE0U, 0x0U, 2);
+	new (toFill++) EmojiData(945, 0, 2, 0xD83DDCE1U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 27, 2, 0xD83DDCE2U, 0x0U, 2);
+	new (toFill++) EmojiData(135, 27, 2, 0xD83DDCE3U, 0x0U, 2);
+	new (toFill++) EmojiData(189, 54, 2, 0xD83DDCE4U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 54, 2, 0xD83DDCE5U, 0x0U, 2);
+	new (toFill++) EmojiData(459, 54, 2, 0xD83DDCE6U, 0x0U, 2);
+	new (toFill++) EmojiData(135, 54, 2, 0xD83DDCE7U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 54, 2, 0xD83DDCE8U, 0x0U, 2);
+	new (toFill++) EmojiData(243, 54, 2, 0xD83DDCE9U, 0x0U, 2);
+	new (toFill++) EmojiData(351, 54, 2, 0xD83DDCEAU, 0x0U, 2);
+	new (toFill++) EmojiData(324, 54, 2, 0xD83DDCEBU, 0x0U, 2);
+	new (toFill++) EmojiData(378, 54, 2, 0xD83DDCECU, 0x0U, 2);
+	new (toFill++) EmojiData(405, 54, 2, 0xD83DDCEDU, 0x0U, 2);
+	new (toFill++) EmojiData(432, 54, 2, 0xD83DDCEEU, 0x0U, 2);
+	new (toFill++) EmojiData(297, 54, 2, 0xD83DDCEFU, 0x0U, 2);
+	new (toFill++) EmojiData(324, 81, 2, 0xD83DDCF0U, 0x0U, 2);
+	new (toFill++) EmojiData(810, 0, 2, 0xD83DDCF1U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 54, 2, 0xD83DDCF2U, 0x0U, 2);
+	new (toFill++) EmojiData(621, 54, 4, 0xD83DDCF3U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 54, 4, 0xD83DDCF4U, 0x0U, 2);
+	new (toFill++) EmojiData(243, 54, 4, 0xD83DDCF5U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 27, 4, 0xD83DDCF6U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 0, 2, 0xD83DDCF7U, 0x0U, 2);
+	new (toFill++) EmojiData(621, 0, 2, 0xD83DDCF9U, 0x0U, 2);
+	new (toFill++) EmojiData(972, 0, 2, 0xD83DDCFAU, 0x0U, 2);
+	new (toFill++) EmojiData(999, 0, 2, 0xD83DDCFBU, 0x0U, 2);
+	new (toFill++) EmojiData(648, 0, 2, 0xD83DDCFCU, 0x0U, 2);
+	new (toFill++) EmojiData(54, 27, 4, 0xD83DDD00U, 0x0U, 2);
+	new (toFill++) EmojiData(81, 27, 4, 0xD83DDD01U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 27, 4, 0xD83DDD02U, 0x0U, 2);
+	new (toFill++) EmojiData(702, 81, 4, 0xD83DDD03U, 0x0U, 2);
+	new (toFill++) EmojiData(729, 0, 4, 0xD83DDD04U, 0x0U, 2);
+	new (toFill++) EmojiData(513, 27, 2, 0xD83DDD05U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 27, 2, 0xD83DDD06U, 0x0U, 2);
+	new (toFill++) EmojiData(27, 27, 2, 0xD83DDD07U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 27, 2, 0xD83DDD08U, 0x0U, 2);
+	new (toFill++) EmojiData(1053, 0, 2, 0xD83DDD09U, 0x0U, 2);
+	new (toFill++) EmojiData(1026, 0, 2, 0xD83DDD0AU, 0x0U, 2);
+	new (toFill++) EmojiData(567, 27, 2, 0xD83DDD0BU, 0x0U, 2);
+	new (toFill++) EmojiData(540, 27, 2, 0xD83DDD0CU, 0x0U, 2);
+	new (toFill++) EmojiData(594, 27, 2, 0xD83DDD0DU, 0x0U, 2);
+	new (toFill++) EmojiData(405, 27, 2, 0xD83DDD0EU, 0x0U, 2);
+	new (toFill++) EmojiData(324, 27, 2, 0xD83DDD0FU, 0x0U, 2);
+	new (toFill++) EmojiData(351, 27, 2, 0xD83DDD10U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 27, 2, 0xD83DDD11U, 0x0U, 2);
+	new (toFill++) EmojiData(297, 27, 2, 0xD83DDD12U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 27, 2, 0xD83DDD13U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 27, 2, 0xD83DDD14U, 0x0U, 2);
+	new (toFill++) EmojiData(81, 27, 2, 0xD83DDD15U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 81, 2, 0xD83DDD16U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 108, 4, 0xD83DDD17U, 0x0U, 2);
+	new (toFill++) EmojiData(621, 108, 4, 0xD83DDD18U, 0x0U, 2);
+	new (toFill++) EmojiData(621, 81, 4, 0xD83DDD19U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 81, 4, 0xD83DDD1AU, 0x0U, 2);
+	new (toFill++) EmojiData(648, 81, 4, 0xD83DDD1BU, 0x0U, 2);
+	new (toFill++) EmojiData(675, 81, 4, 0xD83DDD1CU, 0x0U, 2);
+	new (toFill++) EmojiData(567, 81, 4, 0xD83DDD1DU, 0x0U, 2);
+	new (toFill++) EmojiData(216, 54, 4, 0xD83DDD1EU, 0x0U, 2);
+	new (toFill++) EmojiData(270, 0, 4, 0xD83DDD1FU, 0x0U, 2);
+	new (toFill++) EmojiData(486, 0, 4, 0xD83DDD20U, 0x0U, 2);
+	new (toFill++) EmojiData(513, 0, 4, 0xD83DDD21U, 0x0U, 2);
+	new (toFill++) EmojiData(297, 0, 4, 0xD83DDD22U, 0x0U, 2);
+	new (toFill++) EmojiData(351, 0, 4, 0xD83DDD23U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 0, 4, 0xD83DDD24U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 54, 0, 0xD83DDD25U, 0x0U, 2);
+	new (toFill++) EmojiData(459, 27, 2, 0xD83DDD26U, 0x0U, 2);
+	new (toFill++) EmojiData(729, 27, 2, 0xD83DDD27U, 0x0U, 2);
+	new (toFill++) EmojiData(783, 27, 2, 0xD83DDD28U, 0x0U, 2);
+	new (toFill++) EmojiData(756, 27, 2, 0xD83DDD29U, 0x0U, 2);
+	new (toFill++) EmojiData(918, 27, 2, 0xD83DDD2AU, 0x0U, 2);
+	new (toFill++) EmojiData(891, 27, 2, 0xD83DDD2BU, 0x0U, 2);
+	new (toFill++) EmojiData(270, 81, 2, 0xD83DDD2CU, 0x0U, 2);
+	new (toFill++) EmojiData(297, 81, 2, 0xD83DDD2DU, 0x0U, 2);
+	new (toFill++) EmojiData(540, 0, 2, 0xD83DDD2EU, 0x0U, 2);
+	new (toFill++) EmojiData(135, 81, 4, 0xD83DDD2FU, 0x0U, 2);
+	new (toFill++) EmojiData(27, 54, 3, 0xD83DDD30U, 0x0U, 2);
+	new (toFill++) EmojiData(756, 108, 4, 0xD83DDD31U, 0x0U, 2);
+	new (toFill++) EmojiData(972, 108, 4, 0xD83DDD32U, 0x0U, 2);
+	new (toFill++) EmojiData(999, 108, 4, 0xD83DDD33U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 135, 4, 0xD83DDD34U, 0x0U, 2);
+	new (toFill++) EmojiData(27, 135, 4, 0xD83DDD35U, 0x0U, 2);
+	new (toFill++) EmojiData(135, 135, 4, 0xD83DDD36U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 135, 4, 0xD83DDD37U, 0x0U, 2);
+	new (toFill++) EmojiData(189, 135, 4, 0xD83DDD38U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 135, 4, 0xD83DDD39U, 0x0U, 2);
+	new (toFill++) EmojiData(945, 108, 4, 0xD83DDD3AU, 0x0U, 2);
+	new (toFill++) EmojiData(54, 135, 4, 0xD83DDD3BU, 0x0U, 2);
+	new (toFill++) EmojiData(810, 0, 4, 0xD83DDD3CU, 0x0U, 2);
+	new (toFill++) EmojiData(837, 0, 4, 0xD83DDD3DU, 0x0U, 2);
+	new (toFill++) EmojiData(783, 81, 4, 0xD83DDD50U, 0x0U, 2);
+	new (toFill++) EmojiData(837, 81, 4, 0xD83DDD51U, 0x0U, 2);
+	new (toFill++) EmojiData(891, 81, 4, 0xD83DDD52U, 0x0U, 2);
+	new (toFill++) EmojiData(945, 81, 4, 0xD83DDD53U, 0x0U, 2);
+	new (toFill++) EmojiData(999, 81, 4, 0xD83DDD54U, 0x0U, 2);
+	new (toFill++) EmojiData(1053, 81, 4, 0xD83DDD55U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 108, 4, 0xD83DDD56U, 0x0U, 2);
+	new (toFill++) EmojiData(27, 108, 4, 0xD83DDD57U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 108, 4, 0xD83DDD58U, 0x0U, 2);
+	new (toFill++) EmojiData(81, 108, 4, 0xD83DDD59U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 108, 4, 0xD83DDD5AU, 0x0U, 2);
+	new (toFill++) EmojiData(729, 81, 4, 0xD83DDD5BU, 0x0U, 2);
+	new (toFill++) EmojiData(810, 81, 4, 0xD83DDD5CU, 0x0U, 2);
+	new (toFill++) EmojiData(864, 81, 4, 0xD83DDD5DU, 0x0U, 2);
+	new (toFill++) EmojiData(918, 81, 4, 0xD83DDD5EU, 0x0U, 2);
+	new (toFill++) EmojiData(972, 81, 4, 0xD83DDD5FU, 0x0U, 2);
+	new (toFill++) EmojiData(1026, 81, 4, 0xD83DDD60U, 0x0U, 2);
+	new (toFill++) EmojiData(135, 108, 4, 0xD83DDD61U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 108, 4, 0xD83DDD62U, 0x0U, 2);
+	new (toFill++) EmojiData(189, 108, 4, 0xD83DDD63U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 108, 4, 0xD83DDD64U, 0x0U, 2);
+	new (toFill++) EmojiData(243, 108, 4, 0xD83DDD65U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 108, 4, 0xD83DDD66U, 0x0U, 2);
+	new (toFill++) EmojiData(756, 81, 4, 0xD83DDD67U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 0, 3, 0xD83DDDFBU, 0x0U, 2);
+	new (toFill++) EmojiData(540, 0, 3, 0xD83DDDFCU, 0x0U, 2);
+	new (toFill++) EmojiData(702, 0, 3, 0xD83DDDFDU, 0x0U, 2);
+	new (toFill++) EmojiData(567, 0, 3, 0xD83DDDFEU, 0x0U, 2);
+	new (toFill++) EmojiData(162, 54, 3, 0xD83DDDFFU, 0x0U, 2);
+	new (toFill++) EmojiData(54, 0, 0, 0xD83DDE00U, 0x0U, 2);
+	new (toFill++) EmojiData(405, 0, 0, 0xD83DDE01U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 0, 0, 0xD83DDE02U, 0x0U, 2);
+	new (toFill++) EmojiData(27, 0, 0, 0xD83DDE03U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 0, 0, 0xD83DDE04U, 0x0U, 2);
+	new (toFill++) EmojiData(729, 0, 0, 0xD83DDE05U, 0x0U, 2);
+	new (toFill++) EmojiData(999, 0, 0, 0xD83DDE06U, 0x0U, 2);
+	new (toFill++) EmojiData(405, 27, 0, 0xD83DDE07U, 0x0U, 2);
+	new (toFill++) EmojiData(189, 27, 0, 0xD83DDE08U, 0x0U, 2);
+	new (toFill++) EmojiData(135, 0, 0, 0xD83DDE09U, 0x0U, 2);
+	new (toFill++) EmojiData(81, 0, 0, 0xD83DDE0AU, 0x0U, 2);
+	new (toFill++) EmojiData(1026, 0, 0, 0xD83DDE0BU, 0x0U, 2);
+	new (toFill++) EmojiData(459, 0, 0, 0xD83DDE0CU, 0x0U, 2);
+	new (toFill++) EmojiData(162, 0, 0, 0xD83DDE0DU, 0x0U, 2);
+	new (toFill++) EmojiData(0, 27, 0, 0xD83DDE0EU, 0x0U, 2);
+	new (toFill++) EmojiData(432, 27, 0, 0xD83DDE0FU, 0x0U, 2);
+	new (toFill++) EmojiData(297, 27, 0, 0xD83DDE10U, 0x0U, 2);
+	new (toFill++) EmojiData(459, 27, 0, 0xD83DDE11U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 0, 0, 0xD83DDE12U, 0x0U, 2);
+	new (toFill++) EmojiData(756, 0, 0, 0xD83DDE13U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 0, 0, 0xD83DDE14U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 27, 0, 0xD83DDE15U, 0x0U, 2);
+	new (toFill++) EmojiData(972, 0, 0, 0xD83DDE16U, 0x0U, 2);
+	new (toFill++) EmojiData(243, 0, 0, 0xD83DDE17U, 0x0U, 2);
+	new (toFill++) EmojiData(189, 0, 0, 0xD83DDE18U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 0, 0, 0xD83DDE19U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 0, 0, 0xD83DDE1AU, 0x0U, 2);
+	new (toFill++) EmojiData(351, 0, 0, 0xD83DDE1BU, 0x0U, 2);
+	new (toFill++) EmojiData(297, 0, 0, 0xD83DDE1CU, 0x0U, 2);
+	new (toFill++) EmojiData(324, 0, 0, 0xD83DDE1DU, 0x0U, 2);
+	new (toFill++) EmojiData(513, 0, 0, 0xD83DDE1EU, 0x0U, 2);
+	new (toFill++) EmojiData(108, 27, 0, 0xD83DDE1FU, 0x0U, 2);
+	new (toFill++) EmojiData(891, 0, 0, 0xD83DDE20U, 0x0U, 2);
+	new (toFill++) EmojiData(918, 0, 0, 0xD83DDE21U, 0x0U, 2);
+	new (toFill++) EmojiData(567, 0, 0, 0xD83DDE22U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 0, 0, 0xD83DDE23U, 0x0U, 2);
+	new (toFill++) EmojiData(945, 0, 0, 0xD83DDE24U, 0x0U, 2);
+	new (toFill++) EmojiData(675, 0, 0, 0xD83DDE25U, 0x0U, 2);
+	new (toFill++) EmojiData(135, 27, 0, 0xD83DDE26U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 27, 0, 0xD83DDE27U, 0x0U, 2);
+	new (toFill++) EmojiData(837, 0, 0, 0xD83DDE28U, 0x0U, 2);
+	new (toFill++) EmojiData(783, 0, 0, 0xD83DDE29U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 0, 0, 0xD83DDE2AU, 0x0U, 2);
+	new (toFill++) EmojiData(810, 0, 0, 0xD83DDE2BU, 0x0U, 2);
+	new (toFill++) EmojiData(270, 27, 0, 0xD83DDE2CU, 0x0U, 2);
+	new (toFill++) EmojiData(621, 0, 0, 0xD83DDE2DU, 0x0U, 2);
+	new (toFill++) EmojiData(243, 27, 0, 0xD83DDE2EU, 0x0U, 2);
+	new (toFill++) EmojiData(351, 27, 0, 0xD83DDE2FU, 0x0U, 2);
+	new (toFill++) EmojiData(702, 0, 0, 0xD83DDE30U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 0, 0, 0xD83DDE31U, 0x0U, 2);
+	new (toFill++) EmojiData(81, 27, 0, 0xD83DDE32U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 0, 0, 0xD83DDE33U, 0x0U, 2);
+	new (toFill++) EmojiData(27, 27, 0, 0xD83DDE34U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 27, 0, 0xD83DDE35U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 27, 0, 0xD83DDE36U, 0x0U, 2);
+	new (toFill++) EmojiData(1053, 0, 0, 0xD83DDE37U, 0x0U, 2);
+	new (toFill++) EmojiData(918, 27, 0, 0xD83DDE38U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 54, 0, 0xD83DDE39U, 0x0U, 2);
+	new (toFill++) EmojiData(891, 27, 0, 0xD83DDE3AU, 0x0U, 2);
+	new (toFill++) EmojiData(945, 27, 0, 0xD83DDE3BU, 0x0U, 2);
+	new (toFill++) EmojiData(999, 27, 0, 0xD83DDE3CU, 0x0U, 2);
+	new (toFill++) EmojiData(972, 27, 0, 0xD83DDE3DU, 0x0U, 2);
+	new (toFill++) EmojiData(27, 54, 0, 0xD83DDE3EU, 0x0U, 2);
+	new (toFill++) EmojiData(1053, 27, 0, 0xD83DDE3FU, 0x0U, 2);
+	new (toFill++) EmojiData(1026, 27, 0, 0xD83DDE40U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 81, 0, 0xD83DDE45U, 0x0U, 2);
+	new (toFill++) EmojiData(351, 81, 0, 0xD83DDE46U, 0x0U, 2);
+	new (toFill++) EmojiData(621, 81, 0, 0xD83DDE47U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 54, 0, 0xD83DDE48U, 0x0U, 2);
+	new (toFill++) EmojiData(135, 54, 0, 0xD83DDE49U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 54, 0, 0xD83DDE4AU, 0x0U, 2);
+	new (toFill++) EmojiData(432, 81, 0, 0xD83DDE4BU, 0x0U, 2);
+	new (toFill++) EmojiData(1026, 54, 0, 0xD83DDE4CU, 0x0U, 2);
+	new (toFill++) EmojiData(594, 81, 0, 0xD83DDE4DU, 0x0U, 2);
+	new (toFill++) EmojiData(567, 81, 0, 0xD83DDE4EU, 0x0U, 2);
+	new (toFill++) EmojiData(1053, 54, 0, 0xD83DDE4FU, 0x0U, 2);
+	new (toFill++) EmojiData(999, 0, 3, 0xD83DDE80U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 27, 3, 0xD83DDE81U, 0x0U, 2);
+	new (toFill++) EmojiData(27, 27, 3, 0xD83DDE82U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 27, 3, 0xD83DDE83U, 0x0U, 2);
+	new (toFill++) EmojiData(162, 27, 3, 0xD83DDE84U, 0x0U, 2);
+	new (toFill++) EmojiData(189, 27, 3, 0xD83DDE85U, 0x0U, 2);
+	new (toFill++) EmojiData(135, 27, 3, 0xD83DDE86U, 0x0U, 2);
+	new (toFill++) EmojiData(243, 27, 3, 0xD83DDE87U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 27, 3, 0xD83DDE88U, 0x0U, 2);
+	new (toFill++) EmojiData(81, 27, 3, 0xD83DDE89U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 27, 3, 0xD83DDE8AU, 0x0U, 2);
+	new (toFill++) EmojiData(297, 27, 3, 0xD83DDE8BU, 0x0U, 2);
+	new (toFill++) EmojiData(378, 27, 3, 0xD83DDE8CU, 0x0U, 2);
+	new (toFill++) EmojiData(405, 27, 3, 0xD83DDE8DU, 0x0U, 2);
+	new (toFill++) EmojiData(351, 27, 3, 0xD83DDE8EU, 0x0U, 2);
+	new (toFill++) EmojiData(945, 27, 3, 0xD83DDE8FU, 0x0U, 2);
+	new (toFill++) EmojiData(756, 27, 3, 0xD83DDE90U, 0x0U, 2);
+	new (toFill++) EmojiData(729, 27, 3, 0xD83DDE91U, 0x0U, 2);
+	new (toFill++) EmojiData(702, 27, 3, 0xD83DDE92U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 27, 3, 0xD83DDE93U, 0x0U, 2);
+	new (toFill++) EmojiData(675, 27, 3, 0xD83DDE94U, 0x0U, 2);
+	new (toFill++) EmojiData(513, 27, 3, 0xD83DDE95U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 27, 3, 0xD83DDE96U, 0x0U, 2);
+	new (toFill++) EmojiData(486, 27, 3, 0xD83DDE97U, 0x0U, 2);
+	new (toFill++) EmojiData(459, 27, 3, 0xD83DDE98U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 27, 3, 0xD83DDE99U, 0x0U, 2);
+	new (toFill++) EmojiData(594, 27, 3, 0xD83DDE9AU, 0x0U, 2);
+	new (toFill++) EmojiData(567, 27, 3, 0xD83DDE9BU, 0x0U, 2);
+	new (toFill++) EmojiData(891, 27, 3, 0xD83DDE9CU, 0x0U, 2);
+	new (toFill++) EmojiData(270, 27, 3, 0xD83DDE9DU, 0x0U, 2);
+	new (toFill++) EmojiData(108, 27, 3, 0xD83DDE9EU, 0x0U, 2);
+	new (toFill++) EmojiData(837, 27, 3, 0xD83DDE9FU, 0x0U, 2);
+	new (toFill++) EmojiData(864, 27, 3, 0xD83DDEA0U, 0x0U, 2);
+	new (toFill++) EmojiData(810, 27, 3, 0xD83DDEA1U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 0, 3, 0xD83DDEA2U, 0x0U, 2);
+	new (toFill++) EmojiData(945, 0, 3, 0xD83DDEA3U, 0x0U, 2);
+	new (toFill++) EmojiData(918, 0, 3, 0xD83DDEA4U, 0x0U, 2);
+	new (toFill++) EmojiData(1026, 27, 3, 0xD83DDEA5U, 0x0U, 2);
+	new (toFill++) EmojiData(999, 27, 3, 0xD83DDEA6U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 54, 3, 0xD83DDEA7U, 0x0U, 2);
+	new (toFill++) EmojiData(621, 27, 3, 0xD83DDEA8U, 0x0U, 2);
+	new (toFill++) EmojiData(270, 54, 3, 0xD83DDEA9U, 0x0U, 2);
+	new (toFill++) EmojiData(810, 27, 2, 0xD83DDEAAU, 0x0U, 2);
+	new (toFill++) EmojiData(189, 54, 4, 0xD83DDEABU, 0x0U, 2);
+	new (toFill++) EmojiData(837, 27, 2, 0xD83DDEACU, 0x0U, 2);
+	new (toFill++) EmojiData(864, 27, 4, 0xD83DDEADU, 0x0U, 2);
+	new (toFill++) EmojiData(783, 27, 4, 0xD83DDEAEU, 0x0U, 2);
+	new (toFill++) EmojiData(270, 54, 4, 0xD83DDEAFU, 0x0U, 2);
+	new (toFill++) EmojiData(756, 27, 4, 0xD83DDEB0U, 0x0U, 2);
+	new (toFill++) EmojiData(297, 54, 4, 0xD83DDEB1U, 0x0U, 2);
+	new (toFill++) EmojiData(783, 27, 3, 0xD83DDEB2U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 54, 4, 0xD83DDEB3U, 0x0U, 2);
+	new (toFill++) EmojiData(54, 108, 2, 0xD83DDEB4U, 0x0U, 2);
+	new (toFill++) EmojiData(27, 108, 2, 0xD83DDEB5U, 0x0U, 2);
+	new (toFill++) EmojiData(81, 81, 0, 0xD83DDEB6U, 0x0U, 2);
+	new (toFill++) EmojiData(351, 54, 4, 0xD83DDEB7U, 0x0U, 2);
+	new (toFill++) EmojiData(378, 54, 4, 0xD83DDEB8U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 27, 4, 0xD83DDEB9U, 0x0U, 2);
+	new (toFill++) EmojiData(675, 27, 4, 0xD83DDEBAU, 0x0U, 2);
+	new (toFill++) EmojiData(621, 27, 4, 0xD83DDEBBU, 0x0U, 2);
+	new (toFill++) EmojiData(702, 27, 4, 0xD83DDEBCU, 0x0U, 2);
+	new (toFill++) EmojiData(702, 27, 2, 0xD83DDEBDU, 0x0U, 2);
+	new (toFill++) EmojiData(729, 27, 4, 0xD83DDEBEU, 0x0U, 2);
+	new (toFill++) EmojiData(675, 27, 2, 0xD83DDEBFU, 0x0U, 2);
+	new (toFill++) EmojiData(648, 27, 2, 0xD83DDEC0U, 0x0U, 2);
+	new (toFill++) EmojiData(621, 27, 2, 0xD83DDEC1U, 0x0U, 2);
+	new (toFill++) EmojiData(999, 27, 4, 0xD83DDEC2U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 54, 4, 0xD83DDEC3U, 0x0U, 2);
+	new (toFill++) EmojiData(1026, 27, 4, 0xD83DDEC4U, 0x0U, 2);
+	new (toFill++) EmojiData(1053, 27, 4, 0xD83DDEC5U, 0x0U, 2);
 }
 
 void initEmojiTwo() {
 	EmojiData *toFill = emojis = (EmojiData*)emojisData;
 
-	new (toFill++) EmojiData(216, 684, 0xA9U, 0x0U, 1);
-	new (toFill++) EmojiData(252, 684, 0xAEU, 0x0U, 1);
-	new (toFill++) EmojiData(360, 684, 0x203CU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(396, 684, 0x2049U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(288, 684, 0x2122U, 0x0U, 1);
-	new (toFill++) EmojiData(1080, 576, 0x2139U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(756, 576, 0x2194U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(792, 576, 0x2195U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(648, 576, 0x2196U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(612, 576, 0x2197U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(684, 576, 0x2198U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(720, 576, 0x2199U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1008, 576, 0x21A9U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1044, 576, 0x21AAU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1224, 288, 0x231AU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1152, 288, 0x231BU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1152, 576, 0x23E9U, 0x0U, 1);
-	new (toFill++) EmojiData(1116, 576, 0x23EAU, 0x0U, 1);
-	new (toFill++) EmojiData(1188, 576, 0x23EBU, 0x0U, 1);
-	new (toFill++) EmojiData(1224, 576, 0x23ECU, 0x0U, 1);
-	new (toFill++) EmojiData(1188, 288, 0x23F0U, 0x0U, 1);
-	new (toFill++) EmojiData(1116, 288, 0x23F3U, 0x0U, 1);
-	new (toFill++) EmojiData(1152, 612, 0x24C2U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1044, 720, 0x25AAU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1080, 720, 0x25ABU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(900, 576, 0x25B6U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(864, 576, 0x25C0U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(936, 720, 0x25FBU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(900, 720, 0x25FCU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1008, 720, 0x25FDU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(972, 720, 0x25FEU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(504, 252, 0x2600U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(576, 252, 0x2601U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(576, 288, 0x260EU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(648, 720, 0x2611U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(648, 252, 0x2614U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1296, 396, 0x2615U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(0, 108, 0x261DU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(144, 0, 0x263AU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1008, 648, 0x2648U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1044, 648, 0x2649U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1080, 648, 0x264AU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1116, 648, 0x264BU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1152, 648, 0x264CU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1188, 648, 0x264DU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1224, 648, 0x264EU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1260, 648, 0x264FU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1296, 648, 0x2650U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1332, 648, 0x2651U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1368, 648, 0x2652U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1404, 648, 0x2653U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(396, 720, 0x2660U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(468, 720, 0x2663U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(432, 720, 0x2665U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(504, 720, 0x2666U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(720, 540, 0x2668U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(972, 648, 0x267BU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(972, 612, 0x267FU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(396, 504, 0x2693U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(504, 540, 0x26A0U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(612, 252, 0x26A1U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1260, 720, 0x26AAU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1224, 720, 0x26ABU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(684, 396, 0x26BDU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(720, 396, 0x26BEU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(720, 252, 0x26C4U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(540, 252, 0x26C5U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(0, 684, 0x26CEU, 0x0U, 1);
-	new (toFill++) EmojiData(396, 648, 0x26D4U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(936, 468, 0x26EAU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(180, 504, 0x26F2U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(900, 396, 0x26F3U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(288, 504, 0x26F5U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1188, 468, 0x26FAU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(612, 540, 0x26FDU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(612, 360, 0x2702U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(540, 648, 0x2705U, 0x0U, 1);
-	new (toFill++) EmojiData(468, 504, 0x2708U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1188, 324, 0x2709U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1044, 72, 0x270AU, 0x0U, 1);
-	new (toFill++) EmojiData(1152, 72, 0x270BU, 0x0U, 1);
-	new (toFill++) EmojiData(1080, 72, 0x270CU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(756, 360, 0x270FU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(720, 360, 0x2712U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(612, 720, 0x2714U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(252, 720, 0x2716U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(396, 72, 0x2728U, 0x0U, 1);
-	new (toFill++) EmojiData(432, 648, 0x2733U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(576, 648, 0x2734U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(684, 252, 0x2744U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(468, 648, 0x2747U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(324, 684, 0x274CU, 0x0U, 1);
-	new (toFill++) EmojiData(504, 648, 0x274EU, 0x0U, 1);
-	new (toFill++) EmojiData(468, 684, 0x2753U, 0x0U, 1);
-	new (toFill++) EmojiData(540, 684, 0x2754U, 0x0U, 1);
-	new (toFill++) EmojiData(504, 684, 0x2755U, 0x0U, 1);
-	new (toFill++) EmojiData(432, 684, 0x2757U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(432, 144, 0x2764U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(288, 720, 0x2795U, 0x0U, 1);
-	new (toFill++) EmojiData(324, 720, 0x2796U, 0x0U, 1);
-	new (toFill++) EmojiData(360, 720, 0x2797U, 0x0U, 1);
-	new (toFill++) EmojiData(468, 576, 0x27A1U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(756, 720, 0x27B0U, 0x0U, 1);
-	new (toFill++) EmojiData(936, 648, 0x27BFU, 0x0U, 1);
-	new (toFill++) EmojiData(1296, 576, 0x2934U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1260, 576, 0x2935U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(432, 576, 0x2B05U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(360, 576, 0x2B06U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(396, 576, 0x2B07U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(0, 756, 0x2B1BU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1404, 720, 0x2B1CU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(468, 252, 0x2B50U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(576, 684, 0x2B55U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(792, 720, 0x3030U, 0x0U, 1);
-	new (toFill++) EmojiData(828, 720, 0x303DU, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1404, 612, 0x3297U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(1368, 612, 0x3299U, 0x0U, 1, 0xFE0F);
-	new (toFill++) EmojiData(288, 576, 0x2320E3U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 576, 0x3020E3U, 0x0U, 2);
-	new (toFill++) EmojiData(1296, 540, 0x3120E3U, 0x0U, 2);
-	new (toFill++) EmojiData(1332, 540, 0x3220E3U, 0x0U, 2);
-	new (toFill++) EmojiData(1368, 540, 0x3320E3U, 0x0U, 2);
-	new (toFill++) EmojiData(1404, 540, 0x3420E3U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 576, 0x3520E3U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 576, 0x3620E3U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 576, 0x3720E3U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 576, 0x3820E3U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 576, 0x3920E3U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 396, 0xD83CDC04U, 0x0U, 2, 0xFE0F);
-	new (toFill++) EmojiData(432, 396, 0xD83CDCCFU, 0x0U, 2);
-	new (toFill++) EmojiData(756, 648, 0xD83CDD70U, 0x0U, 2);
-	new (toFill++) EmojiData(792, 648, 0xD83CDD71U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 648, 0xD83CDD7EU, 0x0U, 2);
-	new (toFill++) EmojiData(936, 612, 0xD83CDD7FU, 0x0U, 2, 0xFE0F);
-	new (toFill++) EmojiData(828, 648, 0xD83CDD8EU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 648, 0xD83CDD91U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 612, 0xD83CDD92U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 612, 0xD83CDD93U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 648, 0xD83CDD94U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 612, 0xD83CDD95U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 612, 0xD83CDD96U, 0x0U, 2);
-	new (toFill++) EmojiData(1332, 576, 0xD83CDD97U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 648, 0xD83CDD98U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 612, 0xD83CDD99U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 648, 0xD83CDD9AU, 0x0U, 2);
-	new (toFill++) EmojiData(1044, 540, 0xD83CDDE8U, 0xD83CDDF3U, 4);
-	new (toFill++) EmojiData(1008, 540, 0xD83CDDE9U, 0xD83CDDEAU, 4);
-	new (toFill++) EmojiData(1152, 540, 0xD83CDDEAU, 0xD83CDDF8U, 4);
-	new (toFill++) EmojiData(1116, 540, 0xD83CDDEBU, 0xD83CDDF7U, 4);
-	new (toFill++) EmojiData(1260, 540, 0xD83CDDECU, 0xD83CDDE7U, 4);
-	new (toFill++) EmojiData(1188, 540, 0xD83CDDEEU, 0xD83CDDF9U, 4);
-	new (toFill++) EmojiData(936, 540, 0xD83CDDEFU, 0xD83CDDF5U, 4);
-	new (toFill++) EmojiData(972, 540, 0xD83CDDF0U, 0xD83CDDF7U, 4);
-	new (toFill++) EmojiData(1224, 540, 0xD83CDDF7U, 0xD83CDDFAU, 4);
-	new (toFill++) EmojiData(1080, 540, 0xD83CDDFAU, 0xD83CDDF8U, 4);
-	new (toFill++) EmojiData(288, 612, 0xD83CDE01U, 0x0U, 2);
-	new (toFill++) EmojiData(1116, 612, 0xD83CDE02U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 612, 0xD83CDE1AU, 0x0U, 2, 0xFE0F);
-	new (toFill++) EmojiData(324, 612, 0xD83CDE2FU, 0x0U, 2, 0xFE0F);
-	new (toFill++) EmojiData(468, 612, 0xD83CDE32U, 0x0U, 2);
-	new (toFill++) EmojiData(360, 612, 0xD83CDE33U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 612, 0xD83CDE34U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 612, 0xD83CDE35U, 0x0U, 2);
-	new (toFill++) EmojiData(612, 612, 0xD83CDE36U, 0x0U, 2);
-	new (toFill++) EmojiData(1044, 612, 0xD83CDE37U, 0x0U, 2);
-	new (toFill++) EmojiData(1080, 612, 0xD83CDE38U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 612, 0xD83CDE39U, 0x0U, 2);
-	new (toFill++) EmojiData(576, 612, 0xD83CDE3AU, 0x0U, 2);
-	new (toFill++) EmojiData(504, 612, 0xD83CDE50U, 0x0U, 2);
-	new (toFill++) EmojiData(1332, 612, 0xD83CDE51U, 0x0U, 2);
-	new (toFill++) EmojiData(756, 252, 0xD83CDF00U, 0x0U, 2);
-	new (toFill++) EmojiData(792, 252, 0xD83CDF01U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 144, 0xD83CDF02U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 504, 0xD83CDF03U, 0x0U, 2);
-	new (toFill++) EmojiData(1368, 468, 0xD83CDF04U, 0x0U, 2);
-	new (toFill++) EmojiData(1404, 468, 0xD83CDF05U, 0x0U, 2);
-	new (toFill++) EmojiData(1080, 468, 0xD83CDF06U, 0x0U, 2);
-	new (toFill++) EmojiData(1044, 468, 0xD83CDF07U, 0x0U, 2);
-	new (toFill++) EmojiData(828, 252, 0xD83CDF08U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 504, 0xD83CDF09U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 252, 0xD83CDF0AU, 0x0U, 2);
-	new (toFill++) EmojiData(360, 252, 0xD83CDF0BU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 252, 0xD83CDF0CU, 0x0U, 2);
-	new (toFill++) EmojiData(252, 252, 0xD83CDF0DU, 0x0U, 2);
-	new (toFill++) EmojiData(288, 252, 0xD83CDF0EU, 0x0U, 2);
-	new (toFill++) EmojiData(324, 252, 0xD83CDF0FU, 0x0U, 2);
-	new (toFill++) EmojiData(1152, 216, 0xD83CDF10U, 0x0U, 2);
-	new (toFill++) EmojiData(1296, 216, 0xD83CDF11U, 0x0U, 2);
-	new (toFill++) EmojiData(1332, 216, 0xD83CDF12U, 0x0U, 2);
-	new (toFill++) EmojiData(1368, 216, 0xD83CDF13U, 0x0U, 2);
-	new (toFill++) EmojiData(1404, 216, 0xD83CDF14U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 252, 0xD83CDF15U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 252, 0xD83CDF16U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 252, 0xD83CDF17U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 252, 0xD83CDF18U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 252, 0xD83CDF19U, 0x0U, 2);
-	new (toFill++) EmojiData(1260, 216, 0xD83CDF1AU, 0x0U, 2);
-	new (toFill++) EmojiData(180, 252, 0xD83CDF1BU, 0x0U, 2);
-	new (toFill++) EmojiData(144, 252, 0xD83CDF1CU, 0x0U, 2);
-	new (toFill++) EmojiData(1224, 216, 0xD83CDF1DU, 0x0U, 2);
-	new (toFill++) EmojiData(1188, 216, 0xD83CDF1EU, 0x0U, 2);
-	new (toFill++) EmojiData(432, 72, 0xD83CDF1FU, 0x0U, 2);
-	new (toFill++) EmojiData(432, 252, 0xD83CDF20U, 0x0U, 2);
-	new (toFill++) EmojiData(1044, 216, 0xD83CDF30U, 0x0U, 2);
-	new (toFill++) EmojiData(1080, 216, 0xD83CDF31U, 0x0U, 2);
-	new (toFill++) EmojiData(972, 216, 0xD83CDF32U, 0x0U, 2);
-	new (toFill++) EmojiData(1008, 216, 0xD83CDF33U, 0x0U, 2);
-	new (toFill++) EmojiData(936, 216, 0xD83CDF34U, 0x0U, 2);
-	new (toFill++) EmojiData(900, 216, 0xD83CDF35U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 216, 0xD83CDF37U, 0x0U, 2);
-	new (toFill++) EmojiData(468, 216, 0xD83CDF38U, 0x0U, 2);
-	new (toFill++) EmojiData(576, 216, 0xD83CDF39U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 216, 0xD83CDF3AU, 0x0U, 2);
-	new (toFill++) EmojiData(612, 216, 0xD83CDF3BU, 0x0U, 2);
-	new (toFill++) EmojiData(1116, 216, 0xD83CDF3CU, 0x0U, 2);
-	new (toFill++) EmojiData(504, 468, 0xD83CDF3DU, 0x0U, 2);
-	new (toFill++) EmojiData(828, 216, 0xD83CDF3EU, 0x0U, 2);
-	new (toFill++) EmojiData(792, 216, 0xD83CDF3FU, 0x0U, 2);
-	new (toFill++) EmojiData(540, 216, 0xD83CDF40U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 216, 0xD83CDF41U, 0x0U, 2);
-	new (toFill++) EmojiData(756, 216, 0xD83CDF42U, 0x0U, 2);
-	new (toFill++) EmojiData(720, 216, 0xD83CDF43U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 216, 0xD83CDF44U, 0x0U, 2);
-	new (toFill++) EmojiData(468, 468, 0xD83CDF45U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 468, 0xD83CDF46U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 468, 0xD83CDF47U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 468, 0xD83CDF48U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 468, 0xD83CDF49U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 468, 0xD83CDF4AU, 0x0U, 2);
-	new (toFill++) EmojiData(36, 468, 0xD83CDF4BU, 0x0U, 2);
-	new (toFill++) EmojiData(288, 468, 0xD83CDF4CU, 0x0U, 2);
-	new (toFill++) EmojiData(360, 468, 0xD83CDF4DU, 0x0U, 2);
-	new (toFill++) EmojiData(1368, 432, 0xD83CDF4EU, 0x0U, 2);
-	new (toFill++) EmojiData(1404, 432, 0xD83CDF4FU, 0x0U, 2);
-	new (toFill++) EmojiData(324, 468, 0xD83CDF50U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 468, 0xD83CDF51U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 468, 0xD83CDF52U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 468, 0xD83CDF53U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 432, 0xD83CDF54U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 432, 0xD83CDF55U, 0x0U, 2);
-	new (toFill++) EmojiData(360, 432, 0xD83CDF56U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 432, 0xD83CDF57U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 432, 0xD83CDF58U, 0x0U, 2);
-	new (toFill++) EmojiData(612, 432, 0xD83CDF59U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 432, 0xD83CDF5AU, 0x0U, 2);
-	new (toFill++) EmojiData(432, 432, 0xD83CDF5BU, 0x0U, 2);
-	new (toFill++) EmojiData(720, 432, 0xD83CDF5CU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 432, 0xD83CDF5DU, 0x0U, 2);
-	new (toFill++) EmojiData(900, 432, 0xD83CDF5EU, 0x0U, 2);
-	new (toFill++) EmojiData(288, 432, 0xD83CDF5FU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 468, 0xD83CDF60U, 0x0U, 2);
-	new (toFill++) EmojiData(828, 432, 0xD83CDF61U, 0x0U, 2);
-	new (toFill++) EmojiData(792, 432, 0xD83CDF62U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 432, 0xD83CDF63U, 0x0U, 2);
-	new (toFill++) EmojiData(468, 432, 0xD83CDF64U, 0x0U, 2);
-	new (toFill++) EmojiData(576, 432, 0xD83CDF65U, 0x0U, 2);
-	new (toFill++) EmojiData(1008, 432, 0xD83CDF66U, 0x0U, 2);
-	new (toFill++) EmojiData(1080, 432, 0xD83CDF67U, 0x0U, 2);
-	new (toFill++) EmojiData(1044, 432, 0xD83CDF68U, 0x0U, 2);
-	new (toFill++) EmojiData(936, 432, 0xD83CDF69U, 0x0U, 2);
-	new (toFill++) EmojiData(1188, 432, 0xD83CDF6AU, 0x0U, 2);
-	new (toFill++) EmojiData(1224, 432, 0xD83CDF6BU, 0x0U, 2);
-	new (toFill++) EmojiData(1260, 432, 0xD83CDF6CU, 0x0U, 2);
-	new (toFill++) EmojiData(1296, 432, 0xD83CDF6DU, 0x0U, 2);
-	new (toFill++) EmojiData(972, 432, 0xD83CDF6EU, 0x0U, 2);
-	new (toFill++) EmojiData(1332, 432, 0xD83CDF6FU, 0x0U, 2);
-	new (toFill++) EmojiData(1152, 432, 0xD83CDF70U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 432, 0xD83CDF71U, 0x0U, 2);
-	new (toFill++) EmojiData(756, 432, 0xD83CDF72U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 432, 0xD83CDF73U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 432, 0xD83CDF74U, 0x0U, 2);
-	new (toFill++) EmojiData(1332, 396, 0xD83CDF75U, 0x0U, 2);
-	new (toFill++) EmojiData(1368, 396, 0xD83CDF76U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 432, 0xD83CDF77U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 432, 0xD83CDF78U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 432, 0xD83CDF79U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 432, 0xD83CDF7AU, 0x0U, 2);
-	new (toFill++) EmojiData(36, 432, 0xD83CDF7BU, 0x0U, 2);
-	new (toFill++) EmojiData(1404, 396, 0xD83CDF7CU, 0x0U, 2);
-	new (toFill++) EmojiData(180, 144, 0xD83CDF80U, 0x0U, 2);
-	new (toFill++) EmojiData(1404, 252, 0xD83CDF81U, 0x0U, 2);
-	new (toFill++) EmojiData(1116, 432, 0xD83CDF82U, 0x0U, 2);
-	new (toFill++) EmojiData(1260, 252, 0xD83CDF83U, 0x0U, 2);
-	new (toFill++) EmojiData(1368, 252, 0xD83CDF84U, 0x0U, 2);
-	new (toFill++) EmojiData(1332, 252, 0xD83CDF85U, 0x0U, 2);
-	new (toFill++) EmojiData(1116, 252, 0xD83CDF86U, 0x0U, 2);
-	new (toFill++) EmojiData(1152, 252, 0xD83CDF87U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 288, 0xD83CDF88U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 288, 0xD83CDF89U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 288, 0xD83CDF8AU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 288, 0xD83CDF8BU, 0x0U, 2);
-	new (toFill++) EmojiData(144, 288, 0xD83CDF8CU, 0x0U, 2);
-	new (toFill++) EmojiData(900, 252, 0xD83CDF8DU, 0x0U, 2);
-	new (toFill++) EmojiData(972, 252, 0xD83CDF8EU, 0x0U, 2);
-	new (toFill++) EmojiData(1080, 252, 0xD83CDF8FU, 0x0U, 2);
-	new (toFill++) EmojiData(1188, 252, 0xD83CDF90U, 0x0U, 2);
-	new (toFill++) EmojiData(1224, 252, 0xD83CDF91U, 0x0U, 2);
-	new (toFill++) EmojiData(1008, 252, 0xD83CDF92U, 0x0U, 2);
-	new (toFill++) EmojiData(1044, 252, 0xD83CDF93U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 504, 0xD83CDFA0U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 504, 0xD83CDFA1U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 504, 0xD83CDFA2U, 0x0U, 2);
-	new (toFill++) EmojiData(1260, 396, 0xD83CDFA3U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 396, 0xD83CDFA4U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 288, 0xD83CDFA5U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 612, 0xD83CDFA6U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 396, 0xD83CDFA7U, 0x0U, 2);
-	new (toFill++) EmojiData(1368, 360, 0xD83CDFA8U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 108, 0xD83CDFA9U, 0x0U, 2);
-	new (toFill++) EmojiData(792, 540, 0xD83CDFAAU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 540, 0xD83CDFABU, 0x0U, 2);
-	new (toFill++) EmojiData(1404, 360, 0xD83CDFACU, 0x0U, 2);
-	new (toFill++) EmojiData(828, 540, 0xD83CDFADU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 396, 0xD83CDFAEU, 0x0U, 2);
-	new (toFill++) EmojiData(576, 396, 0xD83CDFAFU, 0x0U, 2);
-	new (toFill++) EmojiData(684, 540, 0xD83CDFB0U, 0x0U, 2);
-	new (toFill++) EmojiData(792, 396, 0xD83CDFB1U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 396, 0xD83CDFB2U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 396, 0xD83CDFB3U, 0x0U, 2);
-	new (toFill++) EmojiData(468, 396, 0xD83CDFB4U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 396, 0xD83CDFB5U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 396, 0xD83CDFB6U, 0x0U, 2);
-	new (toFill++) EmojiData(288, 396, 0xD83CDFB7U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 396, 0xD83CDFB8U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 396, 0xD83CDFB9U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 396, 0xD83CDFBAU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 396, 0xD83CDFBBU, 0x0U, 2);
-	new (toFill++) EmojiData(72, 396, 0xD83CDFBCU, 0x0U, 2);
-	new (toFill++) EmojiData(1296, 108, 0xD83CDFBDU, 0x0U, 2);
-	new (toFill++) EmojiData(756, 396, 0xD83CDFBEU, 0x0U, 2);
-	new (toFill++) EmojiData(1116, 396, 0xD83CDFBFU, 0x0U, 2);
-	new (toFill++) EmojiData(648, 396, 0xD83CDFC0U, 0x0U, 2);
-	new (toFill++) EmojiData(1008, 396, 0xD83CDFC1U, 0x0U, 2);
-	new (toFill++) EmojiData(1152, 396, 0xD83CDFC2U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 108, 0xD83CDFC3U, 0x0U, 2);
-	new (toFill++) EmojiData(1224, 396, 0xD83CDFC4U, 0x0U, 2);
-	new (toFill++) EmojiData(1080, 396, 0xD83CDFC6U, 0x0U, 2);
-	new (toFill++) EmojiData(1044, 396, 0xD83CDFC7U, 0x0U, 2);
-	new (toFill++) EmojiData(612, 396, 0xD83CDFC8U, 0x0U, 2);
-	new (toFill++) EmojiData(828, 396, 0xD83CDFC9U, 0x0U, 2);
-	new (toFill++) EmojiData(1188, 396, 0xD83CDFCAU, 0x0U, 2);
-	new (toFill++) EmojiData(540, 468, 0xD83CDFE0U, 0x0U, 2);
-	new (toFill++) EmojiData(576, 468, 0xD83CDFE1U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 468, 0xD83CDFE2U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 468, 0xD83CDFE3U, 0x0U, 2);
-	new (toFill++) EmojiData(1008, 468, 0xD83CDFE4U, 0x0U, 2);
-	new (toFill++) EmojiData(720, 468, 0xD83CDFE5U, 0x0U, 2);
-	new (toFill++) EmojiData(756, 468, 0xD83CDFE6U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 684, 0xD83CDFE7U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 468, 0xD83CDFE8U, 0x0U, 2);
-	new (toFill++) EmojiData(828, 468, 0xD83CDFE9U, 0x0U, 2);
-	new (toFill++) EmojiData(792, 468, 0xD83CDFEAU, 0x0U, 2);
-	new (toFill++) EmojiData(612, 468, 0xD83CDFEBU, 0x0U, 2);
-	new (toFill++) EmojiData(972, 468, 0xD83CDFECU, 0x0U, 2);
-	new (toFill++) EmojiData(1224, 468, 0xD83CDFEDU, 0x0U, 2);
-	new (toFill++) EmojiData(648, 540, 0xD83CDFEEU, 0x0U, 2);
-	new (toFill++) EmojiData(1116, 468, 0xD83CDFEFU, 0x0U, 2);
-	new (toFill++) EmojiData(1152, 468, 0xD83CDFF0U, 0x0U, 2);
-	new (toFill++) EmojiData(1116, 180, 0xD83DDC00U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 216, 0xD83DDC01U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 216, 0xD83DDC02U, 0x0U, 2);
-	new (toFill++) EmojiData(1152, 180, 0xD83DDC03U, 0x0U, 2);
-	new (toFill++) EmojiData(1044, 180, 0xD83DDC04U, 0x0U, 2);
-	new (toFill++) EmojiData(1188, 180, 0xD83DDC05U, 0x0U, 2);
-	new (toFill++) EmojiData(288, 216, 0xD83DDC06U, 0x0U, 2);
-	new (toFill++) EmojiData(1224, 180, 0xD83DDC07U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 216, 0xD83DDC08U, 0x0U, 2);
-	new (toFill++) EmojiData(1260, 180, 0xD83DDC09U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 216, 0xD83DDC0AU, 0x0U, 2);
-	new (toFill++) EmojiData(1008, 180, 0xD83DDC0BU, 0x0U, 2);
-	new (toFill++) EmojiData(756, 180, 0xD83DDC0CU, 0x0U, 2);
-	new (toFill++) EmojiData(540, 180, 0xD83DDC0DU, 0x0U, 2);
-	new (toFill++) EmojiData(1296, 180, 0xD83DDC0EU, 0x0U, 2);
-	new (toFill++) EmojiData(1080, 180, 0xD83DDC0FU, 0x0U, 2);
-	new (toFill++) EmojiData(1332, 180, 0xD83DDC10U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 180, 0xD83DDC11U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 180, 0xD83DDC12U, 0x0U, 2);
-	new (toFill++) EmojiData(1368, 180, 0xD83DDC13U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 180, 0xD83DDC14U, 0x0U, 2);
-	new (toFill++) EmojiData(1404, 180, 0xD83DDC15U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 216, 0xD83DDC16U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 180, 0xD83DDC17U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 180, 0xD83DDC18U, 0x0U, 2);
-	new (toFill++) EmojiData(792, 180, 0xD83DDC19U, 0x0U, 2);
-	new (toFill++) EmojiData(828, 180, 0xD83DDC1AU, 0x0U, 2);
-	new (toFill++) EmojiData(612, 180, 0xD83DDC1BU, 0x0U, 2);
-	new (toFill++) EmojiData(684, 180, 0xD83DDC1CU, 0x0U, 2);
-	new (toFill++) EmojiData(648, 180, 0xD83DDC1DU, 0x0U, 2);
-	new (toFill++) EmojiData(720, 180, 0xD83DDC1EU, 0x0U, 2);
-	new (toFill++) EmojiData(900, 180, 0xD83DDC1FU, 0x0U, 2);
-	new (toFill++) EmojiData(864, 180, 0xD83DDC20U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 216, 0xD83DDC21U, 0x0U, 2);
-	new (toFill++) EmojiData(576, 180, 0xD83DDC22U, 0x0U, 2);
-	new (toFill++) EmojiData(468, 180, 0xD83DDC23U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 180, 0xD83DDC24U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 180, 0xD83DDC25U, 0x0U, 2);
-	new (toFill++) EmojiData(360, 180, 0xD83DDC26U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 180, 0xD83DDC27U, 0x0U, 2);
-	new (toFill++) EmojiData(1332, 144, 0xD83DDC28U, 0x0U, 2);
-	new (toFill++) EmojiData(360, 216, 0xD83DDC29U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 216, 0xD83DDC2AU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 216, 0xD83DDC2BU, 0x0U, 2);
-	new (toFill++) EmojiData(936, 180, 0xD83DDC2CU, 0x0U, 2);
-	new (toFill++) EmojiData(1152, 144, 0xD83DDC2DU, 0x0U, 2);
-	new (toFill++) EmojiData(36, 180, 0xD83DDC2EU, 0x0U, 2);
-	new (toFill++) EmojiData(1296, 144, 0xD83DDC2FU, 0x0U, 2);
-	new (toFill++) EmojiData(1224, 144, 0xD83DDC30U, 0x0U, 2);
-	new (toFill++) EmojiData(1116, 144, 0xD83DDC31U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 216, 0xD83DDC32U, 0x0U, 2);
-	new (toFill++) EmojiData(972, 180, 0xD83DDC33U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 180, 0xD83DDC34U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 180, 0xD83DDC35U, 0x0U, 2);
-	new (toFill++) EmojiData(1044, 144, 0xD83DDC36U, 0x0U, 2);
-	new (toFill++) EmojiData(1404, 144, 0xD83DDC37U, 0x0U, 2);
-	new (toFill++) EmojiData(1260, 144, 0xD83DDC38U, 0x0U, 2);
-	new (toFill++) EmojiData(1188, 144, 0xD83DDC39U, 0x0U, 2);
-	new (toFill++) EmojiData(1080, 144, 0xD83DDC3AU, 0x0U, 2);
-	new (toFill++) EmojiData(1368, 144, 0xD83DDC3BU, 0x0U, 2);
-	new (toFill++) EmojiData(288, 180, 0xD83DDC3CU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 180, 0xD83DDC3DU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 216, 0xD83DDC3EU, 0x0U, 2);
-	new (toFill++) EmojiData(756, 72, 0xD83DDC40U, 0x0U, 2);
-	new (toFill++) EmojiData(720, 72, 0xD83DDC42U, 0x0U, 2);
-	new (toFill++) EmojiData(792, 72, 0xD83DDC43U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 72, 0xD83DDC44U, 0x0U, 2);
-	new (toFill++) EmojiData(828, 72, 0xD83DDC45U, 0x0U, 2);
-	new (toFill++) EmojiData(1224, 72, 0xD83DDC46U, 0x0U, 2);
-	new (toFill++) EmojiData(1260, 72, 0xD83DDC47U, 0x0U, 2);
-	new (toFill++) EmojiData(1332, 72, 0xD83DDC48U, 0x0U, 2);
-	new (toFill++) EmojiData(1296, 72, 0xD83DDC49U, 0x0U, 2);
-	new (toFill++) EmojiData(1008, 72, 0xD83DDC4AU, 0x0U, 2);
-	new (toFill++) EmojiData(1116, 72, 0xD83DDC4BU, 0x0U, 2);
-	new (toFill++) EmojiData(972, 72, 0xD83DDC4CU, 0x0U, 2);
-	new (toFill++) EmojiData(900, 72, 0xD83DDC4DU, 0x0U, 2);
-	new (toFill++) EmojiData(936, 72, 0xD83DDC4EU, 0x0U, 2);
-	new (toFill++) EmojiData(36, 108, 0xD83DDC4FU, 0x0U, 2);
-	new (toFill++) EmojiData(1188, 72, 0xD83DDC50U, 0x0U, 2);
-	new (toFill++) EmojiData(900, 108, 0xD83DDC51U, 0x0U, 2);
-	new (toFill++) EmojiData(936, 108, 0xD83DDC52U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 144, 0xD83DDC53U, 0x0U, 2);
-	new (toFill++) EmojiData(1188, 108, 0xD83DDC54U, 0x0U, 2);
-	new (toFill++) EmojiData(1152, 108, 0xD83DDC55U, 0x0U, 2);
-	new (toFill++) EmojiData(1332, 108, 0xD83DDC56U, 0x0U, 2);
-	new (toFill++) EmojiData(1260, 108, 0xD83DDC57U, 0x0U, 2);
-	new (toFill++) EmojiData(1368, 108, 0xD83DDC58U, 0x0U, 2);
-	new (toFill++) EmojiData(1404, 108, 0xD83DDC59U, 0x0U, 2);
-	new (toFill++) EmojiData(1224, 108, 0xD83DDC5AU, 0x0U, 2);
-	new (toFill++) EmojiData(108, 144, 0xD83DDC5BU, 0x0U, 2);
-	new (toFill++) EmojiData(36, 144, 0xD83DDC5CU, 0x0U, 2);
-	new (toFill++) EmojiData(72, 144, 0xD83DDC5DU, 0x0U, 2);
-	new (toFill++) EmojiData(1008, 108, 0xD83DDC5EU, 0x0U, 2);
-	new (toFill++) EmojiData(972, 108, 0xD83DDC5FU, 0x0U, 2);
-	new (toFill++) EmojiData(1080, 108, 0xD83DDC60U, 0x0U, 2);
-	new (toFill++) EmojiData(1044, 108, 0xD83DDC61U, 0x0U, 2);
-	new (toFill++) EmojiData(1116, 108, 0xD83DDC62U, 0x0U, 2);
-	new (toFill++) EmojiData(972, 144, 0xD83DDC63U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 144, 0xD83DDC64U, 0x0U, 2);
-	new (toFill++) EmojiData(900, 144, 0xD83DDC65U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 36, 0xD83DDC66U, 0x0U, 2);
-	new (toFill++) EmojiData(900, 36, 0xD83DDC67U, 0x0U, 2);
-	new (toFill++) EmojiData(936, 36, 0xD83DDC68U, 0x0U, 2);
-	new (toFill++) EmojiData(972, 36, 0xD83DDC69U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 108, 0xD83DDC6AU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 108, 0xD83DDC6BU, 0x0U, 2);
-	new (toFill++) EmojiData(288, 108, 0xD83DDC6CU, 0x0U, 2);
-	new (toFill++) EmojiData(324, 108, 0xD83DDC6DU, 0x0U, 2);
-	new (toFill++) EmojiData(720, 36, 0xD83DDC6EU, 0x0U, 2);
-	new (toFill++) EmojiData(432, 108, 0xD83DDC6FU, 0x0U, 2);
-	new (toFill++) EmojiData(720, 108, 0xD83DDC70U, 0x0U, 2);
-	new (toFill++) EmojiData(1080, 36, 0xD83DDC71U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 36, 0xD83DDC72U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 36, 0xD83DDC73U, 0x0U, 2);
-	new (toFill++) EmojiData(1008, 36, 0xD83DDC74U, 0x0U, 2);
-	new (toFill++) EmojiData(1044, 36, 0xD83DDC75U, 0x0U, 2);
-	new (toFill++) EmojiData(828, 36, 0xD83DDC76U, 0x0U, 2);
-	new (toFill++) EmojiData(756, 36, 0xD83DDC77U, 0x0U, 2);
-	new (toFill++) EmojiData(1152, 36, 0xD83DDC78U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 72, 0xD83DDC79U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 72, 0xD83DDC7AU, 0x0U, 2);
-	new (toFill++) EmojiData(1296, 252, 0xD83DDC7BU, 0x0U, 2);
-	new (toFill++) EmojiData(1116, 36, 0xD83DDC7CU, 0x0U, 2);
-	new (toFill++) EmojiData(288, 72, 0xD83DDC7DU, 0x0U, 2);
-	new (toFill++) EmojiData(360, 396, 0xD83DDC7EU, 0x0U, 2);
-	new (toFill++) EmojiData(288, 36, 0xD83DDC7FU, 0x0U, 2);
-	new (toFill++) EmojiData(252, 72, 0xD83DDC80U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 108, 0xD83DDC81U, 0x0U, 2);
-	new (toFill++) EmojiData(792, 36, 0xD83DDC82U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 108, 0xD83DDC83U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 144, 0xD83DDC84U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 108, 0xD83DDC85U, 0x0U, 2);
-	new (toFill++) EmojiData(612, 108, 0xD83DDC86U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 108, 0xD83DDC87U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 540, 0xD83DDC88U, 0x0U, 2);
-	new (toFill++) EmojiData(756, 324, 0xD83DDC89U, 0x0U, 2);
-	new (toFill++) EmojiData(720, 324, 0xD83DDC8AU, 0x0U, 2);
-	new (toFill++) EmojiData(756, 144, 0xD83DDC8BU, 0x0U, 2);
-	new (toFill++) EmojiData(720, 144, 0xD83DDC8CU, 0x0U, 2);
-	new (toFill++) EmojiData(792, 144, 0xD83DDC8DU, 0x0U, 2);
-	new (toFill++) EmojiData(828, 144, 0xD83DDC8EU, 0x0U, 2);
-	new (toFill++) EmojiData(360, 108, 0xD83DDC8FU, 0x0U, 2);
-	new (toFill++) EmojiData(432, 216, 0xD83DDC90U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 108, 0xD83DDC91U, 0x0U, 2);
-	new (toFill++) EmojiData(900, 468, 0xD83DDC92U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 144, 0xD83DDC93U, 0x0U, 2);
-	new (toFill++) EmojiData(468, 144, 0xD83DDC94U, 0x0U, 2);
-	new (toFill++) EmojiData(576, 144, 0xD83DDC95U, 0x0U, 2);
-	new (toFill++) EmojiData(612, 144, 0xD83DDC96U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 144, 0xD83DDC97U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 144, 0xD83DDC98U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 144, 0xD83DDC99U, 0x0U, 2);
-	new (toFill++) EmojiData(396, 144, 0xD83DDC9AU, 0x0U, 2);
-	new (toFill++) EmojiData(288, 144, 0xD83DDC9BU, 0x0U, 2);
-	new (toFill++) EmojiData(360, 144, 0xD83DDC9CU, 0x0U, 2);
-	new (toFill++) EmojiData(936, 252, 0xD83DDC9DU, 0x0U, 2);
-	new (toFill++) EmojiData(648, 144, 0xD83DDC9EU, 0x0U, 2);
-	new (toFill++) EmojiData(612, 648, 0xD83DDC9FU, 0x0U, 2);
-	new (toFill++) EmojiData(900, 648, 0xD83DDCA0U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 324, 0xD83DDCA1U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 72, 0xD83DDCA2U, 0x0U, 2);
-	new (toFill++) EmojiData(612, 324, 0xD83DDCA3U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 72, 0xD83DDCA4U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 72, 0xD83DDCA5U, 0x0U, 2);
-	new (toFill++) EmojiData(576, 72, 0xD83DDCA6U, 0x0U, 2);
-	new (toFill++) EmojiData(612, 72, 0xD83DDCA7U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 72, 0xD83DDCA8U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 72, 0xD83DDCA9U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 108, 0xD83DDCAAU, 0x0U, 2);
-	new (toFill++) EmojiData(468, 72, 0xD83DDCABU, 0x0U, 2);
-	new (toFill++) EmojiData(936, 144, 0xD83DDCACU, 0x0U, 2);
-	new (toFill++) EmojiData(1008, 144, 0xD83DDCADU, 0x0U, 2);
-	new (toFill++) EmojiData(540, 720, 0xD83DDCAEU, 0x0U, 2);
-	new (toFill++) EmojiData(576, 720, 0xD83DDCAFU, 0x0U, 2);
-	new (toFill++) EmojiData(792, 324, 0xD83DDCB0U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 684, 0xD83DDCB1U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 684, 0xD83DDCB2U, 0x0U, 2);
-	new (toFill++) EmojiData(972, 324, 0xD83DDCB3U, 0x0U, 2);
-	new (toFill++) EmojiData(828, 324, 0xD83DDCB4U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 324, 0xD83DDCB5U, 0x0U, 2);
-	new (toFill++) EmojiData(936, 324, 0xD83DDCB6U, 0x0U, 2);
-	new (toFill++) EmojiData(900, 324, 0xD83DDCB7U, 0x0U, 2);
-	new (toFill++) EmojiData(1008, 324, 0xD83DDCB8U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 684, 0xD83DDCB9U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 504, 0xD83DDCBAU, 0x0U, 2);
-	new (toFill++) EmojiData(504, 288, 0xD83DDCBBU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 144, 0xD83DDCBCU, 0x0U, 2);
-	new (toFill++) EmojiData(432, 288, 0xD83DDCBDU, 0x0U, 2);
-	new (toFill++) EmojiData(468, 288, 0xD83DDCBEU, 0x0U, 2);
-	new (toFill++) EmojiData(360, 288, 0xD83DDCBFU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 288, 0xD83DDCC0U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 360, 0xD83DDCC1U, 0x0U, 2);
-	new (toFill++) EmojiData(576, 360, 0xD83DDCC2U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 360, 0xD83DDCC3U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 360, 0xD83DDCC4U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 360, 0xD83DDCC5U, 0x0U, 2);
-	new (toFill++) EmojiData(468, 360, 0xD83DDCC6U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 360, 0xD83DDCC7U, 0x0U, 2);
-	new (toFill++) EmojiData(288, 360, 0xD83DDCC8U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 360, 0xD83DDCC9U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 360, 0xD83DDCCAU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 360, 0xD83DDCCBU, 0x0U, 2);
-	new (toFill++) EmojiData(648, 360, 0xD83DDCCCU, 0x0U, 2);
-	new (toFill++) EmojiData(864, 540, 0xD83DDCCDU, 0x0U, 2);
-	new (toFill++) EmojiData(684, 360, 0xD83DDCCEU, 0x0U, 2);
-	new (toFill++) EmojiData(792, 360, 0xD83DDCCFU, 0x0U, 2);
-	new (toFill++) EmojiData(828, 360, 0xD83DDCD0U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 360, 0xD83DDCD1U, 0x0U, 2);
-	new (toFill++) EmojiData(1080, 360, 0xD83DDCD2U, 0x0U, 2);
-	new (toFill++) EmojiData(1008, 360, 0xD83DDCD3U, 0x0U, 2);
-	new (toFill++) EmojiData(1044, 360, 0xD83DDCD4U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 360, 0xD83DDCD5U, 0x0U, 2);
-	new (toFill++) EmojiData(1152, 360, 0xD83DDCD6U, 0x0U, 2);
-	new (toFill++) EmojiData(900, 360, 0xD83DDCD7U, 0x0U, 2);
-	new (toFill++) EmojiData(936, 360, 0xD83DDCD8U, 0x0U, 2);
-	new (toFill++) EmojiData(972, 360, 0xD83DDCD9U, 0x0U, 2);
-	new (toFill++) EmojiData(1116, 360, 0xD83DDCDAU, 0x0U, 2);
-	new (toFill++) EmojiData(1224, 360, 0xD83DDCDBU, 0x0U, 2);
-	new (toFill++) EmojiData(360, 360, 0xD83DDCDCU, 0x0U, 2);
-	new (toFill++) EmojiData(108, 360, 0xD83DDCDDU, 0x0U, 2);
-	new (toFill++) EmojiData(612, 288, 0xD83DDCDEU, 0x0U, 2);
-	new (toFill++) EmojiData(648, 288, 0xD83DDCDFU, 0x0U, 2);
-	new (toFill++) EmojiData(684, 288, 0xD83DDCE0U, 0x0U, 2);
-	new (toFill++) EmojiData(720, 288, 0xD83DDCE1U, 0x0U, 2);
-	new (toFill++) EmojiData(1044, 288, 0xD83DDCE2U, 0x0U, 2);
-	new (toFill++) EmojiData(1080, 288, 0xD83DDCE3U, 0x0U, 2);
-	new (toFill++) EmojiData(1152, 324, 0xD83DDCE4U, 0x0U, 2);
-	new (toFill++) EmojiData(1116, 324, 0xD83DDCE5U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 360, 0xD83DDCE6U, 0x0U, 2);
-	new (toFill++) EmojiData(1080, 324, 0xD83DDCE7U, 0x0U, 2);
-	new (toFill++) EmojiData(1260, 324, 0xD83DDCE8U, 0x0U, 2);
-	new (toFill++) EmojiData(1224, 324, 0xD83DDCE9U, 0x0U, 2);
-	new (toFill++) EmojiData(1368, 324, 0xD83DDCEAU, 0x0U, 2);
-	new (toFill++) EmojiData(1332, 324, 0xD83DDCEBU, 0x0U, 2);
-	new (toFill++) EmojiData(1404, 324, 0xD83DDCECU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 360, 0xD83DDCEDU, 0x0U, 2);
-	new (toFill++) EmojiData(36, 360, 0xD83DDCEEU, 0x0U, 2);
-	new (toFill++) EmojiData(1296, 324, 0xD83DDCEFU, 0x0U, 2);
-	new (toFill++) EmojiData(1332, 360, 0xD83DDCF0U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 288, 0xD83DDCF1U, 0x0U, 2);
-	new (toFill++) EmojiData(1044, 324, 0xD83DDCF2U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 648, 0xD83DDCF3U, 0x0U, 2);
-	new (toFill++) EmojiData(720, 648, 0xD83DDCF4U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 648, 0xD83DDCF5U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 612, 0xD83DDCF6U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 288, 0xD83DDCF7U, 0x0U, 2);
-	new (toFill++) EmojiData(288, 288, 0xD83DDCF9U, 0x0U, 2);
-	new (toFill++) EmojiData(756, 288, 0xD83DDCFAU, 0x0U, 2);
-	new (toFill++) EmojiData(792, 288, 0xD83DDCFBU, 0x0U, 2);
-	new (toFill++) EmojiData(324, 288, 0xD83DDCFCU, 0x0U, 2);
-	new (toFill++) EmojiData(1368, 576, 0xD83DDD00U, 0x0U, 2);
-	new (toFill++) EmojiData(1404, 576, 0xD83DDD01U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 612, 0xD83DDD02U, 0x0U, 2);
-	new (toFill++) EmojiData(792, 684, 0xD83DDD03U, 0x0U, 2);
-	new (toFill++) EmojiData(828, 576, 0xD83DDD04U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 324, 0xD83DDD05U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 324, 0xD83DDD06U, 0x0U, 2);
-	new (toFill++) EmojiData(936, 288, 0xD83DDD07U, 0x0U, 2);
-	new (toFill++) EmojiData(900, 288, 0xD83DDD08U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 288, 0xD83DDD09U, 0x0U, 2);
-	new (toFill++) EmojiData(828, 288, 0xD83DDD0AU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 324, 0xD83DDD0BU, 0x0U, 2);
-	new (toFill++) EmojiData(180, 324, 0xD83DDD0CU, 0x0U, 2);
-	new (toFill++) EmojiData(252, 324, 0xD83DDD0DU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 324, 0xD83DDD0EU, 0x0U, 2);
-	new (toFill++) EmojiData(1332, 288, 0xD83DDD0FU, 0x0U, 2);
-	new (toFill++) EmojiData(1368, 288, 0xD83DDD10U, 0x0U, 2);
-	new (toFill++) EmojiData(1404, 288, 0xD83DDD11U, 0x0U, 2);
-	new (toFill++) EmojiData(1296, 288, 0xD83DDD12U, 0x0U, 2);
-	new (toFill++) EmojiData(1260, 288, 0xD83DDD13U, 0x0U, 2);
-	new (toFill++) EmojiData(972, 288, 0xD83DDD14U, 0x0U, 2);
-	new (toFill++) EmojiData(1008, 288, 0xD83DDD15U, 0x0U, 2);
-	new (toFill++) EmojiData(1188, 360, 0xD83DDD16U, 0x0U, 2);
-	new (toFill++) EmojiData(720, 720, 0xD83DDD17U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 720, 0xD83DDD18U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 684, 0xD83DDD19U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 684, 0xD83DDD1AU, 0x0U, 2);
-	new (toFill++) EmojiData(720, 684, 0xD83DDD1BU, 0x0U, 2);
-	new (toFill++) EmojiData(756, 684, 0xD83DDD1CU, 0x0U, 2);
-	new (toFill++) EmojiData(612, 684, 0xD83DDD1DU, 0x0U, 2);
-	new (toFill++) EmojiData(144, 648, 0xD83DDD1EU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 576, 0xD83DDD1FU, 0x0U, 2);
-	new (toFill++) EmojiData(504, 576, 0xD83DDD20U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 576, 0xD83DDD21U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 576, 0xD83DDD22U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 576, 0xD83DDD23U, 0x0U, 2);
-	new (toFill++) EmojiData(576, 576, 0xD83DDD24U, 0x0U, 2);
-	new (toFill++) EmojiData(360, 72, 0xD83DDD25U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 324, 0xD83DDD26U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 324, 0xD83DDD27U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 324, 0xD83DDD28U, 0x0U, 2);
-	new (toFill++) EmojiData(468, 324, 0xD83DDD29U, 0x0U, 2);
-	new (toFill++) EmojiData(684, 324, 0xD83DDD2AU, 0x0U, 2);
-	new (toFill++) EmojiData(648, 324, 0xD83DDD2BU, 0x0U, 2);
-	new (toFill++) EmojiData(1260, 360, 0xD83DDD2CU, 0x0U, 2);
-	new (toFill++) EmojiData(1296, 360, 0xD83DDD2DU, 0x0U, 2);
-	new (toFill++) EmojiData(180, 288, 0xD83DDD2EU, 0x0U, 2);
-	new (toFill++) EmojiData(36, 684, 0xD83DDD2FU, 0x0U, 2);
-	new (toFill++) EmojiData(576, 540, 0xD83DDD30U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 720, 0xD83DDD31U, 0x0U, 2);
-	new (toFill++) EmojiData(1152, 720, 0xD83DDD32U, 0x0U, 2);
-	new (toFill++) EmojiData(1188, 720, 0xD83DDD33U, 0x0U, 2);
-	new (toFill++) EmojiData(1296, 720, 0xD83DDD34U, 0x0U, 2);
-	new (toFill++) EmojiData(1332, 720, 0xD83DDD35U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 756, 0xD83DDD36U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 756, 0xD83DDD37U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 756, 0xD83DDD38U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 756, 0xD83DDD39U, 0x0U, 2);
-	new (toFill++) EmojiData(1116, 720, 0xD83DDD3AU, 0x0U, 2);
-	new (toFill++) EmojiData(1368, 720, 0xD83DDD3BU, 0x0U, 2);
-	new (toFill++) EmojiData(936, 576, 0xD83DDD3CU, 0x0U, 2);
-	new (toFill++) EmojiData(972, 576, 0xD83DDD3DU, 0x0U, 2);
-	new (toFill++) EmojiData(900, 684, 0xD83DDD50U, 0x0U, 2);
-	new (toFill++) EmojiData(972, 684, 0xD83DDD51U, 0x0U, 2);
-	new (toFill++) EmojiData(1044, 684, 0xD83DDD52U, 0x0U, 2);
-	new (toFill++) EmojiData(1116, 684, 0xD83DDD53U, 0x0U, 2);
-	new (toFill++) EmojiData(1188, 684, 0xD83DDD54U, 0x0U, 2);
-	new (toFill++) EmojiData(1260, 684, 0xD83DDD55U, 0x0U, 2);
-	new (toFill++) EmojiData(1296, 684, 0xD83DDD56U, 0x0U, 2);
-	new (toFill++) EmojiData(1332, 684, 0xD83DDD57U, 0x0U, 2);
-	new (toFill++) EmojiData(1368, 684, 0xD83DDD58U, 0x0U, 2);
-	new (toFill++) EmojiData(1404, 684, 0xD83DDD59U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 720, 0xD83DDD5AU, 0x0U, 2);
-	new (toFill++) EmojiData(828, 684, 0xD83DDD5BU, 0x0U, 2);
-	new (toFill++) EmojiData(936, 684, 0xD83DDD5CU, 0x0U, 2);
-	new (toFill++) EmojiData(1008, 684, 0xD83DDD5DU, 0x0U, 2);
-	new (toFill++) EmojiData(1080, 684, 0xD83DDD5EU, 0x0U, 2);
-	new (toFill++) EmojiData(1152, 684, 0xD83DDD5FU, 0x0U, 2);
-	new (toFill++) EmojiData(1224, 684, 0xD83DDD60U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 720, 0xD83DDD61U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 720, 0xD83DDD62U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 720, 0xD83DDD63U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 720, 0xD83DDD64U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 720, 0xD83DDD65U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 720, 0xD83DDD66U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 684, 0xD83DDD67U, 0x0U, 2);
-	new (toFill++) EmojiData(1332, 468, 0xD83DDDFBU, 0x0U, 2);
-	new (toFill++) EmojiData(1260, 468, 0xD83DDDFCU, 0x0U, 2);
-	new (toFill++) EmojiData(36, 504, 0xD83DDDFDU, 0x0U, 2);
-	new (toFill++) EmojiData(1296, 468, 0xD83DDDFEU, 0x0U, 2);
-	new (toFill++) EmojiData(756, 540, 0xD83DDDFFU, 0x0U, 2);
-	new (toFill++) EmojiData(72, 0, 0xD83DDE00U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 0, 0xD83DDE01U, 0x0U, 2);
-	new (toFill++) EmojiData(792, 0, 0xD83DDE02U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 0, 0xD83DDE03U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 0, 0xD83DDE04U, 0x0U, 2);
-	new (toFill++) EmojiData(972, 0, 0xD83DDE05U, 0x0U, 2);
-	new (toFill++) EmojiData(1332, 0, 0xD83DDE06U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 36, 0xD83DDE07U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 36, 0xD83DDE08U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 0, 0xD83DDE09U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 0, 0xD83DDE0AU, 0x0U, 2);
-	new (toFill++) EmojiData(1368, 0, 0xD83DDE0BU, 0x0U, 2);
-	new (toFill++) EmojiData(612, 0, 0xD83DDE0CU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 0, 0xD83DDE0DU, 0x0U, 2);
-	new (toFill++) EmojiData(0, 36, 0xD83DDE0EU, 0x0U, 2);
-	new (toFill++) EmojiData(576, 36, 0xD83DDE0FU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 36, 0xD83DDE10U, 0x0U, 2);
-	new (toFill++) EmojiData(612, 36, 0xD83DDE11U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 0, 0xD83DDE12U, 0x0U, 2);
-	new (toFill++) EmojiData(1008, 0, 0xD83DDE13U, 0x0U, 2);
-	new (toFill++) EmojiData(576, 0, 0xD83DDE14U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 36, 0xD83DDE15U, 0x0U, 2);
-	new (toFill++) EmojiData(1296, 0, 0xD83DDE16U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 0, 0xD83DDE17U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 0, 0xD83DDE18U, 0x0U, 2);
-	new (toFill++) EmojiData(360, 0, 0xD83DDE19U, 0x0U, 2);
-	new (toFill++) EmojiData(288, 0, 0xD83DDE1AU, 0x0U, 2);
-	new (toFill++) EmojiData(468, 0, 0xD83DDE1BU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 0, 0xD83DDE1CU, 0x0U, 2);
-	new (toFill++) EmojiData(432, 0, 0xD83DDE1DU, 0x0U, 2);
-	new (toFill++) EmojiData(684, 0, 0xD83DDE1EU, 0x0U, 2);
-	new (toFill++) EmojiData(144, 36, 0xD83DDE1FU, 0x0U, 2);
-	new (toFill++) EmojiData(1188, 0, 0xD83DDE20U, 0x0U, 2);
-	new (toFill++) EmojiData(1224, 0, 0xD83DDE21U, 0x0U, 2);
-	new (toFill++) EmojiData(756, 0, 0xD83DDE22U, 0x0U, 2);
-	new (toFill++) EmojiData(720, 0, 0xD83DDE23U, 0x0U, 2);
-	new (toFill++) EmojiData(1260, 0, 0xD83DDE24U, 0x0U, 2);
-	new (toFill++) EmojiData(900, 0, 0xD83DDE25U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 36, 0xD83DDE26U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 36, 0xD83DDE27U, 0x0U, 2);
-	new (toFill++) EmojiData(1116, 0, 0xD83DDE28U, 0x0U, 2);
-	new (toFill++) EmojiData(1044, 0, 0xD83DDE29U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 0, 0xD83DDE2AU, 0x0U, 2);
-	new (toFill++) EmojiData(1080, 0, 0xD83DDE2BU, 0x0U, 2);
-	new (toFill++) EmojiData(360, 36, 0xD83DDE2CU, 0x0U, 2);
-	new (toFill++) EmojiData(828, 0, 0xD83DDE2DU, 0x0U, 2);
-	new (toFill++) EmojiData(324, 36, 0xD83DDE2EU, 0x0U, 2);
-	new (toFill++) EmojiData(468, 36, 0xD83DDE2FU, 0x0U, 2);
-	new (toFill++) EmojiData(936, 0, 0xD83DDE30U, 0x0U, 2);
-	new (toFill++) EmojiData(1152, 0, 0xD83DDE31U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 36, 0xD83DDE32U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 0, 0xD83DDE33U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 36, 0xD83DDE34U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 36, 0xD83DDE35U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 36, 0xD83DDE36U, 0x0U, 2);
-	new (toFill++) EmojiData(1404, 0, 0xD83DDE37U, 0x0U, 2);
-	new (toFill++) EmojiData(1224, 36, 0xD83DDE38U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 72, 0xD83DDE39U, 0x0U, 2);
-	new (toFill++) EmojiData(1188, 36, 0xD83DDE3AU, 0x0U, 2);
-	new (toFill++) EmojiData(1260, 36, 0xD83DDE3BU, 0x0U, 2);
-	new (toFill++) EmojiData(1332, 36, 0xD83DDE3CU, 0x0U, 2);
-	new (toFill++) EmojiData(1296, 36, 0xD83DDE3DU, 0x0U, 2);
-	new (toFill++) EmojiData(36, 72, 0xD83DDE3EU, 0x0U, 2);
-	new (toFill++) EmojiData(1404, 36, 0xD83DDE3FU, 0x0U, 2);
-	new (toFill++) EmojiData(1368, 36, 0xD83DDE40U, 0x0U, 2);
-	new (toFill++) EmojiData(504, 108, 0xD83DDE45U, 0x0U, 2);
-	new (toFill++) EmojiData(468, 108, 0xD83DDE46U, 0x0U, 2);
-	new (toFill++) EmojiData(828, 108, 0xD83DDE47U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 72, 0xD83DDE48U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 72, 0xD83DDE49U, 0x0U, 2);
-	new (toFill++) EmojiData(216, 72, 0xD83DDE4AU, 0x0U, 2);
-	new (toFill++) EmojiData(576, 108, 0xD83DDE4BU, 0x0U, 2);
-	new (toFill++) EmojiData(1368, 72, 0xD83DDE4CU, 0x0U, 2);
-	new (toFill++) EmojiData(792, 108, 0xD83DDE4DU, 0x0U, 2);
-	new (toFill++) EmojiData(756, 108, 0xD83DDE4EU, 0x0U, 2);
-	new (toFill++) EmojiData(1404, 72, 0xD83DDE4FU, 0x0U, 2);
-	new (toFill++) EmojiData(432, 504, 0xD83DDE80U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 504, 0xD83DDE81U, 0x0U, 2);
-	new (toFill++) EmojiData(576, 504, 0xD83DDE82U, 0x0U, 2);
-	new (toFill++) EmojiData(972, 504, 0xD83DDE83U, 0x0U, 2);
-	new (toFill++) EmojiData(756, 504, 0xD83DDE84U, 0x0U, 2);
-	new (toFill++) EmojiData(792, 504, 0xD83DDE85U, 0x0U, 2);
-	new (toFill++) EmojiData(720, 504, 0xD83DDE86U, 0x0U, 2);
-	new (toFill++) EmojiData(864, 504, 0xD83DDE87U, 0x0U, 2);
-	new (toFill++) EmojiData(828, 504, 0xD83DDE88U, 0x0U, 2);
-	new (toFill++) EmojiData(648, 504, 0xD83DDE89U, 0x0U, 2);
-	new (toFill++) EmojiData(612, 504, 0xD83DDE8AU, 0x0U, 2);
-	new (toFill++) EmojiData(936, 504, 0xD83DDE8BU, 0x0U, 2);
-	new (toFill++) EmojiData(1044, 504, 0xD83DDE8CU, 0x0U, 2);
-	new (toFill++) EmojiData(1080, 504, 0xD83DDE8DU, 0x0U, 2);
-	new (toFill++) EmojiData(1008, 504, 0xD83DDE8EU, 0x0U, 2);
-	new (toFill++) EmojiData(360, 540, 0xD83DDE8FU, 0x0U, 2);
-	new (toFill++) EmojiData(108, 540, 0xD83DDE90U, 0x0U, 2);
-	new (toFill++) EmojiData(72, 540, 0xD83DDE91U, 0x0U, 2);
-	new (toFill++) EmojiData(36, 540, 0xD83DDE92U, 0x0U, 2);
-	new (toFill++) EmojiData(1404, 504, 0xD83DDE93U, 0x0U, 2);
-	new (toFill++) EmojiData(0, 540, 0xD83DDE94U, 0x0U, 2);
-	new (toFill++) EmojiData(1224, 504, 0xD83DDE95U, 0x0U, 2);
-	new (toFill++) EmojiData(1260, 504, 0xD83DDE96U, 0x0U, 2);
-	new (toFill++) EmojiData(1188, 504, 0xD83DDE97U, 0x0U, 2);
-	new (toFill++) EmojiData(1152, 504, 0xD83DDE98U, 0x0U, 2);
-	new (toFill++) EmojiData(1116, 504, 0xD83DDE99U, 0x0U, 2);
-	new (toFill++) EmojiData(1332, 504, 0xD83DDE9AU, 0x0U, 2);
-	new (toFill++) EmojiData(1296, 504, 0xD83DDE9BU, 0x0U, 2);
-	new (toFill++) EmojiData(288, 540, 0xD83DDE9CU, 0x0U, 2);
-	new (toFill++) EmojiData(900, 504, 0xD83DDE9DU, 0x0U, 2);
-	new (toFill++) EmojiData(684, 504, 0xD83DDE9EU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 540, 0xD83DDE9FU, 0x0U, 2);
-	new (toFill++) EmojiData(252, 540, 0xD83DDEA0U, 0x0U, 2);
-	new (toFill++) EmojiData(180, 540, 0xD83DDEA1U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 504, 0xD83DDEA2U, 0x0U, 2);
-	new (toFill++) EmojiData(360, 504, 0xD83DDEA3U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 504, 0xD83DDEA4U, 0x0U, 2);
-	new (toFill++) EmojiData(468, 540, 0xD83DDEA5U, 0x0U, 2);
-	new (toFill++) EmojiData(432, 540, 0xD83DDEA6U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 540, 0xD83DDEA7U, 0x0U, 2);
-	new (toFill++) EmojiData(1368, 504, 0xD83DDEA8U, 0x0U, 2);
-	new (toFill++) EmojiData(900, 540, 0xD83DDEA9U, 0x0U, 2);
-	new (toFill++) EmojiData(540, 324, 0xD83DDEAAU, 0x0U, 2);
-	new (toFill++) EmojiData(108, 648, 0xD83DDEABU, 0x0U, 2);
-	new (toFill++) EmojiData(576, 324, 0xD83DDEACU, 0x0U, 2);
-	new (toFill++) EmojiData(1008, 612, 0xD83DDEADU, 0x0U, 2);
-	new (toFill++) EmojiData(900, 612, 0xD83DDEAEU, 0x0U, 2);
-	new (toFill++) EmojiData(216, 648, 0xD83DDEAFU, 0x0U, 2);
-	new (toFill++) EmojiData(864, 612, 0xD83DDEB0U, 0x0U, 2);
-	new (toFill++) EmojiData(252, 648, 0xD83DDEB1U, 0x0U, 2);
-	new (toFill++) EmojiData(144, 540, 0xD83DDEB2U, 0x0U, 2);
-	new (toFill++) EmojiData(288, 648, 0xD83DDEB3U, 0x0U, 2);
-	new (toFill++) EmojiData(972, 396, 0xD83DDEB4U, 0x0U, 2);
-	new (toFill++) EmojiData(936, 396, 0xD83DDEB5U, 0x0U, 2);
-	new (toFill++) EmojiData(108, 108, 0xD83DDEB6U, 0x0U, 2);
-	new (toFill++) EmojiData(324, 648, 0xD83DDEB7U, 0x0U, 2);
-	new (toFill++) EmojiData(360, 648, 0xD83DDEB8U, 0x0U, 2);
-	new (toFill++) EmojiData(720, 612, 0xD83DDEB9U, 0x0U, 2);
-	new (toFill++) EmojiData(756, 612, 0xD83DDEBAU, 0x0U, 2);
-	new (toFill++) EmojiData(684, 612, 0xD83DDEBBU, 0x0U, 2);
-	new (toFill++) EmojiData(792, 612, 0xD83DDEBCU, 0x0U, 2);
-	new (toFill++) EmojiData(396, 324, 0xD83DDEBDU, 0x0U, 2);
-	new (toFill++) EmojiData(828, 612, 0xD83DDEBEU, 0x0U, 2);
-	new (toFill++) EmojiData(360, 324, 0xD83DDEBFU, 0x0U, 2);
-	new (toFill++) EmojiData(324, 324, 0xD83DDEC0U, 0x0U, 2);
-	new (toFill++) EmojiData(288, 324, 0xD83DDEC1U, 0x0U, 2);
-	new (toFill++) EmojiData(1188, 612, 0xD83DDEC2U, 0x0U, 2);
-	new (toFill++) EmojiData(1296, 612, 0xD83DDEC3U, 0x0U, 2);
-	new (toFill++) EmojiData(1224, 612, 0xD83DDEC4U, 0x0U, 2);
-	new (toFill++) EmojiData(1260, 612, 0xD83DDEC5U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 108, 4, 0xA9U, 0x0U, 1);
+	new (toFill++) EmojiData(396, 108, 4, 0xAEU, 0x0U, 1);
+	new (toFill++) EmojiData(504, 108, 4, 0x203CU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(540, 108, 4, 0x2049U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(432, 108, 4, 0x2122U, 0x0U, 1);
+	new (toFill++) EmojiData(1224, 0, 4, 0x2139U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(900, 0, 4, 0x2194U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(936, 0, 4, 0x2195U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(792, 0, 4, 0x2196U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(756, 0, 4, 0x2197U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(828, 0, 4, 0x2198U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(864, 0, 4, 0x2199U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1152, 0, 4, 0x21A9U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1188, 0, 4, 0x21AAU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(324, 36, 2, 0x231AU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(252, 36, 2, 0x231BU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1296, 0, 4, 0x23E9U, 0x0U, 1);
+	new (toFill++) EmojiData(1260, 0, 4, 0x23EAU, 0x0U, 1);
+	new (toFill++) EmojiData(1332, 0, 4, 0x23EBU, 0x0U, 1);
+	new (toFill++) EmojiData(1368, 0, 4, 0x23ECU, 0x0U, 1);
+	new (toFill++) EmojiData(288, 36, 2, 0x23F0U, 0x0U, 1);
+	new (toFill++) EmojiData(216, 36, 2, 0x23F3U, 0x0U, 1);
+	new (toFill++) EmojiData(1296, 36, 4, 0x24C2U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1188, 144, 4, 0x25AAU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1224, 144, 4, 0x25ABU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1044, 0, 4, 0x25B6U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1008, 0, 4, 0x25C0U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1080, 144, 4, 0x25FBU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1044, 144, 4, 0x25FCU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1152, 144, 4, 0x25FDU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1116, 144, 4, 0x25FEU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(900, 72, 1, 0x2600U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(972, 72, 1, 0x2601U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1116, 0, 2, 0x260EU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(792, 144, 4, 0x2611U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1044, 72, 1, 0x2614U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(396, 144, 2, 0x2615U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(0, 108, 0, 0x261DU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(144, 0, 0, 0x263AU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1152, 72, 4, 0x2648U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1188, 72, 4, 0x2649U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1224, 72, 4, 0x264AU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1260, 72, 4, 0x264BU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1296, 72, 4, 0x264CU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1332, 72, 4, 0x264DU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1368, 72, 4, 0x264EU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1404, 72, 4, 0x264FU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(0, 108, 4, 0x2650U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(36, 108, 4, 0x2651U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(72, 108, 4, 0x2652U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(108, 108, 4, 0x2653U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(540, 144, 4, 0x2660U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(612, 144, 4, 0x2663U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(576, 144, 4, 0x2665U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(648, 144, 4, 0x2666U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(180, 72, 3, 0x2668U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1116, 72, 4, 0x267BU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1116, 36, 4, 0x267FU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1296, 0, 3, 0x2693U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1404, 36, 3, 0x26A0U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1008, 72, 1, 0x26A1U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1404, 144, 4, 0x26AAU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1368, 144, 4, 0x26ABU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1224, 108, 2, 0x26BDU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1260, 108, 2, 0x26BEU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1116, 72, 1, 0x26C4U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(936, 72, 1, 0x26C5U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(144, 108, 4, 0x26CEU, 0x0U, 1);
+	new (toFill++) EmojiData(540, 72, 4, 0x26D4U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(396, 0, 3, 0x26EAU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1080, 0, 3, 0x26F2U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(0, 144, 2, 0x26F3U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1188, 0, 3, 0x26F5U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(648, 0, 3, 0x26FAU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(72, 72, 3, 0x26FDU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1152, 72, 2, 0x2702U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(684, 72, 4, 0x2705U, 0x0U, 1);
+	new (toFill++) EmojiData(1368, 0, 3, 0x2708U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(288, 72, 2, 0x2709U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1044, 72, 0, 0x270AU, 0x0U, 1);
+	new (toFill++) EmojiData(1152, 72, 0, 0x270BU, 0x0U, 1);
+	new (toFill++) EmojiData(1080, 72, 0, 0x270CU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1296, 72, 2, 0x270FU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1260, 72, 2, 0x2712U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(756, 144, 4, 0x2714U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(396, 144, 4, 0x2716U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(396, 72, 0, 0x2728U, 0x0U, 1);
+	new (toFill++) EmojiData(576, 72, 4, 0x2733U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(720, 72, 4, 0x2734U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1080, 72, 1, 0x2744U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(612, 72, 4, 0x2747U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(468, 108, 4, 0x274CU, 0x0U, 1);
+	new (toFill++) EmojiData(648, 72, 4, 0x274EU, 0x0U, 1);
+	new (toFill++) EmojiData(612, 108, 4, 0x2753U, 0x0U, 1);
+	new (toFill++) EmojiData(684, 108, 4, 0x2754U, 0x0U, 1);
+	new (toFill++) EmojiData(648, 108, 4, 0x2755U, 0x0U, 1);
+	new (toFill++) EmojiData(576, 108, 4, 0x2757U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(432, 144, 0, 0x2764U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(432, 144, 4, 0x2795U, 0x0U, 1);
+	new (toFill++) EmojiData(468, 144, 4, 0x2796U, 0x0U, 1);
+	new (toFill++) EmojiData(504, 144, 4, 0x2797U, 0x0U, 1);
+	new (toFill++) EmojiData(612, 0, 4, 0x27A1U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(900, 144, 4, 0x27B0U, 0x0U, 1);
+	new (toFill++) EmojiData(1080, 72, 4, 0x27BFU, 0x0U, 1);
+	new (toFill++) EmojiData(0, 36, 4, 0x2934U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(1404, 0, 4, 0x2935U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(576, 0, 4, 0x2B05U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(504, 0, 4, 0x2B06U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(540, 0, 4, 0x2B07U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(144, 180, 4, 0x2B1BU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(108, 180, 4, 0x2B1CU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(864, 72, 1, 0x2B50U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(720, 108, 4, 0x2B55U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(936, 144, 4, 0x3030U, 0x0U, 1);
+	new (toFill++) EmojiData(972, 144, 4, 0x303DU, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(108, 72, 4, 0x3297U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(72, 72, 4, 0x3299U, 0x0U, 1, 0xFE0F);
+	new (toFill++) EmojiData(432, 0, 4, 0x2320E3U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 0, 4, 0x3020E3U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 0, 4, 0x3120E3U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 0, 4, 0x3220E3U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 0, 4, 0x3320E3U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 0, 4, 0x3420E3U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 0, 4, 0x3520E3U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 0, 4, 0x3620E3U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 0, 4, 0x3720E3U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 0, 4, 0x3820E3U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 0, 4, 0x3920E3U, 0x0U, 2);
+	new (toFill++) EmojiData(1044, 108, 2, 0xD83CDC04U, 0x0U, 2, 0xFE0F);
+	new (toFill++) EmojiData(972, 108, 2, 0xD83CDCCFU, 0x0U, 2);
+	new (toFill++) EmojiData(900, 72, 4, 0xD83CDD70U, 0x0U, 2);
+	new (toFill++) EmojiData(936, 72, 4, 0xD83CDD71U, 0x0U, 2);
+	new (toFill++) EmojiData(1008, 72, 4, 0xD83CDD7EU, 0x0U, 2);
+	new (toFill++) EmojiData(1080, 36, 4, 0xD83CDD7FU, 0x0U, 2, 0xFE0F);
+	new (toFill++) EmojiData(972, 72, 4, 0xD83CDD8EU, 0x0U, 2);
+	new (toFill++) EmojiData(144, 72, 4, 0xD83CDD91U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 36, 4, 0xD83CDD92U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 36, 4, 0xD83CDD93U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 72, 4, 0xD83CDD94U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 36, 4, 0xD83CDD95U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 36, 4, 0xD83CDD96U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 36, 4, 0xD83CDD97U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 72, 4, 0xD83CDD98U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 36, 4, 0xD83CDD99U, 0x0U, 2);
+	new (toFill++) EmojiData(792, 72, 4, 0xD83CDD9AU, 0x0U, 2);
+	new (toFill++) EmojiData(504, 72, 3, 0xD83CDDE8U, 0xD83CDDF3U, 4);
+	new (toFill++) EmojiData(468, 72, 3, 0xD83CDDE9U, 0xD83CDDEAU, 4);
+	new (toFill++) EmojiData(612, 72, 3, 0xD83CDDEAU, 0xD83CDDF8U, 4);
+	new (toFill++) EmojiData(576, 72, 3, 0xD83CDDEBU, 0xD83CDDF7U, 4);
+	new (toFill++) EmojiData(720, 72, 3, 0xD83CDDECU, 0xD83CDDE7U, 4);
+	new (toFill++) EmojiData(648, 72, 3, 0xD83CDDEEU, 0xD83CDDF9U, 4);
+	new (toFill++) EmojiData(396, 72, 3, 0xD83CDDEFU, 0xD83CDDF5U, 4);
+	new (toFill++) EmojiData(432, 72, 3, 0xD83CDDF0U, 0xD83CDDF7U, 4);
+	new (toFill++) EmojiData(684, 72, 3, 0xD83CDDF7U, 0xD83CDDFAU, 4);
+	new (toFill++) EmojiData(540, 72, 3, 0xD83CDDFAU, 0xD83CDDF8U, 4);
+	new (toFill++) EmojiData(432, 36, 4, 0xD83CDE01U, 0x0U, 2);
+	new (toFill++) EmojiData(1260, 36, 4, 0xD83CDE02U, 0x0U, 2);
+	new (toFill++) EmojiData(792, 36, 4, 0xD83CDE1AU, 0x0U, 2, 0xFE0F);
+	new (toFill++) EmojiData(468, 36, 4, 0xD83CDE2FU, 0x0U, 2, 0xFE0F);
+	new (toFill++) EmojiData(612, 36, 4, 0xD83CDE32U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 36, 4, 0xD83CDE33U, 0x0U, 2);
+	new (toFill++) EmojiData(576, 36, 4, 0xD83CDE34U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 36, 4, 0xD83CDE35U, 0x0U, 2);
+	new (toFill++) EmojiData(756, 36, 4, 0xD83CDE36U, 0x0U, 2);
+	new (toFill++) EmojiData(1188, 36, 4, 0xD83CDE37U, 0x0U, 2);
+	new (toFill++) EmojiData(1224, 36, 4, 0xD83CDE38U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 36, 4, 0xD83CDE39U, 0x0U, 2);
+	new (toFill++) EmojiData(720, 36, 4, 0xD83CDE3AU, 0x0U, 2);
+	new (toFill++) EmojiData(648, 36, 4, 0xD83CDE50U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 72, 4, 0xD83CDE51U, 0x0U, 2);
+	new (toFill++) EmojiData(1152, 72, 1, 0xD83CDF00U, 0x0U, 2);
+	new (toFill++) EmojiData(1188, 72, 1, 0xD83CDF01U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 144, 0, 0xD83CDF02U, 0x0U, 2);
+	new (toFill++) EmojiData(900, 0, 3, 0xD83CDF03U, 0x0U, 2);
+	new (toFill++) EmojiData(828, 0, 3, 0xD83CDF04U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 0, 3, 0xD83CDF05U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 0, 3, 0xD83CDF06U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 0, 3, 0xD83CDF07U, 0x0U, 2);
+	new (toFill++) EmojiData(1224, 72, 1, 0xD83CDF08U, 0x0U, 2);
+	new (toFill++) EmojiData(972, 0, 3, 0xD83CDF09U, 0x0U, 2);
+	new (toFill++) EmojiData(1260, 72, 1, 0xD83CDF0AU, 0x0U, 2);
+	new (toFill++) EmojiData(756, 72, 1, 0xD83CDF0BU, 0x0U, 2);
+	new (toFill++) EmojiData(792, 72, 1, 0xD83CDF0CU, 0x0U, 2);
+	new (toFill++) EmojiData(648, 72, 1, 0xD83CDF0DU, 0x0U, 2);
+	new (toFill++) EmojiData(684, 72, 1, 0xD83CDF0EU, 0x0U, 2);
+	new (toFill++) EmojiData(720, 72, 1, 0xD83CDF0FU, 0x0U, 2);
+	new (toFill++) EmojiData(108, 72, 1, 0xD83CDF10U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 72, 1, 0xD83CDF11U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 72, 1, 0xD83CDF12U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 72, 1, 0xD83CDF13U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 72, 1, 0xD83CDF14U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 72, 1, 0xD83CDF15U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 72, 1, 0xD83CDF16U, 0x0U, 2);
+	new (toFill++) EmojiData(468, 72, 1, 0xD83CDF17U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 72, 1, 0xD83CDF18U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 72, 1, 0xD83CDF19U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 72, 1, 0xD83CDF1AU, 0x0U, 2);
+	new (toFill++) EmojiData(576, 72, 1, 0xD83CDF1BU, 0x0U, 2);
+	new (toFill++) EmojiData(540, 72, 1, 0xD83CDF1CU, 0x0U, 2);
+	new (toFill++) EmojiData(180, 72, 1, 0xD83CDF1DU, 0x0U, 2);
+	new (toFill++) EmojiData(144, 72, 1, 0xD83CDF1EU, 0x0U, 2);
+	new (toFill++) EmojiData(432, 72, 0, 0xD83CDF1FU, 0x0U, 2);
+	new (toFill++) EmojiData(828, 72, 1, 0xD83CDF20U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 72, 1, 0xD83CDF30U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 72, 1, 0xD83CDF31U, 0x0U, 2);
+	new (toFill++) EmojiData(1368, 36, 1, 0xD83CDF32U, 0x0U, 2);
+	new (toFill++) EmojiData(1404, 36, 1, 0xD83CDF33U, 0x0U, 2);
+	new (toFill++) EmojiData(1332, 36, 1, 0xD83CDF34U, 0x0U, 2);
+	new (toFill++) EmojiData(1296, 36, 1, 0xD83CDF35U, 0x0U, 2);
+	new (toFill++) EmojiData(900, 36, 1, 0xD83CDF37U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 36, 1, 0xD83CDF38U, 0x0U, 2);
+	new (toFill++) EmojiData(972, 36, 1, 0xD83CDF39U, 0x0U, 2);
+	new (toFill++) EmojiData(1044, 36, 1, 0xD83CDF3AU, 0x0U, 2);
+	new (toFill++) EmojiData(1008, 36, 1, 0xD83CDF3BU, 0x0U, 2);
+	new (toFill++) EmojiData(72, 72, 1, 0xD83CDF3CU, 0x0U, 2);
+	new (toFill++) EmojiData(1044, 180, 2, 0xD83CDF3DU, 0x0U, 2);
+	new (toFill++) EmojiData(1224, 36, 1, 0xD83CDF3EU, 0x0U, 2);
+	new (toFill++) EmojiData(1188, 36, 1, 0xD83CDF3FU, 0x0U, 2);
+	new (toFill++) EmojiData(936, 36, 1, 0xD83CDF40U, 0x0U, 2);
+	new (toFill++) EmojiData(1080, 36, 1, 0xD83CDF41U, 0x0U, 2);
+	new (toFill++) EmojiData(1152, 36, 1, 0xD83CDF42U, 0x0U, 2);
+	new (toFill++) EmojiData(1116, 36, 1, 0xD83CDF43U, 0x0U, 2);
+	new (toFill++) EmojiData(1260, 36, 1, 0xD83CDF44U, 0x0U, 2);
+	new (toFill++) EmojiData(1008, 180, 2, 0xD83CDF45U, 0x0U, 2);
+	new (toFill++) EmojiData(972, 180, 2, 0xD83CDF46U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 180, 2, 0xD83CDF47U, 0x0U, 2);
+	new (toFill++) EmojiData(792, 180, 2, 0xD83CDF48U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 180, 2, 0xD83CDF49U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 180, 2, 0xD83CDF4AU, 0x0U, 2);
+	new (toFill++) EmojiData(576, 180, 2, 0xD83CDF4BU, 0x0U, 2);
+	new (toFill++) EmojiData(828, 180, 2, 0xD83CDF4CU, 0x0U, 2);
+	new (toFill++) EmojiData(900, 180, 2, 0xD83CDF4DU, 0x0U, 2);
+	new (toFill++) EmojiData(468, 180, 2, 0xD83CDF4EU, 0x0U, 2);
+	new (toFill++) EmojiData(504, 180, 2, 0xD83CDF4FU, 0x0U, 2);
+	new (toFill++) EmojiData(864, 180, 2, 0xD83CDF50U, 0x0U, 2);
+	new (toFill++) EmojiData(756, 180, 2, 0xD83CDF51U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 180, 2, 0xD83CDF52U, 0x0U, 2);
+	new (toFill++) EmojiData(720, 180, 2, 0xD83CDF53U, 0x0U, 2);
+	new (toFill++) EmojiData(792, 144, 2, 0xD83CDF54U, 0x0U, 2);
+	new (toFill++) EmojiData(756, 144, 2, 0xD83CDF55U, 0x0U, 2);
+	new (toFill++) EmojiData(900, 144, 2, 0xD83CDF56U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 144, 2, 0xD83CDF57U, 0x0U, 2);
+	new (toFill++) EmojiData(1188, 144, 2, 0xD83CDF58U, 0x0U, 2);
+	new (toFill++) EmojiData(1152, 144, 2, 0xD83CDF59U, 0x0U, 2);
+	new (toFill++) EmojiData(1224, 144, 2, 0xD83CDF5AU, 0x0U, 2);
+	new (toFill++) EmojiData(972, 144, 2, 0xD83CDF5BU, 0x0U, 2);
+	new (toFill++) EmojiData(1260, 144, 2, 0xD83CDF5CU, 0x0U, 2);
+	new (toFill++) EmojiData(936, 144, 2, 0xD83CDF5DU, 0x0U, 2);
+	new (toFill++) EmojiData(0, 180, 2, 0xD83CDF5EU, 0x0U, 2);
+	new (toFill++) EmojiData(828, 144, 2, 0xD83CDF5FU, 0x0U, 2);
+	new (toFill++) EmojiData(936, 180, 2, 0xD83CDF60U, 0x0U, 2);
+	new (toFill++) EmojiData(1368, 144, 2, 0xD83CDF61U, 0x0U, 2);
+	new (toFill++) EmojiData(1332, 144, 2, 0xD83CDF62U, 0x0U, 2);
+	new (toFill++) EmojiData(1080, 144, 2, 0xD83CDF63U, 0x0U, 2);
+	new (toFill++) EmojiData(1008, 144, 2, 0xD83CDF64U, 0x0U, 2);
+	new (toFill++) EmojiData(1116, 144, 2, 0xD83CDF65U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 180, 2, 0xD83CDF66U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 180, 2, 0xD83CDF67U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 180, 2, 0xD83CDF68U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 180, 2, 0xD83CDF69U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 180, 2, 0xD83CDF6AU, 0x0U, 2);
+	new (toFill++) EmojiData(324, 180, 2, 0xD83CDF6BU, 0x0U, 2);
+	new (toFill++) EmojiData(360, 180, 2, 0xD83CDF6CU, 0x0U, 2);
+	new (toFill++) EmojiData(396, 180, 2, 0xD83CDF6DU, 0x0U, 2);
+	new (toFill++) EmojiData(72, 180, 2, 0xD83CDF6EU, 0x0U, 2);
+	new (toFill++) EmojiData(432, 180, 2, 0xD83CDF6FU, 0x0U, 2);
+	new (toFill++) EmojiData(252, 180, 2, 0xD83CDF70U, 0x0U, 2);
+	new (toFill++) EmojiData(1044, 144, 2, 0xD83CDF71U, 0x0U, 2);
+	new (toFill++) EmojiData(1296, 144, 2, 0xD83CDF72U, 0x0U, 2);
+	new (toFill++) EmojiData(1404, 144, 2, 0xD83CDF73U, 0x0U, 2);
+	new (toFill++) EmojiData(720, 144, 2, 0xD83CDF74U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 144, 2, 0xD83CDF75U, 0x0U, 2);
+	new (toFill++) EmojiData(468, 144, 2, 0xD83CDF76U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 144, 2, 0xD83CDF77U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 144, 2, 0xD83CDF78U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 144, 2, 0xD83CDF79U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 144, 2, 0xD83CDF7AU, 0x0U, 2);
+	new (toFill++) EmojiData(576, 144, 2, 0xD83CDF7BU, 0x0U, 2);
+	new (toFill++) EmojiData(504, 144, 2, 0xD83CDF7CU, 0x0U, 2);
+	new (toFill++) EmojiData(180, 144, 0, 0xD83CDF80U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 0, 2, 0xD83CDF81U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 180, 2, 0xD83CDF82U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 0, 2, 0xD83CDF83U, 0x0U, 2);
+	new (toFill++) EmojiData(468, 0, 2, 0xD83CDF84U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 0, 2, 0xD83CDF85U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 0, 2, 0xD83CDF86U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 0, 2, 0xD83CDF87U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 0, 2, 0xD83CDF88U, 0x0U, 2);
+	new (toFill++) EmojiData(576, 0, 2, 0xD83CDF89U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 0, 2, 0xD83CDF8AU, 0x0U, 2);
+	new (toFill++) EmojiData(540, 0, 2, 0xD83CDF8BU, 0x0U, 2);
+	new (toFill++) EmojiData(684, 0, 2, 0xD83CDF8CU, 0x0U, 2);
+	new (toFill++) EmojiData(0, 0, 2, 0xD83CDF8DU, 0x0U, 2);
+	new (toFill++) EmojiData(72, 0, 2, 0xD83CDF8EU, 0x0U, 2);
+	new (toFill++) EmojiData(180, 0, 2, 0xD83CDF8FU, 0x0U, 2);
+	new (toFill++) EmojiData(288, 0, 2, 0xD83CDF90U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 0, 2, 0xD83CDF91U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 0, 2, 0xD83CDF92U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 0, 2, 0xD83CDF93U, 0x0U, 2);
+	new (toFill++) EmojiData(1008, 0, 3, 0xD83CDFA0U, 0x0U, 2);
+	new (toFill++) EmojiData(1044, 0, 3, 0xD83CDFA1U, 0x0U, 2);
+	new (toFill++) EmojiData(1116, 0, 3, 0xD83CDFA2U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 144, 2, 0xD83CDFA3U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 108, 2, 0xD83CDFA4U, 0x0U, 2);
+	new (toFill++) EmojiData(756, 0, 2, 0xD83CDFA5U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 36, 4, 0xD83CDFA6U, 0x0U, 2);
+	new (toFill++) EmojiData(576, 108, 2, 0xD83CDFA7U, 0x0U, 2);
+	new (toFill++) EmojiData(468, 108, 2, 0xD83CDFA8U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 108, 0, 0xD83CDFA9U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 72, 3, 0xD83CDFAAU, 0x0U, 2);
+	new (toFill++) EmojiData(1296, 36, 3, 0xD83CDFABU, 0x0U, 2);
+	new (toFill++) EmojiData(504, 108, 2, 0xD83CDFACU, 0x0U, 2);
+	new (toFill++) EmojiData(288, 72, 3, 0xD83CDFADU, 0x0U, 2);
+	new (toFill++) EmojiData(936, 108, 2, 0xD83CDFAEU, 0x0U, 2);
+	new (toFill++) EmojiData(1116, 108, 2, 0xD83CDFAFU, 0x0U, 2);
+	new (toFill++) EmojiData(144, 72, 3, 0xD83CDFB0U, 0x0U, 2);
+	new (toFill++) EmojiData(1332, 108, 2, 0xD83CDFB1U, 0x0U, 2);
+	new (toFill++) EmojiData(1080, 108, 2, 0xD83CDFB2U, 0x0U, 2);
+	new (toFill++) EmojiData(1404, 108, 2, 0xD83CDFB3U, 0x0U, 2);
+	new (toFill++) EmojiData(1008, 108, 2, 0xD83CDFB4U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 108, 2, 0xD83CDFB5U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 108, 2, 0xD83CDFB6U, 0x0U, 2);
+	new (toFill++) EmojiData(828, 108, 2, 0xD83CDFB7U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 108, 2, 0xD83CDFB8U, 0x0U, 2);
+	new (toFill++) EmojiData(720, 108, 2, 0xD83CDFB9U, 0x0U, 2);
+	new (toFill++) EmojiData(792, 108, 2, 0xD83CDFBAU, 0x0U, 2);
+	new (toFill++) EmojiData(756, 108, 2, 0xD83CDFBBU, 0x0U, 2);
+	new (toFill++) EmojiData(612, 108, 2, 0xD83CDFBCU, 0x0U, 2);
+	new (toFill++) EmojiData(1296, 108, 0, 0xD83CDFBDU, 0x0U, 2);
+	new (toFill++) EmojiData(1296, 108, 2, 0xD83CDFBEU, 0x0U, 2);
+	new (toFill++) EmojiData(216, 144, 2, 0xD83CDFBFU, 0x0U, 2);
+	new (toFill++) EmojiData(1188, 108, 2, 0xD83CDFC0U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 144, 2, 0xD83CDFC1U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 144, 2, 0xD83CDFC2U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 108, 0, 0xD83CDFC3U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 144, 2, 0xD83CDFC4U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 144, 2, 0xD83CDFC6U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 144, 2, 0xD83CDFC7U, 0x0U, 2);
+	new (toFill++) EmojiData(1152, 108, 2, 0xD83CDFC8U, 0x0U, 2);
+	new (toFill++) EmojiData(1368, 108, 2, 0xD83CDFC9U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 144, 2, 0xD83CDFCAU, 0x0U, 2);
+	new (toFill++) EmojiData(0, 0, 3, 0xD83CDFE0U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 0, 3, 0xD83CDFE1U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 0, 3, 0xD83CDFE2U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 0, 3, 0xD83CDFE3U, 0x0U, 2);
+	new (toFill++) EmojiData(468, 0, 3, 0xD83CDFE4U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 0, 3, 0xD83CDFE5U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 0, 3, 0xD83CDFE6U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 108, 4, 0xD83CDFE7U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 0, 3, 0xD83CDFE8U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 0, 3, 0xD83CDFE9U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 0, 3, 0xD83CDFEAU, 0x0U, 2);
+	new (toFill++) EmojiData(72, 0, 3, 0xD83CDFEBU, 0x0U, 2);
+	new (toFill++) EmojiData(432, 0, 3, 0xD83CDFECU, 0x0U, 2);
+	new (toFill++) EmojiData(684, 0, 3, 0xD83CDFEDU, 0x0U, 2);
+	new (toFill++) EmojiData(108, 72, 3, 0xD83CDFEEU, 0x0U, 2);
+	new (toFill++) EmojiData(576, 0, 3, 0xD83CDFEFU, 0x0U, 2);
+	new (toFill++) EmojiData(612, 0, 3, 0xD83CDFF0U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 36, 1, 0xD83DDC00U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 36, 1, 0xD83DDC01U, 0x0U, 2);
+	new (toFill++) EmojiData(468, 36, 1, 0xD83DDC02U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 36, 1, 0xD83DDC03U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 36, 1, 0xD83DDC04U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 36, 1, 0xD83DDC05U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 36, 1, 0xD83DDC06U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 36, 1, 0xD83DDC07U, 0x0U, 2);
+	new (toFill++) EmojiData(720, 36, 1, 0xD83DDC08U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 36, 1, 0xD83DDC09U, 0x0U, 2);
+	new (toFill++) EmojiData(576, 36, 1, 0xD83DDC0AU, 0x0U, 2);
+	new (toFill++) EmojiData(1404, 0, 1, 0xD83DDC0BU, 0x0U, 2);
+	new (toFill++) EmojiData(1152, 0, 1, 0xD83DDC0CU, 0x0U, 2);
+	new (toFill++) EmojiData(936, 0, 1, 0xD83DDC0DU, 0x0U, 2);
+	new (toFill++) EmojiData(252, 36, 1, 0xD83DDC0EU, 0x0U, 2);
+	new (toFill++) EmojiData(36, 36, 1, 0xD83DDC0FU, 0x0U, 2);
+	new (toFill++) EmojiData(288, 36, 1, 0xD83DDC10U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 0, 1, 0xD83DDC11U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 0, 1, 0xD83DDC12U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 36, 1, 0xD83DDC13U, 0x0U, 2);
+	new (toFill++) EmojiData(900, 0, 1, 0xD83DDC14U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 36, 1, 0xD83DDC15U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 36, 1, 0xD83DDC16U, 0x0U, 2);
+	new (toFill++) EmojiData(468, 0, 1, 0xD83DDC17U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 0, 1, 0xD83DDC18U, 0x0U, 2);
+	new (toFill++) EmojiData(1188, 0, 1, 0xD83DDC19U, 0x0U, 2);
+	new (toFill++) EmojiData(1224, 0, 1, 0xD83DDC1AU, 0x0U, 2);
+	new (toFill++) EmojiData(1008, 0, 1, 0xD83DDC1BU, 0x0U, 2);
+	new (toFill++) EmojiData(1080, 0, 1, 0xD83DDC1CU, 0x0U, 2);
+	new (toFill++) EmojiData(1044, 0, 1, 0xD83DDC1DU, 0x0U, 2);
+	new (toFill++) EmojiData(1116, 0, 1, 0xD83DDC1EU, 0x0U, 2);
+	new (toFill++) EmojiData(1296, 0, 1, 0xD83DDC1FU, 0x0U, 2);
+	new (toFill++) EmojiData(1260, 0, 1, 0xD83DDC20U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 36, 1, 0xD83DDC21U, 0x0U, 2);
+	new (toFill++) EmojiData(972, 0, 1, 0xD83DDC22U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 0, 1, 0xD83DDC23U, 0x0U, 2);
+	new (toFill++) EmojiData(792, 0, 1, 0xD83DDC24U, 0x0U, 2);
+	new (toFill++) EmojiData(828, 0, 1, 0xD83DDC25U, 0x0U, 2);
+	new (toFill++) EmojiData(756, 0, 1, 0xD83DDC26U, 0x0U, 2);
+	new (toFill++) EmojiData(720, 0, 1, 0xD83DDC27U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 0, 1, 0xD83DDC28U, 0x0U, 2);
+	new (toFill++) EmojiData(756, 36, 1, 0xD83DDC29U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 36, 1, 0xD83DDC2AU, 0x0U, 2);
+	new (toFill++) EmojiData(612, 36, 1, 0xD83DDC2BU, 0x0U, 2);
+	new (toFill++) EmojiData(1332, 0, 1, 0xD83DDC2CU, 0x0U, 2);
+	new (toFill++) EmojiData(108, 0, 1, 0xD83DDC2DU, 0x0U, 2);
+	new (toFill++) EmojiData(432, 0, 1, 0xD83DDC2EU, 0x0U, 2);
+	new (toFill++) EmojiData(252, 0, 1, 0xD83DDC2FU, 0x0U, 2);
+	new (toFill++) EmojiData(180, 0, 1, 0xD83DDC30U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 0, 1, 0xD83DDC31U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 36, 1, 0xD83DDC32U, 0x0U, 2);
+	new (toFill++) EmojiData(1368, 0, 1, 0xD83DDC33U, 0x0U, 2);
+	new (toFill++) EmojiData(576, 0, 1, 0xD83DDC34U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 0, 1, 0xD83DDC35U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 0, 1, 0xD83DDC36U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 0, 1, 0xD83DDC37U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 0, 1, 0xD83DDC38U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 0, 1, 0xD83DDC39U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 0, 1, 0xD83DDC3AU, 0x0U, 2);
+	new (toFill++) EmojiData(324, 0, 1, 0xD83DDC3BU, 0x0U, 2);
+	new (toFill++) EmojiData(684, 0, 1, 0xD83DDC3CU, 0x0U, 2);
+	new (toFill++) EmojiData(396, 0, 1, 0xD83DDC3DU, 0x0U, 2);
+	new (toFill++) EmojiData(792, 36, 1, 0xD83DDC3EU, 0x0U, 2);
+	new (toFill++) EmojiData(756, 72, 0, 0xD83DDC40U, 0x0U, 2);
+	new (toFill++) EmojiData(720, 72, 0, 0xD83DDC42U, 0x0U, 2);
+	new (toFill++) EmojiData(792, 72, 0, 0xD83DDC43U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 72, 0, 0xD83DDC44U, 0x0U, 2);
+	new (toFill++) EmojiData(828, 72, 0, 0xD83DDC45U, 0x0U, 2);
+	new (toFill++) EmojiData(1224, 72, 0, 0xD83DDC46U, 0x0U, 2);
+	new (toFill++) EmojiData(1260, 72, 0, 0xD83DDC47U, 0x0U, 2);
+	new (toFill++) EmojiData(1332, 72, 0, 0xD83DDC48U, 0x0U, 2);
+	new (toFill++) EmojiData(1296, 72, 0, 0xD83DDC49U, 0x0U, 2);
+	new (toFill++) EmojiData(1008, 72, 0, 0xD83DDC4AU, 0x0U, 2);
+	new (toFill++) EmojiData(1116, 72, 0, 0xD83DDC4BU, 0x0U, 2);
+	new (toFill++) EmojiData(972, 72, 0, 0xD83DDC4CU, 0x0U, 2);
+	new (toFill++) EmojiData(900, 72, 0, 0xD83DDC4DU, 0x0U, 2);
+	new (toFill++) EmojiData(936, 72, 0, 0xD83DDC4EU, 0x0U, 2);
+	new (toFill++) EmojiData(36, 108, 0, 0xD83DDC4FU, 0x0U, 2);
+	new (toFill++) EmojiData(1188, 72, 0, 0xD83DDC50U, 0x0U, 2);
+	new (toFill++) EmojiData(900, 108, 0, 0xD83DDC51U, 0x0U, 2);
+	new (toFill++) EmojiData(936, 108, 0, 0xD83DDC52U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 144, 0, 0xD83DDC53U, 0x0U, 2);
+	new (toFill++) EmojiData(1188, 108, 0, 0xD83DDC54U, 0x0U, 2);
+	new (toFill++) EmojiData(1152, 108, 0, 0xD83DDC55U, 0x0U, 2);
+	new (toFill++) EmojiData(1332, 108, 0, 0xD83DDC56U, 0x0U, 2);
+	new (toFill++) EmojiData(1260, 108, 0, 0xD83DDC57U, 0x0U, 2);
+	new (toFill++) EmojiData(1368, 108, 0, 0xD83DDC58U, 0x0U, 2);
+	new (toFill++) EmojiData(1404, 108, 0, 0xD83DDC59U, 0x0U, 2);
+	new (toFill++) EmojiData(1224, 108, 0, 0xD83DDC5AU, 0x0U, 2);
+	new (toFill++) EmojiData(108, 144, 0, 0xD83DDC5BU, 0x0U, 2);
+	new (toFill++) EmojiData(36, 144, 0, 0xD83DDC5CU, 0x0U, 2);
+	new (toFill++) EmojiData(72, 144, 0, 0xD83DDC5DU, 0x0U, 2);
+	new (toFill++) EmojiData(1008, 108, 0, 0xD83DDC5EU, 0x0U, 2);
+	new (toFill++) EmojiData(972, 108, 0, 0xD83DDC5FU, 0x0U, 2);
+	new (toFill++) EmojiData(1080, 108, 0, 0xD83DDC60U, 0x0U, 2);
+	new (toFill++) EmojiData(1044, 108, 0, 0xD83DDC61U, 0x0U, 2);
+	new (toFill++) EmojiData(1116, 108, 0, 0xD83DDC62U, 0x0U, 2);
+	new (toFill++) EmojiData(972, 144, 0, 0xD83DDC63U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 144, 0, 0xD83DDC64U, 0x0U, 2);
+	new (toFill++) EmojiData(900, 144, 0, 0xD83DDC65U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 36, 0, 0xD83DDC66U, 0x0U, 2);
+	new (toFill++) EmojiData(900, 36, 0, 0xD83DDC67U, 0x0U, 2);
+	new (toFill++) EmojiData(936, 36, 0, 0xD83DDC68U, 0x0U, 2);
+	new (toFill++) EmojiData(972, 36, 0, 0xD83DDC69U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 108, 0, 0xD83DDC6AU, 0x0U, 2);
+	new (toFill++) EmojiData(216, 108, 0, 0xD83DDC6BU, 0x0U, 2);
+	new (toFill++) EmojiData(288, 108, 0, 0xD83DDC6CU, 0x0U, 2);
+	new (toFill++) EmojiData(324, 108, 0, 0xD83DDC6DU, 0x0U, 2);
+	new (toFill++) EmojiData(720, 36, 0, 0xD83DDC6EU, 0x0U, 2);
+	new (toFill++) EmojiData(432, 108, 0, 0xD83DDC6FU, 0x0U, 2);
+	new (toFill++) EmojiData(720, 108, 0, 0xD83DDC70U, 0x0U, 2);
+	new (toFill++) EmojiData(1080, 36, 0, 0xD83DDC71U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 36, 0, 0xD83DDC72U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 36, 0, 0xD83DDC73U, 0x0U, 2);
+	new (toFill++) EmojiData(1008, 36, 0, 0xD83DDC74U, 0x0U, 2);
+	new (toFill++) EmojiData(1044, 36, 0, 0xD83DDC75U, 0x0U, 2);
+	new (toFill++) EmojiData(828, 36, 0, 0xD83DDC76U, 0x0U, 2);
+	new (toFill++) EmojiData(756, 36, 0, 0xD83DDC77U, 0x0U, 2);
+	new (toFill++) EmojiData(1152, 36, 0, 0xD83DDC78U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 72, 0, 0xD83DDC79U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 72, 0, 0xD83DDC7AU, 0x0U, 2);
+	new (toFill++) EmojiData(396, 0, 2, 0xD83DDC7BU, 0x0U, 2);
+	new (toFill++) EmojiData(1116, 36, 0, 0xD83DDC7CU, 0x0U, 2);
+	new (toFill++) EmojiData(288, 72, 0, 0xD83DDC7DU, 0x0U, 2);
+	new (toFill++) EmojiData(900, 108, 2, 0xD83DDC7EU, 0x0U, 2);
+	new (toFill++) EmojiData(288, 36, 0, 0xD83DDC7FU, 0x0U, 2);
+	new (toFill++) EmojiData(252, 72, 0, 0xD83DDC80U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 108, 0, 0xD83DDC81U, 0x0U, 2);
+	new (toFill++) EmojiData(792, 36, 0, 0xD83DDC82U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 108, 0, 0xD83DDC83U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 144, 0, 0xD83DDC84U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 108, 0, 0xD83DDC85U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 108, 0, 0xD83DDC86U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 108, 0, 0xD83DDC87U, 0x0U, 2);
+	new (toFill++) EmojiData(1224, 36, 3, 0xD83DDC88U, 0x0U, 2);
+	new (toFill++) EmojiData(1296, 36, 2, 0xD83DDC89U, 0x0U, 2);
+	new (toFill++) EmojiData(1260, 36, 2, 0xD83DDC8AU, 0x0U, 2);
+	new (toFill++) EmojiData(756, 144, 0, 0xD83DDC8BU, 0x0U, 2);
+	new (toFill++) EmojiData(720, 144, 0, 0xD83DDC8CU, 0x0U, 2);
+	new (toFill++) EmojiData(792, 144, 0, 0xD83DDC8DU, 0x0U, 2);
+	new (toFill++) EmojiData(828, 144, 0, 0xD83DDC8EU, 0x0U, 2);
+	new (toFill++) EmojiData(360, 108, 0, 0xD83DDC8FU, 0x0U, 2);
+	new (toFill++) EmojiData(828, 36, 1, 0xD83DDC90U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 108, 0, 0xD83DDC91U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 0, 3, 0xD83DDC92U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 144, 0, 0xD83DDC93U, 0x0U, 2);
+	new (toFill++) EmojiData(468, 144, 0, 0xD83DDC94U, 0x0U, 2);
+	new (toFill++) EmojiData(576, 144, 0, 0xD83DDC95U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 144, 0, 0xD83DDC96U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 144, 0, 0xD83DDC97U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 144, 0, 0xD83DDC98U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 144, 0, 0xD83DDC99U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 144, 0, 0xD83DDC9AU, 0x0U, 2);
+	new (toFill++) EmojiData(288, 144, 0, 0xD83DDC9BU, 0x0U, 2);
+	new (toFill++) EmojiData(360, 144, 0, 0xD83DDC9CU, 0x0U, 2);
+	new (toFill++) EmojiData(36, 0, 2, 0xD83DDC9DU, 0x0U, 2);
+	new (toFill++) EmojiData(648, 144, 0, 0xD83DDC9EU, 0x0U, 2);
+	new (toFill++) EmojiData(756, 72, 4, 0xD83DDC9FU, 0x0U, 2);
+	new (toFill++) EmojiData(1044, 72, 4, 0xD83DDCA0U, 0x0U, 2);
+	new (toFill++) EmojiData(576, 36, 2, 0xD83DDCA1U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 72, 0, 0xD83DDCA2U, 0x0U, 2);
+	new (toFill++) EmojiData(1152, 36, 2, 0xD83DDCA3U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 72, 0, 0xD83DDCA4U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 72, 0, 0xD83DDCA5U, 0x0U, 2);
+	new (toFill++) EmojiData(576, 72, 0, 0xD83DDCA6U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 72, 0, 0xD83DDCA7U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 72, 0, 0xD83DDCA8U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 72, 0, 0xD83DDCA9U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 108, 0, 0xD83DDCAAU, 0x0U, 2);
+	new (toFill++) EmojiData(468, 72, 0, 0xD83DDCABU, 0x0U, 2);
+	new (toFill++) EmojiData(936, 144, 0, 0xD83DDCACU, 0x0U, 2);
+	new (toFill++) EmojiData(1008, 144, 0, 0xD83DDCADU, 0x0U, 2);
+	new (toFill++) EmojiData(684, 144, 4, 0xD83DDCAEU, 0x0U, 2);
+	new (toFill++) EmojiData(720, 144, 4, 0xD83DDCAFU, 0x0U, 2);
+	new (toFill++) EmojiData(1332, 36, 2, 0xD83DDCB0U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 108, 4, 0xD83DDCB1U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 108, 4, 0xD83DDCB2U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 72, 2, 0xD83DDCB3U, 0x0U, 2);
+	new (toFill++) EmojiData(1368, 36, 2, 0xD83DDCB4U, 0x0U, 2);
+	new (toFill++) EmojiData(1404, 36, 2, 0xD83DDCB5U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 72, 2, 0xD83DDCB6U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 72, 2, 0xD83DDCB7U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 72, 2, 0xD83DDCB8U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 108, 4, 0xD83DDCB9U, 0x0U, 2);
+	new (toFill++) EmojiData(1404, 0, 3, 0xD83DDCBAU, 0x0U, 2);
+	new (toFill++) EmojiData(1044, 0, 2, 0xD83DDCBBU, 0x0U, 2);
+	new (toFill++) EmojiData(0, 144, 0, 0xD83DDCBCU, 0x0U, 2);
+	new (toFill++) EmojiData(972, 0, 2, 0xD83DDCBDU, 0x0U, 2);
+	new (toFill++) EmojiData(1008, 0, 2, 0xD83DDCBEU, 0x0U, 2);
+	new (toFill++) EmojiData(900, 0, 2, 0xD83DDCBFU, 0x0U, 2);
+	new (toFill++) EmojiData(936, 0, 2, 0xD83DDCC0U, 0x0U, 2);
+	new (toFill++) EmojiData(1080, 72, 2, 0xD83DDCC1U, 0x0U, 2);
+	new (toFill++) EmojiData(1116, 72, 2, 0xD83DDCC2U, 0x0U, 2);
+	new (toFill++) EmojiData(720, 72, 2, 0xD83DDCC3U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 72, 2, 0xD83DDCC4U, 0x0U, 2);
+	new (toFill++) EmojiData(972, 72, 2, 0xD83DDCC5U, 0x0U, 2);
+	new (toFill++) EmojiData(1008, 72, 2, 0xD83DDCC6U, 0x0U, 2);
+	new (toFill++) EmojiData(1044, 72, 2, 0xD83DDCC7U, 0x0U, 2);
+	new (toFill++) EmojiData(828, 72, 2, 0xD83DDCC8U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 72, 2, 0xD83DDCC9U, 0x0U, 2);
+	new (toFill++) EmojiData(792, 72, 2, 0xD83DDCCAU, 0x0U, 2);
+	new (toFill++) EmojiData(936, 72, 2, 0xD83DDCCBU, 0x0U, 2);
+	new (toFill++) EmojiData(1188, 72, 2, 0xD83DDCCCU, 0x0U, 2);
+	new (toFill++) EmojiData(324, 72, 3, 0xD83DDCCDU, 0x0U, 2);
+	new (toFill++) EmojiData(1224, 72, 2, 0xD83DDCCEU, 0x0U, 2);
+	new (toFill++) EmojiData(1332, 72, 2, 0xD83DDCCFU, 0x0U, 2);
+	new (toFill++) EmojiData(1368, 72, 2, 0xD83DDCD0U, 0x0U, 2);
+	new (toFill++) EmojiData(756, 72, 2, 0xD83DDCD1U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 108, 2, 0xD83DDCD2U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 108, 2, 0xD83DDCD3U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 108, 2, 0xD83DDCD4U, 0x0U, 2);
+	new (toFill++) EmojiData(1404, 72, 2, 0xD83DDCD5U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 108, 2, 0xD83DDCD6U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 108, 2, 0xD83DDCD7U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 108, 2, 0xD83DDCD8U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 108, 2, 0xD83DDCD9U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 108, 2, 0xD83DDCDAU, 0x0U, 2);
+	new (toFill++) EmojiData(324, 108, 2, 0xD83DDCDBU, 0x0U, 2);
+	new (toFill++) EmojiData(900, 72, 2, 0xD83DDCDCU, 0x0U, 2);
+	new (toFill++) EmojiData(648, 72, 2, 0xD83DDCDDU, 0x0U, 2);
+	new (toFill++) EmojiData(1152, 0, 2, 0xD83DDCDEU, 0x0U, 2);
+	new (toFill++) EmojiData(1188, 0, 2, 0xD83DDCDFU, 0x0U, 2);
+	new (toFill++) EmojiData(1224, 0, 2, 0xD83DDCE0U, 0x0U, 2);
+	new (toFill++) EmojiData(1260, 0, 2, 0xD83DDCE1U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 36, 2, 0xD83DDCE2U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 36, 2, 0xD83DDCE3U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 72, 2, 0xD83DDCE4U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 72, 2, 0xD83DDCE5U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 72, 2, 0xD83DDCE6U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 72, 2, 0xD83DDCE7U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 72, 2, 0xD83DDCE8U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 72, 2, 0xD83DDCE9U, 0x0U, 2);
+	new (toFill++) EmojiData(468, 72, 2, 0xD83DDCEAU, 0x0U, 2);
+	new (toFill++) EmojiData(432, 72, 2, 0xD83DDCEBU, 0x0U, 2);
+	new (toFill++) EmojiData(504, 72, 2, 0xD83DDCECU, 0x0U, 2);
+	new (toFill++) EmojiData(540, 72, 2, 0xD83DDCEDU, 0x0U, 2);
+	new (toFill++) EmojiData(576, 72, 2, 0xD83DDCEEU, 0x0U, 2);
+	new (toFill++) EmojiData(396, 72, 2, 0xD83DDCEFU, 0x0U, 2);
+	new (toFill++) EmojiData(432, 108, 2, 0xD83DDCF0U, 0x0U, 2);
+	new (toFill++) EmojiData(1080, 0, 2, 0xD83DDCF1U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 72, 2, 0xD83DDCF2U, 0x0U, 2);
+	new (toFill++) EmojiData(828, 72, 4, 0xD83DDCF3U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 72, 4, 0xD83DDCF4U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 72, 4, 0xD83DDCF5U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 36, 4, 0xD83DDCF6U, 0x0U, 2);
+	new (toFill++) EmojiData(792, 0, 2, 0xD83DDCF7U, 0x0U, 2);
+	new (toFill++) EmojiData(828, 0, 2, 0xD83DDCF9U, 0x0U, 2);
+	new (toFill++) EmojiData(1296, 0, 2, 0xD83DDCFAU, 0x0U, 2);
+	new (toFill++) EmojiData(1332, 0, 2, 0xD83DDCFBU, 0x0U, 2);
+	new (toFill++) EmojiData(864, 0, 2, 0xD83DDCFCU, 0x0U, 2);
+	new (toFill++) EmojiData(72, 36, 4, 0xD83DDD00U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 36, 4, 0xD83DDD01U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 36, 4, 0xD83DDD02U, 0x0U, 2);
+	new (toFill++) EmojiData(936, 108, 4, 0xD83DDD03U, 0x0U, 2);
+	new (toFill++) EmojiData(972, 0, 4, 0xD83DDD04U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 36, 2, 0xD83DDD05U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 36, 2, 0xD83DDD06U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 36, 2, 0xD83DDD07U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 36, 2, 0xD83DDD08U, 0x0U, 2);
+	new (toFill++) EmojiData(1404, 0, 2, 0xD83DDD09U, 0x0U, 2);
+	new (toFill++) EmojiData(1368, 0, 2, 0xD83DDD0AU, 0x0U, 2);
+	new (toFill++) EmojiData(756, 36, 2, 0xD83DDD0BU, 0x0U, 2);
+	new (toFill++) EmojiData(720, 36, 2, 0xD83DDD0CU, 0x0U, 2);
+	new (toFill++) EmojiData(792, 36, 2, 0xD83DDD0DU, 0x0U, 2);
+	new (toFill++) EmojiData(540, 36, 2, 0xD83DDD0EU, 0x0U, 2);
+	new (toFill++) EmojiData(432, 36, 2, 0xD83DDD0FU, 0x0U, 2);
+	new (toFill++) EmojiData(468, 36, 2, 0xD83DDD10U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 36, 2, 0xD83DDD11U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 36, 2, 0xD83DDD12U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 36, 2, 0xD83DDD13U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 36, 2, 0xD83DDD14U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 36, 2, 0xD83DDD15U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 108, 2, 0xD83DDD16U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 144, 4, 0xD83DDD17U, 0x0U, 2);
+	new (toFill++) EmojiData(828, 144, 4, 0xD83DDD18U, 0x0U, 2);
+	new (toFill++) EmojiData(828, 108, 4, 0xD83DDD19U, 0x0U, 2);
+	new (toFill++) EmojiData(792, 108, 4, 0xD83DDD1AU, 0x0U, 2);
+	new (toFill++) EmojiData(864, 108, 4, 0xD83DDD1BU, 0x0U, 2);
+	new (toFill++) EmojiData(900, 108, 4, 0xD83DDD1CU, 0x0U, 2);
+	new (toFill++) EmojiData(756, 108, 4, 0xD83DDD1DU, 0x0U, 2);
+	new (toFill++) EmojiData(288, 72, 4, 0xD83DDD1EU, 0x0U, 2);
+	new (toFill++) EmojiData(360, 0, 4, 0xD83DDD1FU, 0x0U, 2);
+	new (toFill++) EmojiData(648, 0, 4, 0xD83DDD20U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 0, 4, 0xD83DDD21U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 0, 4, 0xD83DDD22U, 0x0U, 2);
+	new (toFill++) EmojiData(468, 0, 4, 0xD83DDD23U, 0x0U, 2);
+	new (toFill++) EmojiData(720, 0, 4, 0xD83DDD24U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 72, 0, 0xD83DDD25U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 36, 2, 0xD83DDD26U, 0x0U, 2);
+	new (toFill++) EmojiData(972, 36, 2, 0xD83DDD27U, 0x0U, 2);
+	new (toFill++) EmojiData(1044, 36, 2, 0xD83DDD28U, 0x0U, 2);
+	new (toFill++) EmojiData(1008, 36, 2, 0xD83DDD29U, 0x0U, 2);
+	new (toFill++) EmojiData(1224, 36, 2, 0xD83DDD2AU, 0x0U, 2);
+	new (toFill++) EmojiData(1188, 36, 2, 0xD83DDD2BU, 0x0U, 2);
+	new (toFill++) EmojiData(360, 108, 2, 0xD83DDD2CU, 0x0U, 2);
+	new (toFill++) EmojiData(396, 108, 2, 0xD83DDD2DU, 0x0U, 2);
+	new (toFill++) EmojiData(720, 0, 2, 0xD83DDD2EU, 0x0U, 2);
+	new (toFill++) EmojiData(180, 108, 4, 0xD83DDD2FU, 0x0U, 2);
+	new (toFill++) EmojiData(36, 72, 3, 0xD83DDD30U, 0x0U, 2);
+	new (toFill++) EmojiData(1008, 144, 4, 0xD83DDD31U, 0x0U, 2);
+	new (toFill++) EmojiData(1296, 144, 4, 0xD83DDD32U, 0x0U, 2);
+	new (toFill++) EmojiData(1332, 144, 4, 0xD83DDD33U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 180, 4, 0xD83DDD34U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 180, 4, 0xD83DDD35U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 180, 4, 0xD83DDD36U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 180, 4, 0xD83DDD37U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 180, 4, 0xD83DDD38U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 180, 4, 0xD83DDD39U, 0x0U, 2);
+	new (toFill++) EmojiData(1260, 144, 4, 0xD83DDD3AU, 0x0U, 2);
+	new (toFill++) EmojiData(72, 180, 4, 0xD83DDD3BU, 0x0U, 2);
+	new (toFill++) EmojiData(1080, 0, 4, 0xD83DDD3CU, 0x0U, 2);
+	new (toFill++) EmojiData(1116, 0, 4, 0xD83DDD3DU, 0x0U, 2);
+	new (toFill++) EmojiData(1044, 108, 4, 0xD83DDD50U, 0x0U, 2);
+	new (toFill++) EmojiData(1116, 108, 4, 0xD83DDD51U, 0x0U, 2);
+	new (toFill++) EmojiData(1188, 108, 4, 0xD83DDD52U, 0x0U, 2);
+	new (toFill++) EmojiData(1260, 108, 4, 0xD83DDD53U, 0x0U, 2);
+	new (toFill++) EmojiData(1332, 108, 4, 0xD83DDD54U, 0x0U, 2);
+	new (toFill++) EmojiData(1404, 108, 4, 0xD83DDD55U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 144, 4, 0xD83DDD56U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 144, 4, 0xD83DDD57U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 144, 4, 0xD83DDD58U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 144, 4, 0xD83DDD59U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 144, 4, 0xD83DDD5AU, 0x0U, 2);
+	new (toFill++) EmojiData(972, 108, 4, 0xD83DDD5BU, 0x0U, 2);
+	new (toFill++) EmojiData(1080, 108, 4, 0xD83DDD5CU, 0x0U, 2);
+	new (toFill++) EmojiData(1152, 108, 4, 0xD83DDD5DU, 0x0U, 2);
+	new (toFill++) EmojiData(1224, 108, 4, 0xD83DDD5EU, 0x0U, 2);
+	new (toFill++) EmojiData(1296, 108, 4, 0xD83DDD5FU, 0x0U, 2);
+	new (toFill++) EmojiData(1368, 108, 4, 0xD83DDD60U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 144, 4, 0xD83DDD61U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 144, 4, 0xD83DDD62U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 144, 4, 0xD83DDD63U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 144, 4, 0xD83DDD64U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 144, 4, 0xD83DDD65U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 144, 4, 0xD83DDD66U, 0x0U, 2);
+	new (toFill++) EmojiData(1008, 108, 4, 0xD83DDD67U, 0x0U, 2);
+	new (toFill++) EmojiData(792, 0, 3, 0xD83DDDFBU, 0x0U, 2);
+	new (toFill++) EmojiData(720, 0, 3, 0xD83DDDFCU, 0x0U, 2);
+	new (toFill++) EmojiData(936, 0, 3, 0xD83DDDFDU, 0x0U, 2);
+	new (toFill++) EmojiData(756, 0, 3, 0xD83DDDFEU, 0x0U, 2);
+	new (toFill++) EmojiData(216, 72, 3, 0xD83DDDFFU, 0x0U, 2);
+	new (toFill++) EmojiData(72, 0, 0, 0xD83DDE00U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 0, 0, 0xD83DDE01U, 0x0U, 2);
+	new (toFill++) EmojiData(792, 0, 0, 0xD83DDE02U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 0, 0, 0xD83DDE03U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 0, 0, 0xD83DDE04U, 0x0U, 2);
+	new (toFill++) EmojiData(972, 0, 0, 0xD83DDE05U, 0x0U, 2);
+	new (toFill++) EmojiData(1332, 0, 0, 0xD83DDE06U, 0x0U, 2);
+	new (toFill++) EmojiData(540, 36, 0, 0xD83DDE07U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 36, 0, 0xD83DDE08U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 0, 0, 0xD83DDE09U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 0, 0, 0xD83DDE0AU, 0x0U, 2);
+	new (toFill++) EmojiData(1368, 0, 0, 0xD83DDE0BU, 0x0U, 2);
+	new (toFill++) EmojiData(612, 0, 0, 0xD83DDE0CU, 0x0U, 2);
+	new (toFill++) EmojiData(216, 0, 0, 0xD83DDE0DU, 0x0U, 2);
+	new (toFill++) EmojiData(0, 36, 0, 0xD83DDE0EU, 0x0U, 2);
+	new (toFill++) EmojiData(576, 36, 0, 0xD83DDE0FU, 0x0U, 2);
+	new (toFill++) EmojiData(396, 36, 0, 0xD83DDE10U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 36, 0, 0xD83DDE11U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 0, 0, 0xD83DDE12U, 0x0U, 2);
+	new (toFill++) EmojiData(1008, 0, 0, 0xD83DDE13U, 0x0U, 2);
+	new (toFill++) EmojiData(576, 0, 0, 0xD83DDE14U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 36, 0, 0xD83DDE15U, 0x0U, 2);
+	new (toFill++) EmojiData(1296, 0, 0, 0xD83DDE16U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 0, 0, 0xD83DDE17U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 0, 0, 0xD83DDE18U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 0, 0, 0xD83DDE19U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 0, 0, 0xD83DDE1AU, 0x0U, 2);
+	new (toFill++) EmojiData(468, 0, 0, 0xD83DDE1BU, 0x0U, 2);
+	new (toFill++) EmojiData(396, 0, 0, 0xD83DDE1CU, 0x0U, 2);
+	new (toFill++) EmojiData(432, 0, 0, 0xD83DDE1DU, 0x0U, 2);
+	new (toFill++) EmojiData(684, 0, 0, 0xD83DDE1EU, 0x0U, 2);
+	new (toFill++) EmojiData(144, 36, 0, 0xD83DDE1FU, 0x0U, 2);
+	new (toFill++) EmojiData(1188, 0, 0, 0xD83DDE20U, 0x0U, 2);
+	new (toFill++) EmojiData(1224, 0, 0, 0xD83DDE21U, 0x0U, 2);
+	new (toFill++) EmojiData(756, 0, 0, 0xD83DDE22U, 0x0U, 2);
+	new (toFill++) EmojiData(720, 0, 0, 0xD83DDE23U, 0x0U, 2);
+	new (toFill++) EmojiData(1260, 0, 0, 0xD83DDE24U, 0x0U, 2);
+	new (toFill++) EmojiData(900, 0, 0, 0xD83DDE25U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 36, 0, 0xD83DDE26U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 36, 0, 0xD83DDE27U, 0x0U, 2);
+	new (toFill++) EmojiData(1116, 0, 0, 0xD83DDE28U, 0x0U, 2);
+	new (toFill++) EmojiData(1044, 0, 0, 0xD83DDE29U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 0, 0, 0xD83DDE2AU, 0x0U, 2);
+	new (toFill++) EmojiData(1080, 0, 0, 0xD83DDE2BU, 0x0U, 2);
+	new (toFill++) EmojiData(360, 36, 0, 0xD83DDE2CU, 0x0U, 2);
+	new (toFill++) EmojiData(828, 0, 0, 0xD83DDE2DU, 0x0U, 2);
+	new (toFill++) EmojiData(324, 36, 0, 0xD83DDE2EU, 0x0U, 2);
+	new (toFill++) EmojiData(468, 36, 0, 0xD83DDE2FU, 0x0U, 2);
+	new (toFill++) EmojiData(936, 0, 0, 0xD83DDE30U, 0x0U, 2);
+	new (toFill++) EmojiData(1152, 0, 0, 0xD83DDE31U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 36, 0, 0xD83DDE32U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 0, 0, 0xD83DDE33U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 36, 0, 0xD83DDE34U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 36, 0, 0xD83DDE35U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 36, 0, 0xD83DDE36U, 0x0U, 2);
+	new (toFill++) EmojiData(1404, 0, 0, 0xD83DDE37U, 0x0U, 2);
+	new (toFill++) EmojiData(1224, 36, 0, 0xD83DDE38U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 72, 0, 0xD83DDE39U, 0x0U, 2);
+	new (toFill++) EmojiData(1188, 36, 0, 0xD83DDE3AU, 0x0U, 2);
+	new (toFill++) EmojiData(1260, 36, 0, 0xD83DDE3BU, 0x0U, 2);
+	new (toFill++) EmojiData(1332, 36, 0, 0xD83DDE3CU, 0x0U, 2);
+	new (toFill++) EmojiData(1296, 36, 0, 0xD83DDE3DU, 0x0U, 2);
+	new (toFill++) EmojiData(36, 72, 0, 0xD83DDE3EU, 0x0U, 2);
+	new (toFill++) EmojiData(1404, 36, 0, 0xD83DDE3FU, 0x0U, 2);
+	new (toFill++) EmojiData(1368, 36, 0, 0xD83DDE40U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 108, 0, 0xD83DDE45U, 0x0U, 2);
+	new (toFill++) EmojiData(468, 108, 0, 0xD83DDE46U, 0x0U, 2);
+	new (toFill++) EmojiData(828, 108, 0, 0xD83DDE47U, 0x0U, 2);
+	new (toFill++) EmojiData(144, 72, 0, 0xD83DDE48U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 72, 0, 0xD83DDE49U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 72, 0, 0xD83DDE4AU, 0x0U, 2);
+	new (toFill++) EmojiData(576, 108, 0, 0xD83DDE4BU, 0x0U, 2);
+	new (toFill++) EmojiData(1368, 72, 0, 0xD83DDE4CU, 0x0U, 2);
+	new (toFill++) EmojiData(792, 108, 0, 0xD83DDE4DU, 0x0U, 2);
+	new (toFill++) EmojiData(756, 108, 0, 0xD83DDE4EU, 0x0U, 2);
+	new (toFill++) EmojiData(1404, 72, 0, 0xD83DDE4FU, 0x0U, 2);
+	new (toFill++) EmojiData(1332, 0, 3, 0xD83DDE80U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 36, 3, 0xD83DDE81U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 36, 3, 0xD83DDE82U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 36, 3, 0xD83DDE83U, 0x0U, 2);
+	new (toFill++) EmojiData(216, 36, 3, 0xD83DDE84U, 0x0U, 2);
+	new (toFill++) EmojiData(252, 36, 3, 0xD83DDE85U, 0x0U, 2);
+	new (toFill++) EmojiData(180, 36, 3, 0xD83DDE86U, 0x0U, 2);
+	new (toFill++) EmojiData(324, 36, 3, 0xD83DDE87U, 0x0U, 2);
+	new (toFill++) EmojiData(288, 36, 3, 0xD83DDE88U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 36, 3, 0xD83DDE89U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 36, 3, 0xD83DDE8AU, 0x0U, 2);
+	new (toFill++) EmojiData(396, 36, 3, 0xD83DDE8BU, 0x0U, 2);
+	new (toFill++) EmojiData(504, 36, 3, 0xD83DDE8CU, 0x0U, 2);
+	new (toFill++) EmojiData(540, 36, 3, 0xD83DDE8DU, 0x0U, 2);
+	new (toFill++) EmojiData(468, 36, 3, 0xD83DDE8EU, 0x0U, 2);
+	new (toFill++) EmojiData(1260, 36, 3, 0xD83DDE8FU, 0x0U, 2);
+	new (toFill++) EmojiData(1008, 36, 3, 0xD83DDE90U, 0x0U, 2);
+	new (toFill++) EmojiData(972, 36, 3, 0xD83DDE91U, 0x0U, 2);
+	new (toFill++) EmojiData(936, 36, 3, 0xD83DDE92U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 36, 3, 0xD83DDE93U, 0x0U, 2);
+	new (toFill++) EmojiData(900, 36, 3, 0xD83DDE94U, 0x0U, 2);
+	new (toFill++) EmojiData(684, 36, 3, 0xD83DDE95U, 0x0U, 2);
+	new (toFill++) EmojiData(720, 36, 3, 0xD83DDE96U, 0x0U, 2);
+	new (toFill++) EmojiData(648, 36, 3, 0xD83DDE97U, 0x0U, 2);
+	new (toFill++) EmojiData(612, 36, 3, 0xD83DDE98U, 0x0U, 2);
+	new (toFill++) EmojiData(576, 36, 3, 0xD83DDE99U, 0x0U, 2);
+	new (toFill++) EmojiData(792, 36, 3, 0xD83DDE9AU, 0x0U, 2);
+	new (toFill++) EmojiData(756, 36, 3, 0xD83DDE9BU, 0x0U, 2);
+	new (toFill++) EmojiData(1188, 36, 3, 0xD83DDE9CU, 0x0U, 2);
+	new (toFill++) EmojiData(360, 36, 3, 0xD83DDE9DU, 0x0U, 2);
+	new (toFill++) EmojiData(144, 36, 3, 0xD83DDE9EU, 0x0U, 2);
+	new (toFill++) EmojiData(1116, 36, 3, 0xD83DDE9FU, 0x0U, 2);
+	new (toFill++) EmojiData(1152, 36, 3, 0xD83DDEA0U, 0x0U, 2);
+	new (toFill++) EmojiData(1080, 36, 3, 0xD83DDEA1U, 0x0U, 2);
+	new (toFill++) EmojiData(1152, 0, 3, 0xD83DDEA2U, 0x0U, 2);
+	new (toFill++) EmojiData(1260, 0, 3, 0xD83DDEA3U, 0x0U, 2);
+	new (toFill++) EmojiData(1224, 0, 3, 0xD83DDEA4U, 0x0U, 2);
+	new (toFill++) EmojiData(1368, 36, 3, 0xD83DDEA5U, 0x0U, 2);
+	new (toFill++) EmojiData(1332, 36, 3, 0xD83DDEA6U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 72, 3, 0xD83DDEA7U, 0x0U, 2);
+	new (toFill++) EmojiData(828, 36, 3, 0xD83DDEA8U, 0x0U, 2);
+	new (toFill++) EmojiData(360, 72, 3, 0xD83DDEA9U, 0x0U, 2);
+	new (toFill++) EmojiData(1080, 36, 2, 0xD83DDEAAU, 0x0U, 2);
+	new (toFill++) EmojiData(252, 72, 4, 0xD83DDEABU, 0x0U, 2);
+	new (toFill++) EmojiData(1116, 36, 2, 0xD83DDEACU, 0x0U, 2);
+	new (toFill++) EmojiData(1152, 36, 4, 0xD83DDEADU, 0x0U, 2);
+	new (toFill++) EmojiData(1044, 36, 4, 0xD83DDEAEU, 0x0U, 2);
+	new (toFill++) EmojiData(360, 72, 4, 0xD83DDEAFU, 0x0U, 2);
+	new (toFill++) EmojiData(1008, 36, 4, 0xD83DDEB0U, 0x0U, 2);
+	new (toFill++) EmojiData(396, 72, 4, 0xD83DDEB1U, 0x0U, 2);
+	new (toFill++) EmojiData(1044, 36, 3, 0xD83DDEB2U, 0x0U, 2);
+	new (toFill++) EmojiData(432, 72, 4, 0xD83DDEB3U, 0x0U, 2);
+	new (toFill++) EmojiData(72, 144, 2, 0xD83DDEB4U, 0x0U, 2);
+	new (toFill++) EmojiData(36, 144, 2, 0xD83DDEB5U, 0x0U, 2);
+	new (toFill++) EmojiData(108, 108, 0, 0xD83DDEB6U, 0x0U, 2);
+	new (toFill++) EmojiData(468, 72, 4, 0xD83DDEB7U, 0x0U, 2);
+	new (toFill++) EmojiData(504, 72, 4, 0xD83DDEB8U, 0x0U, 2);
+	new (toFill++) EmojiData(864, 36, 4, 0xD83DDEB9U, 0x0U, 2);
+	new (toFill++) EmojiData(900, 36, 4, 0xD83DDEBAU, 0x0U, 2);
+	new (toFill++) EmojiData(828, 36, 4, 0xD83DDEBBU, 0x0U, 2);
+	new (toFill++) EmojiData(936, 36, 4, 0xD83DDEBCU, 0x0U, 2);
+	new (toFill++) EmojiData(936, 36, 2, 0xD83DDEBDU, 0x0U, 2);
+	new (toFill++) EmojiData(972, 36, 4, 0xD83DDEBEU, 0x0U, 2);
+	new (toFill++) EmojiData(900, 36, 2, 0xD83DDEBFU, 0x0U, 2);
+	new (toFill++) EmojiData(864, 36, 2, 0xD83DDEC0U, 0x0U, 2);
+	new (toFill++) EmojiData(828, 36, 2, 0xD83DDEC1U, 0x0U, 2);
+	new (toFill++) EmojiData(1332, 36, 4, 0xD83DDEC2U, 0x0U, 2);
+	new (toFill++) EmojiData(0, 72, 4, 0xD83DDEC3U, 0x0U, 2);
+	new (toFill++) EmojiData(1368, 36, 4, 0xD83DDEC4U, 0x0U, 2);
+	new (toFill++) EmojiData(1404, 36, 4, 0xD83DDEC5U, 0x0U, 2);
 }
 
 void initEmoji() {
@@ -309,6 +309,10 @@ yi += stride;
 }
 
 QImage imageColored(const style::color &add, QImage img) {
+	return imageColored(add->c, img);
+}
+
+QImage imageColored(const QColor &add, QImage img) {
 	QImage::Format fmt = img.format();
 	if (fmt != QImage::Format_RGB32 && fmt != QImage::Format_ARGB32_Premultiplied) {
 		img = img.convertToFormat(QImage::Format_ARGB32_Premultiplied);
@@ -316,7 +320,7 @@ QImage imageColored(const style::color &add, QImage img) {
 
 	uchar *pix = img.bits();
 	if (pix) {
-		int ca = int(add->c.alphaF() * 0xFF), cr = int(add->c.redF() * 0xFF), cg = int(add->c.greenF() * 0xFF), cb = int(add->c.blueF() * 0xFF);
+		int ca = int(add.alphaF() * 0xFF), cr = int(add.redF() * 0xFF), cg = int(add.greenF() * 0xFF), cb = int(add.blueF() * 0xFF);
 		const int w = img.width(), h = img.height(), size = w * h * 4;
 		for (int32 i = 0; i < size; i += 4) {
 			int b = pix[i], g = pix[i + 1], r = pix[i + 2], a = pix[i + 3], aca = a * ca;
@@ -428,6 +432,22 @@ void Image::restore() const {
 	forgot = false;
 }
 
+QByteArray Image::encodedData(QByteArray &fmt) const {
+	if (!forgot) return QByteArray();
+	fmt = format;
+	return saved;
+}
+
+void Image::restore(const QByteArray &encoded, const QImage &decoded) const {
+	if (!forgot || decoded.isNull() || encoded.constData() != saved.constData()) return;
+	doRestore(decoded);
+	const QPixmap &p(pixData());
+	if (!p.isNull()) {
+		globalAquiredSize += int64(p.width()) * p.height() * 4;
+	}
+	forgot = false;
+}
+
 void Image::invalidateSizeCache() const {
 	for (Sizes::const_iterator i = _sizesCache.cbegin(), e = _sizesCache.cend(); i != e; ++i) {
 		if (!i->isNull()) {
@@ -538,35 +558,61 @@ int32 StorageImage::height() const {
 
 bool StorageImage::check() const {
 	if (loader->done()) {
-		switch (loader->fileType()) {
-		case mtpc_storage_fileGif: format = "GIF"; break;
-		case mtpc_storage_fileJpeg: format = "JPG"; break;
-		case mtpc_storage_filePng: format = "PNG"; break;
-		default: format = QByteArray(); break;
-		}
-		if (!data.isNull()) {
-			globalAquiredSize -= int64(data.width()) * data.height() * 4;
-		}
-		QByteArray bytes = loader->bytes();
-		data = QPixmap::fromImage(App::readImage(bytes, &format, false), Qt::ColorOnly);
-		if (!data.isNull()) {
-			globalAquiredSize += int64(data.width()) * data.height() * 4;
-		}
-
-		w = data.width();
-		h = data.height();
-		invalidateSizeCache();
-		loader->deleteLater();
-		loader->rpcInvalidate();
-		loader = 0;
-
-		saved = bytes;
-		forgot = false;
+		loaderDone(QImage());
 		return true;
 	}
 	return false;
 }
 
+void StorageImage::loaderDone(QImage decoded) const {
+	switch (loader->fileType()) {
+	case mtpc_storage_fileGif: format = "GIF"; break;
+	case mtpc_storage_fileJpeg: format = "JPG"; break;
+	case mtpc_storage_filePng: format = "PNG"; break;
+	default: format = QByteArray(); break;
+	}
+	if (!data.isNull()) {
+		globalAquiredSize -= int64(data.width()) * data.height() * 4;
+	}
+	QByteArray bytes = loader->bytes();
+	if (decoded.isNull()) {
+		decoded = App::readImage(bytes, &format, false);
+	}
+	data = QPixmap::fromImage(decoded, Qt::ColorOnly);
+	if (!data.isNull()) {
+		globalAquiredSize += int64(data.width()) * data.height() * 4;
+	}
+
+	w = data.width();
+	h = data.height();
+	invalidateSizeCache();
+	loader->deleteLater();
+	loader->rpcInvalidate();
+	loader = 0;
+
+	saved = bytes;
+	forgot = false;
+}
+
+QByteArray StorageImage::encodedData(QByteArray &fmt) const {
+	if (!loader) return Image::encodedData(fmt);
+	if (!loader->done()) return QByteArray();
+
+	switch (loader->fileType()) {
+	case mtpc_storage_fileGif: fmt = "GIF"; break;
+	case mtpc_storage_fileJpeg: fmt = "JPG"; break;
+	case mtpc_storage_filePng: fmt = "PNG"; break;
+	default: fmt = QByteArray(); break;
+	}
+	return loader->bytes();
+}
+
+void StorageImage::restore(const QByteArray &encoded, const QImage &decoded) const {
+	if (!loader) return Image::restore(encoded, decoded);
+	if (decoded.isNull() || !loader->done() || encoded.constData() != loader->bytes().constData()) return;
+	loaderDone(decoded);
+}
+
 void StorageImage::setData(QByteArray &bytes, const QByteArray &format) {
 	QBuffer buffer(&bytes);
 
@@ -20,6 +20,8 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 #include <QtGui/QPixmap>
 
 QImage imageBlur(QImage img);
+QImage imageColored(const style::color &add, QImage img);
+QImage imageColored(const QColor &add, QImage img); // can be used outside of the gui thread
 
 class Image {
 public:
@@ -32,6 +34,9 @@ public:
 	virtual bool loading() const {
 		return false;
 	}
+	virtual bool downloaded() const { // like loaded(), but does not decode the downloaded data
+		return true;
+	}
 	const QPixmap &pix(int32 w = 0, int32 h = 0) const;
 	const QPixmap &pixBlurred(int32 w = 0, int32 h = 0) const;
 	const QPixmap &pixColored(const style::color &add, int32 w = 0, int32 h = 0) const;
@@ -52,11 +57,19 @@ public:
 	virtual void checkload() const {
 	}
 
+	virtual void pause() { // remove from the load queue, load() continues
+	}
+
 	bool isNull() const;
 	
 	void forget() const;
 	void restore() const;
 
+	// encoded bytes of a loaded image which is not decoded in memory right now,
+	// they can be decoded in another thread and passed back to restore()
+	virtual QByteArray encodedData(QByteArray &format) const;
+	virtual void restore(const QByteArray &encoded, const QImage &decoded) const;
+
 	QByteArray savedFormat() const {
 		return format;
 	}
@@ -73,6 +86,7 @@ protected:
 	virtual const QPixmap &pixData() const = 0;
 	virtual void doForget() const = 0;
 	virtual void doRestore() const = 0;
+	virtual void doRestore(const QImage &decoded) const = 0;
 
 	void invalidateSizeCache() const;
 
@@ -109,6 +123,9 @@ protected:
 		QImageReader reader(&buffer, format);
 		data = QPixmap::fromImageReader(&reader, Qt::ColorOnly);
 	}
+	void doRestore(const QImage &decoded) const {
+		data = QPixmap::fromImage(decoded, Qt::ColorOnly);
+	}
 
 private:
 
@@ -149,8 +166,15 @@ public:
 	bool loading() const {
 		return loader ? loader->loading() : false;
 	}
+	bool downloaded() const {
+		return loader ? loader->done() : true;
+	}
 	void setData(QByteArray &bytes, const QByteArray &format = QByteArray());
 
+	QByteArray encodedData(QByteArray &format) const;
+	using Image::restore;
+	void restore(const QByteArray &encoded, const QImage &decoded) const;
+
 	void load(bool loadFirst = false, bool prior = true) {
 		if (loader) {
 			loader->start(loadFirst, prior);
@@ -165,6 +189,9 @@ public:
 			if (loader) check();
 		}
 	}
+	void pause() {
+		if (loader) loader->pause();
+	}
 
 	~StorageImage();
 
@@ -172,6 +199,7 @@ protected:
 
 	const QPixmap &pixData() const;
 	bool check() const;
+	void loaderDone(QImage decoded) const;
 	void doForget() const {
 		data = QPixmap();
 	}
@@ -180,6 +208,9 @@ protected:
 		QImageReader reader(&buffer, format);
 		data = QPixmap::fromImageReader(&reader, Qt::ColorOnly);
 	}
+	void doRestore(const QImage &decoded) const {
+		data = QPixmap::fromImage(decoded, Qt::ColorOnly);
+	}
 
 private:
 
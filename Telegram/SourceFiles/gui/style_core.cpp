@@ -20,6 +20,8 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 namespace {
 	typedef QMap<QString, uint32> FontFamilyMap;
 	FontFamilyMap _fontFamilyMap;
+
+	QMutex _materializeMutex(QMutex::Recursive); // creates the data of st:: fonts and colors, Font::v() and Color::v() read it without locking
 }
 
 namespace style {
@@ -62,6 +64,7 @@ namespace style {
 	}
 
 	Font FontData::otherFlagsFont(uint32 flag, bool set) const {
+		QMutexLocker lock(&_materializeMutex);
 		int32 newFlags = set ? (_flags | flag) : (_flags & ~flag);
 		if (!modified[newFlags].v()) {
 			modified[newFlags] = Font(_size, newFlags, _family, modified);
@@ -81,7 +84,7 @@ namespace style {
 			style::_fontFamilies.push_back(family);
 			i = _fontFamilyMap.insert(family, style::_fontFamilies.size() - 1);
 		}
-		init(i.value(), size, flags, 0);
+		init(size, flags, i.value(), 0);
 	}
 
 	Font::Font(uint32 size, uint32 flags, uint32 family) {
@@ -93,15 +96,30 @@ namespace style {
 	}
 
 	void Font::init(uint32 size, uint32 flags, uint32 family, Font *modified) {
-		uint32 key = _fontKey(size, flags, family);
+		key = _fontKey(size, flags, family);
+		ptr.store(0);
+		if (modified) { // from FontData::otherFlagsFont(), new data shares the modified fonts with it
+			FontDatas::const_iterator i = _fontsMap.constFind(key);
+			if (i == _fontsMap.cend()) {
+				i = _fontsMap.insert(key, new FontData(size, flags, family, modified));
+			}
+			ptr.storeRelease(i.value());
+		}
+	}
+
+	FontData *Font::materialize() const {
+		QMutexLocker lock(&_materializeMutex);
+		if (FontData *result = ptr.load()) return result;
+
 		FontDatas::const_iterator i = _fontsMap.constFind(key);
 		if (i == _fontsMap.cend()) {
-			i = _fontsMap.insert(key, new FontData(size, flags, family, modified));
+			i = _fontsMap.insert(key, new FontData(_fontKeySize(key), _fontKeyFlags(key), _fontKeyFamily(key), 0));
 		}
-		ptr = i.value();
+		ptr.storeRelease(i.value());
+		return i.value();
 	}
 
-	Color::Color(const Color &c) : ptr(c.owner ? new ColorData(*c.ptr) : c.ptr), owner(c.owner) {
+	Color::Color(const Color &c) : ptr(c.owner ? new ColorData(*c.ptr.load()) : c.ptr.loadAcquire()), key(c.key), owner(c.owner), lazy(c.lazy) {
 	}
 
 	Color::Color(const QColor &c) : owner(false) {
@@ -115,42 +133,49 @@ namespace style {
 	Color &Color::operator=(const Color &c) {
 		if (this != &c) {
 			if (owner) {
-				delete ptr;
+				delete ptr.load();
 			}
-			ptr = c.owner ? new ColorData(*c.ptr) : c.ptr;
+			ptr.store(c.owner ? new ColorData(*c.ptr.load()) : c.ptr.loadAcquire());
+			key = c.key;
 			owner = c.owner;
+			lazy = c.lazy;
 		}
 		return *this;
 	}
 
 	void Color::set(const QColor &newv) {
 		if (!owner) {
-			ptr = new ColorData(*ptr);
+			ptr.storeRelease(new ColorData(*v()));
 			owner = true;
 		}
-		ptr->set(newv);
+		ptr.load()->set(newv);
 	}
 
 	void Color::set(uchar r, uchar g, uchar b, uchar a) {
-		if (!owner) {
-			ptr = new ColorData(*ptr);
-			owner = true;
-		}
-		ptr->set(QColor(r, g, b, a));
+		set(QColor(r, g, b, a));
 	}
 
 	void Color::init(uchar r, uchar g, uchar b, uchar a) {
-		uint32 key = _colorKey(r, g, b, a);
+		key = _colorKey(r, g, b, a);
+		ptr.store(0);
+		lazy = true;
+	}
+
+	ColorData *Color::materialize() const {
+		QMutexLocker lock(&_materializeMutex);
+		if (ColorData *result = ptr.load()) return result;
+
 		ColorDatas::const_iterator i = _colorsMap.constFind(key);
 		if (i == _colorsMap.cend()) {
-			i = _colorsMap.insert(key, new ColorData(r, g, b, a));
+			i = _colorsMap.insert(key, new ColorData(uchar((key >> 24) & 0xFF), uchar((key >> 16) & 0xFF), uchar((key >> 8) & 0xFF), uchar(key & 0xFF)));
 		}
-		ptr = i.value();
+		ptr.storeRelease(i.value());
+		return i.value();
 	}
 
 	Color::~Color() {
 		if (owner) {
-			delete ptr;
+			delete ptr.load();
 		}
 	}
 
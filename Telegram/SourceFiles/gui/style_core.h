@@ -38,40 +38,49 @@ namespace style {
 	class FontData;
 	class Font {
 	public:
-		Font(Qt::Initialization = Qt::Uninitialized) : ptr(0) {
+		Font(Qt::Initialization = Qt::Uninitialized) : ptr(0), key(0) {
 		}
 		Font(uint32 size, uint32 flags, const QString &family);
 		Font(uint32 size, uint32 flags = 0, uint32 family = 0);
 
 		Font &operator=(const Font &other) {
-			ptr = other.ptr;
+			ptr.store(other.ptr.loadAcquire());
+			key = other.key;
 			return (*this);
 		}
 
 		FontData *operator->() const {
-			return ptr;
+			return v();
 		}
 		FontData *v() const {
-			return ptr;
+			FontData *result = ptr.loadAcquire();
+			return (result || !key) ? result : materialize();
 		}
 
 		operator bool() const {
-			return !!ptr;
+			return ptr.load() || key;
 		}
 
 	private:
-		FontData *ptr;
+		mutable QAtomicPointer<FontData> ptr; // published with a release store in materialize(), can be first used from any thread
+		uint32 key; // FontData is created in _fontsMap on first use, QFont and QFontMetrics are not needed for most styles at startup
 
 		void init(uint32 size, uint32 flags, uint32 family, Font *modified);
+		FontData *materialize() const;
 		friend void startManager();
 
-		Font(FontData *p) : ptr(p) {
+		Font(FontData *p) : ptr(p), key(0) {
 		}
 		Font(uint32 size, uint32 flags, uint32 family, Font *modified);
 		friend class FontData;
 
 	};
 
+	struct FontInit { // rows of the generated style tables
+		Font *font;
+		uint32 size, flags, family;
+	};
+
 	enum FontFlagBits {
 		FontBoldBit,
 		FontItalicBit,
@@ -91,6 +100,15 @@ namespace style {
 	inline uint32 _fontKey(uint32 size, uint32 flags, uint32 family) {
 		return (((family << 10) | size) << FontFlagsBits) | flags;
 	}
+	inline uint32 _fontKeySize(uint32 key) {
+		return (key >> FontFlagsBits) & 0x3FF;
+	}
+	inline uint32 _fontKeyFlags(uint32 key) {
+		return key & (FontDifferentFlags - 1);
+	}
+	inline uint32 _fontKeyFamily(uint32 key) {
+		return key >> (FontFlagsBits + 10);
+	}
 
 	class FontData {
 	public:
@@ -130,7 +148,7 @@ inline bool operator!=(const Font &a, const Font &b) {
 	class ColorData;
 	class Color {
 	public:
-		Color(Qt::Initialization = Qt::Uninitialized) : ptr(0), owner(false) {
+		Color(Qt::Initialization = Qt::Uninitialized) : ptr(0), key(0), owner(false), lazy(false) {
 		}
 		Color(const Color &c);
 		Color(const QColor &c);
@@ -142,30 +160,46 @@ inline bool operator!=(const Font &a, const Font &b) {
 		void set(uchar r, uchar g, uchar b, uchar a = 255);
 
 		ColorData *operator->() const {
-			return ptr;
+			return v();
 		}
 		ColorData *v() const {
-			return ptr;
+			ColorData *result = ptr.loadAcquire();
+			return (result || !lazy) ? result : materialize();
 		}
 
 		operator bool() const {
-			return !!ptr;
+			return ptr.load() || lazy;
 		}
 
 	private:
-		ColorData *ptr;
+		mutable QAtomicPointer<ColorData> ptr; // published with a release store in materialize(), can be first used from any thread
+		uint32 key; // _colorKey() of ColorData created in _colorsMap on first use
 		bool owner;
+		bool lazy; // ptr is created from key on first use, not changed after init()
 
 		void init(uchar r, uchar g, uchar b, uchar a);
+		ColorData *materialize() const;
 		
 		friend void startManager();
 
-		Color(ColorData *p) : ptr(p) {
+		Color(ColorData *p) : ptr(p), key(0), owner(false), lazy(false) {
 		}
 		friend class ColorData;
 
 	};
 
+	struct ColorInit { // rows of the generated style tables
+		Color *color;
+		uchar r, g, b, a;
+	};
+
+	struct ScaleInit { // generated style tables of one scale, indexed by DBIScale
+		const FontInit *fonts;
+		int32 fontsCount;
+		const ColorInit *colors;
+		int32 colorsCount;
+	};
+
 	inline uint32 _colorKey(uchar r, uchar g, uchar b, uchar a) {
 		return (((((uint32(r) << 8) | uint32(g)) << 8) | uint32(b)) << 8) | uint32(a);
 	}
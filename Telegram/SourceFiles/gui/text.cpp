@@ -307,7 +307,7 @@ public:
 			} else if (len == 1 && _t->_text.at(blockStart) == QChar::LineFeed) {
 				_t->_blocks.push_back(new NewlineBlock(_t->_font, _t->_text, blockStart, len));
 			} else {
-				_t->_blocks.push_back(new TextBlock(_t->_font, _t->_text, _t->_minResizeWidth, blockStart, len, flags, color, lnkIndex));
+				_t->_blocks.push_back(new TextBlock(_t->_font, _t->_text, _t->_minResizeWidth, blockStart, len, flags, color, lnkIndex, _t->_words));
 			}
 			blockStart += len;
 			blockCreated();
@@ -620,6 +620,7 @@ public:
 		}
 		_t->_links.squeeze();
 		_t->_blocks.squeeze();
+		_t->_words.squeeze();
 		_t->_text.squeeze();
 	}
 
@@ -953,7 +954,7 @@ public:
 				TextBlock *t = static_cast<TextBlock*>(b);
 				QFixed f_wLeft = _wLeft;
 				int32 f_lineHeight = _lineHeight;
-				for (TextBlock::TextWords::const_iterator j = t->_words.cbegin(), en = t->_words.cend(), f = j; j != en; ++j) {
+				for (TextWords::const_iterator j = _t->_words.cbegin() + t->_wordsFrom, en = j + t->_wordsCount, f = j; j != en; ++j) {
 					bool wordEndsHere = (j->width >= 0);
 					QFixed j_width = wordEndsHere ? j->width : -j->width;
 
@@ -1326,7 +1327,7 @@ public:
 							}
 						}
 					}
-					_p->drawPixmap(QPoint((glyphX + int(st::emojiPadding)).toInt(), _y + _yDelta + emojiY), App::emojis(), QRect(static_cast<EmojiBlock*>(currentBlock)->emoji->x, static_cast<EmojiBlock*>(currentBlock)->emoji->y, st::emojiImgSize, st::emojiImgSize));
+					_p->drawPixmap(QPoint((glyphX + int(st::emojiPadding)).toInt(), _y + _yDelta + emojiY), App::emojis(static_cast<EmojiBlock*>(currentBlock)->emoji->tile), QRect(static_cast<EmojiBlock*>(currentBlock)->emoji->x, static_cast<EmojiBlock*>(currentBlock)->emoji->y, st::emojiImgSize, st::emojiImgSize));
 //				} else if (_p && currentBlock->type() == TextBlockSkip) { // debug
 //					_p->fillRect(QRect(x.toInt(), _y, currentBlock->width(), static_cast<SkipBlock*>(currentBlock)->height()), QColor(0, 0, 0, 32));
 				}
@@ -1464,7 +1465,7 @@ public:
 	void elideSaveBlock(int32 blockIndex, ITextBlock *&_endBlock, int32 elideStart, int32 elideWidth) {
 		_elideSavedIndex = blockIndex;
 		_elideSavedBlock = _t->_blocks[blockIndex];
-		const_cast<Text*>(_t)->_blocks[blockIndex] = new TextBlock(_t->_font, _t->_text, QFIXED_MAX, elideStart, 0, _elideSavedBlock->flags(), _elideSavedBlock->color(), _elideSavedBlock->lnkIndex());
+		const_cast<Text*>(_t)->_blocks[blockIndex] = new TextBlock(_t->_font, _t->_text, QFIXED_MAX, elideStart, 0, _elideSavedBlock->flags(), _elideSavedBlock->color(), _elideSavedBlock->lnkIndex(), const_cast<Text*>(_t)->_words);
 		_blocksSize = blockIndex + 1;
 		_endBlock = (blockIndex + 1 < _t->_blocks.size() ? _t->_blocks[blockIndex + 1] : 0);
 	}
@@ -2257,6 +2258,7 @@ _minHeight(other._minHeight),
 _text(other._text),
 _font(other._font),
 _blocks(other._blocks.size()),
+_words(other._words),
 _links(other._links),
 _startDir(other._startDir)
 {
@@ -2466,7 +2468,7 @@ int32 Text::countHeight(int32 w) const {
 			TextBlock *t = static_cast<TextBlock*>(b);
 			QFixed f_wLeft = widthLeft;
 			int32 f_lineHeight = lineHeight;
-			for (TextBlock::TextWords::const_iterator j = t->_words.cbegin(), e = t->_words.cend(), f = j; j != e; ++j) {
+			for (TextWords::const_iterator j = _words.cbegin() + t->_wordsFrom, e = j + t->_wordsCount, f = j; j != e; ++j) {
 				bool wordEndsHere = (j->width >= 0);
 				QFixed j_width = wordEndsHere ? j->width : -j->width;
 
@@ -2647,6 +2649,7 @@ void Text::clean() {
 		delete *i;
 	}
 	_blocks.clear();
+	_words.clear();
 	_links.clear();
 	_maxWidth = _minHeight = 0;
 	_startDir = Qt::LayoutDirectionAuto;
@@ -2750,7 +2753,7 @@ namespace {
 class BlockParser {
 public:
 
-	BlockParser(QTextEngine *e, TextBlock *b, QFixed minResizeWidth, int32 blockFrom) : block(b), eng(e) {
+	BlockParser(QTextEngine *e, TextBlock *b, TextWords &words, QFixed minResizeWidth, int32 blockFrom) : block(b), words(words), eng(e) {
 		parseWords(minResizeWidth, blockFrom);
 	}
 
@@ -2773,7 +2776,8 @@ public:
 		lbh.previousGlyph = 0;
 
 		block->_lpadding = 0;
-		block->_words.clear();
+		block->_wordsFrom = words.size();
+		block->_wordsCount = 0;
 
 		int wordStart = lbh.currentPosition;
 
@@ -2807,10 +2811,10 @@ public:
 					addNextCluster(lbh.currentPosition, end, lbh.spaceData, lbh.glyphCount,
 								   current, lbh.logClusters, lbh.glyphs);
 
-				if (block->_words.isEmpty()) {
+				if (words.size() == block->_wordsFrom) {
 					block->_lpadding = lbh.spaceData.textWidth;
 				} else {
-					block->_words.back().rpadding += lbh.spaceData.textWidth;
+					words.back().rpadding += lbh.spaceData.textWidth;
 					block->_width += lbh.spaceData.textWidth;
 				}
 				lbh.spaceData.length = 0;
@@ -2830,7 +2834,7 @@ public:
 						|| attributes[lbh.currentPosition].whiteSpace
 						|| attributes[lbh.currentPosition].lineBreak) {
 						lbh.adjustRightBearing();
-						block->_words.push_back(TextWord(wordStart + blockFrom, lbh.tmpData.textWidth, qMin(QFixed(), lbh.rightBearing)));
+						words.push_back(TextWord(wordStart + blockFrom, lbh.tmpData.textWidth, qMin(QFixed(), lbh.rightBearing)));
 						block->_width += lbh.tmpData.textWidth;
 						lbh.tmpData.textWidth = 0;
 						lbh.tmpData.length = 0;
@@ -2840,7 +2844,7 @@ public:
 						if (!addingEachGrapheme && lbh.tmpData.textWidth > minResizeWidth) {
 							if (lastGraphemeBoundaryPosition >= 0) {
 								lbh.adjustPreviousRightBearing();
-								block->_words.push_back(TextWord(wordStart + blockFrom, -lastGraphemeBoundaryLine.textWidth, qMin(QFixed(), lbh.rightBearing)));
+								words.push_back(TextWord(wordStart + blockFrom, -lastGraphemeBoundaryLine.textWidth, qMin(QFixed(), lbh.rightBearing)));
 								block->_width += lastGraphemeBoundaryLine.textWidth;
 								lbh.tmpData.textWidth -= lastGraphemeBoundaryLine.textWidth;
 								lbh.tmpData.length -= lastGraphemeBoundaryLine.length;
@@ -2850,7 +2854,7 @@ public:
 						}
 						if (addingEachGrapheme) {
 							lbh.adjustRightBearing();
-							block->_words.push_back(TextWord(wordStart + blockFrom, -lbh.tmpData.textWidth, qMin(QFixed(), lbh.rightBearing)));
+							words.push_back(TextWord(wordStart + blockFrom, -lbh.tmpData.textWidth, qMin(QFixed(), lbh.rightBearing)));
 							block->_width += lbh.tmpData.textWidth;
 							lbh.tmpData.textWidth = 0;
 							lbh.tmpData.length = 0;
@@ -2866,23 +2870,25 @@ public:
 			if (lbh.currentPosition == end)
 				newItem = item + 1;
 		}
-		if (block->_words.isEmpty()) {
+		block->_wordsCount = words.size() - block->_wordsFrom;
+		if (!block->_wordsCount) {
 			block->_rpadding = 0;
 		} else {
-			block->_rpadding = block->_words.back().rpadding;
+			block->_rpadding = words.back().rpadding;
+			block->_rbearing = words.back().f_rbearing();
 			block->_width -= block->_rpadding;
-			block->_words.squeeze();
 		}
 	}
 
 private:
 
 	TextBlock *block;
+	TextWords &words;
 	QTextEngine *eng;
 
 };
 
-TextBlock::TextBlock(const style::font &font, const QString &str, QFixed minResizeWidth, uint16 from, uint16 length, uchar flags, const style::color &color, uint16 lnkIndex) : ITextBlock(font, str, from, length, flags, color, lnkIndex) {
+TextBlock::TextBlock(const style::font &font, const QString &str, QFixed minResizeWidth, uint16 from, uint16 length, uchar flags, const style::color &color, uint16 lnkIndex, TextWords &words) : ITextBlock(font, str, from, length, flags, color, lnkIndex), _wordsFrom(words.size()), _wordsCount(0), _rbearing(0) {
 	_flags |= ((TextBlockText & 0x0F) << 8);
 	if (length) {
 		style::font blockFont = font;
@@ -2900,7 +2906,7 @@ TextBlock::TextBlock(const style::font &font, const QString &str, QFixed minResi
 		layout.beginLayout();
 		layout.createLine();
 
-		BlockParser parser(&engine, this, minResizeWidth, _from);
+		BlockParser parser(&engine, this, words, minResizeWidth, _from);
 
 		layout.endLayout();
 	}
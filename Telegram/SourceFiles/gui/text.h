@@ -64,7 +64,7 @@ enum TextBlockFlags {
 	TextBlockUnderline = 0x04,
 };
 
-class ITextBlock {
+class ITextBlock : public SlabAllocated {
 public:
 
 	ITextBlock(const style::font &font, const QString &str, uint16 from, uint16 length, uchar flags, const style::color &color, uint16 lnkIndex) : _from(from), _flags((flags & 0xFF) | ((lnkIndex & 0xFFFF) << 12))/*, _color(color)*/, _lpadding(0) {
@@ -170,12 +170,13 @@ struct TextWord {
 	int16 _rbearing;
 	QFixed width, rpadding;
 };
+typedef QVector<TextWord> TextWords;
 
 class TextBlock : public ITextBlock {
 public:
 
 	QFixed f_rbearing() const {
-		return _words.isEmpty() ? 0 : _words.back().f_rbearing();
+		return _rbearing;
 	}
 
 	ITextBlock *clone() const {
@@ -184,10 +185,10 @@ public:
 
 private:
 
-	TextBlock(const style::font &font, const QString &str, QFixed minResizeWidth, uint16 from, uint16 length, uchar flags, const style::color &color, uint16 lnkIndex);
+	TextBlock(const style::font &font, const QString &str, QFixed minResizeWidth, uint16 from, uint16 length, uchar flags, const style::color &color, uint16 lnkIndex, TextWords &words);
 
-	typedef QVector<TextWord> TextWords;
-	TextWords _words;
+	uint16 _wordsFrom, _wordsCount; // words of all blocks are in one Text::_words vector
+	QFixed _rbearing; // of the last word
 
 	friend class Text;
 	friend class TextParser;
@@ -488,6 +489,7 @@ private:
 
 	typedef QVector<ITextBlock*> TextBlocks;
 	TextBlocks _blocks;
+	TextWords _words;
 
 	typedef QVector<TextLinkPtr> TextLinks;
 	TextLinks _links;
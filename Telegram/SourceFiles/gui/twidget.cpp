@@ -32,19 +32,67 @@ namespace {
 			}
 		}
 	}
+
+	typedef QList<QPixmap> GrabPool;
+	GrabPool _grabPool; // animation caches are dropped when animations finish, their pixmaps are painted again by the next grab
+	QPixmap _grabUnpooled; // when all pooled pixmaps are held by running animations
+
+	QPixmap &_grabPixmap(const QSize &size) {
+		int32 reuse = -1;
+		for (int32 i = 0, l = _grabPool.size(); i < l; ++i) {
+			if (!_grabPool.at(i).isDetached()) continue; // still used by some animation
+
+			if (_grabPool.at(i).size() == size) return _grabPool[i];
+			reuse = i;
+		}
+		if (_grabPool.size() < GrabPoolSize) {
+			_grabPool.push_back(QPixmap(size));
+			return _grabPool.back();
+		}
+		if (reuse < 0) {
+			_grabUnpooled = QPixmap(size);
+			return _grabUnpooled;
+		}
+		_grabPool[reuse] = QPixmap(size);
+		return _grabPool[reuse];
+	}
+}
+
+QPixmap myGrab(QWidget *target, const QRect &rect, bool pooled) {
+	uint64 ms = getms();
+	if (target->testAttribute(Qt::WA_PendingResizeEvent) || !target->testAttribute(Qt::WA_WState_Created)) {
+		_sendResizeEvents(target);
+	}
+
+	qreal dpr = cRetina() ? App::app()->devicePixelRatio() : 1.;
+	QPixmap own;
+	if (!pooled) own = QPixmap(rect.size() * dpr);
+	QPixmap &pix(pooled ? _grabPixmap(rect.size() * dpr) : own);
+	pix.setDevicePixelRatio(dpr);
+
+	// like QWidget::grab(), opaque widgets paint every pixel themselves
+	bool opaque = target->testAttribute(Qt::WA_OpaquePaintEvent) || (target->autoFillBackground() && target->palette().brush(target->backgroundRole()).isOpaque());
+	if (!opaque) {
+		pix.fill(Qt::transparent);
+	}
+	target->render(&pix, QPoint(), QRegion(rect), QWidget::DrawWindowBackground | QWidget::DrawChildren | QWidget::IgnoreMask);
+
+	QPixmap result(pix);
+	_grabUnpooled = QPixmap();
+	DEBUG_LOG(("Grab Info: %1 snapshot %2x%3 rendered in %4ms").arg(target->metaObject()->className()).arg(rect.width()).arg(rect.height()).arg(getms() - ms));
+	return result;
+}
+
+void myGrabTrim() {
+	for (GrabPool::iterator i = _grabPool.begin(); i != _grabPool.end();) {
+		if (i->isDetached()) { // not held by any animation
+			i = _grabPool.erase(i);
+		} else {
+			++i;
+		}
+	}
 }
 
-QPixmap myGrab(QWidget *target, const QRect &rect) {
-    if (!cRetina()) return target->grab(rect);
-        
-    if (target->testAttribute(Qt::WA_PendingResizeEvent) || !target->testAttribute(Qt::WA_WState_Created)) {
-        _sendResizeEvents(target);
-    }
-    
-    qreal dpr = App::app()->devicePixelRatio();
-    QPixmap result(rect.size() * dpr);
-    result.setDevicePixelRatio(dpr);
-    result.fill(Qt::transparent);
-    target->render(&result, QPoint(), QRegion(rect), QWidget::DrawWindowBackground | QWidget::DrawChildren | QWidget::IgnoreMask);
-    return result;
+void myGrabClear() {
+	_grabPool.clear();
 }
@@ -125,4 +125,6 @@ private:
 
 };
 
-QPixmap myGrab(QWidget *target, const QRect &rect);
+QPixmap myGrab(QWidget *target, const QRect &rect, bool pooled = true); // not pooled for caches kept after the animation
+void myGrabTrim(); // when no animation runs, releases the pooled pixmaps no cache holds
+void myGrabClear();
@@ -133,7 +133,82 @@ void stopGif() {
 	animated.stop();
 }
 
+typedef QLinkedList<const DialogRow*> DialogRowsCached; // least recently painted first
+
+struct DialogRowCache {
+	DialogRowCache() : version(0), width(0), state(0), day(0), last(0), lastId(0), photo(0) {
+	}
+	QPixmap pix;
+	uint32 version;
+	int32 width, state, day;
+	const HistoryItem *last;
+	MsgId lastId;
+	const Image *photo;
+	DialogRowsCached::iterator inList;
+};
+
+namespace {
+	DialogRowsCached _dialogRowsCached;
+}
+
+void dialogRowsCacheClear() {
+	while (!_dialogRowsCached.isEmpty()) {
+		_dialogRowsCached.front()->clearCache();
+	}
+}
+
+void DialogRow::clearCache() const {
+	if (_cache) {
+		_dialogRowsCached.erase(_cache->inList);
+		delete _cache;
+		_cache = 0;
+	}
+}
+
 void DialogRow::paint(QPainter &p, int32 w, bool act, bool sel) const {
+	if (!history->typing.isEmpty() || w <= 0) { // typing animation changes the row every frame
+		clearCache();
+		paintContent(p, w, act, sel);
+		return;
+	}
+
+	HistoryItem *last = history->last;
+	const Image *photo = history->peer->photo.v();
+	int32 state = (act ? 0x01 : 0) | (sel ? 0x02 : 0) | (photo->loaded() ? 0x04 : 0) | ((last && last->unread()) ? 0x08 : 0);
+	int32 day = last ? QDate::currentDate().toJulianDay() : 0; // date is drawn relative to today
+
+	if (_cache) {
+		_dialogRowsCached.erase(_cache->inList);
+		_cache->inList = _dialogRowsCached.insert(_dialogRowsCached.end(), this);
+	} else {
+		if (_dialogRowsCached.size() >= DialogRowsCacheSize) {
+			_dialogRowsCached.front()->clearCache();
+		}
+		_cache = new DialogRowCache();
+		_cache->inList = _dialogRowsCached.insert(_dialogRowsCached.end(), this);
+	}
+
+	if (_cache->pix.isNull() || _cache->version != history->dialogVersion || _cache->width != w || _cache->state != state || _cache->day != day || _cache->last != last || _cache->lastId != (last ? last->id : 0) || _cache->photo != photo) {
+		if (_cache->width != w || _cache->pix.isNull()) {
+			_cache->pix = QPixmap(w * cIntRetinaFactor(), st::dlgHeight * cIntRetinaFactor());
+			if (cRetina()) _cache->pix.setDevicePixelRatio(cRetinaFactor());
+		}
+		{
+			QPainter cp(&_cache->pix);
+			paintContent(cp, w, act, sel);
+		}
+		_cache->version = history->dialogVersion;
+		_cache->width = w;
+		_cache->state = state;
+		_cache->day = day;
+		_cache->last = last;
+		_cache->lastId = last ? last->id : 0;
+		_cache->photo = photo;
+	}
+	p.drawPixmap(0, 0, _cache->pix);
+}
+
+void DialogRow::paintContent(QPainter &p, int32 w, bool act, bool sel) const {
 	QRect fullRect(0, 0, w, st::dlgHeight);
 	p.fillRect(fullRect, (act ? st::dlgActiveBG : (sel ? st::dlgHoverBG : st::dlgBG))->b);
 	
@@ -299,6 +374,7 @@ History::History(const PeerId &peerId) : width(0), height(0)
 , sendRequestId(0)
 , textCachedFor(0)
 , lastItemTextCache(st::dlgRichMinWidth)
+, dialogVersion(0)
 , posInDialogs(0)
 , typingText(st::dlgRichMinWidth)
 , myTyping(0)
@@ -310,6 +386,7 @@ History::History(const PeerId &peerId) : width(0), height(0)
 
 void History::updateNameText() {
 	nameText.setText(st::msgNameFont, peer->nameOrPhone.isEmpty() ? peer->name : peer->nameOrPhone, _textNameOptions);
+	dialogChanged();
 }
 
 bool History::updateTyping(uint64 ms, uint32 dots, bool force) {
@@ -338,6 +415,7 @@ bool History::updateTyping(uint64 ms, uint32 dots, bool force) {
 		}
 		if (typingStr != newTypingStr) {
 			typingText.setText(st::dlgHistFont, (typingStr = newTypingStr), _textNameOptions);
+			dialogChanged();
 		}
 	}
 	if (!typingStr.isEmpty()) {
@@ -348,6 +426,133 @@ bool History::updateTyping(uint64 ms, uint32 dots, bool force) {
 	return changed;
 }
 
+namespace {
+	uint32 _dialogRowSeed = 0x9E3779B9;
+	uint32 _dialogRowPriority() { // xorshift, treap priorities only need to be well mixed
+		_dialogRowSeed ^= _dialogRowSeed << 13;
+		_dialogRowSeed ^= _dialogRowSeed >> 17;
+		_dialogRowSeed ^= _dialogRowSeed << 5;
+		return _dialogRowSeed;
+	}
+
+	inline int32 _dialogRowSize(const DialogRow *row) {
+		return row ? row->size : 0;
+	}
+
+	inline void _dialogRowUpdate(DialogRow *row) {
+		row->size = _dialogRowSize(row->left) + _dialogRowSize(row->right) + 1;
+		if (row->left) row->left->parent = row;
+		if (row->right) row->right->parent = row;
+	}
+
+	// first "count" rows of the tree go to "left", all the others to "right"
+	void _dialogRowsSplit(DialogRow *tree, int32 count, DialogRow *&left, DialogRow *&right) {
+		if (!tree) {
+			left = right = 0;
+			return;
+		}
+		int32 leftSize = _dialogRowSize(tree->left);
+		if (count <= leftSize) {
+			_dialogRowsSplit(tree->left, count, left, tree->left);
+			right = tree;
+		} else {
+			_dialogRowsSplit(tree->right, count - leftSize - 1, tree->right, right);
+			left = tree;
+		}
+		_dialogRowUpdate(tree);
+	}
+
+	DialogRow *_dialogRowsMerge(DialogRow *left, DialogRow *right) {
+		if (!left) return right;
+		if (!right) return left;
+		if (left->priority > right->priority) {
+			left->right = _dialogRowsMerge(left->right, right);
+			_dialogRowUpdate(left);
+			return left;
+		}
+		right->left = _dialogRowsMerge(left, right->left);
+		_dialogRowUpdate(right);
+		return right;
+	}
+}
+
+int32 DialogRow::pos() const {
+	int32 result = _dialogRowSize(left);
+	for (const DialogRow *row = this; row->parent; row = row->parent) {
+		if (row == row->parent->right) {
+			result += _dialogRowSize(row->parent->left) + 1;
+		}
+	}
+	return result;
+}
+
+DialogRow *DialogsList::rowAt(int32 pos) const {
+	DialogRow *row = root;
+	while (row) {
+		int32 leftSize = _dialogRowSize(row->left);
+		if (pos < leftSize) {
+			row = row->left;
+		} else if (pos == leftSize) {
+			return row;
+		} else {
+			pos -= leftSize + 1;
+			row = row->right;
+		}
+	}
+	return end;
+}
+
+void DialogsList::insertBefore(DialogRow *row, DialogRow *before) {
+	row->left = row->right = row->parent = 0;
+	row->size = 1;
+	row->priority = _dialogRowPriority();
+
+	DialogRow *left, *right;
+	_dialogRowsSplit(root, before->pos(), left, right);
+	root = _dialogRowsMerge(_dialogRowsMerge(left, row), right);
+	root->parent = 0;
+
+	row->next = before;
+	row->prev = before->prev;
+	before->prev = row;
+	if (row->prev) {
+		row->prev->next = row;
+	} else {
+		begin = row;
+	}
+}
+
+void DialogsList::insertSorted(DialogRow *row) {
+	DialogRow *before = end;
+	for (DialogRow *n = root; n;) {
+		bool greater = (n == end) || (byName ? (n->history->peer->name > row->history->peer->name) : (n->history->posInDialogs > row->history->posInDialogs));
+		if (greater) {
+			before = n;
+			n = n->left;
+		} else {
+			n = n->right;
+		}
+	}
+	insertBefore(row, before);
+}
+
+void DialogsList::remove(DialogRow *row) {
+	DialogRow *left, *middle, *right;
+	_dialogRowsSplit(root, row->pos(), left, right);
+	_dialogRowsSplit(right, 1, middle, right);
+	root = _dialogRowsMerge(left, right);
+	root->parent = 0;
+
+	if (current == row) current = row->next;
+	row->next->prev = row->prev;
+	if (row->prev) {
+		row->prev->next = row->next;
+	} else {
+		begin = row->next;
+	}
+	row->prev = row->next = 0;
+}
+
 bool DialogsList::del(const PeerId &peerId, DialogRow *replacedBy) {
 	RowByPeer::iterator i = rowByPeer.find(peerId);
 	if (i == rowByPeer.cend()) return false;
@@ -355,13 +560,6 @@ bool DialogsList::del(const PeerId &peerId, DialogRow *replacedBy) {
 	DialogRow *row = i.value();
 	emit App::main()->dialogRowReplaced(row, replacedBy);
 
-	if (row == current) {
-		current = row->next;
-	}
-	for (DialogRow *change = row->next; change != end; change = change->next) {
-		change->pos--;
-	}
-	end->pos--;
 	remove(row);
 	delete row;
 	--count;
@@ -370,6 +568,20 @@ bool DialogsList::del(const PeerId &peerId, DialogRow *replacedBy) {
 	return true;
 }
 
+void DialogsList::clear() {
+	for (DialogRow *row = begin; row != end;) {
+		DialogRow *next = row->next;
+		delete row;
+		row = next;
+	}
+	last.prev = last.next = 0;
+	last.left = last.right = last.parent = 0;
+	last.size = 1;
+	begin = current = root = end;
+	rowByPeer.clear();
+	count = 0;
+}
+
 void DialogsIndexed::peerNameChanged(PeerData *peer, const PeerData::Names &oldNames, const PeerData::NameFirstChars &oldChars) {
 	if (byName) {
 		DialogRow *mainRow = list.adjustByName(peer);
@@ -810,7 +1022,7 @@ void History::newItemAdded(HistoryItem *item) {
 	if (item->out()) {
 		if (unreadBar) unreadBar->destroy();
 	} else if (item->unread()) {
-		notifies.push_back(item);
+		if (!App::main()->notifySilent(item)) notifies.push_back(item);
 		App::main()->newUnreadMsg(this, item);
 	}
 	if (dialogs.isEmpty()) {
@@ -1026,6 +1238,7 @@ void History::outboxRead(int32 upTo) {
 		int32 till = upTo ? upTo : back()->back()->id;
 		if (outboxReadTill < till) outboxReadTill = till;
 	}
+	dialogChanged();
 }
 
 void History::outboxRead(HistoryItem *wasRead) {
@@ -1042,6 +1255,7 @@ void History::setUnreadCount(int32 newUnreadCount, bool psUpdate) {
 		App::histories().unreadFull += newUnreadCount - unreadCount;
 		if (mute) App::histories().unreadMuted += newUnreadCount - unreadCount;
 		unreadCount = newUnreadCount;
+		dialogChanged();
 		if (psUpdate) App::wnd()->updateCounter();
 		if (unreadBar) unreadBar->setCount(unreadCount);
 	}
@@ -1057,6 +1271,7 @@ void History::setMsgCount(int32 newMsgCount) {
 	if (mute != newMute) {
 		App::histories().unreadMuted += newMute ? unreadCount : (-unreadCount);
 		mute = newMute;
+		dialogChanged();
 		if (App::wnd()) App::wnd()->updateCounter();
 		if (App::main()) App::main()->dlgUpdated(this);
 	}
@@ -2948,24 +3163,18 @@ void HistorySticker::draw(QPainter &p, const HistoryItem *parent, bool selected,
 	if (!data->loader && data->status != FileFailed && !already && !hasdata) {
 		data->save(QString());
 	}
-	if (data->sticker->isNull() && (already || hasdata)) {
-		if (already) {
-			data->sticker = ImagePtr(data->already());
-		} else {
-			data->sticker = ImagePtr(data->data);
-		}
-	}
+	const QPixmap *decoded = (already || hasdata) ? App::stickerDecoder()->pix(data, pixw, pixh, selected) : 0;
 	if (selected) {
-		if (data->sticker->isNull()) {
+		if (!decoded) {
 			p.drawPixmap(QPoint(usex + (usew - pixw) / 2, (_minh - pixh) / 2), data->thumb->pixBlurredColored(st::msgStickerOverlay, pixw, pixh));
 		} else {
-			p.drawPixmap(QPoint(usex + (usew - pixw) / 2, (_minh - pixh) / 2), data->sticker->pixColored(st::msgStickerOverlay, pixw, pixh));
+			p.drawPixmap(QPoint(usex + (usew - pixw) / 2, (_minh - pixh) / 2), *decoded);
 		}
 	} else {
-		if (data->sticker->isNull()) {
+		if (!decoded) {
 			p.drawPixmap(QPoint(usex + (usew - pixw) / 2, (_minh - pixh) / 2), data->thumb->pixBlurred(pixw, pixh));
 		} else {
-			p.drawPixmap(QPoint(usex + (usew - pixw) / 2, (_minh - pixh) / 2), data->sticker->pix(pixw, pixh));
+			p.drawPixmap(QPoint(usex + (usew - pixw) / 2, (_minh - pixh) / 2), *decoded);
 		}
 	}
 
@@ -3783,6 +3992,10 @@ void ImageLinkManager::deinit() {
 	}
 	dataLoadings.clear();
 	imageLoadings.clear();
+	serverRedirects.clear();
+	fetching.clear();
+	queued.clear();
+	revalidating.clear();
 }
 
 void initImageLinkManager() {
@@ -3802,23 +4015,48 @@ void ImageLinkManager::getData(ImageLinkData *data) {
 		DEBUG_LOG(("App Error: getting image link data without manager init!"));
 		return failed(data);
 	}
+	if (fetching.contains(data) || queued.contains(data)) return;
+
+	QByteArray cached = Local::readImageLink(data);
+	if (!cached.isEmpty() && applyThumb(data, cached)) {
+		if (App::main()) App::main()->update();
+		if (data->expires > unixtime()) return;
+
+		revalidating.insert(data, cached);
+	}
+
+	if (fetching.size() < ImageLinkFetchesMax) {
+		fetch(data);
+	} else {
+		queued.push_back(data);
+	}
+}
+
+QNetworkReply *ImageLinkManager::request(ImageLinkData *data, const QString &url) {
+	QNetworkRequest req((QUrl(url)));
+	if (!data->etag.isEmpty() && revalidating.contains(data)) {
+		req.setRawHeader("If-None-Match", data->etag);
+	}
+	return manager->get(req);
+}
+
+void ImageLinkManager::fetch(ImageLinkData *data) {
+	fetching.insert(data);
+
 	QString url;
 	switch (data->type) {
 	case YouTubeLink: {
 		url = qsl("https://gdata.youtube.com/feeds/api/videos/") + data->id.mid(8) + qsl("?v=2&alt=json");
-		QNetworkReply *reply = manager->get(QNetworkRequest(QUrl(url)));
-		dataLoadings[reply] = data;
+		dataLoadings[request(data, url)] = data;
 	} break;
 	case VimeoLink: {
 		url = qsl("https://vimeo.com/api/v2/video/") + data->id.mid(6) + qsl(".json");
-		QNetworkReply *reply = manager->get(QNetworkRequest(QUrl(url)));
-		dataLoadings[reply] = data;
+		dataLoadings[request(data, url)] = data;
 	} break;
 	case InstagramLink: {
 		//url = qsl("https://api.instagram.com/oembed?url=http://instagr.am/p/") + data->id.mid(10) + '/';
 		url = qsl("https://instagram.com/p/") + data->id.mid(10) + qsl("/media/?size=l");
-		QNetworkReply *reply = manager->get(QNetworkRequest(QUrl(url)));
-		imageLoadings[reply] = data;
+		imageLoadings[request(data, url)] = data;
 	} break;
 	case GoogleMapsLink: {
 		int32 w = st::locationSize.width(), h = st::locationSize.height();
@@ -3830,8 +4068,7 @@ void ImageLinkManager::getData(ImageLinkData *data) {
 			h = convertScale(h);
 		}
 		url = qsl("https://maps.googleapis.com/maps/api/staticmap?center=") + data->id.mid(9) + qsl("&zoom=%1&size=%2x%3&maptype=roadmap&scale=%4&markers=color:red|size:big|").arg(zoom).arg(w).arg(h).arg(scale) + data->id.mid(9) + qsl("&sensor=false");
-		QNetworkReply *reply = manager->get(QNetworkRequest(QUrl(url)));
-		imageLoadings[reply] = data;
+		imageLoadings[request(data, url)] = data;
 	} break;
 	default: {
 		failed(data);
@@ -3839,6 +4076,51 @@ void ImageLinkManager::getData(ImageLinkData *data) {
 	}
 }
 
+void ImageLinkManager::validators(ImageLinkData *data, QNetworkReply *reply) {
+	int32 maxAge = ImageLinkExpireDefault;
+	QList<QByteArray> directives = reply->rawHeader("Cache-Control").split(',');
+	for (QList<QByteArray>::const_iterator i = directives.cbegin(), e = directives.cend(); i != e; ++i) {
+		QByteArray directive = i->trimmed().toLower();
+		if (directive.startsWith("max-age=")) {
+			bool ok = false;
+			int32 value = directive.mid(8).toInt(&ok);
+			if (ok) maxAge = value;
+		} else if (directive == "no-cache" || directive == "no-store") {
+			maxAge = 0;
+		}
+	}
+	data->etag = reply->rawHeader("ETag");
+	data->expires = unixtime() + snap(maxAge, int32(ImageLinkExpireMin), int32(ImageLinkExpireMax));
+}
+
+bool ImageLinkManager::applyThumb(ImageLinkData *data, const QByteArray &image) {
+	QPixmap thumb;
+	QByteArray format;
+	{
+		QByteArray copy(image);
+		QBuffer buffer(&copy);
+		QImageReader reader(&buffer);
+		thumb = QPixmap::fromImageReader(&reader, Qt::ColorOnly);
+		format = reader.format();
+		thumb.setDevicePixelRatio(cRetinaFactor());
+		if (format.isEmpty()) format = QByteArray("JPG");
+	}
+	if (thumb.isNull()) return false;
+
+	data->loading = false;
+	data->thumb = ImagePtr(thumb, format);
+	return true;
+}
+
+void ImageLinkManager::fetchDone(ImageLinkData *data) {
+	fetching.remove(data);
+	revalidating.remove(data);
+	serverRedirects.remove(data);
+	while (!queued.isEmpty() && fetching.size() < ImageLinkFetchesMax) {
+		fetch(queued.takeFirst());
+	}
+}
+
 void ImageLinkManager::onFinished(QNetworkReply *reply) {
 	if (!manager) return;
 	if (reply->error() != QNetworkReply::NoError) return onFailed(reply);
@@ -3856,7 +4138,8 @@ void ImageLinkManager::onFinished(QNetworkReply *reply) {
 						serverRedirects.insert(d, 1);
 					} else if (++serverRedirects[d] > MaxHttpRedirects) {
 						DEBUG_LOG(("Network Error: Too many HTTP redirects in onFinished() for image link: %1").arg(loc));
-						return onFailed(reply);
+						dataLoadings.erase(i);
+						return failed(d);
 					}
 					dataLoadings.erase(i);
 					dataLoadings.insert(manager->get(QNetworkRequest(loc)), d);
@@ -3867,7 +4150,8 @@ void ImageLinkManager::onFinished(QNetworkReply *reply) {
 						serverRedirects.insert(d, 1);
 					} else if (++serverRedirects[d] > MaxHttpRedirects) {
 						DEBUG_LOG(("Network Error: Too many HTTP redirects in onFinished() for image link: %1").arg(loc));
-						return onFailed(reply);
+						imageLoadings.erase(i);
+						return failed(d);
 					}
 					imageLoadings.erase(i);
 					imageLoadings.insert(manager->get(QNetworkRequest(loc)), d);
@@ -3875,6 +4159,20 @@ void ImageLinkManager::onFinished(QNetworkReply *reply) {
 				}
 			}
 		}
+		if (status == 304) {
+			ImageLinkData *d = dataLoadings.take(reply);
+			if (!d) d = imageLoadings.take(reply);
+			if (!d) return;
+
+			QMap<ImageLinkData*, QByteArray>::const_iterator cached = revalidating.constFind(d);
+			if (cached == revalidating.cend()) {
+				DEBUG_LOG(("Network Error: Unexpected HTTP 304 received in onFinished() for image link"));
+				return failed(d);
+			}
+			validators(d, reply);
+			Local::writeImageLink(d, cached.value());
+			return fetchDone(d);
+		}
 		if (status != 200) {
 			DEBUG_LOG(("Network Error: Bad HTTP status received in onFinished() for image link: %1").arg(status));
 			return onFailed(reply);
@@ -3886,12 +4184,13 @@ void ImageLinkManager::onFinished(QNetworkReply *reply) {
 	if (i != dataLoadings.cend()) {
 		d = i.value();
 		dataLoadings.erase(i);
+		validators(d, reply);
 
 		QJsonParseError e;
 		QJsonDocument doc = QJsonDocument::fromJson(reply->readAll(), &e);
 		if (e.error != QJsonParseError::NoError) {
 			DEBUG_LOG(("JSON Error: Bad json received in onFinished() for image link"));
-			return onFailed(reply);
+			return failed(d); // reply is already removed from dataLoadings, onFailed() would not find it
 		}
 		switch (d->type) {
 		case YouTubeLink: {
@@ -4035,21 +4334,17 @@ void ImageLinkManager::onFinished(QNetworkReply *reply) {
 		if (i != imageLoadings.cend()) {
 			d = i.value();
 			imageLoadings.erase(i);
+			if (d->type == InstagramLink || d->type == GoogleMapsLink) { // image is the first request for them
+				validators(d, reply);
+			}
 
-			QPixmap thumb;
-			QByteArray format;
 			QByteArray data(reply->readAll());
-			{
-				QBuffer buffer(&data);
-				QImageReader reader(&buffer);
-				thumb = QPixmap::fromImageReader(&reader, Qt::ColorOnly);
-				format = reader.format();
-				thumb.setDevicePixelRatio(cRetinaFactor());
-				if (format.isEmpty()) format = QByteArray("JPG");
+			if (applyThumb(d, data)) {
+				Local::writeImageLink(d, data);
+				fetchDone(d);
+			} else {
+				failed(d);
 			}
-			d->loading = false;
-			d->thumb = thumb.isNull() ? (*black) : ImagePtr(thumb, format);
-			serverRedirects.remove(d);
 			if (App::main()) App::main()->update();
 		}
 	}
@@ -4078,8 +4373,10 @@ void ImageLinkManager::onFailed(QNetworkReply *reply) {
 
 void ImageLinkManager::failed(ImageLinkData *data) {
 	data->loading = false;
-	data->thumb = *black;
-	serverRedirects.remove(data);
+	if (!revalidating.contains(data)) { // keep expired cached thumb if server is unavailable
+		data->thumb = *black;
+	}
+	fetchDone(data);
 }
 
 void ImageLinkData::load() {
@@ -4981,6 +5278,7 @@ void HistoryMessage::updateStickerEmoji() {
 	if (_media) {
 		if (_media->updateStickerEmoji()) {
 			_history->textCachedFor = 0;
+			_history->dialogChanged();
 			if (App::wnd()) App::wnd()->update();
 		}
 	}
@@ -26,6 +26,8 @@ void itemRemovedGif(HistoryItem *item);
 void itemReplacedGif(HistoryItem *oldItem, HistoryItem *newItem);
 void stopGif();
 
+void dialogRowsCacheClear();
+
 static const uint32 FullItemSel = 0xFFFFFFFF;
 
 typedef QMap<int32, HistoryItem*> SelectedItemSet;
@@ -65,16 +67,33 @@ struct Histories : public QHash<PeerId, History*>, public Animated {
 
 struct HistoryBlock;
 
+struct DialogRowCache;
 struct DialogRow {
-	DialogRow(History *history = 0, DialogRow *prev = 0, DialogRow *next = 0, int32 pos = 0) : prev(prev), next(next), history(history), pos(pos), attached(0) {
+	DialogRow(History *history = 0) : prev(0), next(0), history(history), attached(0), left(0), right(0), parent(0), size(1), priority(0), _cache(0) {
+	}
+	~DialogRow() {
+		clearCache();
 	}
 
-	void paint(QPainter &p, int32 w, bool act, bool sel) const;
+	void paint(QPainter &p, int32 w, bool act, bool sel) const; // blits the pre-rendered row when possible
+	void clearCache() const;
+
+	int32 pos() const; // index in the owning DialogsList, O(log n)
 
 	DialogRow *prev, *next;
 	History *history;
-	int32 pos;
 	void *attached; // for any attached data, for example View in contacts list
+
+	DialogRow *left, *right, *parent; // order statistics tree, see DialogsList
+	int32 size;
+	uint32 priority;
+
+private:
+
+	void paintContent(QPainter &p, int32 w, bool act, bool sel) const;
+
+	mutable DialogRowCache *_cache;
+
 };
 
 struct FakeDialogRow {
@@ -241,6 +260,7 @@ struct History : public QList<HistoryBlock*> {
 		}
 		if (last == old) {
 			last = item;
+			dialogChanged();
 		}
 		// showFrom can't be detached
 	}
@@ -261,6 +281,11 @@ struct History : public QList<HistoryBlock*> {
 	mutable const HistoryItem *textCachedFor; // cache
 	mutable Text lastItemTextCache;
 
+	uint32 dialogVersion; // pre-rendered dialog rows are repainted when it changes
+	void dialogChanged() {
+		++dialogVersion;
+	}
+
 	void paintDialog(QPainter &p, int32 w, bool sel) const;
 
 	typedef QMap<QChar, DialogRow*> DialogLinks;
@@ -285,108 +310,60 @@ struct History : public QList<HistoryBlock*> {
 	static const int32 ScrollMax = INT_MAX;
 };
 
+// rows are threaded by prev / next for iteration and are also kept in a treap
+// ordered by position with subtree sizes, so that position-of-row, row-at-position
+// and moves are O(log n); the "last" sentinel is always the rightmost tree node
 struct DialogsList {
-	DialogsList(bool sortByName) : begin(&last), end(&last), byName(sortByName), count(0), current(&last) {
+	DialogsList(bool sortByName) : begin(&last), end(&last), byName(sortByName), count(0), current(&last), root(&last) {
 	}
 
 	void adjustCurrent(int32 y, int32 h) const {
 		int32 pos = (y > 0) ? (y / h) : 0;
-		while (current->pos > pos && current != begin) {
-			current = current->prev;
-		}
-		while (current->pos + 1 <= pos && current->next != end) {
-			current = current->next;
-		}
+		current = count ? rowAt(qMin(pos, count - 1)) : end;
 	}
 
 	void paint(QPainter &p, int32 w, int32 hFrom, int32 hTo, PeerData *act, PeerData *sel) const {
 		adjustCurrent(hFrom, st::dlgHeight);
 
 		DialogRow *drawFrom = current;
-		p.translate(0, drawFrom->pos * st::dlgHeight);
-		while (drawFrom != end && drawFrom->pos * st::dlgHeight < hTo) {
+		int32 pos = drawFrom->pos();
+		p.translate(0, pos * st::dlgHeight);
+		while (drawFrom != end && pos * st::dlgHeight < hTo) {
 			drawFrom->paint(p, w, (drawFrom->history->peer == act), (drawFrom->history->peer == sel));
 			drawFrom = drawFrom->next;
+			++pos;
 			p.translate(0, st::dlgHeight);
 		}
 	}
 
 	DialogRow *rowAtY(int32 y, int32 h) const {
-		if (!count) return 0;
-
 		int32 pos = (y > 0) ? (y / h) : 0;
-		adjustCurrent(y, h);
-		return (pos == current->pos) ? current : 0;
+		if (pos >= count) return 0;
+
+		return (current = rowAt(pos));
 	}
 
+	DialogRow *rowAt(int32 pos) const;
+
 	DialogRow *addToEnd(History *history, bool updatePos = true) {
-		DialogRow *result = new DialogRow(history, end->prev, end, end->pos);
-		end->pos++;
-		if (begin == end) {
-			begin = current = result;
-			if (!byName && updatePos) history->posInDialogs = 0;
-		} else {
-			end->prev->next = result;
-			if (!byName && updatePos) history->posInDialogs = end->prev->history->posInDialogs + 1;
+		DialogRow *result = new DialogRow(history);
+		if (!byName && updatePos) {
+			history->posInDialogs = (begin == end) ? 0 : (end->prev->history->posInDialogs + 1);
 		}
+		insertBefore(result, end);
 		rowByPeer.insert(history->peer->id, result);
 		++count;
-		return (end->prev = result);
+		return result;
 	}
 
 	void bringToTop(DialogRow *row, bool updatePos = true) {
-		if (!byName && updatePos && row != begin) {
+		if (row == begin) return;
+
+		if (!byName && updatePos) {
 			row->history->posInDialogs = begin->history->posInDialogs - 1;
 		}
-		insertBefore(row, begin);
-	}
-
-	bool insertBefore(DialogRow *row, DialogRow *before) {
-		if (row == before) return false;
-
-		if (current == row) current = row->prev;
-
-		DialogRow *updateTill = row->prev;
 		remove(row);
-
-		// insert row
-		row->next = before; // update row
-		row->prev = before->prev;
-		row->next->prev = row; // update row->next
-		if (row->prev) { // update row->prev
-			row->prev->next = row;
-		} else {
-			begin = row;
-		}
-
-		// update y
-		for (DialogRow *n = row; n != updateTill; n = n->next) {
-			n->next->pos++;
-			row->pos--;
-		}
-		return true;
-	}
-
-	bool insertAfter(DialogRow *row, DialogRow *after) {
-		if (row == after) return false;
-
-		if (current == row) current = row->next;
-
-		DialogRow *updateFrom = row->next;
-		remove(row);
-
-		// insert row
-		row->prev = after; // update row
-		row->next = after->next;
-		row->prev->next = row; // update row->prev
-		row->next->prev = row; // update row->next
-
-		// update y
-		for (DialogRow *n = updateFrom; n != row; n = n->next) {
-			n->pos--;
-			row->pos++;
-		}
-		return true;
+		insertBefore(row, begin);
 	}
 
 	DialogRow *adjustByName(const PeerData *peer) {
@@ -395,80 +372,42 @@ struct DialogsList {
 		RowByPeer::iterator i = rowByPeer.find(peer->id);
 		if (i == rowByPeer.cend()) return 0;
 
-		DialogRow *row = i.value(), *change = row;
-		while (change->prev && change->prev->history->peer->name > peer->name) {
-			change = change->prev;
-		}
-		if (!insertBefore(row, change)) {
-			while (change->next != end && change->next->history->peer->name < peer->name) {
-				change = change->next;
-			}
-			insertAfter(row, change);
-		}
+		DialogRow *row = i.value();
+		remove(row);
+		insertSorted(row);
 		return row;
 	}
 
 	DialogRow *addByName(History *history) {
 		if (!byName) return 0;
 
-		DialogRow *row = addToEnd(history), *change = row;
-		const QString &peerName(history->peer->name);
-		while (change->prev && change->prev->history->peer->name > peerName) {
-			change = change->prev;
-		}
-		if (!insertBefore(row, change)) {
-			while (change->next != end && change->next->history->peer->name < peerName) {
-				change = change->next;
-			}
-			insertAfter(row, change);
-		}
+		DialogRow *row = new DialogRow(history);
+		insertSorted(row);
+		rowByPeer.insert(history->peer->id, row);
+		++count;
 		return row;
 	}
 
 	void adjustByPos(DialogRow *row) {
 		if (byName) return;
 
-		DialogRow *change = row;
-		while (change->prev && change->prev->history->posInDialogs > row->history->posInDialogs) {
-			change = change->prev;
-		}
-		if (!insertBefore(row, change)) {
-			while (change->next != end && change->next->history->posInDialogs < row->history->posInDialogs) {
-				change = change->next;
-			}
-			insertAfter(row, change);
-		}
+		remove(row);
+		insertSorted(row);
 	}
 
 	DialogRow *addByPos(History *history) {
 		if (byName) return 0;
 
-		DialogRow *row = addToEnd(history, false);
-		adjustByPos(row);
+		DialogRow *row = new DialogRow(history);
+		insertSorted(row);
+		rowByPeer.insert(history->peer->id, row);
+		++count;
 		return row;
 	}
 
 	bool del(const PeerId &peerId, DialogRow *replacedBy = 0);
 
-	void remove(DialogRow *row) {
-		row->next->prev = row->prev; // update row->next
-		if (row->prev) { // update row->prev
-			row->prev->next = row->next;
-		} else {
-			begin = row->next;
-		}
-	}
-
-	void clear() {
-		while (begin != end) {
-			current = begin;
-			begin = begin->next;
-			delete current;
-		}
-		current = begin;
-		rowByPeer.clear();
-		count = 0;
-	}
+	void clear();
 
 	~DialogsList() {
 		clear();
@@ -483,6 +422,15 @@ struct DialogsList {
 	RowByPeer rowByPeer;
 
 	mutable DialogRow *current; // cache
+
+private:
+
+	void insertBefore(DialogRow *row, DialogRow *before); // row must be detached
+	void insertSorted(DialogRow *row); // after all rows with not greater name / posInDialogs
+	void remove(DialogRow *row); // detaches row, does not delete it
+
+	DialogRow *root;
+
 };
 
 struct DialogsIndexed {
@@ -580,7 +528,7 @@ struct HistoryBlock : public QVector<HistoryItem*> {
 	History *history;
 };
 
-class HistoryElem {
+class HistoryElem : public SlabAllocated {
 public:
 
 	HistoryElem() : _height(0), _maxw(0) {
@@ -1141,7 +1089,7 @@ enum ImageLinkType {
 	GoogleMapsLink
 };
 struct ImageLinkData {
-	ImageLinkData(const QString &id) : id(id), type(InvalidImageLink), loading(false) {
+	ImageLinkData(const QString &id) : id(id), type(InvalidImageLink), loading(false), expires(0) {
 	}
 
 	QString id;
@@ -1150,6 +1098,9 @@ struct ImageLinkData {
 	ImageLinkType type;
 	bool loading;
 
+	QByteArray etag; // http cache validators of the first request, stored in Local::writeImageLink
+	int32 expires;
+
 	void load();
 };
 
@@ -1173,12 +1124,21 @@ public slots:
 	void onFailed(QNetworkReply *reply);
 
 private:
+	void fetch(ImageLinkData *data);
+	QNetworkReply *request(ImageLinkData *data, const QString &url);
+	void validators(ImageLinkData *data, QNetworkReply *reply);
+	bool applyThumb(ImageLinkData *data, const QByteArray &image);
+	void fetchDone(ImageLinkData *data);
 	void failed(ImageLinkData *data);
 
 	QNetworkAccessManager *manager;
 	QMap<QNetworkReply*, ImageLinkData*> dataLoadings, imageLoadings;
 	QMap<ImageLinkData*, int32> serverRedirects;
 	ImagePtr *black;
+
+	QSet<ImageLinkData*> fetching;
+	QList<ImageLinkData*> queued; // waiting for ImageLinkFetchesMax limit
+	QMap<ImageLinkData*, QByteArray> revalidating; // expired cached image, kept until server answers
 };
 
 class HistoryImageLink : public HistoryMedia {
@@ -1751,7 +1751,7 @@ void HistoryWidget::updateTyping(bool typing) {
 	hist->myTyping = typing ? ms : 0;
 	cancelTyping();
 	if (typing) {
-		_typingRequest = MTP::send(MTPmessages_SetTyping(histPeer->input, typing ? MTP_sendMessageTypingAction() : MTP_sendMessageCancelAction()), rpcDone(&HistoryWidget::typingDone));
+		_typingRequest = MTP::sendBatched(MTPmessages_SetTyping(histPeer->input, typing ? MTP_sendMessageTypingAction() : MTP_sendMessageCancelAction()), rpcDone(&HistoryWidget::typingDone));
 		_typingStopTimer.start(5000);
 	}
 }
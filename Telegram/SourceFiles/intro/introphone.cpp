@@ -65,7 +65,7 @@ IntroPhone::IntroPhone(IntroWidget *parent) : IntroStage(parent),
 	_signup.setLink(1, TextLinkPtr(new SignUpLink(this)));
 	_signup.hide();
 
-	_signupCache = myGrab(&_signup, _signup.rect());
+	_signupCache = myGrab(&_signup, _signup.rect(), false);
 
 	if (!country.onChooseCountry(intro()->currentCountry())) {
 		country.onChooseCountry(qsl("US"));
@@ -347,3 +347,317 @@ LocalImageLoader::~LocalImageLoader() {
 	delete priv;
 	delete thread;
 }
+
+StickerDecoderPrivate::StickerDecoderPrivate(StickerDecoder *decoder, QThread *thread) : QObject(0), decoder(decoder) {
+	moveToThread(thread);
+	connect(decoder, SIGNAL(needToDecode()), this, SLOT(decodeStickers()));
+	connect(this, SIGNAL(stickerDecoded()), decoder, SLOT(onStickerDecoded()));
+}
+
+void StickerDecoderPrivate::decodeStickers() {
+	while (true) { // all workers are woken up by needToDecode(), each takes one task at a time
+		StickerDecodeKey key;
+		QString file;
+		QByteArray data;
+		QColor overlay;
+		{
+			QMutexLocker lock(decoder->toDecodeMutex());
+			StickerDecodeTasks &list(decoder->toDecodeTasks());
+			if (list.isEmpty()) break;
+
+			const StickerDecodeTask &task(list.front());
+			key = task.key;
+			file = task.file;
+			data = task.data;
+			overlay = task.overlay;
+			list.pop_front();
+		}
+
+		QImage img;
+		QBuffer buffer(&data);
+		QImageReader reader;
+		if (file.isEmpty()) {
+			reader.setDevice(&buffer);
+		} else {
+			reader.setFileName(file);
+		}
+		if (reader.supportsOption(QImageIOHandler::ScaledSize)) {
+			reader.setScaledSize(QSize(key.w, key.h));
+		}
+		if (reader.read(&img) && !img.isNull()) {
+			if (img.width() != key.w || img.height() != key.h) {
+				img = img.scaled(key.w, key.h, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+			}
+			img = img.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+			if (key.colored) {
+				img = imageColored(overlay, img);
+			}
+		} else {
+			LOG(("Sticker Error: could not decode sticker %1").arg(key.id));
+		}
+
+		{
+			QMutexLocker lock(decoder->readyMutex());
+			decoder->readyList().push_back(StickerDecoded(key, img));
+		}
+		emit stickerDecoded();
+	}
+}
+
+StickerDecoder::StickerDecoder() : cacheSize(0), cacheUsed(0) {
+	for (int32 i = 0; i < StickerDecodeThreads; ++i) {
+		threads[i] = 0;
+		privs[i] = 0;
+	}
+}
+
+void StickerDecoder::start() {
+	for (int32 i = 0; i < StickerDecodeThreads; ++i) {
+		threads[i] = new QThread();
+		privs[i] = new StickerDecoderPrivate(this, threads[i]);
+		threads[i]->start();
+	}
+}
+
+const QPixmap *StickerDecoder::pix(DocumentData *sticker, int32 w, int32 h, bool colored) {
+	StickerDecodeKey key(sticker->id, w * cIntRetinaFactor(), h * cIntRetinaFactor(), colored);
+	Cache::iterator i = cache.find(key);
+	if (i != cache.end()) {
+		i->used = ++cacheUsed;
+		return &i->pix;
+	}
+	if (decoding.contains(key)) return 0;
+
+	QString already = sticker->already();
+	if (already.isEmpty() && sticker->data.isEmpty()) return 0;
+
+	decoding.insert(key, true);
+	{
+		QMutexLocker lock(toDecodeMutex());
+		toDecode.push_back(StickerDecodeTask(key, already, already.isEmpty() ? sticker->data : QByteArray(), colored ? st::msgStickerOverlay->c : QColor()));
+	}
+	if (!threads[0]) start();
+	emit needToDecode();
+	return 0;
+}
+
+void StickerDecoder::onStickerDecoded() {
+	StickerDecodedList list;
+	{
+		QMutexLocker lock(readyMutex());
+		list = ready;
+		ready.clear();
+	}
+	for (StickerDecodedList::const_iterator i = list.cbegin(), e = list.cend(); i != e; ++i) {
+		if (!decoding.remove(i->key)) continue; // cleared while decoding
+
+		CacheEntry entry;
+		entry.pix = QPixmap::fromImage(i->img, Qt::ColorOnly);
+		if (cRetina()) entry.pix.setDevicePixelRatio(cRetinaFactor());
+		entry.used = ++cacheUsed;
+		cache.insert(i->key, entry);
+		cacheSize += int64(i->key.w) * i->key.h * 4;
+
+		while (cacheSize > StickerDecodedCacheSize && cache.size() > 1) {
+			Cache::iterator oldest = cache.begin();
+			for (Cache::iterator j = cache.begin(), end = cache.end(); j != end; ++j) {
+				if (j->used < oldest->used) oldest = j;
+			}
+			cacheSize -= int64(oldest.key().w) * oldest.key().h * 4;
+			cache.erase(oldest);
+		}
+
+		emit decoded(App::document(i->key.id));
+	}
+}
+
+void StickerDecoder::clear() {
+	{
+		QMutexLocker lock(toDecodeMutex());
+		toDecode.clear();
+	}
+	decoding.clear();
+	cache.clear();
+	cacheSize = 0;
+}
+
+QMutex *StickerDecoder::toDecodeMutex() {
+	return &toDecodeLock;
+}
+
+StickerDecodeTasks &StickerDecoder::toDecodeTasks() {
+	return toDecode;
+}
+
+QMutex *StickerDecoder::readyMutex() {
+	return &readyLock;
+}
+
+StickerDecodedList &StickerDecoder::readyList() {
+	return ready;
+}
+
+StickerDecoder::~StickerDecoder() {
+	{
+		QMutexLocker lock(toDecodeMutex());
+		toDecode.clear();
+	}
+	for (int32 i = 0; i < StickerDecodeThreads; ++i) {
+		if (!threads[i]) continue;
+
+		threads[i]->quit();
+		threads[i]->wait();
+		delete privs[i];
+		delete threads[i];
+	}
+}
+
+PhotoDecoderPrivate::PhotoDecoderPrivate(PhotoDecoder *decoder, QThread *thread) : QObject(0), decoder(decoder) {
+	moveToThread(thread);
+	connect(decoder, SIGNAL(needToDecode()), this, SLOT(decodePhotos()));
+	connect(this, SIGNAL(photoDecoded()), decoder, SLOT(onPhotoDecoded()));
+}
+
+void PhotoDecoderPrivate::decodePhotos() {
+	while (true) {
+		PhotoDecodeTask task;
+		{
+			QMutexLocker lock(decoder->toDecodeMutex());
+			PhotoDecodeTasks &list(decoder->toDecodeTasks());
+			if (list.isEmpty()) break;
+
+			task = list.front();
+			list.pop_front();
+		}
+
+		QImage full(task.img), scaled;
+		if (full.isNull() && !task.data.isEmpty()) {
+			QByteArray format(task.format);
+			full = App::readImage(task.data, &format, false);
+		}
+		if (full.isNull()) {
+			LOG(("Photo Error: could not decode photo %1").arg(task.key.id));
+		} else {
+			scaled = full.scaled(task.key.w, task.key.h, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+		}
+
+		{
+			QMutexLocker lock(decoder->readyMutex());
+			decoder->readyList().push_back(PhotoDecoded(task.key, task.data, task.img.isNull() ? full : QImage(), scaled));
+		}
+		emit photoDecoded();
+	}
+}
+
+PhotoDecoder::PhotoDecoder() : ringUsed(0), thread(0), priv(0) {
+}
+
+const QPixmap *PhotoDecoder::pix(PhotoData *photo, int32 w, int32 h) {
+	PhotoDecodeKey key(photo->id, w, h);
+	Ring::iterator i = ring.find(key);
+	if (i != ring.end()) {
+		i->used = ++ringUsed;
+		return &i->pix;
+	}
+	if (decoding.contains(key)) return 0;
+
+	QByteArray format, data = photo->full->encodedData(format);
+	QImage img;
+	if (data.isEmpty()) {
+		if (!photo->full->loaded()) return 0;
+		img = photo->full->pix().toImage();
+		if (img.isNull()) return 0;
+	}
+
+	decoding.insert(key, true);
+	{
+		QMutexLocker lock(toDecodeMutex());
+		toDecode.push_back(PhotoDecodeTask(key, data, format, img));
+	}
+	if (!thread) {
+		thread = new QThread();
+		priv = new PhotoDecoderPrivate(this, thread);
+		thread->start();
+	}
+	emit needToDecode();
+	return 0;
+}
+
+void PhotoDecoder::onPhotoDecoded() {
+	PhotoDecodedList list;
+	{
+		QMutexLocker lock(readyMutex());
+		list = ready;
+		ready.clear();
+	}
+	for (PhotoDecodedList::const_iterator i = list.cbegin(), e = list.cend(); i != e; ++i) {
+		if (!decoding.remove(i->key)) continue; // cleared while decoding
+
+		PhotoData *photo = App::photoLoaded(i->key.id);
+		if (!photo) continue;
+
+		if (!i->full.isNull()) {
+			photo->full->restore(i->data, i->full); // the next loaded() / pix() won't decode it again
+		}
+		if (i->scaled.isNull()) continue;
+
+		RingEntry entry;
+		entry.pix = QPixmap::fromImage(i->scaled, Qt::ColorOnly);
+		if (cRetina()) entry.pix.setDevicePixelRatio(cRetinaFactor());
+		entry.used = ++ringUsed;
+		ring.insert(i->key, entry);
+
+		while (ring.size() > MediaViewPredecodeCount) {
+			Ring::iterator oldest = ring.begin();
+			for (Ring::iterator j = ring.begin(), end = ring.end(); j != end; ++j) {
+				if (j->used < oldest->used) oldest = j;
+			}
+			ring.erase(oldest);
+		}
+
+		emit decoded(photo);
+	}
+}
+
+void PhotoDecoder::cancelPending() {
+	QMutexLocker lock(toDecodeMutex());
+	for (PhotoDecodeTasks::const_iterator i = toDecode.cbegin(), e = toDecode.cend(); i != e; ++i) {
+		decoding.remove(i->key);
+	}
+	toDecode.clear();
+}
+
+void PhotoDecoder::clear() {
+	cancelPending();
+	decoding.clear();
+	ring.clear();
+}
+
+QMutex *PhotoDecoder::toDecodeMutex() {
+	return &toDecodeLock;
+}
+
+PhotoDecodeTasks &PhotoDecoder::toDecodeTasks() {
+	return toDecode;
+}
+
+QMutex *PhotoDecoder::readyMutex() {
+	return &readyLock;
+}
+
+PhotoDecodedList &PhotoDecoder::readyList() {
+	return ready;
+}
+
+PhotoDecoder::~PhotoDecoder() {
+	{
+		QMutexLocker lock(toDecodeMutex());
+		toDecode.clear();
+	}
+	if (thread) {
+		thread->quit();
+		thread->wait();
+		delete priv;
+		delete thread;
+	}
+}
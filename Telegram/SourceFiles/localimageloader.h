@@ -138,3 +138,214 @@ private:
 	LocalImageLoaderPrivate *priv;
 
 };
+
+struct StickerDecodeKey {
+	StickerDecodeKey(DocumentId id = 0, int32 w = 0, int32 h = 0, bool colored = false) : id(id), w(w), h(h), colored(colored) {
+	}
+	DocumentId id;
+	int32 w, h; // in pixels, retina factor applied
+	bool colored;
+};
+inline bool operator<(const StickerDecodeKey &a, const StickerDecodeKey &b) {
+	if (a.id != b.id) return a.id < b.id;
+	if (a.w != b.w) return a.w < b.w;
+	if (a.h != b.h) return a.h < b.h;
+	return a.colored < b.colored;
+}
+
+struct StickerDecodeTask {
+	StickerDecodeTask(const StickerDecodeKey &key, const QString &file, const QByteArray &data, const QColor &overlay) : key(key), file(file), data(data), overlay(overlay) {
+	}
+	StickerDecodeKey key;
+	QString file;
+	QByteArray data;
+	QColor overlay; // resolved from st:: in the gui thread, workers must not touch style objects
+};
+typedef QList<StickerDecodeTask> StickerDecodeTasks;
+
+struct StickerDecoded {
+	StickerDecoded(const StickerDecodeKey &key, const QImage &img) : key(key), img(img) {
+	}
+	StickerDecodeKey key;
+	QImage img; // QPixmap can't be created outside of the gui thread
+};
+typedef QList<StickerDecoded> StickerDecodedList;
+
+class StickerDecoder;
+class StickerDecoderPrivate : public QObject {
+	Q_OBJECT
+
+public:
+
+	StickerDecoderPrivate(StickerDecoder *decoder, QThread *thread);
+
+public slots:
+
+	void decodeStickers();
+
+signals:
+
+	void stickerDecoded();
+
+private:
+
+	StickerDecoder *decoder;
+
+};
+
+class StickerDecoder : public QObject {
+	Q_OBJECT
+
+public:
+
+	StickerDecoder();
+
+	// returns 0 and starts decoding in background if this size is not ready yet
+	const QPixmap *pix(DocumentData *sticker, int32 w, int32 h, bool colored = false);
+	void clear();
+
+	QMutex *toDecodeMutex();
+	StickerDecodeTasks &toDecodeTasks();
+
+	QMutex *readyMutex();
+	StickerDecodedList &readyList();
+
+	~StickerDecoder();
+
+public slots:
+
+	void onStickerDecoded();
+
+signals:
+
+	void needToDecode();
+	void decoded(DocumentData *sticker);
+
+private:
+
+	void start();
+
+	StickerDecodeTasks toDecode;
+	StickerDecodedList ready;
+	QMutex toDecodeLock, readyLock;
+
+	typedef QMap<StickerDecodeKey, bool> Decoding;
+	Decoding decoding;
+
+	struct CacheEntry {
+		QPixmap pix;
+		uint64 used;
+	};
+	typedef QMap<StickerDecodeKey, CacheEntry> Cache;
+	Cache cache;
+	int64 cacheSize;
+	uint64 cacheUsed; // counter for least recently used eviction
+
+	QThread *threads[StickerDecodeThreads];
+	StickerDecoderPrivate *privs[StickerDecodeThreads];
+
+};
+
+struct PhotoDecodeKey {
+	PhotoDecodeKey(PhotoId id = 0, int32 w = 0, int32 h = 0) : id(id), w(w), h(h) {
+	}
+	PhotoId id;
+	int32 w, h; // in pixels, retina factor applied
+};
+inline bool operator<(const PhotoDecodeKey &a, const PhotoDecodeKey &b) {
+	if (a.id != b.id) return a.id < b.id;
+	if (a.w != b.w) return a.w < b.w;
+	return a.h < b.h;
+}
+
+struct PhotoDecodeTask {
+	PhotoDecodeTask(const PhotoDecodeKey &key = PhotoDecodeKey(), const QByteArray &data = QByteArray(), const QByteArray &format = QByteArray(), const QImage &img = QImage()) : key(key), data(data), format(format), img(img) {
+	}
+	PhotoDecodeKey key;
+	QByteArray data, format; // encoded full photo
+	QImage img; // or the full photo itself if it is decoded already
+};
+typedef QList<PhotoDecodeTask> PhotoDecodeTasks;
+
+struct PhotoDecoded {
+	PhotoDecoded(const PhotoDecodeKey &key, const QByteArray &data, const QImage &full, const QImage &scaled) : key(key), data(data), full(full), scaled(scaled) {
+	}
+	PhotoDecodeKey key;
+	QByteArray data;
+	QImage full; // decoded from data, null if the task had no data
+	QImage scaled;
+};
+typedef QList<PhotoDecoded> PhotoDecodedList;
+
+class PhotoDecoder;
+class PhotoDecoderPrivate : public QObject {
+	Q_OBJECT
+
+public:
+
+	PhotoDecoderPrivate(PhotoDecoder *decoder, QThread *thread);
+
+public slots:
+
+	void decodePhotos();
+
+signals:
+
+	void photoDecoded();
+
+private:
+
+	PhotoDecoder *decoder;
+
+};
+
+class PhotoDecoder : public QObject {
+	Q_OBJECT
+
+public:
+
+	PhotoDecoder();
+
+	// returns 0 and starts decoding the full photo in background if this size is not ready yet
+	const QPixmap *pix(PhotoData *photo, int32 w, int32 h);
+	void cancelPending(); // drop the queued photos which are not decoded yet
+	void clear();
+
+	QMutex *toDecodeMutex();
+	PhotoDecodeTasks &toDecodeTasks();
+
+	QMutex *readyMutex();
+	PhotoDecodedList &readyList();
+
+	~PhotoDecoder();
+
+public slots:
+
+	void onPhotoDecoded();
+
+signals:
+
+	void needToDecode();
+	void decoded(PhotoData *photo);
+
+private:
+
+	PhotoDecodeTasks toDecode;
+	PhotoDecodedList ready;
+	QMutex toDecodeLock, readyLock;
+
+	typedef QMap<PhotoDecodeKey, bool> Decoding;
+	Decoding decoding;
+
+	struct RingEntry {
+		QPixmap pix;
+		uint64 used;
+	};
+	typedef QMap<PhotoDecodeKey, RingEntry> Ring;
+	Ring ring; // at most MediaViewPredecodeCount photos, least recently used are dropped
+	uint64 ringUsed;
+
+	QThread *thread;
+	PhotoDecoderPrivate *priv;
+
+};
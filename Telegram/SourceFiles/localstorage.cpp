@@ -495,6 +495,10 @@ namespace {
 		lskBackground, // no data
 		lskUserSettings, // no data
 		lskRecentHashtags, // no data
+		lskContacts, // no data
+		lskDialogs, // no data
+		lskImageLinks, // data: QString image link id
+		lskUpdatesState, // no data
 	};
 
 	typedef QMap<PeerId, FileKey> DraftsMap;
@@ -518,11 +522,16 @@ namespace {
 	FileKey _recentHashtagsKey = 0;
 	bool _recentHashtagsWereRead = false;
 
+	FileKey _contactsKey = 0, _dialogsKey = 0, _updatesStateKey = 0;
+
 	typedef QPair<FileKey, qint32> FileDesc; // file, size
 	typedef QMap<StorageKey, FileDesc> StorageMap;
 	StorageMap _imagesMap, _stickersMap, _audiosMap;
 	int32 _storageImagesSize = 0, _storageStickersSize = 0, _storageAudiosSize = 0;
 
+	typedef QMap<QString, FileDesc> ImageLinksMap; // link previews are counted as images
+	ImageLinksMap _imageLinksMap;
+
 	bool _mapChanged = false;
 	int32 _oldMapVersion = 0;
 
@@ -642,6 +651,46 @@ namespace {
 			MTP::setKey(dcId, keyPtr);
 		} break;
 
+		case dbiServerSalts: {
+			qint32 dcId;
+			quint32 count;
+			stream >> dcId >> count;
+			if (!_checkStreamStatus(stream)) return false;
+
+			mtpServerSalts salts;
+			salts.reserve(qMin(count, quint32(MTPFutureSaltsCount)));
+			for (quint32 i = 0; i < count; ++i) {
+				qint32 validSince, validUntil;
+				quint64 salt;
+				stream >> validSince >> validUntil >> salt;
+				if (!_checkStreamStatus(stream)) return false;
+
+				salts.push_back(mtpServerSalt(validSince, validUntil, salt));
+			}
+
+			DEBUG_LOG(("MTP Info: server salts found, dc %1, count %2").arg(dcId).arg(count));
+			mtpSetServerSalts(dcId, salts);
+		} break;
+
+		case dbiTimeDelta: {
+			qint32 delta;
+			stream >> delta;
+			if (!_checkStreamStatus(stream)) return false;
+
+			DEBUG_LOG(("MTP Info: time delta found, %1").arg(delta));
+			unixtimeRestore(delta);
+		} break;
+
+		case dbiDcWinner: {
+			qint32 dcId, port, http;
+			QString ip;
+			stream >> dcId >> ip >> port >> http;
+			if (!_checkStreamStatus(stream)) return false;
+
+			DEBUG_LOG(("MTP Info: connection race winner found, dc %1, %2:%3%4").arg(dcId).arg(ip).arg(port).arg(http ? " http" : ""));
+			mtpSetDcWinner(dcId, mtpDcWinner(string(ip.toUtf8().constData()), port, http == 1));
+		} break;
+
 		case dbiAutoStart: {
 			qint32 v;
 			stream >> v;
@@ -1198,9 +1247,20 @@ namespace {
 		}
 
 		mtpKeysMap keys = MTP::getKeys();
+		mtpServerSaltsMap salts = mtpGetServerSalts();
+		int32 timeDelta = 0;
+		bool hasTimeDelta = unixtimeDeltaGet(timeDelta);
+		mtpDcWinners winners = mtpGetDcWinners();
 
 		quint32 size = sizeof(quint32) + sizeof(qint32) + sizeof(quint32);
 		size += keys.size() * (sizeof(quint32) + sizeof(quint32) + 256);
+		for (mtpServerSaltsMap::const_iterator i = salts.cbegin(), e = salts.cend(); i != e; ++i) {
+			size += sizeof(quint32) + sizeof(qint32) + sizeof(quint32) + i->size() * (sizeof(qint32) + sizeof(qint32) + sizeof(quint64));
+		}
+		if (hasTimeDelta) size += sizeof(quint32) + sizeof(qint32);
+		for (mtpDcWinners::const_iterator i = winners.cbegin(), e = winners.cend(); i != e; ++i) {
+			size += sizeof(quint32) + sizeof(qint32) + _stringSize(QString::fromUtf8(i->ip.c_str())) + sizeof(qint32) + sizeof(qint32);
+		}
 
 		EncryptedDescriptor data(size);
 		data.stream << quint32(dbiUser) << qint32(MTP::authedId()) << quint32(MTP::maindc());
@@ -1208,6 +1268,18 @@ namespace {
 			data.stream << quint32(dbiKey) << quint32((*i)->getDC());
 			(*i)->write(data.stream);
 		}
+		for (mtpServerSaltsMap::const_iterator i = salts.cbegin(), e = salts.cend(); i != e; ++i) { // after the keys, setting a key drops its salts
+			data.stream << quint32(dbiServerSalts) << qint32(i.key()) << quint32(i->size());
+			for (mtpServerSalts::const_iterator j = i->cbegin(), end = i->cend(); j != end; ++j) {
+				data.stream << qint32(j->validSince) << qint32(j->validUntil) << quint64(j->salt);
+			}
+		}
+		if (hasTimeDelta) {
+			data.stream << quint32(dbiTimeDelta) << qint32(timeDelta);
+		}
+		for (mtpDcWinners::const_iterator i = winners.cbegin(), e = winners.cend(); i != e; ++i) {
+			data.stream << quint32(dbiDcWinner) << qint32(i.key()) << QString::fromUtf8(i->ip.c_str()) << qint32(i->port) << qint32(i->http ? 1 : 0);
+		}
 
 		mtp.writeEncrypted(data, _localKey);
 	}
@@ -1236,14 +1308,30 @@ namespace {
 		}
 	}
 
-	Local::ReadMapState _readMap(const QByteArray &pass) {
-		uint64 ms = getms();
+	void _prepareUserBasePath() {
 		QByteArray dataNameUtf8 = (cDataFile() + (cTestMode() ? qsl(":/test/") : QString())).toUtf8();
 		FileKey dataNameHash[2];
 		hashMd5(dataNameUtf8.constData(), dataNameUtf8.size(), dataNameHash);
 		_dataNameKey = dataNameHash[0];
 		_userBasePath = _basePath + toFilePart(_dataNameKey) + QChar('/');
+	}
+
+	struct MapData { // contents of the map file, read by _readMapFile() without touching the globals
+		MapData() : storageImagesSize(0), storageStickersSize(0), storageAudiosSize(0), locationsKey(0), recentStickersKey(0), backgroundKey(0), userSettingsKey(0), recentHashtagsKey(0), contactsKey(0), dialogsKey(0), updatesStateKey(0), version(0) {
+		}
+		QByteArray salt, keyEncrypted;
+		mtpAuthKey passKey, localKey;
+
+		DraftsMap draftsMap, draftsPositionsMap;
+		DraftsNotReadMap draftsNotReadMap;
+		StorageMap imagesMap, stickersMap, audiosMap;
+		ImageLinksMap imageLinksMap;
+		qint64 storageImagesSize, storageStickersSize, storageAudiosSize;
+		quint64 locationsKey, recentStickersKey, backgroundKey, userSettingsKey, recentHashtagsKey, contactsKey, dialogsKey, updatesStateKey;
+		int32 version;
+	};
 
+	Local::ReadMapState _readMapFile(MapData &result, const QByteArray &pass) { // can be called from any thread, see Local::KeyDeriver
 		FileReadDescriptor mapData;
 		if (!readFile(mapData, qsl("map"))) {
 			return Local::ReadMapFailed;
@@ -1260,10 +1348,11 @@ namespace {
 			LOG(("App Error: bad salt in map file, size: %1").arg(salt.size()));
 			return Local::ReadMapFailed;
 		}
-		createLocalKey(pass, &salt, &_passKey);
+		createLocalKey(pass, &salt, &result.passKey);
+		result.salt = salt;
 
 		EncryptedDescriptor keyData, map;
-		if (!decryptLocal(keyData, keyEncrypted, _passKey)) {
+		if (!decryptLocal(keyData, keyEncrypted, result.passKey)) {
 			LOG(("App Info: could not decrypt pass-protected key from map file, maybe bad password.."));
 			return Local::ReadMapPassNeeded;
 		}
@@ -1272,22 +1361,22 @@ namespace {
 			LOG(("App Error: could not read pass-protected key from map file"));
 			return Local::ReadMapFailed;
 		}
-		_localKey.setKey(key);
+		result.localKey.setKey(key);
+		result.keyEncrypted = keyEncrypted;
 
-		_passKeyEncrypted = keyEncrypted;
-		_passKeySalt = salt;
-
-		if (!decryptLocal(map, mapEncrypted)) {
+		if (!decryptLocal(map, mapEncrypted, result.localKey)) {
 			LOG(("App Error: could not decrypt map."));
 			return Local::ReadMapFailed;
 		}
 		LOG(("App Info: reading encrypted map.."));
 
-		DraftsMap draftsMap, draftsPositionsMap;
-		DraftsNotReadMap draftsNotReadMap;
-		StorageMap imagesMap, stickersMap, audiosMap;
-		qint64 storageImagesSize = 0, storageStickersSize = 0, storageAudiosSize = 0;
-		quint64 locationsKey = 0, recentStickersKey = 0, backgroundKey = 0, userSettingsKey = 0, recentHashtagsKey = 0;
+		DraftsMap &draftsMap(result.draftsMap), &draftsPositionsMap(result.draftsPositionsMap);
+		DraftsNotReadMap &draftsNotReadMap(result.draftsNotReadMap);
+		StorageMap &imagesMap(result.imagesMap), &stickersMap(result.stickersMap), &audiosMap(result.audiosMap);
+		ImageLinksMap &imageLinksMap(result.imageLinksMap);
+		qint64 &storageImagesSize(result.storageImagesSize), &storageStickersSize(result.storageStickersSize), &storageAudiosSize(result.storageAudiosSize);
+		quint64 &locationsKey(result.locationsKey), &recentStickersKey(result.recentStickersKey), &backgroundKey(result.backgroundKey), &userSettingsKey(result.userSettingsKey);
+		quint64 &recentHashtagsKey(result.recentHashtagsKey), &contactsKey(result.contactsKey), &dialogsKey(result.dialogsKey), &updatesStateKey(result.updatesStateKey);
 		while (!map.stream.atEnd()) {
 			quint32 keyType;
 			map.stream >> keyType;
@@ -1364,6 +1453,27 @@ namespace {
 			case lskRecentHashtags: {
 				map.stream >> recentHashtagsKey;
 			} break;
+			case lskContacts: {
+				map.stream >> contactsKey;
+			} break;
+			case lskDialogs: {
+				map.stream >> dialogsKey;
+			} break;
+			case lskUpdatesState: {
+				map.stream >> updatesStateKey;
+			} break;
+			case lskImageLinks: {
+				quint32 count = 0;
+				map.stream >> count;
+				for (quint32 i = 0; i < count; ++i) {
+					FileKey key;
+					QString id;
+					qint32 size;
+					map.stream >> key >> id >> size;
+					imageLinksMap.insert(id, FileDesc(key, size));
+					storageImagesSize += size;
+				}
+			} break;
 			default:
 				LOG(("App Error: unknown key type in encrypted map: %1").arg(keyType));
 				return Local::ReadMapFailed;
@@ -1372,37 +1482,75 @@ namespace {
 				return Local::ReadMapFailed;
 			}
 		}
+		result.version = mapData.version;
+		return Local::ReadMapDone;
+	}
 
-		_draftsMap = draftsMap;
-		_draftsPositionsMap = draftsPositionsMap;
-		_draftsNotReadMap = draftsNotReadMap;
-
-		_imagesMap = imagesMap;
-		_storageImagesSize = storageImagesSize;
-		_stickersMap = stickersMap;
-		_storageStickersSize = storageStickersSize;
-		_audiosMap = audiosMap;
-		_storageAudiosSize = storageAudiosSize;
-
-		_locationsKey = locationsKey;
-		_recentStickersKey = recentStickersKey;
-		_backgroundKey = backgroundKey;
-		_userSettingsKey = userSettingsKey;
-		_recentHashtagsKey = recentHashtagsKey;
-		_oldMapVersion = mapData.version;
+	Local::ReadMapState _applyMap(const MapData &data, Local::ReadMapState state) {
+		if (!data.salt.isEmpty()) {
+			_passKey = data.passKey;
+			_passKeySalt = data.salt; // Local::KeyDeriver derives the pass key with this salt when unlocking
+		}
+		if (state != Local::ReadMapDone) return state;
+
+		_localKey = data.localKey;
+		_passKeyEncrypted = data.keyEncrypted;
+
+		_draftsMap = data.draftsMap;
+		_draftsPositionsMap = data.draftsPositionsMap;
+		_draftsNotReadMap = data.draftsNotReadMap;
+
+		_imagesMap = data.imagesMap;
+		_imageLinksMap = data.imageLinksMap;
+		_storageImagesSize = data.storageImagesSize;
+		_stickersMap = data.stickersMap;
+		_storageStickersSize = data.storageStickersSize;
+		_audiosMap = data.audiosMap;
+		_storageAudiosSize = data.storageAudiosSize;
+
+		_locationsKey = data.locationsKey;
+		_recentStickersKey = data.recentStickersKey;
+		_backgroundKey = data.backgroundKey;
+		_userSettingsKey = data.userSettingsKey;
+		_recentHashtagsKey = data.recentHashtagsKey;
+		_contactsKey = data.contactsKey;
+		_dialogsKey = data.dialogsKey;
+		_updatesStateKey = data.updatesStateKey;
+		_oldMapVersion = data.version;
 		if (_oldMapVersion < AppVersion) {
 			_mapChanged = true;
 			_writeMap();
 		} else {
 			_mapChanged = false;
 		}
+		return state;
+	}
 
+	void _readMapUserData() { // not needed by MTP::start()
 		if (_locationsKey) {
+			STARTUP_TRACE("Local::readLocations");
 			_readLocations();
 		}
 
-		_readUserSettings();
-		_readMtpData();
+		{
+			STARTUP_TRACE("Local::readUserSettings");
+			_readUserSettings();
+		}
+	}
+
+	Local::ReadMapState _readMap(const QByteArray &pass) {
+		uint64 ms = getms();
+		_prepareUserBasePath();
+
+		MapData data;
+		Local::ReadMapState state = _applyMap(data, _readMapFile(data, pass));
+		if (state != Local::ReadMapDone) return state;
+
+		_readMapUserData();
+		{
+			STARTUP_TRACE("Local::readMtpData");
+			_readMtpData();
+		}
 
 		LOG(("Map read time: %1").arg(getms() - ms));
 		return Local::ReadMapDone;
@@ -1452,6 +1600,15 @@ namespace {
 		if (_backgroundKey) mapSize += sizeof(quint32) + sizeof(quint64);
 		if (_userSettingsKey) mapSize += sizeof(quint32) + sizeof(quint64);
 		if (_recentHashtagsKey) mapSize += sizeof(quint32) + sizeof(quint64);
+		if (_contactsKey) mapSize += sizeof(quint32) + sizeof(quint64);
+		if (_dialogsKey) mapSize += sizeof(quint32) + sizeof(quint64);
+		if (_updatesStateKey) mapSize += sizeof(quint32) + sizeof(quint64);
+		if (!_imageLinksMap.isEmpty()) {
+			mapSize += sizeof(quint32) * 2;
+			for (ImageLinksMap::const_iterator i = _imageLinksMap.cbegin(), e = _imageLinksMap.cend(); i != e; ++i) {
+				mapSize += sizeof(quint64) + _stringSize(i.key()) + sizeof(qint32);
+			}
+		}
 		EncryptedDescriptor mapData(mapSize);
 		if (!_draftsMap.isEmpty()) {
 			mapData.stream << quint32(lskDraft) << quint32(_draftsMap.size());
@@ -1498,6 +1655,21 @@ namespace {
 		if (_recentHashtagsKey) {
 			mapData.stream << quint32(lskRecentHashtags) << quint64(_recentHashtagsKey);
 		}
+		if (_contactsKey) {
+			mapData.stream << quint32(lskContacts) << quint64(_contactsKey);
+		}
+		if (_dialogsKey) {
+			mapData.stream << quint32(lskDialogs) << quint64(_dialogsKey);
+		}
+		if (_updatesStateKey) {
+			mapData.stream << quint32(lskUpdatesState) << quint64(_updatesStateKey);
+		}
+		if (!_imageLinksMap.isEmpty()) {
+			mapData.stream << quint32(lskImageLinks) << quint32(_imageLinksMap.size());
+			for (ImageLinksMap::const_iterator i = _imageLinksMap.cbegin(), e = _imageLinksMap.cend(); i != e; ++i) {
+				mapData.stream << quint64(i.value().first) << i.key() << qint32(i.value().second);
+			}
+		}
 		map.writeEncrypted(mapData);
 
 		_mapChanged = false;
@@ -1717,10 +1889,12 @@ namespace Local {
 		_draftsMap.clear();
 		_draftsPositionsMap.clear();
 		_imagesMap.clear();
+		_imageLinksMap.clear();
 		_draftsNotReadMap.clear();
 		_stickersMap.clear();
 		_audiosMap.clear();
 		_locationsKey = _recentStickersKey = _backgroundKey = _userSettingsKey = _recentHashtagsKey = 0;
+		_contactsKey = _dialogsKey = _updatesStateKey = 0;
 		_mapChanged = true;
 		_writeMap(WriteMapNow);
 
@@ -1755,6 +1929,83 @@ namespace Local {
 		return result;
 	}
 
+	struct KeyDeriverData {
+		KeyDeriverData() : thread(0), map(0), mapState(ReadMapFailed) {
+		}
+		QThread *thread;
+		QByteArray passcode, salt;
+		mtpAuthKey key;
+
+		MapData *map; // map file is read and decrypted with the key on the same thread, for readMap(KeyDeriver*)
+		ReadMapState mapState;
+	};
+
+	KeyDeriver::KeyDeriver(const QByteArray &passcode, bool withMap) : data(new KeyDeriverData()) {
+		data->thread = new QThread();
+		data->passcode = passcode;
+		data->salt = _passKeySalt;
+		if (withMap) {
+			_prepareUserBasePath();
+			data->map = new MapData();
+		}
+	}
+
+	void KeyDeriver::start() {
+		moveToThread(data->thread);
+		connect(data->thread, SIGNAL(started()), this, SLOT(onStart()));
+		data->thread->start();
+	}
+
+	const KeyDeriverData *KeyDeriver::result() const {
+		return data;
+	}
+
+	KeyDeriver::~KeyDeriver() {
+		data->thread->wait();
+		delete data->thread;
+		delete data->map;
+		delete data;
+	}
+
+	void KeyDeriver::onStart() {
+		if (data->map) {
+			data->mapState = _readMapFile(*data->map, data->passcode);
+		} else {
+			createLocalKey(data->passcode, &data->salt, &data->key);
+		}
+
+		moveToThread(QCoreApplication::instance()->thread()); // deleted and used in main thread
+		data->thread->quit();
+		emit done(this);
+	}
+
+	bool checkPasscode(const KeyDeriver *deriver) {
+		const KeyDeriverData *result = deriver->result();
+		if (result->salt != _passKeySalt) { // salt was changed while deriving, check synchronously
+			return checkPasscode(result->passcode);
+		}
+		return (result->key == _passKey);
+	}
+
+	ReadMapState readMap(const KeyDeriver *deriver) {
+		const KeyDeriverData *result = deriver->result();
+		if (!result->map) return readMap(result->passcode);
+
+		ReadMapState state = _applyMap(*result->map, result->mapState);
+		if (state == ReadMapDone) {
+			STARTUP_TRACE("Local::readMtpData");
+			_readMtpData();
+		} else if (state == ReadMapFailed) {
+			_mapChanged = true;
+			_writeMap(WriteMapNow);
+		}
+		return state;
+	}
+
+	void readMapUserData() {
+		_readMapUserData();
+	}
+
 	int32 oldMapVersion() {
 		return _oldMapVersion;
 	}
@@ -1988,13 +2239,73 @@ namespace Local {
 	}
 
 	int32 hasImages() {
-		return _imagesMap.size();
+		return _imagesMap.size() + _imageLinksMap.size();
 	}
 
 	qint64 storageImagesSize() {
 		return _storageImagesSize;
 	}
 
+	qint32 _imageLinkDataSize(const ImageLinkData *link, qint32 rawlen) {
+		// id + title + duration + etag + expires + len + data
+		return _stringSize(link->id) + _stringSize(link->title) + _stringSize(link->duration) + sizeof(quint32) + link->etag.size() + sizeof(qint32) + sizeof(quint32) + rawlen;
+	}
+
+	qint32 _storageImageLinkSize(qint32 datalen) {
+		// fulllen + data
+		qint32 result = sizeof(uint32) + datalen;
+		if (result & 0x0F) result += 0x10 - (result & 0x0F);
+		result += tdfMagicLen + sizeof(qint32) + sizeof(quint32) + 0x10 + 0x10; // magic + version + len of encrypted + part of sha1 + md5
+		return result;
+	}
+
+	void writeImageLink(const ImageLinkData *link, const QByteArray &image) {
+		if (!_working()) return;
+
+		qint32 datalen = _imageLinkDataSize(link, image.size()), size = _storageImageLinkSize(datalen);
+		ImageLinksMap::iterator i = _imageLinksMap.find(link->id);
+		if (i == _imageLinksMap.end()) {
+			i = _imageLinksMap.insert(link->id, FileDesc(genKey(UserPath), 0));
+			_mapChanged = true;
+			_writeMap();
+		}
+		EncryptedDescriptor data(datalen);
+		data.stream << link->id << link->title << link->duration << link->etag << qint32(link->expires) << image;
+		FileWriteDescriptor file(i.value().first, UserPath);
+		file.writeEncrypted(data);
+		if (i.value().second != size) {
+			_storageImagesSize += size - i.value().second;
+			i.value().second = size;
+		}
+	}
+
+	QByteArray readImageLink(ImageLinkData *link) {
+		ImageLinksMap::iterator j = _imageLinksMap.find(link->id);
+		if (j == _imageLinksMap.end()) return QByteArray();
+
+		FileReadDescriptor file;
+		if (!readEncryptedFile(file, j.value().first, UserPath)) {
+			clearKey(j.value().first, UserPath);
+			_storageImagesSize -= j.value().second;
+			_imageLinksMap.erase(j);
+			_mapChanged = true;
+			_writeMap();
+			return QByteArray();
+		}
+
+		QString id, title, duration;
+		QByteArray etag, image;
+		qint32 expires = 0;
+		file.stream >> id >> title >> duration >> etag >> expires >> image;
+		if (!_checkStreamStatus(file.stream) || id != link->id) return QByteArray();
+
+		link->title = title;
+		link->duration = duration;
+		link->etag = etag;
+		link->expires = expires;
+		return image;
+	}
+
 	void writeSticker(const StorageKey &location, const QByteArray &sticker, bool overwrite) {
 		if (!_working()) return;
 
@@ -2319,9 +2630,117 @@ namespace Local {
 		cSetRecentSearchHashtags(search);
 	}
 
+	template <typename TMTPType>
+	void _writeMtpSnapshot(FileKey &key, const TMTPType &object) {
+		if (!_working()) return;
+
+		if (!key) {
+			key = genKey();
+			_mapChanged = true;
+			_writeMap(WriteMapFast);
+		}
+
+		mtpBuffer buffer;
+		object.write(buffer);
+
+		EncryptedDescriptor data(sizeof(quint32) + buffer.size() * sizeof(mtpPrime));
+		data.stream << quint32(buffer.size());
+		data.stream.writeRawData((const char*)buffer.constData(), buffer.size() * sizeof(mtpPrime));
+
+		FileWriteDescriptor file(key);
+		file.writeEncrypted(data);
+	}
+
+	template <typename TMTPType>
+	bool _readMtpSnapshot(FileKey &key, TMTPType &object) {
+		if (!key) return false;
+
+		FileReadDescriptor file;
+		if (readEncryptedFile(file, key)) {
+			if (file.version == AppVersion) { // mtp scheme can change with the app version
+				quint32 count = 0;
+				file.stream >> count;
+				if (_checkStreamStatus(file.stream) && count > 0 && count < quint32(MTPPacketSizeMax / sizeof(mtpPrime))) {
+					mtpBuffer buffer(count);
+					if (file.stream.readRawData((char*)buffer.data(), count * sizeof(mtpPrime)) == int(count * sizeof(mtpPrime))) {
+						const mtpPrime *from = buffer.constData(), *end = from + buffer.size();
+						try {
+							object.read(from, end);
+							return true;
+						} catch (Exception &e) {
+							LOG(("App Error: could not parse mtp snapshot, %1").arg(e.what()));
+						}
+					}
+				}
+			}
+		}
+
+		clearKey(key);
+		key = 0;
+		_mapChanged = true;
+		_writeMap();
+		return false;
+	}
+
+	void writeContacts(const MTPcontacts_Contacts &contacts) {
+		_writeMtpSnapshot(_contactsKey, contacts);
+	}
+
+	bool readContacts(MTPcontacts_Contacts &contacts) {
+		return _readMtpSnapshot(_contactsKey, contacts);
+	}
+
+	void writeDialogs(const MTPmessages_Dialogs &dialogs) {
+		_writeMtpSnapshot(_dialogsKey, dialogs);
+	}
+
+	bool readDialogs(MTPmessages_Dialogs &dialogs) {
+		return _readMtpSnapshot(_dialogsKey, dialogs);
+	}
+
+	void writeUpdatesState(int32 pts, int32 date, int32 qts, int32 seq) {
+		if (!_working()) return;
+
+		if (!_updatesStateKey) {
+			_updatesStateKey = genKey();
+			_mapChanged = true;
+			_writeMap(WriteMapFast);
+		}
+
+		EncryptedDescriptor data(sizeof(qint32) * 4);
+		data.stream << qint32(pts) << qint32(date) << qint32(qts) << qint32(seq);
+
+		FileWriteDescriptor file(_updatesStateKey);
+		file.writeEncrypted(data);
+	}
+
+	bool readUpdatesState(int32 &pts, int32 &date, int32 &qts, int32 &seq) {
+		if (!_updatesStateKey) return false;
+
+		FileReadDescriptor file;
+		if (!readEncryptedFile(file, _updatesStateKey)) {
+			clearKey(_updatesStateKey);
+			_updatesStateKey = 0;
+			_mapChanged = true;
+			_writeMap();
+			return false;
+		}
+
+		qint32 filePts = 0, fileDate = 0, fileQts = 0, fileSeq = 0;
+		file.stream >> filePts >> fileDate >> fileQts >> fileSeq;
+		if (!_checkStreamStatus(file.stream) || filePts <= 0 || fileDate <= 0) return false;
+
+		pts = filePts;
+		date = fileDate;
+		qts = fileQts;
+		seq = fileSeq;
+		return true;
+	}
+
 	struct ClearManagerData {
 		QThread *thread;
 		StorageMap images, stickers, audios;
+		QList<FileKey> imageLinks;
 		QMutex mutex;
 		QList<int> tasks;
 		bool working;
@@ -2339,8 +2758,9 @@ namespace Local {
 		if (!data->tasks.isEmpty() && (data->tasks.at(0) == ClearManagerAll)) return true;
 		if (task == ClearManagerAll) {
 			data->tasks.clear();
-			if (!_imagesMap.isEmpty()) {
+			if (!_imagesMap.isEmpty() || !_imageLinksMap.isEmpty()) {
 				_imagesMap.clear();
+				_imageLinksMap.clear();
 				_storageImagesSize = 0;
 				_mapChanged = true;
 			}
@@ -2374,6 +2794,18 @@ namespace Local {
 				_recentHashtagsKey = 0;
 				_mapChanged = true;
 			}
+			if (_contactsKey) {
+				_contactsKey = 0;
+				_mapChanged = true;
+			}
+			if (_dialogsKey) {
+				_dialogsKey = 0;
+				_mapChanged = true;
+			}
+			if (_updatesStateKey) {
+				_updatesStateKey = 0;
+				_mapChanged = true;
+			}
 			_writeMap();
 		} else {
 			if (task & ClearManagerStorage) {
@@ -2388,8 +2820,12 @@ namespace Local {
 						data->images.insert(k, i.value());
 					}
 				}
-				if (!_imagesMap.isEmpty()) {
+				for (ImageLinksMap::const_iterator i = _imageLinksMap.cbegin(), e = _imageLinksMap.cend(); i != e; ++i) {
+					data->imageLinks.push_back(i.value().first);
+				}
+				if (!_imagesMap.isEmpty() || !_imageLinksMap.isEmpty()) {
 					_imagesMap.clear();
+					_imageLinksMap.clear();
 					_storageImagesSize = 0;
 					_mapChanged = true;
 				}
@@ -2461,6 +2897,7 @@ namespace Local {
 			int task = 0;
 			bool result = false;
 			StorageMap images, stickers, audios;
+			QList<FileKey> imageLinks;
 			{
 				QMutexLocker lock(&data->mutex);
 				if (data->tasks.isEmpty()) {
@@ -2469,6 +2906,7 @@ namespace Local {
 				}
 				task = data->tasks.at(0);
 				images = data->images;
+				imageLinks = data->imageLinks;
 				stickers = data->stickers;
 				audios = data->audios;
 			}
@@ -2496,6 +2934,9 @@ namespace Local {
 				for (StorageMap::const_iterator i = images.cbegin(), e = images.cend(); i != e; ++i) {
 					clearKey(i.value().first, UserPath);
 				}
+				for (QList<FileKey>::const_iterator i = imageLinks.cbegin(), e = imageLinks.cend(); i != e; ++i) {
+					clearKey(*i, UserPath);
+				}
 				for (StorageMap::const_iterator i = stickers.cbegin(), e = stickers.cend(); i != e; ++i) {
 					clearKey(i.value().first, UserPath);
 				}
@@ -62,6 +62,28 @@ namespace Local {
 
 	bool checkPasscode(const QByteArray &passcode);
 	void setPasscode(const QByteArray &passcode);
+
+	struct KeyDeriverData;
+	class KeyDeriver : public QObject { // derives the passcode key on its own thread, see checkPasscode(KeyDeriver*) and readMap(KeyDeriver*)
+		Q_OBJECT
+
+	public:
+		KeyDeriver(const QByteArray &passcode, bool withMap = false); // withMap also reads and decrypts the map file there
+		void start();
+		const KeyDeriverData *result() const;
+		~KeyDeriver();
+
+	public slots:
+		void onStart();
+
+	signals:
+		void done(void *deriver);
+
+	private:
+		KeyDeriverData *data;
+
+	};
+	bool checkPasscode(const KeyDeriver *deriver);
 	
 	enum ClearManagerTask {
 		ClearManagerAll = 0xFFFF,
@@ -98,6 +120,8 @@ namespace Local {
 		ReadMapPassNeeded = 2,
 	};
 	ReadMapState readMap(const QByteArray &pass);
+	ReadMapState readMap(const KeyDeriver *deriver); // applies the map read by KeyDeriver and reads mtp data, call readMapUserData() after MTP::start()
+	void readMapUserData(); // user settings and file locations
 	int32 oldMapVersion();
 
 	struct MessageDraft {
@@ -122,6 +146,9 @@ namespace Local {
 	int32 hasImages();
 	qint64 storageImagesSize();
 
+	void writeImageLink(const ImageLinkData *link, const QByteArray &image); // with title, duration and http cache validators
+	QByteArray readImageLink(ImageLinkData *link); // returns stored preview image, empty if link is not stored
+
 	void writeSticker(const StorageKey &location, const QByteArray &data, bool overwrite = true);
 	QByteArray readSticker(const StorageKey &location);
 	int32 hasStickers();
@@ -141,4 +168,13 @@ namespace Local {
 	void writeRecentHashtags();
 	void readRecentHashtags();
 
+	void writeContacts(const MTPcontacts_Contacts &contacts);
+	bool readContacts(MTPcontacts_Contacts &contacts);
+
+	void writeDialogs(const MTPmessages_Dialogs &dialogs); // first page, shown on the next launch until it is reloaded
+	bool readDialogs(MTPmessages_Dialogs &dialogs);
+
+	void writeUpdatesState(int32 pts, int32 date, int32 qts, int32 seq); // checkpoint of applied updates, to getDifference from on the next launch
+	bool readUpdatesState(int32 &pts, int32 &date, int32 &qts, int32 &seq);
+
 };
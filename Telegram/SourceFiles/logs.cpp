@@ -19,6 +19,12 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 #include <iostream>
 #include "pspecific.h"
 
+#ifdef Q_OS_MAC
+#include <mach/mach.h>
+#elif !defined Q_OS_WIN
+#include <time.h>
+#endif
+
 namespace {
 	QFile debugLog, tcpLog, mtpLog, mainLog;
 	QTextStream *debugLogStream = 0, *tcpLogStream = 0, *mtpLogStream = 0, *mainLogStream = 0;
@@ -358,3 +364,120 @@ QString logVectorLong(const QVector<uint64> &ids) {
 	}
 	return idsStr + "]";
 }
+
+namespace {
+	struct StartupTraceEntry {
+		const char *name;
+		quint64 thread;
+		uint64 wallStart, wallDuration, cpuStart, cpuDuration;
+	};
+	typedef QVector<StartupTraceEntry> StartupTraceEntries;
+	StartupTraceEntries startupTraceEntries;
+	QMutex startupTraceMutex;
+	QElapsedTimer startupTraceTimer;
+	QAtomicInt startupTraceRunning(0); // spans check it from any thread, set after the timer is started
+
+	uint64 startupTraceWallTime() {
+		return uint64(startupTraceTimer.nsecsElapsed() / 1000);
+	}
+
+	uint64 startupTraceCpuTime() { // current thread cpu time in microseconds
+#ifdef Q_OS_WIN
+		FILETIME creation, exit, kernel, user;
+		if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user)) return 0;
+		uint64 k = (uint64(kernel.dwHighDateTime) << 32) | uint64(kernel.dwLowDateTime);
+		uint64 u = (uint64(user.dwHighDateTime) << 32) | uint64(user.dwLowDateTime);
+		return (k + u) / 10; // FILETIME is in 100ns units
+#elif defined Q_OS_MAC
+		mach_port_t thread = mach_thread_self();
+		thread_basic_info_data_t info;
+		mach_msg_type_number_t count = THREAD_BASIC_INFO_COUNT;
+		kern_return_t res = thread_info(thread, THREAD_BASIC_INFO, (thread_info_t)&info, &count);
+		mach_port_deallocate(mach_task_self(), thread);
+		if (res != KERN_SUCCESS) return 0;
+		return uint64(info.user_time.seconds + info.system_time.seconds) * 1000000ULL + uint64(info.user_time.microseconds + info.system_time.microseconds);
+#else
+		timespec ts;
+		if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) return 0;
+		return 1000000ULL * uint64(ts.tv_sec) + uint64(ts.tv_nsec) / 1000ULL;
+#endif
+	}
+}
+
+void startupTraceInit() {
+	if (!cStartupTrace() || startupTraceRunning.loadAcquire()) return;
+
+	startupTraceTimer.start();
+	{
+		QMutexLocker lock(&startupTraceMutex);
+		startupTraceEntries.reserve(64);
+	}
+	startupTraceRunning.storeRelease(1);
+}
+
+void startupTraceFinish() {
+	StartupTraceEntries entries;
+	{
+		QMutexLocker lock(&startupTraceMutex);
+		if (!startupTraceRunning.loadAcquire()) return;
+
+		startupTraceRunning.storeRelease(0);
+		entries = startupTraceEntries;
+		startupTraceEntries.clear();
+	}
+
+	quint64 mainThread = quint64(quintptr(QThread::currentThreadId())), pid = quint64(QCoreApplication::applicationPid());
+	QJsonArray events;
+	for (StartupTraceEntries::const_iterator i = entries.cbegin(), e = entries.cend(); i != e; ++i) {
+		QJsonObject event;
+		event.insert(qsl("name"), QString::fromLatin1(i->name));
+		event.insert(qsl("cat"), qsl("startup"));
+		event.insert(qsl("ph"), qsl("X"));
+		event.insert(qsl("pid"), double(pid));
+		event.insert(qsl("tid"), double((i->thread == mainThread) ? 0 : i->thread));
+		event.insert(qsl("ts"), double(i->wallStart));
+		event.insert(qsl("dur"), double(i->wallDuration));
+		event.insert(qsl("tts"), double(i->cpuStart));
+		event.insert(qsl("tdur"), double(i->cpuDuration));
+		events.append(event);
+
+		LOG(("Startup Trace: %1 took %2 ms wall, %3 ms cpu").arg(i->name).arg(i->wallDuration / 1000.0, 0, 'f', 2).arg(i->cpuDuration / 1000.0, 0, 'f', 2));
+	}
+	LOG(("Startup Trace: finished in %1 ms").arg(startupTraceWallTime() / 1000.0, 0, 'f', 2));
+
+	QJsonObject trace;
+	trace.insert(qsl("traceEvents"), events);
+	trace.insert(qsl("displayTimeUnit"), qsl("ms"));
+
+	QFile f(cWorkingDir() + qsl("startup_trace.json"));
+	if (f.open(QIODevice::WriteOnly)) {
+		f.write(QJsonDocument(trace).toJson(QJsonDocument::Compact));
+		f.close();
+	} else {
+		LOG(("Startup Trace Error: could not write %1").arg(f.fileName()));
+	}
+}
+
+StartupTraceSpan::StartupTraceSpan(const char *name) : _name(name), _wallStart(0), _cpuStart(0), _active(startupTraceRunning.loadAcquire() != 0) {
+	if (_active) {
+		_wallStart = startupTraceWallTime();
+		_cpuStart = startupTraceCpuTime();
+	}
+}
+
+StartupTraceSpan::~StartupTraceSpan() {
+	if (!_active) return;
+
+	StartupTraceEntry entry;
+	entry.name = _name;
+	entry.thread = quint64(quintptr(QThread::currentThreadId()));
+	entry.wallStart = _wallStart;
+	entry.wallDuration = startupTraceWallTime() - _wallStart;
+	entry.cpuStart = _cpuStart;
+	entry.cpuDuration = startupTraceCpuTime() - _cpuStart;
+
+	QMutexLocker lock(&startupTraceMutex);
+	if (startupTraceRunning.loadAcquire()) {
+		startupTraceEntries.push_back(entry);
+	}
+}
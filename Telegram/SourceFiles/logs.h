@@ -82,3 +82,24 @@ void logWrite(const QString &v);
 void logsInit();
 void logsInitDebug();
 void logsClose();
+
+// startup timeline tracing, enabled by -tracestartup, written as chrome trace json
+void startupTraceInit();
+void startupTraceFinish();
+
+class StartupTraceSpan {
+public:
+	StartupTraceSpan(const char *name);
+	~StartupTraceSpan();
+
+private:
+	const char *_name;
+	uint64 _wallStart, _cpuStart; // microseconds
+	bool _active;
+
+};
+
+#define STARTUP_TRACE_JOIN2(a, b) a##b
+#define STARTUP_TRACE_JOIN(a, b) STARTUP_TRACE_JOIN2(a, b)
+#define STARTUP_TRACE(name) StartupTraceSpan STARTUP_TRACE_JOIN(_startupTraceSpan, __LINE__)(name)
+//usage STARTUP_TRACE("Local::readMap"); - measures until the end of the scope
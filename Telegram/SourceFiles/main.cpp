@@ -27,6 +27,7 @@ int main(int argc, char *argv[]) {
 #endif
 
 	settingsParseArgs(argc, argv);
+	startupTraceInit();
 	for (int32 i = 0; i < argc; ++i) {
 		if (string("-fixprevious") == argv[i]) {
 			return psFixPrevious();
@@ -34,9 +35,15 @@ int main(int argc, char *argv[]) {
 			return psCleanup();
 		}
 	}
-	logsInit();
+	{
+		STARTUP_TRACE("logsInit");
+		logsInit();
+	}
 
-	Local::readSettings();
+	{
+		STARTUP_TRACE("Local::readSettings");
+		Local::readSettings();
+	}
 	if (cFromAutoStart() && !cAutoStart()) {
 		psAutoStart(false, true);
 		Local::stop();
@@ -351,7 +351,7 @@ MainWidget *TopBarWidget::main() {
 MainWidget::MainWidget(Window *window) : QWidget(window), _started(0), failedObjId(0), _toForwardNameVersion(0), _dialogsWidth(st::dlgMinWidth),
 dialogs(this), history(this), profile(0), overview(0), _topBar(this), _forwardConfirm(0), hider(0), _mediaType(this), _mediaTypeMask(0),
 updGoodPts(0), updLastPts(0), updPtsCount(0), updDate(0), updQts(-1), updSeq(0), updInited(false), updSkipPtsUpdateLevel(0), _onlineRequest(0), _lastWasOnline(false), _lastSetOnline(0), _isIdle(false),
-_failDifferenceTimeout(1), _lastUpdateTime(0), _cachedX(0), _cachedY(0), _background(0), _api(new ApiWrap(this)) {
+_failDifferenceTimeout(1), _diffPts(0), _diffDate(0), _diffQts(0), _diffSlices(0), _diffRequesting(false), _diffPostponed(false), _diffResuming(false), _diffLoadDialogs(false), _diffSilentBefore(0), _lastUpdateTime(0), _cachedX(0), _cachedY(0), _background(0), _api(new ApiWrap(this)) {
 	setGeometry(QRect(0, st::titleHeight, App::wnd()->width(), App::wnd()->height() - st::titleHeight));
 
 	updateScrollColors();
@@ -366,7 +366,10 @@ _failDifferenceTimeout(1), _lastUpdateTime(0), _cachedX(0), _cachedY(0), _backgr
 	connect(&_idleFinishTimer, SIGNAL(timeout()), this, SLOT(checkIdleFinish()));
 	connect(&_bySeqTimer, SIGNAL(timeout()), this, SLOT(getDifference()));
 	connect(&_byPtsTimer, SIGNAL(timeout()), this, SLOT(getDifference()));
+	connect(App::stickerDecoder(), SIGNAL(decoded(DocumentData*)), this, SLOT(stickerDecoded(DocumentData*)));
 	connect(&_failDifferenceTimer, SIGNAL(timeout()), this, SLOT(getDifferenceForce()));
+	connect(&_diffApplyTimer, SIGNAL(timeout()), this, SLOT(onApplyDifference()));
+	connect(&_updStateSaveTimer, SIGNAL(timeout()), this, SLOT(onSaveUpdatesState()));
 	connect(this, SIGNAL(peerUpdated(PeerData*)), &history, SLOT(peerUpdated(PeerData*)));
 	connect(&_topBar, SIGNAL(clicked()), this, SLOT(onTopBarClick()));
 	connect(&history, SIGNAL(peerShown(PeerData*)), this, SLOT(onPeerShown(PeerData*)));
@@ -995,7 +998,7 @@ void MainWidget::readServerHistory(History *hist, bool force) {
     ReadRequests::const_iterator i = _readRequests.constFind(hist->peer);
     if (i == _readRequests.cend()) {
         hist->inboxRead(0);
-        _readRequests.insert(hist->peer, MTP::send(MTPmessages_ReadHistory(hist->peer->input, MTP_int(0), MTP_int(0)), rpcDone(&MainWidget::partWasRead, hist->peer)));
+        _readRequests.insert(hist->peer, MTP::sendBatched(MTPmessages_ReadHistory(hist->peer->input, MTP_int(0), MTP_int(0)), rpcDone(&MainWidget::partWasRead, hist->peer)));
     }
 }
 
@@ -1288,7 +1291,7 @@ void MainWidget::partWasRead(PeerData *peer, const MTPmessages_AffectedHistory &
 	if (!MTP::authedId() || offset <= 0) {
         _readRequests.remove(peer);
     } else {
-        _readRequests[peer] = MTP::send(MTPmessages_ReadHistory(peer->input, MTP_int(0), MTP_int(offset)), rpcDone(&MainWidget::partWasRead, peer));
+        _readRequests[peer] = MTP::sendBatched(MTPmessages_ReadHistory(peer->input, MTP_int(0), MTP_int(offset)), rpcDone(&MainWidget::partWasRead, peer));
     }
 }
 
@@ -1449,6 +1452,16 @@ void MainWidget::documentLoadProgress(mtpFileLoader *loader) {
 	App::wnd()->documentUpdated(document);
 }
 
+void MainWidget::stickerDecoded(DocumentData *sticker) {
+	const DocumentItems &items(App::documentItems());
+	DocumentItems::const_iterator i = items.constFind(sticker);
+	if (i != items.cend()) {
+		for (HistoryItemsMap::const_iterator j = i->cbegin(), e = i->cend(); j != e; ++j) {
+			msgUpdated(j.key()->history()->peer->id, j.key());
+		}
+	}
+}
+
 void MainWidget::documentLoadFailed(mtpFileLoader *loader, bool started) {
 	loadFailed(loader, started, SLOT(documentLoadRetry()));
 	DocumentData *document = App::document(loader->objId());
@@ -2020,6 +2033,10 @@ void MainWidget::newUnreadMsg(History *hist, HistoryItem *item) {
 	history.newUnreadMsg(hist, item);
 }
 
+bool MainWidget::notifySilent(HistoryItem *item) const {
+	return _diffSilentBefore && item->date < date(_diffSilentBefore);
+}
+
 void MainWidget::historyWasRead() {
 	history.historyWasRead(false);
 }
@@ -2319,14 +2336,58 @@ void MainWidget::gotState(const MTPupdates_State &state) {
 	_lastUpdateTime = getms(true);
 	noUpdatesTimer.start(NoUpdatesTimeout);
 	updInited = true;
+	saveUpdatesState();
 
+	_diffLoadDialogs = false;
+	_diffSilentBefore = 0;
 	dialogs.loadDialogs();
 	updateOnline();
 }
 
 void MainWidget::gotDifference(const MTPupdates_Difference &diff) {
 	_failDifferenceTimeout = 1;
+	_diffRequesting = false;
+	_diffResuming = false; // saved state was accepted, further failures are retried from the received slices
+
+	if (diff.type() == mtpc_updates_differenceSlice) {
+		// request the next slice right away, it will be received while this one is applied
+		const MTPDupdates_state &s(diff.c_updates_differenceSlice().vintermediate_state.c_updates_state());
+		_diffPts = s.vpts.v;
+		_diffDate = s.vdate.v;
+		_diffQts = s.vqts.v;
+		++_diffSlices;
+
+		_diffQueue.push_back(diff);
+		if (_diffQueue.size() < DifferenceSlicesQueued) {
+			MTP_LOG(0, ("getDifference { good - after a slice of difference was received, %1 slices queued }%2").arg(_diffQueue.size()).arg(cTestMode() ? " TESTMODE" : ""));
+			requestDifference();
+		} else {
+			_diffPostponed = true;
+		}
+		_diffApplyTimer.startIfNotActive(0);
+	} else if (_diffQueue.isEmpty()) {
+		applyDifference(diff);
+	} else {
+		_diffQueue.push_back(diff);
+		_diffApplyTimer.startIfNotActive(0);
+	}
+}
+
+void MainWidget::onApplyDifference() {
+	if (_diffQueue.isEmpty()) return;
 
+	applyDifference(_diffQueue.takeFirst());
+	if (!_diffQueue.isEmpty()) {
+		_diffApplyTimer.start(0);
+	}
+	if (_diffPostponed && _diffQueue.size() < DifferenceSlicesQueued) {
+		_diffPostponed = false;
+		MTP_LOG(0, ("getDifference { good - after queued slices of difference were applied }%1").arg(cTestMode() ? " TESTMODE" : ""));
+		requestDifference();
+	}
+}
+
+void MainWidget::applyDifference(const MTPupdates_Difference &diff) {
 	switch (diff.type()) {
 	case mtpc_updates_differenceEmpty: {
 		const MTPDupdates_differenceEmpty &d(diff.c_updates_differenceEmpty());
@@ -2337,6 +2398,14 @@ void MainWidget::gotDifference(const MTPupdates_Difference &diff) {
 		noUpdatesTimer.start(NoUpdatesTimeout);
 
 		updInited = true;
+		saveUpdatesState();
+
+		if (_diffLoadDialogs) { // resumed from the saved state, gotState was not called
+			_diffLoadDialogs = false;
+			_diffSilentBefore = 0;
+			dialogs.loadDialogs();
+			updateOnline();
+		}
 	} break;
 	case mtpc_updates_differenceSlice: {
 		const MTPDupdates_differenceSlice &d(diff.c_updates_differenceSlice());
@@ -2344,17 +2413,16 @@ void MainWidget::gotDifference(const MTPupdates_Difference &diff) {
 
 		const MTPDupdates_state &s(d.vintermediate_state.c_updates_state());
 		updSetState(s.vpts.v, s.vdate.v, s.vqts.v, s.vseq.v);
+		saveUpdatesState(); // the slice is fed, a restart continues after it
 
-		updInited = true;
-
-		MTP_LOG(0, ("getDifference { good - after a slice of difference was received }%1").arg(cTestMode() ? " TESTMODE" : ""));
-		getDifference();
+		LOG(("Difference slice applied, %1 slices received, %2 queued, reached date %3").arg(_diffSlices).arg(_diffQueue.size()).arg(s.vdate.v));
 	} break;
 	case mtpc_updates_difference: {
 		const MTPDupdates_difference &d(diff.c_updates_difference());
 		feedDifference(d.vusers, d.vchats, d.vnew_messages, d.vother_updates);
 
 		gotState(d.vstate);
+		if (_diffSlices) LOG(("Difference finished after %1 slices").arg(_diffSlices));
 	} break;
 	};
 }
@@ -2394,6 +2462,7 @@ bool MainWidget::updPtsUpdated(int pts, int ptsCount) { // return false if need
 	if (updLastPts == updPtsCount) {
 		applySkippedPtsUpdates();
 		updGoodPts = updLastPts;
+		_updStateSaveTimer.startIfNotActive(SaveUpdatesStateTimeout);
 		return true;
 	} else if (updLastPts < updPtsCount) {
 		_byPtsTimer.startIfNotActive(1);
@@ -2417,6 +2486,19 @@ bool MainWidget::failDifference(const RPCError &error) {
 	if (error.type().startsWith(qsl("FLOOD_WAIT_"))) return false;
 
 	LOG(("RPC Error: %1 %2: %3").arg(error.code()).arg(error.type()).arg(error.description()));
+	_diffRequesting = false;
+
+	// the saved state is too old or invalid, start from the current one, other errors are retried
+	bool stateInvalid = error.type().startsWith(qsl("PERSISTENT_TIMESTAMP_")) || error.type() == qsl("DIFFERENCE_TOO_LONG");
+	if (_diffResuming && stateInvalid) {
+		LOG(("App Info: could not get difference from the saved state, requesting current state"));
+		_diffResuming = false;
+		_diffPostponed = false;
+		_diffQueue.clear();
+		_diffApplyTimer.stop();
+		MTP::send(MTPupdates_GetState(), rpcDone(&MainWidget::gotState));
+		return true;
+	}
 	_failDifferenceTimer.start(_failDifferenceTimeout * 1000);
 	if (_failDifferenceTimeout < 64) _failDifferenceTimeout *= 2;
 	return true;
@@ -2445,10 +2527,37 @@ void MainWidget::getDifference() {
 	noUpdatesTimer.stop();
 	_failDifferenceTimer.stop();
 
-	LOG(("Getting difference for %1, %2").arg(updGoodPts).arg(updDate));
 	updInited = false;
 	MTP::setGlobalDoneHandler(RPCDoneHandlerPtr(0));
-	MTP::send(MTPupdates_GetDifference(MTP_int(updGoodPts), MTP_int(updDate), MTP_int(updQts)), rpcDone(&MainWidget::gotDifference), rpcFail(&MainWidget::failDifference));
+	if (_diffQueue.isEmpty()) { // otherwise continue from the last received slice
+		_diffPts = updGoodPts;
+		_diffDate = updDate;
+		_diffQts = updQts;
+		_diffSlices = 0;
+	}
+	_diffPostponed = false;
+	requestDifference();
+}
+
+void MainWidget::onSaveUpdatesState() { // live updates, the difference is saved when it is applied
+	if (!updInited) return;
+
+	saveUpdatesState();
+}
+
+void MainWidget::saveUpdatesState() {
+	if (updGoodPts <= 0 || updDate <= 0) return;
+
+	_updStateSaveTimer.stop();
+	Local::writeUpdatesState(updGoodPts, updDate, updQts, updSeq);
+}
+
+void MainWidget::requestDifference() {
+	if (_diffRequesting) return;
+
+	LOG(("Getting difference for %1, %2").arg(_diffPts).arg(_diffDate));
+	_diffRequesting = true;
+	MTP::send(MTPupdates_GetDifference(MTP_int(_diffPts), MTP_int(_diffDate), MTP_int(_diffQts)), rpcDone(&MainWidget::gotDifference), rpcFail(&MainWidget::failDifference));
 }
 
 void MainWidget::mtpPing() {
@@ -2464,8 +2573,19 @@ void MainWidget::start(const MTPUser &user) {
 
 	cSetOtherOnline(0);
 	App::feedUsers(MTP_vector<MTPUser>(1, user));
+	dialogs.loadCachedDialogs();
 	App::app()->startUpdateCheck();
-	MTP::send(MTPupdates_GetState(), rpcDone(&MainWidget::gotState));
+
+	int32 pts = 0, date = 0, qts = 0, seq = 0;
+	if (Local::readUpdatesState(pts, date, qts, seq) && date > unixtime() - UpdatesStateMaxAge) {
+		updSetState(pts, date, qts, seq);
+		updInited = _diffResuming = _diffLoadDialogs = true;
+		_diffSilentBefore = unixtime();
+		MTP_LOG(0, ("getDifference { good - resuming from saved state }%1").arg(cTestMode() ? " TESTMODE" : ""));
+		getDifference();
+	} else {
+		MTP::send(MTPupdates_GetState(), rpcDone(&MainWidget::gotState));
+	}
 	update();
 	if (!cStartUrl().isEmpty()) {
 		openLocalUrl(cStartUrl());
@@ -212,6 +212,7 @@ public:
 	void historyToDown(History *hist);
 	void dialogsToUp();
 	void newUnreadMsg(History *history, HistoryItem *item);
+	bool notifySilent(HistoryItem *item) const; // missed while the app was closed, fed by the resumed difference
 	void historyWasRead();
 
 	void peerBefore(const PeerData *inPeer, MsgId inMsg, PeerData *&outPeer, MsgId &outMsg);
@@ -365,6 +366,7 @@ public slots:
 	void audioLoadRetry();
 	void audioPlayProgress(AudioData *audio);
 	void documentLoadProgress(mtpFileLoader *loader);
+	void stickerDecoded(DocumentData *sticker);
 	void documentLoadFailed(mtpFileLoader *loader, bool started);
 	void documentLoadRetry();
 
@@ -375,6 +377,8 @@ public slots:
 	void getDifference();
 	void mtpPing();
 	void getDifferenceForce();
+	void onApplyDifference();
+	void onSaveUpdatesState();
 
 	void updateOnline(bool gotOtherOffline = false);
 	void checkIdleFinish();
@@ -426,10 +430,13 @@ private:
 	SingleTimer _updateMutedTimer;
 
 	void gotDifference(const MTPupdates_Difference &diff);
+	void applyDifference(const MTPupdates_Difference &diff);
+	void requestDifference();
 	bool failDifference(const RPCError &e);
 	void feedDifference(const MTPVector<MTPUser> &users, const MTPVector<MTPChat> &chats, const MTPVector<MTPMessage> &msgs, const MTPVector<MTPUpdate> &other);
 	void gotState(const MTPupdates_State &state);
 	void updSetState(int32 pts, int32 date, int32 qts, int32 seq);
+	void saveUpdatesState();
 
 	void feedUpdates(const MTPVector<MTPUpdate> &updates, bool skipMessageIds = false);
 	void feedMessageIds(const MTPVector<MTPUpdate> &updates);
@@ -517,6 +524,17 @@ private:
 	int32 _failDifferenceTimeout; // growing timeout for getDifference calls, if it fails
 	SingleTimer _failDifferenceTimer;
 
+	QList<MTPupdates_Difference> _diffQueue; // received and not yet applied, in order
+	int32 _diffPts, _diffDate, _diffQts; // state for the next getDifference request, ahead of upd* while slices are queued
+	int32 _diffSlices; // slices received since catch-up started, for progress logging
+	bool _diffRequesting, _diffPostponed;
+	bool _diffResuming; // getting difference from the state saved in Local:: on startup, until the first answer
+	bool _diffLoadDialogs; // resumed from the saved state, dialogs are loaded when the difference is done
+	int32 _diffSilentBefore; // resumed from the saved state, messages dated before the launch are not notified
+	SingleTimer _diffApplyTimer;
+
+	SingleTimer _updStateSaveTimer; // started when a live update advances updGoodPts
+
 	uint64 _lastUpdateTime;
 
 	QPixmap _cachedBackground;
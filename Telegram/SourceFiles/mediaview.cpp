@@ -54,7 +54,7 @@ _docRadialFirst(0), _docRadialStart(0), _docRadialLast(0), _docRadialOpacity(1),
 _docDownload(this, lang(lng_media_download), st::mvDocLink),
 _docSaveAs(this, lang(lng_mediaview_save_as), st::mvDocLink),
 _docCancel(this, lang(lng_cancel), st::mvDocLink),
-_history(0), _peer(0), _user(0), _from(0), _index(-1), _msgid(0),
+_history(0), _peer(0), _user(0), _from(0), _index(-1), _msgid(0), _navigated(0),
 _loadRequest(0), _over(OverNone), _down(OverNone), _lastAction(-st::mvDeltaFromLastAction, -st::mvDeltaFromLastAction), _ignoringDropdown(false),
 _controlsState(ControlsShown), _controlsAnimStarted(0),
 _menu(0), _dropdown(this, st::mvDropdown), _receiveMouse(true), _touchPress(false), _touchMove(false), _touchRightButton(false),
@@ -89,6 +89,7 @@ _saveMsgStarted(0), _saveMsgOpacity(0)
 	connect(&_touchTimer, SIGNAL(timeout()), this, SLOT(onTouchTimer()));
 
 	connect(&_currentGif, SIGNAL(updated()), this, SLOT(onGifUpdated()));
+	connect(&_decoder, SIGNAL(decoded(PhotoData*)), this, SLOT(onPhotoDecoded(PhotoData*)));
 
 	_btns.push_back(_btnSaveCancel = _dropdown.addButton(new IconedButton(this, st::mvButton, lang(lng_cancel))));
 	connect(_btnSaveCancel, SIGNAL(clicked()), this, SLOT(onSaveCancel()));
@@ -248,7 +249,7 @@ void MediaView::updateControls() {
 		_docCancel.hide();
 	}
 
-	_saveVisible = ((_photo && _photo->full->loaded()) || (_doc && (!_doc->already(true).isEmpty() || (_current.isNull() && _currentGif.isNull()))));
+	_saveVisible = ((_photo && _photo->full->downloaded()) || (_doc && (!_doc->already(true).isEmpty() || (_current.isNull() && _currentGif.isNull()))));
 	_saveNav = rtlrect(width() - st::mvIconSize.width() * 2, height() - st::mvIconSize.height(), st::mvIconSize.width(), st::mvIconSize.height(), width());
 	_saveNavIcon = centersprite(_saveNav, st::mvSave);
 	_moreNav = rtlrect(width() - st::mvIconSize.width(), height() - st::mvIconSize.height(), st::mvIconSize.width(), st::mvIconSize.height(), width());
@@ -291,7 +292,7 @@ void MediaView::updateDropdown() {
 	_btnToMessage->setVisible(_msgid > 0);
 	_btnShowInFolder->setVisible(_doc && !_doc->already(true).isEmpty());
 	_btnSaveAs->setVisible(true);
-	_btnCopy->setVisible((_doc && !_current.isNull()) || (_photo && _photo->full->loaded()));
+	_btnCopy->setVisible((_doc && !_current.isNull()) || (_photo && _photo->full->downloaded()));
 	_btnForward->setVisible(_msgid > 0);
 	_btnDelete->setVisible(_msgid > 0 || (App::self() && App::self()->photoId == _photo->id) || (_photo->chat && _photo->chat->photoId == _photo->id));
 	_btnViewAll->setVisible((_overview != OverviewCount) && _history);
@@ -635,6 +636,7 @@ void MediaView::showPhoto(PhotoData *photo, HistoryItem *context) {
 
 	_index = -1;
 	_msgid = context ? context->id : 0;
+	_navigated = 0;
 	_photo = photo;
 	if (_history) {
 		_overview = OverviewPhotos;
@@ -662,6 +664,7 @@ void MediaView::showPhoto(PhotoData *photo, PeerData *context) {
 
 	_msgid = 0;
 	_index = -1;
+	_navigated = 0;
 	_photo = photo;
 	_overview = OverviewCount;
 	if (_user) {
@@ -703,6 +706,7 @@ void MediaView::showDocument(DocumentData *doc, HistoryItem *context) {
 
 	_index = -1;
 	_msgid = context ? context->id : 0;
+	_navigated = 0;
 	if (_history) {
 		_overview = OverviewDocuments;
 
@@ -733,19 +737,12 @@ void MediaView::displayPhoto(PhotoData *photo) {
 	_current = QPixmap();
 	_currentGif.stop();
 	_down = OverNone;
-	_w = convertScale(photo->full->width());
-	_h = convertScale(photo->full->height());
 	if (isHidden()) {
 		moveToScreen();
 	}
-	if (_w > width()) {
-		_h = qRound(_h * width() / float64(_w));
-		_w = width();
-	}
-	if (_h > height()) {
-		_w = qRound(_w * height() / float64(_h));
-		_h = height();
-	}
+	QSize fit(photoFitSize(photo));
+	_w = fit.width();
+	_h = fit.height();
 	_x = (width() - _w) / 2;
 	_y = (height() - _h) / 2;
 	_width = _w;
@@ -771,10 +768,52 @@ void MediaView::displayPhoto(PhotoData *photo) {
 	}
 }
 
+QSize MediaView::photoFitSize(PhotoData *photo) const {
+	int32 w = convertScale(photo->full->width()), h = convertScale(photo->full->height());
+	if (w > width()) {
+		h = qRound(h * width() / float64(w));
+		w = width();
+	}
+	if (h > height()) {
+		w = qRound(w * height() / float64(h));
+		h = height();
+	}
+	return QSize(w, h);
+}
+
+PhotoData *MediaView::photoAt(int32 index) const {
+	if (_history && _overview != OverviewCount) {
+		if (index < 0 || index >= _history->_overview[_overview].size()) return 0;
+
+		HistoryItem *item = App::histItemById(_history->_overview[_overview][index]);
+		HistoryMedia *media = item ? item->getMedia() : 0;
+		return (media && media->type() == MediaTypePhoto) ? static_cast<HistoryPhoto*>(media)->photo() : 0;
+	} else if (_user) {
+		return (index >= 0 && index < _user->photos.size()) ? _user->photos[index] : 0;
+	}
+	return 0;
+}
+
+void MediaView::predecodePhoto(PhotoData *photo) {
+	if (!photo || !photo->full->width()) return;
+
+	int32 w = photoFitSize(photo).width() * cIntRetinaFactor();
+	_decoder.pix(photo, w, int((photo->full->height() * (qreal(w) / qreal(photo->full->width()))) + 0.9999));
+}
+
+void MediaView::onPhotoDecoded(PhotoData *photo) {
+	if (photo == _photo && _full <= 0) {
+		update(_x, _y, _w, _h);
+	}
+}
+
 void MediaView::displayDocument(DocumentData *doc, HistoryItem *item) {
 	_doc = doc;
 
 	QString already = _doc->already(true);
+	if (_doc->type == StickerDocument && _doc->sticker->isNull() && !_doc->data.isEmpty()) { // in-place stickers are drawn from the decoder cache
+		_doc->sticker = ImagePtr(_doc->data);
+	}
 	if (!_doc->sticker->isNull() && _doc->sticker->loaded()) {
 		_currentGif.stop();
 		_current = _doc->sticker->pix();
@@ -959,10 +998,12 @@ void MediaView::paintEvent(QPaintEvent *e) {
 	// photo
 	if (_photo) {
 		int32 w = _width * cIntRetinaFactor();
-		if (_full <= 0 && _photo->full->loaded()) {
-			int32 h = int((_photo->full->height() * (qreal(w) / qreal(_photo->full->width()))) + 0.9999);
-			_current = _photo->full->pixNoCache(w, h, true);
-			if (cRetina()) _current.setDevicePixelRatio(cRetinaFactor());
+		const QPixmap *decoded = 0;
+		if (_full <= 0 && _photo->full->width()) { // full photo is decoded and scaled in background, see predecodePhoto()
+			decoded = _decoder.pix(_photo, w, int((_photo->full->height() * (qreal(w) / qreal(_photo->full->width()))) + 0.9999));
+		}
+		if (decoded) {
+			_current = *decoded;
 			_full = 1;
 		} else if (_full < 0 && _photo->medium->loaded()) {
 			int32 h = int((_photo->full->height() * (qreal(w) / qreal(_photo->full->width()))) + 0.9999);
@@ -1327,6 +1368,8 @@ void MediaView::keyPressEvent(QKeyEvent *e) {
 void MediaView::moveToNext(int32 delta) {
 	if (_index < 0 || (!_photo && !_doc) || (_overview == OverviewCount && !_user)) return;
 
+	_navigated = ((_navigated > 0) == (delta > 0)) ? (_navigated + delta) : delta;
+
 	int32 newIndex = _index + delta;
 	if (_history && _overview != OverviewCount) {
 		if (newIndex >= 0 && newIndex < _history->_overview[_overview].size()) {
@@ -1358,6 +1401,21 @@ void MediaView::moveToNext(int32 delta) {
 void MediaView::preloadData(int32 delta) {
 	if (_index < 0 || (!_user && _overview == OverviewCount)) return;
 
+	// predecode in the direction the user keeps flipping, both neighbours when it is not clear yet
+	_decoder.cancelPending();
+	if (_photo) predecodePhoto(_photo);
+	int32 direction = (_navigated > 1) ? 1 : ((_navigated < -1) ? -1 : 0);
+	if (direction) {
+		for (int32 i = 1; i <= MediaViewPredecodeAhead; ++i) {
+			predecodePhoto(photoAt(_index + direction * i));
+		}
+		predecodePhoto(photoAt(_index - direction));
+	} else {
+		predecodePhoto(photoAt(_index + (_navigated < 0 ? -1 : 1)));
+		predecodePhoto(photoAt(_index + (_navigated < 0 ? 1 : -1)));
+	}
+
+	if (direction && !delta) delta = direction;
 	int32 from = _index + (delta ? delta : -1), to = _index + (delta ? delta * MediaOverviewPreloadCount : 1), forget = _index - delta * 2;
 	if (from > to) qSwap(from, to);
 	if (_history && _overview != OverviewCount) {
@@ -1725,6 +1783,7 @@ bool MediaView::event(QEvent *e) {
 }
 
 void MediaView::hide() {
+	_decoder.clear();
 	_controlsHideTimer.stop();
 	_controlsState = ControlsShown;
 	a_cOpacity = anim::fvalue(1, 1);
@@ -18,6 +18,7 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 #pragma once
 
 #include "dropdown.h"
+#include "localimageloader.h"
 
 class MediaView : public TWidget, public RPCSender, public Animated {
 	Q_OBJECT
@@ -96,10 +97,14 @@ public slots:
 
 	void updateImage();
 	void onGifUpdated();
+	void onPhotoDecoded(PhotoData *photo);
 
 private:
 
 	void displayPhoto(PhotoData *photo);
+	QSize photoFitSize(PhotoData *photo) const;
+	PhotoData *photoAt(int32 index) const;
+	void predecodePhoto(PhotoData *photo);
 	void displayDocument(DocumentData *doc, HistoryItem *item);
 	void findCurrent();
 	void loadBack();
@@ -156,6 +161,9 @@ private:
 
 	int32 _index; // index in photos or files array, -1 if just photo
 	MsgId _msgid; // msgId of current photo or file
+	int32 _navigated; // how many times in a row user moved to next (> 0) or previous (< 0) photo or file
+
+	PhotoDecoder _decoder;
 
 	mtpRequestId _loadRequest;
 
@@ -25,30 +25,105 @@ namespace {
 	Sessions sessions;
 	MTProtoSessionPtr mainSession;
 
-	typedef QMap<mtpRequestId, int32> RequestsByDC; // holds dc for request to this dc or -dc for request to main dc
+	// request ids are sequential, so consecutive requests land in different shards
+	// and the gui thread and the connection threads rarely wait for the same lock
+	template <typename T>
+	class RequestTable {
+	public:
+
+		bool find(mtpRequestId requestId, T &result) const {
+			const Shard &s(shard(requestId));
+			QMutexLocker lock(&s.lock);
+			typename Map::const_iterator i = s.map.constFind(requestId);
+			if (i == s.map.cend()) return false;
+
+			result = i.value();
+			return true;
+		}
+
+		bool contains(mtpRequestId requestId) const {
+			const Shard &s(shard(requestId));
+			QMutexLocker lock(&s.lock);
+			return s.map.contains(requestId);
+		}
+
+		void insert(mtpRequestId requestId, const T &value) {
+			Shard &s(shard(requestId));
+			QMutexLocker lock(&s.lock);
+			s.map.insert(requestId, value);
+		}
+
+		bool replace(mtpRequestId requestId, const T &was, const T &value) { // fails if the value was changed since it was found
+			Shard &s(shard(requestId));
+			QMutexLocker lock(&s.lock);
+			typename Map::iterator i = s.map.find(requestId);
+			if (i == s.map.end() || !(i.value() == was)) return false;
+
+			i.value() = value;
+			return true;
+		}
+
+		bool take(mtpRequestId requestId, T &result) {
+			Shard &s(shard(requestId));
+			QMutexLocker lock(&s.lock);
+			typename Map::iterator i = s.map.find(requestId);
+			if (i == s.map.end()) return false;
+
+			result = i.value();
+			s.map.erase(i);
+			return true;
+		}
+
+		bool remove(mtpRequestId requestId) {
+			Shard &s(shard(requestId));
+			QMutexLocker lock(&s.lock);
+			return s.map.remove(requestId) > 0;
+		}
+
+	private:
+
+		typedef QHash<mtpRequestId, T> Map;
+		struct Shard {
+			mutable QMutex lock;
+			Map map;
+		};
+
+		enum {
+			ShardsCount = 32,
+		};
+		Shard _shards[ShardsCount];
+
+		Shard &shard(mtpRequestId requestId) {
+			return _shards[uint32(requestId) % ShardsCount];
+		}
+		const Shard &shard(mtpRequestId requestId) const {
+			return _shards[uint32(requestId) % ShardsCount];
+		}
+
+	};
+
+	typedef RequestTable<int32> RequestsByDC; // holds dc for request to this dc or -dc for request to main dc
 	RequestsByDC requestsByDC;
-	QMutex requestByDCLock;
 
 	typedef QMap<mtpRequestId, int32> AuthExportRequests; // holds target dc for auth export request
 	AuthExportRequests authExportRequests;
+	QMutex authExportLock(QMutex::Recursive); // guards authExportRequests and authWaiters, MTP::send() may call exportFail() right away
 
 	bool _started = false;
 
 	uint32 layer;
 	
-	typedef QMap<mtpRequestId, RPCResponseHandler> ParserMap;
+	typedef RequestTable<RPCResponseHandler> ParserMap;
 	ParserMap parserMap;
-	QMutex parserMapLock;
 
-	typedef QMap<mtpRequestId, mtpRequest> RequestMap;
+	typedef RequestTable<mtpRequest> RequestMap;
 	RequestMap requestMap;
-	QReadWriteLock requestMapLock;
 
 	typedef QPair<mtpRequestId, uint64> DelayedRequest;
 	typedef QList<DelayedRequest> DelayedRequestsList;
 	DelayedRequestsList delayedRequests;
 
-	typedef QMap<mtpRequestId, int32> RequestsDelays;
+	typedef RequestTable<int32> RequestsDelays;
 	RequestsDelays requestsDelays;
 
 	typedef QSet<mtpRequestId> BadGuestDCRequests;
@@ -67,45 +142,44 @@ namespace {
 	_mtp_internal::RequestResender *resender = 0;
 
 	void importDone(const MTPauth_Authorization &result, mtpRequestId req) {
-		QMutexLocker locker1(&requestByDCLock);
-
-		RequestsByDC::iterator i = requestsByDC.find(req);
-		if (i == requestsByDC.end()) {
+		int32 newdc = 0;
+		if (!requestsByDC.find(req, newdc)) {
 			LOG(("MTP Error: auth import request not found in requestsByDC, requestId: %1").arg(req));
 			RPCError error(rpcClientError("AUTH_IMPORT_FAIL", QString("did not find import request in requestsByDC, request %1").arg(req)));
 			if (globalHandler.onFail && MTP::authedId()) (*globalHandler.onFail)(req, error); // auth failed in main dc
 			return;
 		}
-		int32 newdc = i.value();
 
 		DEBUG_LOG(("MTP Info: auth import to dc %1 succeeded").arg(newdc));
 
+		QMutexLocker lock(&authExportLock);
 		DCAuthWaiters &waiters(authWaiters[newdc]);
 		MTProtoSessionPtr session(_mtp_internal::getSession(newdc));
 		if (waiters.size()) {
-			QReadLocker locker(&requestMapLock);
 			for (DCAuthWaiters::iterator i = waiters.begin(), e = waiters.end(); i != e; ++i) {
 				mtpRequestId requestId = *i;
-				RequestMap::const_iterator j = requestMap.constFind(requestId);
-				if (j == requestMap.cend()) {
+				mtpRequest request;
+				if (!requestMap.find(requestId, request)) {
 					LOG(("MTP Error: could not find request %1 for resending").arg(requestId));
 					continue;
 				}
 				{
-					RequestsByDC::iterator k = requestsByDC.find(requestId);
-					if (k == requestsByDC.cend()) {
+					int32 dc = 0;
+					if (!requestsByDC.find(requestId, dc)) {
 						LOG(("MTP Error: could not find request %1 by dc for resending").arg(requestId));
 						continue;
 					}
-					if (k.value() < 0) {
+					int32 newDC = (dc < 0) ? -newdc : (dc - (dc % _mtp_internal::dcShift) + newdc);
+					if (!requestsByDC.replace(requestId, dc, newDC)) {
+						LOG(("MTP Error: request %1 was moved or finished while resending after import auth").arg(requestId));
+						continue;
+					}
+					if (dc < 0) {
 						MTP::setdc(newdc);
-						k.value() = -newdc;
-					} else {
-						k.value() = k.value() - (k.value() % _mtp_internal::dcShift) + newdc;
 					}
-					DEBUG_LOG(("MTP Info: resending request %1 to dc %2 after import auth").arg(requestId).arg(k.value()));
+					DEBUG_LOG(("MTP Info: resending request %1 to dc %2 after import auth").arg(requestId).arg(newDC));
 				}
-				session->sendPrepared(j.value());
+				session->sendPrepared(request);
 			}
 			waiters.clear();
 		}
@@ -119,8 +193,12 @@ namespace {
 	}
 
 	void exportDone(const MTPauth_ExportedAuthorization &result, mtpRequestId req) {
-		AuthExportRequests::const_iterator i = authExportRequests.constFind(req);
-		if (i == authExportRequests.cend()) {
+		int32 newdc = 0;
+		{
+			QMutexLocker lock(&authExportLock);
+			newdc = authExportRequests.take(req);
+		}
+		if (!newdc) {
 			LOG(("MTP Error: auth export request target dc not found, requestId: %1").arg(req));
 			RPCError error(rpcClientError("AUTH_IMPORT_FAIL", QString("did not find target dc, request %1").arg(req)));
 			if (globalHandler.onFail && MTP::authedId()) (*globalHandler.onFail)(req, error); // auth failed in main dc
@@ -128,16 +206,18 @@ namespace {
 		}
 
 		const MTPDauth_exportedAuthorization &data(result.c_auth_exportedAuthorization());
-		MTP::send(MTPauth_ImportAuthorization(data.vid, data.vbytes), rpcDone(importDone), rpcFail(importFail), i.value());
-		authExportRequests.remove(req);
+		MTP::send(MTPauth_ImportAuthorization(data.vid, data.vbytes), rpcDone(importDone), rpcFail(importFail), newdc);
 	}
 
 	bool exportFail(const RPCError &error, mtpRequestId req) {
 		if (error.type().startsWith(qsl("FLOOD_WAIT_"))) return false;
 
-		AuthExportRequests::const_iterator i = authExportRequests.constFind(req);
-		if (i != authExportRequests.cend()) {
-			authWaiters[i.value()].clear();
+		{
+			QMutexLocker lock(&authExportLock);
+			AuthExportRequests::const_iterator i = authExportRequests.constFind(req);
+			if (i != authExportRequests.cend()) {
+				authWaiters[i.value()].clear();
+			}
 		}
 		if (globalHandler.onFail && MTP::authedId()) (*globalHandler.onFail)(req, error); // auth failed in main dc
 		return true;
@@ -152,19 +232,14 @@ namespace {
 			if (!requestId) return false;
 
 			int32 dc = 0, newdc = m.captured(2).toInt();
-			{
-				QMutexLocker locker(&requestByDCLock);
-				RequestsByDC::iterator i = requestsByDC.find(requestId);
-				if (i == requestsByDC.end()) {
-					LOG(("MTP Error: could not find request %1 for migrating to %2").arg(requestId).arg(newdc));
-				} else {
-					dc = i.value();
-				}
+			if (!requestsByDC.find(requestId, dc)) {
+				LOG(("MTP Error: could not find request %1 for migrating to %2").arg(requestId).arg(newdc));
 			}
 			if (!dc || !newdc) return false;
 
 			DEBUG_LOG(("MTP Info: changing request %1 dc%2 to %3").arg(requestId).arg((dc > 0) ? "" : " and main dc").arg(newdc));
 			if (dc < 0) {
+				QMutexLocker lock(&authExportLock);
 				if (MTP::authedId() && !authExportRequests.contains(requestId)) { // import auth, set dc and resend
 					DEBUG_LOG(("MTP Info: importing auth to dc %1").arg(newdc));
 					DCAuthWaiters &waiters(authWaiters[newdc]);
@@ -179,14 +254,9 @@ namespace {
 			}
 
 			mtpRequest req;
-			{
-				QReadLocker locker(&requestMapLock);
-				RequestMap::const_iterator i = requestMap.constFind(requestId);
-				if (i == requestMap.cend()) {
-					LOG(("MTP Error: could not find request %1").arg(requestId));
-					return false;
-				}
-				req = i.value();
+			if (!requestMap.find(requestId, req)) {
+				LOG(("MTP Error: could not find request %1").arg(requestId));
+				return false;
 			}
 			_mtp_internal::registerRequest(requestId, (dc < 0) ? -newdc : newdc);
 			_mtp_internal::getSession(newdc)->sendPrepared(req);
@@ -196,9 +266,10 @@ namespace {
 			
 			int32 secs = 1;
 			if (code < 0 || code >= 500) {
-				RequestsDelays::iterator i = requestsDelays.find(requestId);
-				if (i != requestsDelays.cend()) {
-					secs = (i.value() > 60) ? i.value() : (i.value() *= 2);
+				int32 delay = 0;
+				if (requestsDelays.find(requestId, delay)) {
+					secs = (delay > 60) ? delay : (delay * 2);
+					if (secs != delay) requestsDelays.insert(requestId, secs);
 				} else {
 					requestsDelays.insert(requestId, secs);
 				}
@@ -219,14 +290,8 @@ namespace {
 			return true;
 		} else if (code == 401 || (badGuestDC && badGuestDCRequests.constFind(requestId) == badGuestDCRequests.cend())) {
 			int32 dc = 0;
-			{
-				QMutexLocker locker(&requestByDCLock);
-				RequestsByDC::iterator i = requestsByDC.find(requestId);
-				if (i != requestsByDC.end()) {
-					dc = i.value();
-				} else {
-					LOG(("MTP Error: unauthorized request without dc info, requestId %1").arg(requestId));
-				}
+			if (!requestsByDC.find(requestId, dc)) {
+				LOG(("MTP Error: unauthorized request without dc info, requestId %1").arg(requestId));
 			}
 			int32 newdc = abs(dc) % _mtp_internal::dcShift;
 			if (!newdc || newdc == mtpMainDC() || !MTP::authedId()) {
@@ -235,6 +300,7 @@ namespace {
 			}
 
 			DEBUG_LOG(("MTP Info: importing auth to dc %1").arg(dc));
+			QMutexLocker lock(&authExportLock);
 			DCAuthWaiters &waiters(authWaiters[newdc]);
 			if (!waiters.size()) {
 				authExportRequests.insert(MTP::send(MTPauth_ExportAuthorization(MTP_int(newdc)), rpcDone(exportDone), rpcFail(exportFail)), newdc);
@@ -244,24 +310,13 @@ namespace {
 			return true;
 		} else if (err == qsl("CONNECTION_NOT_INITED") || err == qsl("CONNECTION_LAYER_INVALID")) {
 			mtpRequest req;
-			{
-				QReadLocker locker(&requestMapLock);
-				RequestMap::const_iterator i = requestMap.constFind(requestId);
-				if (i == requestMap.cend()) {
-					LOG(("MTP Error: could not find request %1").arg(requestId));
-					return false;
-				}
-				req = i.value();
+			if (!requestMap.find(requestId, req)) {
+				LOG(("MTP Error: could not find request %1").arg(requestId));
+				return false;
 			}
 			int32 dc = 0;
-			{
-				QMutexLocker locker(&requestByDCLock);
-				RequestsByDC::iterator i = requestsByDC.find(requestId);
-				if (i == requestsByDC.end()) {
-					LOG(("MTP Error: could not find request %1 for resending with init connection").arg(requestId));
-				} else {
-					dc = i.value();
-				}
+			if (!requestsByDC.find(requestId, dc)) {
+				LOG(("MTP Error: could not find request %1 for resending with init connection").arg(requestId));
 			}
 			if (!dc) return false;
 
@@ -270,33 +325,22 @@ namespace {
 			return true;
 		} else if (err == qsl("MSG_WAIT_FAILED")) {
 			mtpRequest req;
-			{
-				QReadLocker locker(&requestMapLock);
-				RequestMap::const_iterator i = requestMap.constFind(requestId);
-				if (i == requestMap.cend()) {
-					LOG(("MTP Error: could not find request %1").arg(requestId));
-					return false;
-				}
-				req = i.value();
+			if (!requestMap.find(requestId, req)) {
+				LOG(("MTP Error: could not find request %1").arg(requestId));
+				return false;
 			}
 			if (!req->after) {
 				LOG(("MTP Error: wait failed for not dependent request %1").arg(requestId));
 				return false;
 			}
-			int32 dc = 0;
-			{
-				QMutexLocker locker(&requestByDCLock);
-				RequestsByDC::iterator i = requestsByDC.find(requestId), j = requestsByDC.find(req->after->requestId);
-				if (i == requestsByDC.end()) {
-					LOG(("MTP Error: could not find request %1 by dc").arg(requestId));
-				} else if (j == requestsByDC.end()) {
-					LOG(("MTP Error: could not find dependent request %1 by dc").arg(req->after->requestId));
-				} else {
-					dc = i.value();
-					if (i.value() != j.value()) {
-						req->after = mtpRequest();
-					}
-				}
+			int32 dc = 0, afterDC = 0;
+			if (!requestsByDC.find(requestId, dc)) {
+				LOG(("MTP Error: could not find request %1 by dc").arg(requestId));
+			} else if (!requestsByDC.find(req->after->requestId, afterDC)) {
+				LOG(("MTP Error: could not find dependent request %1 by dc").arg(req->after->requestId));
+				dc = 0;
+			} else if (dc != afterDC) {
+				req->after = mtpRequest();
 			}
 			if (!dc) return false;
 
@@ -305,6 +349,7 @@ namespace {
 				_mtp_internal::getSession(dc < 0 ? (-dc) : dc)->sendPrepared(req);
 			} else {
 				int32 newdc = abs(dc) % _mtp_internal::dcShift;
+				QMutexLocker lock(&authExportLock);
 				DCAuthWaiters &waiters(authWaiters[newdc]);
 				if (waiters.indexOf(req->after->requestId) >= 0) {
 					if (waiters.indexOf(requestId) < 0) {
@@ -356,22 +401,13 @@ namespace _mtp_internal {
 	}
 	
 	void registerRequest(mtpRequestId requestId, int32 dc) {
-		{
-			QMutexLocker locker(&requestByDCLock);
-			requestsByDC.insert(requestId, dc);
-		}
+		requestsByDC.insert(requestId, dc);
 		_mtp_internal::performDelayedClear(); // need to do it somewhere..
 	}
 
 	void unregisterRequest(mtpRequestId requestId) {
 		requestsDelays.remove(requestId);
-
-		{
-			QWriteLocker locker(&requestMapLock);
-			requestMap.remove(requestId);
-		}
-
-		QMutexLocker locker(&requestByDCLock);
+		requestMap.remove(requestId);
 		requestsByDC.remove(requestId);
 	}
 
@@ -379,24 +415,15 @@ namespace _mtp_internal {
 		mtpRequestId res = reqid();
 		request->requestId = res;
 		if (parser.onDone || parser.onFail) {
-			QMutexLocker locker(&parserMapLock);
 			parserMap.insert(res, parser);
 		}
-		{
-			QWriteLocker locker(&requestMapLock);
-			requestMap.insert(res, request);
-		}
+		requestMap.insert(res, request);
 		return res;
 	}
 
 	mtpRequest getRequest(mtpRequestId reqId) {
-		static mtpRequest zero;
 		mtpRequest req;
-		{
-			QReadLocker locker(&requestMapLock);
-			RequestMap::const_iterator i = requestMap.constFind(reqId);
-			req = (i == requestMap.cend()) ? zero : i.value();
-		}
+		requestMap.find(reqId, req);
 		return req;
 	}
 
@@ -425,17 +452,7 @@ namespace _mtp_internal {
 
 	void clearCallbacks(mtpRequestId requestId, int32 errorCode) {
 		RPCResponseHandler h;
-		bool found = false;
-		{
-			QMutexLocker locker(&parserMapLock);
-			ParserMap::iterator i = parserMap.find(requestId);
-			if (i != parserMap.end()) {
-				h = i.value();
-				found = true;
-
-				parserMap.erase(i);
-			}
-		}
+		bool found = parserMap.take(requestId, h);
 		if (errorCode && found) {
 			rpcErrorOccured(requestId, h, rpcClientError("CLEAR_CALLBACK", QString("did not handle request %1, error code %2").arg(requestId).arg(errorCode)));
 		}
@@ -467,11 +484,8 @@ namespace _mtp_internal {
 		QMutexLocker lock(&toClearLock);
 		if (!toClear.isEmpty()) {
 			for (RPCCallbackClears::iterator i = toClear.begin(), e = toClear.end(); i != e; ++i) {
-				if (cDebug()) {
-					QMutexLocker locker(&parserMapLock);
-					if (parserMap.find(i->requestId) != parserMap.end()) {
-						DEBUG_LOG(("RPC Info: clearing delayed callback %1, error code %2").arg(i->requestId).arg(i->errorCode));
-					}
+				if (cDebug() && parserMap.contains(i->requestId)) {
+					DEBUG_LOG(("RPC Info: clearing delayed callback %1, error code %2").arg(i->requestId).arg(i->errorCode));
 				}
 				clearCallbacks(i->requestId, i->errorCode);
 				_mtp_internal::unregisterRequest(i->requestId);
@@ -482,15 +496,8 @@ namespace _mtp_internal {
 
 	void execCallback(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) {
 		RPCResponseHandler h;
-		{
-			QMutexLocker locker(&parserMapLock);
-			ParserMap::iterator i = parserMap.find(requestId);
-			if (i != parserMap.cend()) {
-				h = i.value();
-				parserMap.erase(i);
-
-				DEBUG_LOG(("RPC Info: found parser for request %1, trying to parse response..").arg(requestId));
-			}
+		if (parserMap.take(requestId, h)) {
+			DEBUG_LOG(("RPC Info: found parser for request %1, trying to parse response..").arg(requestId));
 		}
 		if (h.onDone || h.onFail) {
 			try {
@@ -500,7 +507,6 @@ namespace _mtp_internal {
 					RPCError err(MTPRpcError(from, end));
 					DEBUG_LOG(("RPC Info: error received, code %1, type %2, description: %3").arg(err.code()).arg(err.type()).arg(err.description()));
 					if (!rpcErrorOccured(requestId, h, err)) {
-						QMutexLocker locker(&parserMapLock);
 						parserMap.insert(requestId, h);
 						return;
 					}
@@ -509,7 +515,6 @@ namespace _mtp_internal {
 				}
 			} catch (Exception &e) {
 				if (!rpcErrorOccured(requestId, h, rpcClientError("RESPONSE_PARSE_FAILED", QString("exception text: ") + e.what()))) {
-					QMutexLocker locker(&parserMapLock);
 					parserMap.insert(requestId, h);
 					return;
 				}
@@ -521,9 +526,7 @@ namespace _mtp_internal {
 	}
 
 	bool hasCallbacks(mtpRequestId requestId) {
-		QMutexLocker locker(&parserMapLock);
-		ParserMap::iterator i = parserMap.find(requestId);
-		return (i != parserMap.cend());
+		return parserMap.contains(requestId);
 	}
 
 	void globalCallback(const mtpPrime *from, const mtpPrime *end) {
@@ -562,26 +565,15 @@ namespace _mtp_internal {
 			delayedRequests.pop_front();
 
 			int32 dc = 0;
-			{
-				QMutexLocker locker(&requestByDCLock);
-				RequestsByDC::const_iterator i = requestsByDC.constFind(requestId);
-				if (i != requestsByDC.cend()) {
-					dc = i.value();
-				} else {
-					LOG(("MTP Error: could not find request dc for delayed resend, requestId %1").arg(requestId));
-					continue;
-				}
+			if (!requestsByDC.find(requestId, dc)) {
+				LOG(("MTP Error: could not find request dc for delayed resend, requestId %1").arg(requestId));
+				continue;
 			}
 
 			mtpRequest req;
-			{
-				QReadLocker locker(&requestMapLock);
-				RequestMap::const_iterator j = requestMap.constFind(requestId);
-				if (j == requestMap.cend()) {
-					DEBUG_LOG(("MTP Error: could not find request %1").arg(requestId));
-					continue;
-				}
-				req = j.value();
+			if (!requestMap.find(requestId, req)) {
+				DEBUG_LOG(("MTP Error: could not find request %1").arg(requestId));
+				continue;
 			}
 			_mtp_internal::getSession(dc < 0 ? (-dc) : dc)->sendPrepared(req);
 		}
@@ -679,6 +671,35 @@ namespace MTP {
 		return QString();
 	}
 
+	MTPSessionStats sessionstats(int32 dc) {
+		if (!_started) return MTPSessionStats();
+
+		if (!dc) return mainSession->stats();
+		if (!(dc % _mtp_internal::dcShift)) {
+			dc += mainSession->getDC();
+		}
+
+		Sessions::const_iterator i = sessions.constFind(dc);
+		if (i != sessions.cend()) return (*i)->stats();
+
+		return MTPSessionStats();
+	}
+
+	MTPSessionStats dcstats(int32 dc) {
+		if (!_started) return MTPSessionStats();
+
+		if (!dc) dc = mainSession->getDC();
+		dc %= _mtp_internal::dcShift;
+
+		MTPSessionStats result;
+		for (Sessions::const_iterator i = sessions.cbegin(), e = sessions.cend(); i != e; ++i) {
+			if ((*i)->getDC() % _mtp_internal::dcShift == dc) {
+				result.add((*i)->stats());
+			}
+		}
+		return result;
+	}
+
 	void initdc(int32 dc) {
 		if (!_started) return;
 		_mtp_internal::getSession(dc);
@@ -695,19 +716,15 @@ namespace MTP {
 		mtpMsgId msgId = 0;
 		requestsDelays.remove(requestId);
 		{
-			QWriteLocker locker(&requestMapLock);
-			RequestMap::iterator i = requestMap.find(requestId);
-			if (i != requestMap.end()) {
-				msgId = *(mtpMsgId*)(i.value()->constData() + 4);
-				requestMap.erase(i);
+			mtpRequest request;
+			if (requestMap.take(requestId, request)) {
+				msgId = *(mtpMsgId*)(request->constData() + 4);
 			}
 		}
 		{
-			QMutexLocker locker(&requestByDCLock);
-			RequestsByDC::iterator i = requestsByDC.find(requestId);
-			if (i != requestsByDC.end()) {
-				_mtp_internal::getSession(abs(i.value()))->cancel(requestId, msgId);
-				requestsByDC.erase(i);
+			int32 dc = 0;
+			if (requestsByDC.take(requestId, dc)) {
+				_mtp_internal::getSession(abs(dc))->cancel(requestId, msgId);
 			}
 		}
 		_mtp_internal::clearCallbacks(requestId);
@@ -740,10 +757,9 @@ namespace MTP {
 
 	int32 state(mtpRequestId requestId) {
 		if (requestId > 0) {
-			QMutexLocker locker(&requestByDCLock);
-			RequestsByDC::iterator i = requestsByDC.find(requestId);
-			if (i != requestsByDC.end()) {
-				return _mtp_internal::getSession(abs(i.value()))->requestState(requestId);
+			int32 dc = 0;
+			if (requestsByDC.find(requestId, dc)) {
+				return _mtp_internal::getSession(abs(dc))->requestState(requestId);
 			}
 			return MTP::RequestSent;
 		}
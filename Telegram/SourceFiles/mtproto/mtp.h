@@ -89,6 +89,8 @@ namespace MTP {
 
 	int32 dcstate(int32 dc = 0);
 	QString dctransport(int32 dc = 0);
+	MTPSessionStats sessionstats(int32 dc = 0); // one session, dc like in dcstate()
+	MTPSessionStats dcstats(int32 dc = 0); // all sessions (main, download, upload) to the dc, 0 - main dc
 	void initdc(int32 dc);
 	template <typename TRequest>
 	inline mtpRequestId send(const TRequest &request, RPCResponseHandler callbacks = RPCResponseHandler(), int32 dc = 0, uint64 msCanWait = 0, mtpRequestId after = 0) {
@@ -101,6 +103,13 @@ namespace MTP {
 	inline mtpRequestId send(const TRequest &request, RPCDoneHandlerPtr onDone, RPCFailHandlerPtr onFail = RPCFailHandlerPtr(), int32 dc = 0, uint64 msCanWait = 0, mtpRequestId after = 0) {
 		return send(request, RPCResponseHandler(onDone, onFail), dc, msCanWait, after);
 	}
+	template <typename TRequest> // background requests like read receipts or typing, coalesced with other requests for a short rtt based time
+	inline mtpRequestId sendBatched(const TRequest &request, RPCDoneHandlerPtr onDone, RPCFailHandlerPtr onFail = RPCFailHandlerPtr(), int32 dc = 0) {
+		MTProtoSessionPtr session = _mtp_internal::getSession(dc);
+		if (!session) return 0;
+
+		return session->send(request, RPCResponseHandler(onDone, onFail), 0, true, !dc, 0, true);
+	}
 	void ping();
 	void cancel(mtpRequestId req);
 	void killSession(int32 dc);
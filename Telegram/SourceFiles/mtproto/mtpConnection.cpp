@@ -246,6 +246,31 @@ namespace {
 		BN_CTX *ctx;
 	};
 
+	typedef QSet<QByteArray> CheckedPrimes; // dh_prime bytes with g byte appended
+	CheckedPrimes gCheckedPrimes;
+	QMutex gCheckedPrimesMutex; // connections of all dcs create keys in their own threads
+
+	// primality check is the heaviest part of the key creation and the server
+	// sends the same dh_prime for all dcs and all download / upload sessions
+	bool isGoodPrimeCached(const string &dhPrime, int32 g) {
+		QByteArray key(dhPrime.data(), dhPrime.size());
+		key.append(char(g));
+		{
+			QMutexLocker lock(&gCheckedPrimesMutex);
+			if (gCheckedPrimes.contains(key)) return true;
+		}
+
+		// check that dhPrime and (dhPrime - 1) / 2 are really prime using openssl BIGNUM methods
+		_BigNumPrimeTest bnPrimeTest;
+		if (!bnPrimeTest.isPrimeAndGood(&dhPrime[0], MTPMillerRabinIterCount, g)) {
+			return false;
+		}
+
+		QMutexLocker lock(&gCheckedPrimesMutex);
+		gCheckedPrimes.insert(key);
+		return true;
+	}
+
 	typedef QMap<uint64, mtpPublicRSA> PublicRSAKeys;
 	PublicRSAKeys gPublicRSA;
 
@@ -402,7 +427,7 @@ namespace {
 		return mayBeBadKey;
 	}
 
-	mtpBuffer _handleTcpResponse(mtpPrime *packet, uint32 size) {
+	mtpBuffer _handleTcpResponse(MTPabstractConnection *conn, mtpPrime *packet, uint32 size) {
 		if (size < 4 || size * sizeof(mtpPrime) > MTPPacketSizeMax) {
 			LOG(("TCP Error: bad packet size %1").arg(size * sizeof(mtpPrime)));
 			return mtpBuffer(1, -500);
@@ -427,7 +452,7 @@ namespace {
 			return mtpBuffer(1, packet[2]);
 		}
 
-		mtpBuffer data(size - 3);
+		mtpBuffer data(conn->takeBuffer(size - 3));
 		memcpy(data.data(), packet + 2, (size - 3) * sizeof(mtpPrime));
 
 		return data;
@@ -519,6 +544,32 @@ namespace {
 
 }
 
+mtpBuffer MTPabstractConnection::takeBuffer(uint32 size) {
+	for (BuffersQueue::iterator i = freeBuffers.begin(), e = freeBuffers.end(); i != e; ++i) {
+		if (uint32(i->capacity()) >= size) {
+			mtpBuffer result;
+			result.swap(*i);
+			freeBuffers.erase(i);
+			result.resize(size);
+			return result;
+		}
+	}
+	mtpBuffer result;
+	result.reserve(size); // reserved capacity is not shrinked by resize() when reused
+	result.resize(size);
+	return result;
+}
+
+void MTPabstractConnection::recycle(mtpBuffer &buffer) {
+	if (!buffer.isDetached() || uint32(buffer.capacity()) > MTPShortBufferSize) return;
+
+	if (freeBuffers.size() >= MTPBufferPoolSize) {
+		freeBuffers.pop_front();
+	}
+	freeBuffers.push_back(mtpBuffer());
+	freeBuffers.back().swap(buffer);
+}
+
 MTPabstractTcpConnection::MTPabstractTcpConnection() :
 packetNum(0), packetRead(0), packetLeft(0), readingToShort(true), currentPos((char*)shortBuffer) {
 }
@@ -606,7 +657,7 @@ void MTPabstractTcpConnection::socketRead() {
 }
 
 MTPautoConnection::MTPautoConnection(QThread *thread) : status(WaitingBoth),
-tcpNonce(MTP::nonce<MTPint128>()), httpNonce(MTP::nonce<MTPint128>()), _tcpTimeout(MTPMinReceiveDelay) {
+tcpNonce(MTP::nonce<MTPint128>()), httpNonce(MTP::nonce<MTPint128>()), _preferHttp(false), _tcpTimeout(MTPMinReceiveDelay) {
 	moveToThread(thread);
 
 	manager.moveToThread(thread);
@@ -626,6 +677,16 @@ tcpNonce(MTP::nonce<MTPint128>()), httpNonce(MTP::nonce<MTPint128>()), _tcpTimeo
 	connect(&sock, SIGNAL(disconnected()), this, SLOT(onSocketDisconnected()));
 }
 
+void MTPautoConnection::disableHttp() {
+	if (status == WaitingBoth) {
+		status = WaitingTcp;
+	}
+}
+
+void MTPautoConnection::preferHttp() {
+	_preferHttp = true;
+}
+
 void MTPautoConnection::onHttpStart() {
 	if (status == HttpReady) {
 		DEBUG_LOG(("Connection Info: Http-transport chosen by timer"));
@@ -753,6 +814,8 @@ void MTPautoConnection::connectToServer(const QString &addr, int32 port) {
 	connect(&sock, SIGNAL(readyRead()), this, SLOT(socketRead()));
 	sock.connectToHost(QHostAddress(_addr), _port);
 
+	if (status == WaitingTcp) return; // http disabled
+
 	mtpBuffer buffer(_preparePQFake(httpNonce));
 
 	DEBUG_LOG(("Connection Info: sending fake req_pq through http transport"));
@@ -789,7 +852,7 @@ void MTPautoConnection::requestFinished(QNetworkReply *reply) {
 					if (res_pq_data.vnonce == httpNonce) {
 						if (status == WaitingBoth) {
 							status = HttpReady;
-							httpStartTimer.start(MTPTcpConnectionWaitTimeout);
+							httpStartTimer.start(_preferHttp ? 0 : MTPTcpConnectionWaitTimeout);
 						} else {
 							DEBUG_LOG(("Connection Info: Http-transport chosen by pq-response, awaited"));
 							status = UsingHttp;
@@ -827,7 +890,7 @@ void MTPautoConnection::requestFinished(QNetworkReply *reply) {
 void MTPautoConnection::socketPacket(mtpPrime *packet, uint32 size) {
 	if (status == FinishedWork) return;
 
-	mtpBuffer data = _handleTcpResponse(packet, size);
+	mtpBuffer data = _handleTcpResponse(this, packet, size);
 	if (data.size() == 1) {
 		if (status == WaitingBoth) {
 			status = WaitingHttp;
@@ -949,7 +1012,7 @@ void MTPtcpConnection::connectToServer(const QString &addr, int32 port) {
 }
 
 void MTPtcpConnection::socketPacket(mtpPrime *packet, uint32 size) {
-	mtpBuffer data = _handleTcpResponse(packet, size);
+	mtpBuffer data = _handleTcpResponse(this, packet, size);
 	if (data.size() == 1) {
 		bool mayBeBadKey = (data[0] == -404) && _sentEncrypted;
 		emit error(mayBeBadKey);
@@ -1097,8 +1160,10 @@ MTProtoConnectionPrivate::MTProtoConnectionPrivate(QThread *thread, MTProtoConne
     , _pingId(0)
 	, _pingIdToSend(0)
 	, _pingSendAt(0)
+	, _pingStartedAt(0)
     , _pingMsgId(0)
     , restarted(false)
+    , handlingPacket(0)
     , keyId(0)
     , sessionData(data)
     , myKeyLock(false)
@@ -1109,6 +1174,7 @@ MTProtoConnectionPrivate::MTProtoConnectionPrivate(QThread *thread, MTProtoConne
 	connCheckTimer.moveToThread(thread);
 	_pingSender.moveToThread(thread);
 	retryTimer.moveToThread(thread);
+	raceTimer.moveToThread(thread);
 	moveToThread(thread);
 
 //	createConn();
@@ -1131,6 +1197,7 @@ MTProtoConnectionPrivate::MTProtoConnectionPrivate(QThread *thread, MTProtoConne
 	connect(&connCheckTimer, SIGNAL(timeout()), this, SLOT(onBadConnection()));
 	connect(&oldConnectionTimer, SIGNAL(timeout()), this, SLOT(onOldConnection()));
 	connect(&_pingSender, SIGNAL(timeout()), this, SLOT(onPingSender()));
+	connect(&raceTimer, SIGNAL(timeout()), this, SLOT(onRaceNext()));
 	connect(sessionData->owner(), SIGNAL(authKeyCreated()), this, SLOT(updateAuthKey()), Qt::QueuedConnection);
 
 	connect(sessionData->owner(), SIGNAL(needToRestart()), this, SLOT(restartNow()), Qt::QueuedConnection);
@@ -1455,6 +1522,8 @@ void MTProtoConnectionPrivate::tryToSend() {
 
 		_pingId = _pingIdToSend;
 		_pingIdToSend = 0;
+		_pingStartedAt = pingRequest->msDate;
+		sessionData->statsPing();
 	} else {
 		if (prependOnly) {
 			DEBUG_LOG(("MTP Info: dc %1 not sending, waiting for Connected state, state: %2").arg(dc).arg(state));
@@ -1528,7 +1597,7 @@ void MTProtoConnectionPrivate::tryToSend() {
 		initSize = initSizeInInts * sizeof(mtpPrime);
 	}
 
-	bool needAnyResponse = false;
+	bool needAnyResponse = false, sendLater = false;
 	mtpRequest toSendRequest;
 	{
 		QWriteLocker locker1(sessionData->toSendMutex());
@@ -1536,7 +1605,25 @@ void MTProtoConnectionPrivate::tryToSend() {
 		mtpPreRequestMap toSendDummy, &toSend(prependOnly ? toSendDummy : sessionData->toSendMap());
 		if (prependOnly) locker1.unlock();
 
-		uint32 toSendCount = toSend.size();
+		// keep containers reasonably small, so that a lost packet costs less, the rest stays in toSend
+		// and is sent right after, so that cancel() and requestState() still see those requests
+		uint32 toSendTaken = 0, bytes = 0;
+		mtpPreRequestMap::iterator toSendEnd = toSend.begin();
+		for (mtpPreRequestMap::iterator e = toSend.end(); toSendEnd != e; ++toSendEnd, ++toSendTaken) {
+			bytes += mtpRequestData::messageSize(toSendEnd.value()) * sizeof(mtpPrime);
+			if (needsLayer && toSendEnd.value()->needsLayer) bytes += initSize;
+			if (bytes > MTPContainerSizeMax && toSendTaken > 0) {
+				sendLater = true;
+				break;
+			}
+		}
+		sessionData->statsRequests(toSendTaken);
+
+		uint32 toSendCount = toSendTaken;
+		if (!prependOnly) {
+			QReadLocker locker2(sessionData->haveSentMutex());
+			sessionData->statsQueues(toSend.size(), sessionData->haveSentMap().size());
+		}
 		if (pingRequest) ++toSendCount;
 		if (ackRequest) ++toSendCount;
 		if (resendRequest) ++toSendCount;
@@ -1549,7 +1636,7 @@ void MTProtoConnectionPrivate::tryToSend() {
 		if (toSendCount == 1 && first->msDate > 0) { // if can send without container
 			toSendRequest = first;
 			if (!prependOnly) {
-				toSend.clear();
+				if (toSendTaken) toSend.erase(toSend.begin());
 				locker1.unlock();
 			}
 
@@ -1604,7 +1691,7 @@ void MTProtoConnectionPrivate::tryToSend() {
 			if (resendRequest) containerSize += mtpRequestData::messageSize(resendRequest);
 			if (stateRequest) containerSize += mtpRequestData::messageSize(stateRequest);
 			if (httpWaitRequest) containerSize += mtpRequestData::messageSize(httpWaitRequest);
-			for (mtpPreRequestMap::iterator i = toSend.begin(), e = toSend.end(); i != e; ++i) {
+			for (mtpPreRequestMap::iterator i = toSend.begin(); i != toSendEnd; ++i) {
 				containerSize += mtpRequestData::messageSize(i.value());
 				if (needsLayer && i.value()->needsLayer) {
 					containerSize += initSizeInInts;
@@ -1618,9 +1705,10 @@ void MTProtoConnectionPrivate::tryToSend() {
 				initSerialized.push_back(mtpCurrentLayer);
 				initWrapper->write(initSerialized);
 			}
-			toSendRequest = mtpRequestData::prepare(containerSize, containerSize + 3 * toSend.size()); // prepare container + each in invoke after
+			toSendRequest = mtpRequestData::prepare(containerSize, containerSize + 3 * toSendTaken); // prepare container + each in invoke after
 			toSendRequest->push_back(mtpc_msg_container);
 			toSendRequest->push_back(toSendCount);
+			sessionData->statsContainer(toSendCount);
 
 			mtpMsgId bigMsgId = msgid(); // check for a valid container
 
@@ -1641,7 +1729,7 @@ void MTProtoConnectionPrivate::tryToSend() {
 			} else if (resendRequest || stateRequest) {
 				needAnyResponse = true;
 			}
-			for (mtpPreRequestMap::iterator i = toSend.begin(), e = toSend.end(); i != e; ++i) {
+			for (mtpPreRequestMap::iterator i = toSend.begin(); i != toSendEnd; ++i) {
 				mtpRequest &req(i.value());
 				mtpMsgId msgId = prepareToSend(req, bigMsgId);
 				if (msgId > bigMsgId) msgId = replaceMsgId(req, bigMsgId);
@@ -1693,11 +1781,17 @@ void MTProtoConnectionPrivate::tryToSend() {
 			*(mtpMsgId*)(haveSentIdsWrap->data() + 4) = contMsgId;
 			(*haveSentIdsWrap)[6] = 0; // for container, msDate = 0, seqNo = 0
 			haveSent.insert(contMsgId, haveSentIdsWrap);
-			toSend.clear();
+			for (uint32 i = 0; i < toSendTaken; ++i) {
+				toSend.erase(toSend.begin());
+			}
 		}
 	}
 	mtpRequestData::padding(toSendRequest);
 	sendRequest(toSendRequest, needAnyResponse);
+
+	if (sendLater) {
+		emit needToSendAsync();
+	}
 }
 
 void MTProtoConnectionPrivate::retryByTimer() {
@@ -1755,14 +1849,130 @@ void MTProtoConnectionPrivate::socketStart(bool afterConfig) {
 	}
 	dcOption = &dcIndex.value();
 
-	const char *ip(dcOption->ip.c_str());
-	uint32 port(dcOption->port);
+	clearRace();
+	connAddress = RaceAddress(dcOption->ip, dcOption->port);
+	if (cConnectionType() == dbictAuto) {
+		prepareRace(*dcOption);
+	}
+
+	const char *ip(connAddress.ip.c_str());
+	uint32 port(connAddress.port);
 	DEBUG_LOG(("MTP Info: socket connection to %1:%2..").arg(ip).arg(port));
 
 	connect(conn, SIGNAL(connected()), this, SLOT(onConnected()));
 	connect(conn, SIGNAL(disconnected()), this, SLOT(restart()));
 
 	conn->connectToServer(ip, port);
+
+	if (!raceQueue.isEmpty()) {
+		raceTimer.start(MTPConnectionRaceStagger);
+	}
+}
+
+void MTProtoConnectionPrivate::prepareRace(const mtpDcOption &option) {
+	QList<RaceAddress> addresses;
+	addresses.push_back(RaceAddress(option.ip, option.port));
+
+	QList<mtpDcOption> alternatives(mtpDcAlternatives(dc));
+	for (QList<mtpDcOption>::const_iterator i = alternatives.cbegin(), e = alternatives.cend(); i != e; ++i) {
+		addresses.push_back(RaceAddress(i->ip, i->port));
+	}
+
+	mtpDcWinner winner;
+	if (mtpGetDcWinner(dc, winner)) {
+		int32 i = 0, l = addresses.size();
+		for (; i < l; ++i) {
+			if (addresses.at(i).ip == winner.ip && addresses.at(i).port == winner.port) {
+				addresses.move(i, 0); // start with the last winner
+				break;
+			}
+		}
+		if (i == l) { // saved in mtp data, the config with alternatives is not loaded yet
+			addresses.push_front(RaceAddress(winner.ip, winner.port));
+		}
+		if (winner.http) {
+			if (MTPautoConnection *autoConn = qobject_cast<MTPautoConnection*>(conn)) {
+				autoConn->preferHttp();
+			}
+		}
+	}
+
+	connAddress = addresses.front();
+	addresses.pop_front();
+	raceQueue = addresses;
+}
+
+void MTProtoConnectionPrivate::clearRace() {
+	raceTimer.stop();
+	raceQueue.clear();
+	for (RacingConnections::const_iterator i = racing.cbegin(), e = racing.cend(); i != e; ++i) {
+		disconnect(i.key(), 0, this, 0);
+		i.key()->disconnectFromServer();
+		i.key()->deleteLater();
+	}
+	racing.clear();
+}
+
+void MTProtoConnectionPrivate::onRaceNext() {
+	if (!conn || raceQueue.isEmpty() || getState() != MTProtoConnection::Connecting) return;
+
+	RaceAddress address(raceQueue.front());
+	raceQueue.pop_front();
+
+	DEBUG_LOG(("MTP Info: dc %1 racing socket connection to %2:%3..").arg(dc).arg(address.ip.c_str()).arg(address.port));
+
+	MTPautoConnection *racer = new MTPautoConnection(thread());
+	racer->disableHttp(); // http is raced by the main connection already
+	connect(racer, SIGNAL(connected()), this, SLOT(onRaceConnected()));
+	connect(racer, SIGNAL(disconnected()), this, SLOT(onRaceError()));
+	connect(racer, SIGNAL(error(bool)), this, SLOT(onRaceError()));
+	racing.insert(racer, address);
+
+	racer->connectToServer(address.ip.c_str(), address.port);
+
+	if (!raceQueue.isEmpty()) {
+		raceTimer.start(MTPConnectionRaceStagger);
+	}
+}
+
+void MTProtoConnectionPrivate::onRaceConnected() {
+	MTPabstractConnection *racer = qobject_cast<MTPabstractConnection*>(sender());
+	RacingConnections::iterator i = racing.find(racer);
+	if (i == racing.end()) return;
+
+	if (!conn || getState() != MTProtoConnection::Connecting) {
+		return clearRace();
+	}
+
+	DEBUG_LOG(("MTP Info: dc %1 race won by %2:%3 instead of %4:%5").arg(dc).arg(i.value().ip.c_str()).arg(i.value().port).arg(connAddress.ip.c_str()).arg(connAddress.port));
+	connAddress = i.value();
+	racing.erase(i);
+	disconnect(racer, 0, this, 0);
+
+	disconnect(conn, 0, this, 0);
+	conn->disconnectFromServer();
+	conn->deleteLater();
+
+	conn = racer;
+	connect(conn, SIGNAL(error(bool)), this, SLOT(onError(bool)));
+	connect(conn, SIGNAL(receivedSome()), this, SLOT(onReceivedSome()));
+	connect(conn, SIGNAL(disconnected()), this, SLOT(restart()));
+
+	onConnected();
+}
+
+void MTProtoConnectionPrivate::onRaceError() {
+	MTPabstractConnection *racer = qobject_cast<MTPabstractConnection*>(sender());
+	if (!racing.remove(racer)) return;
+
+	disconnect(racer, 0, this, 0);
+	racer->disconnectFromServer();
+	racer->deleteLater();
+
+	if (!raceQueue.isEmpty()) { // this address failed, dont wait for the stagger
+		raceTimer.stop();
+		onRaceNext();
+	}
 }
 
 void MTProtoConnectionPrivate::restart(bool maybeBadKey) {
@@ -1792,6 +2002,7 @@ void MTProtoConnectionPrivate::restart(bool maybeBadKey) {
 		resetSession();
 	}
 	restarted = true;
+	sessionData->statsReconnect();
 	if (retryTimer.isActive()) return;
 
 	DEBUG_LOG(("MTP Info: restart timeout: %1ms").arg(retryTimeout));
@@ -1879,6 +2090,7 @@ void MTProtoConnectionPrivate::onBadConnection() {
 }
 
 void MTProtoConnectionPrivate::doDisconnect() {
+	clearRace();
 	if (conn) {
 		disconnect(conn, SIGNAL(disconnected()), 0, 0);
 		disconnect(conn, SIGNAL(receivedData()), 0, 0);
@@ -1924,9 +2136,12 @@ void MTProtoConnectionPrivate::handleReceived() {
 
 	
 	while (conn->received().size()) {
-		const mtpBuffer &encryptedBuf(conn->received().front());
-		uint32 len = encryptedBuf.size();
-		const mtpPrime *encrypted(encryptedBuf.data());
+		mtpBuffer packet; // decrypted in place, rpc results and updates keep references to it
+		packet.swap(conn->received().front());
+		conn->received().pop_front();
+
+		uint32 len = packet.size();
+		mtpPrime *encrypted(packet.data());
 		if (len < 18) { // 2 auth_key_id, 4 msg_key, 2 salt, 2 session, 2 msg_id, 1 seq_no, 1 length, (1 data + 3 padding) min
 			LOG(("TCP Error: bad message received, len %1").arg(len * sizeof(mtpPrime)));
 			TCP_LOG(("TCP Error: bad message %1").arg(mb(encrypted, len * sizeof(mtpPrime)).str()));
@@ -1938,28 +2153,28 @@ void MTProtoConnectionPrivate::handleReceived() {
 			return restart();
 		}
 
-		QByteArray dataBuffer((len - 6) * sizeof(mtpPrime), Qt::Uninitialized);
-		mtpPrime *data((mtpPrime*)dataBuffer.data()), *msg = data + 8;
+		sessionData->statsReceived(len * sizeof(mtpPrime));
+
+		uint32 dataSize = (len - 6) * sizeof(mtpPrime);
+		mtpPrime *data(encrypted + 6), *msg = data + 8;
 		const mtpPrime *from(msg), *end;
 		MTPint128 msgKey(*(MTPint128*)(encrypted + 2));
 		
-		aesDecrypt(encrypted + 6, data, dataBuffer.size(), key, msgKey);
+		aesDecrypt(data, data, dataSize, key, msgKey); // AES IGE supports in place decryption
 
 		uint64 serverSalt = *(uint64*)&data[0], session = *(uint64*)&data[2], msgId = *(uint64*)&data[4];
 		uint32 seqNo = *(uint32*)&data[6], msgLen = *(uint32*)&data[7];
 		bool needAck = (seqNo & 0x01);
 
-		if (uint32(dataBuffer.size()) < msgLen + 8 * sizeof(mtpPrime) || (msgLen & 0x03)) {
-			LOG(("TCP Error: bad msg_len received %1, data size: %2").arg(msgLen).arg(dataBuffer.size()));
+		if (dataSize < msgLen + 8 * sizeof(mtpPrime) || (msgLen & 0x03)) {
+			LOG(("TCP Error: bad msg_len received %1, data size: %2").arg(msgLen).arg(dataSize));
 			TCP_LOG(("TCP Error: bad message %1").arg(mb(encrypted, len * sizeof(mtpPrime)).str()));
-			conn->received().pop_front();
 			return restart();
 		}
 		uchar sha1Buffer[20];
 		if (memcmp(&msgKey, hashSha1(data, msgLen + 8 * sizeof(mtpPrime), sha1Buffer) + 1, sizeof(msgKey))) {
 			LOG(("TCP Error: bad SHA1 hash after aesDecrypt in message"));
 			TCP_LOG(("TCP Error: bad message %1").arg(mb(encrypted, len * sizeof(mtpPrime)).str()));
-			conn->received().pop_front();
 			return restart();
 		}
 		TCP_LOG(("TCP Info: decrypted message %1,%2,%3 is %4 len").arg(msgId).arg(seqNo).arg(logBool(needAck)).arg(msgLen + 8 * sizeof(mtpPrime)));
@@ -1968,12 +2183,9 @@ void MTProtoConnectionPrivate::handleReceived() {
 		if (session != serverSession) {
 			LOG(("MTP Error: bad server session received"));
 			TCP_LOG(("MTP Error: bad server session %1 instead of %2 in message received").arg(session).arg(serverSession));
-			conn->received().pop_front();
 			return restart();
 		}
 
-		conn->received().pop_front();
-
 		int32 serverTime((int32)(msgId >> 32)), clientTime(unixtime());
 		bool isReply = ((msgId & 0x03) == 1);
 		if (!isReply && ((msgId & 0x03) != 3)) {
@@ -2020,8 +2232,11 @@ void MTProtoConnectionPrivate::handleReceived() {
 			needToHandle = receivedIds.insert(msgId, needAck);
 		}
 		if (needToHandle) {
+			handlingPacket = &packet;
 			res = handleOneReceived(from, end, msgId, serverTime, serverSalt, badTime);
+			handlingPacket = 0;
 		}
+		conn->recycle(packet);
 		{
 			QWriteLocker lock(sessionData->receivedIdsMutex());
 			mtpMsgIdsMap &receivedIds(sessionData->receivedIdsSet());
@@ -2160,6 +2375,7 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 		MTPBadMsgNotification msg(from, end);
 		const MTPDbad_msg_notification &data(msg.c_bad_msg_notification());
 		LOG(("Message Info: bad message notification received (error_code %3) for msg_id = %1, seq_no = %2").arg(data.vbad_msg_id.v).arg(data.vbad_msg_seqno.v).arg(data.verror_code.v));
+		sessionData->statsBadMsgNotification();
 
 		mtpMsgId resendId = data.vbad_msg_id.v;
 		if (resendId == _pingMsgId) {
@@ -2236,6 +2452,7 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 		MTPBadMsgNotification msg(from, end);
 		const MTPDbad_server_salt &data(msg.c_bad_server_salt());
 		DEBUG_LOG(("Message Info: bad server salt received (error_code %4) for msg_id = %1, seq_no = %2, new salt: %3").arg(data.vbad_msg_id.v).arg(data.vbad_msg_seqno.v).arg(data.vnew_server_salt.v).arg(data.verror_code.v));
+		sessionData->statsBadServerSalt();
 
 		mtpMsgId resendId = data.vbad_msg_id.v;
 		if (resendId == _pingMsgId) {
@@ -2483,8 +2700,7 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 			}
 			typeId = response[0];
 		} else {
-			response.resize(end - from);
-			memcpy(response.data(), from, (end - from) * sizeof(mtpPrime));
+			response = receivedSlice(from, end);
 		}
 		if (!sessionData->layerWasInited()) {
 			sessionData->setLayerWasInited(true);
@@ -2540,6 +2756,40 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 		emit sendPongAsync(msgId, msg.vping_id.v);
 	} return 1;
 
+	case mtpc_future_salts: {
+		MTPFutureSalts msg(from, end);
+		const MTPDfuture_salts &data(msg.c_future_salts());
+		const QVector<MTPfutureSalt> &salts(data.vsalts.c_vector().v);
+		DEBUG_LOG(("Message Info: future salts received, req_msg_id: %1, count: %2").arg(data.vreq_msg_id.v).arg(salts.size()));
+
+		mtpRequestId requestId = wasSent(data.vreq_msg_id.v);
+		if (!requestId) {
+			DEBUG_LOG(("Message Error: such message was not sent recently %1").arg(data.vreq_msg_id.v));
+			return (badTime ? 0 : 1);
+		}
+
+		QVector<MTPlong> ids(1, data.vreq_msg_id);
+		if (badTime) {
+			if (requestsFixTimeSalt(ids, serverTime, serverSalt)) {
+				badTime = false;
+			} else {
+				return 0;
+			}
+		}
+		requestsAcked(ids, true);
+		if (requestId != mtpRequestId(0xFFFFFFFF)) {
+			_mtp_internal::clearCallbacksDelayed(RPCCallbackClears(1, RPCCallbackClear(requestId)));
+		}
+
+		mtpServerSalts result;
+		result.reserve(salts.size());
+		for (QVector<MTPfutureSalt>::const_iterator i = salts.cbegin(), e = salts.cend(); i != e; ++i) {
+			const MTPDfuture_salt &salt(i->c_future_salt());
+			result.push_back(mtpServerSalt(salt.vvalid_since.v, salt.vvalid_until.v, salt.vsalt.v));
+		}
+		sessionData->owner()->notifyServerSalts(result);
+	} return 1;
+
 	case mtpc_pong: {
 		MTPPong msg(from, end);
 		const MTPDpong &data(msg.c_pong());
@@ -2551,6 +2801,7 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 		}
 		if (data.vping_id.v == _pingId) {
 			_pingId = 0;
+			sessionData->statsPong(getms(true) - _pingStartedAt);
 		} else {
 			DEBUG_LOG(("Message Info: just pong.."));
 		}
@@ -2579,13 +2830,12 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 		return -2;
 	}
 
-	mtpBuffer update(end - from);
-	if (end > from) memcpy(update.data(), from, (end - from) * sizeof(mtpPrime));
+	mtpResponse update(receivedSlice(from, end));
 		
 	QWriteLocker locker(sessionData->haveReceivedMutex());
 	mtpResponseMap &haveReceived(sessionData->haveReceivedMap());
 	mtpRequestId fakeRequestId = sessionData->nextFakeRequestId();
-	haveReceived.insert(fakeRequestId, mtpResponse(update)); // notify main process about new updates
+	haveReceived.insert(fakeRequestId, update); // notify main process about new updates
 
 	if (cons != mtpc_updatesTooLong && cons != mtpc_updateShortMessage && cons != mtpc_updateShortChatMessage && cons != mtpc_updateShort && cons != mtpc_updatesCombined && cons != mtpc_updates) {
 		LOG(("Message Error: unknown constructor %1").arg(cons)); // maybe new api?..
@@ -2594,6 +2844,15 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 	return 1;
 }
 
+mtpResponse MTProtoConnectionPrivate::receivedSlice(const mtpPrime *from, const mtpPrime *end) const {
+	if (handlingPacket && from >= handlingPacket->constData() && end <= handlingPacket->constData() + handlingPacket->size()) {
+		return mtpResponse(*handlingPacket, from, end);
+	}
+	mtpBuffer result(end - from);
+	if (end > from) memcpy(result.data(), from, (end - from) * sizeof(mtpPrime));
+	return mtpResponse(result);
+}
+
 mtpBuffer MTProtoConnectionPrivate::ungzip(const mtpPrime *from, const mtpPrime *end) const {
 	MTPstring packed(from, end); // read packed string as serialized mtp string type
 	uint32 packedLen = packed.c_string().v.size(), unpackedChunk = packedLen, unpackedLen = 0;
@@ -2824,6 +3083,11 @@ void MTProtoConnectionPrivate::onConnected() {
 
 	TCP_LOG(("Connection Info: connection succeed."));
 
+	clearRace();
+	if (cConnectionType() == dbictAuto) {
+		sessionData->owner()->notifyDcWinner(mtpDcWinner(connAddress.ip, connAddress.port, conn->transport() == qsl("HTTP")));
+	}
+
 	if (updateAuthKey()) {
 		DEBUG_LOG(("MTP Info: returning from socketConnected.."));
 		return;
@@ -3073,9 +3337,7 @@ void MTProtoConnectionPrivate::dhParamsAnswered() {
 			return restart();
 		}
 		
-		// check that dhPrime and (dhPrime - 1) / 2 are really prime using openssl BIGNUM methods
-		_BigNumPrimeTest bnPrimeTest;
-		if (!bnPrimeTest.isPrimeAndGood(&dhPrime[0], MTPMillerRabinIterCount, dh_inner_data.vg.v)) {
+		if (!isGoodPrimeCached(dhPrime, dh_inner_data.vg.v)) {
 			LOG(("AuthKey Error: bad dh_prime primality!").arg(dhPrime.length()).arg(g_a.length()));
 			DEBUG_LOG(("AuthKey Error: dh_prime %1").arg(mb(&dhPrime[0], dhPrime.length()).str()));
 			return restart();
@@ -3216,6 +3478,7 @@ void MTProtoConnectionPrivate::dhClientParamsAnswered() {
 		authKey->setDC(dc % _mtp_internal::dcShift);
 
 		DEBUG_LOG(("AuthKey Info: auth key gen succeed, id: %1, server salt: %2, auth key: %3").arg(authKey->keyId()).arg(serverSalt).arg(mb(authKeyData->auth_key, 256).str()));
+		LOG(("AuthKey Info: auth key for dc %1 created in %2ms").arg(dc).arg(getms(true) - authKeyData->started));
 
 		sessionData->owner()->notifyKeyCreated(authKey); // slot will call authKeyCreated()
 		sessionData->clear();
@@ -3428,6 +3691,7 @@ bool MTProtoConnectionPrivate::sendRequest(mtpRequest &request, bool needAnyResp
 
 	conn->setSentEncrypted();
 	conn->sendData(result);
+	sessionData->statsSent(result.size() * sizeof(mtpPrime));
 
 	if (needAnyResponse) {
 		onSentSome(result.size() * sizeof(mtpPrime));
@@ -142,6 +142,9 @@ public:
 		return receivedQueue;
 	}
 
+	mtpBuffer takeBuffer(uint32 size); // from the pool of already handled received packets
+	void recycle(mtpBuffer &buffer); // returns to the pool if nothing references it anymore
+
 signals:
 
 	void receivedData();
@@ -155,6 +158,7 @@ signals:
 protected:
 
     BuffersQueue receivedQueue; // list of received packets, not processed yet
+	BuffersQueue freeBuffers;
 	bool _sentEncrypted;
 
 };
@@ -191,6 +195,9 @@ public:
 
 	MTPautoConnection(QThread *thread);
 
+	void disableHttp(); // call before connectToServer(), for additional racing connections
+	void preferHttp(); // http won the last race in this network, dont wait for tcp
+
 	void sendData(mtpBuffer &buffer);
 	void disconnectFromServer();
 	void connectToServer(const QString &addr, int32 port);
@@ -233,6 +240,7 @@ private:
 	Status status;
 	MTPint128 tcpNonce, httpNonce;
 	QTimer httpStartTimer;
+	bool _preferHttp;
 
 	QNetworkAccessManager manager;
 	QUrl address;
@@ -370,6 +378,10 @@ public slots:
 
 	void onConfigLoaded();
 
+	void onRaceNext();
+	void onRaceConnected();
+	void onRaceError();
+
 private:
 
 	void createConn();
@@ -383,6 +395,9 @@ private:
 
 	int32 handleOneReceived(const mtpPrime *from, const mtpPrime *end, uint64 msgId, int32 serverTime, uint64 serverSalt, bool badTime);
 	mtpBuffer ungzip(const mtpPrime *from, const mtpPrime *end) const;
+
+	const mtpBuffer *handlingPacket; // decrypted packet, which is handled right now
+	mtpResponse receivedSlice(const mtpPrime *from, const mtpPrime *end) const; // shares handlingPacket, if possible
 	void handleMsgsStates(const QVector<MTPlong> &ids, const string &states, QVector<MTPlong> &acked);
 
 	void clearMessages();
@@ -398,6 +413,23 @@ private:
 	MTProtoConnection *_owner;
 	MTPabstractConnection *conn;
 
+	// other dc addresses are tried in parallel with staggered starts, first connected wins
+	struct RaceAddress {
+		RaceAddress() : port(0) {
+		}
+		RaceAddress(const string &ip, int32 port) : ip(ip), port(port) {
+		}
+		string ip;
+		int32 port;
+	};
+	RaceAddress connAddress;
+	QList<RaceAddress> raceQueue;
+	typedef QMap<MTPabstractConnection*, RaceAddress> RacingConnections;
+	RacingConnections racing;
+	SingleTimer raceTimer;
+	void prepareRace(const mtpDcOption &option);
+	void clearRace();
+
 	SingleTimer retryTimer; // exp retry timer
 	uint32 retryTimeout;
 	quint64 retryWillFinish;
@@ -418,7 +450,7 @@ private:
 	void requestsAcked(const QVector<MTPlong> &ids, bool byResponse = false);
 
 	mtpPingId _pingId, _pingIdToSend;
-	uint64 _pingSendAt;
+	uint64 _pingSendAt, _pingStartedAt;
 	mtpMsgId _pingMsgId;
 	SingleTimer _pingSender;
 
@@ -448,7 +480,8 @@ private:
 		, retries(0)
 		, g(0)
 		, req_num(0)
-		, msgs_sent(0) {
+		, msgs_sent(0)
+		, started(getms(true)) {
 			memset(new_nonce_buf, 0, sizeof(new_nonce_buf));
 			memset(aesKey, 0, sizeof(aesKey));
 			memset(aesIV, 0, sizeof(aesIV));
@@ -470,6 +503,8 @@ private:
 
 		uint32 req_num; // sent not encrypted request number
 		uint32 msgs_sent;
+
+		uint64 started; // for handshake time logging
 	};
 	struct AuthKeyCreateStrings {
 		QByteArray dh_prime;
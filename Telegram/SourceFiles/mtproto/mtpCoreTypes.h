@@ -138,21 +138,43 @@ inline void mtpRequest::write(mtpBuffer &to) const {
     memcpy(to.data() + was, value->constData() + 8, s * sizeof(mtpPrime));
 }
 
-class mtpResponse : public mtpBuffer {
+class mtpResponse { // part of a received packet, shares the packet buffer without copying
 public:
-	mtpResponse() {
+	mtpResponse() : _offset(0), _size(0) {
 	}
-	mtpResponse(const mtpBuffer &v) : mtpBuffer(v) {
+	mtpResponse(const mtpBuffer &v) : _buffer(v), _offset(0), _size(v.size()) {
+	}
+	mtpResponse(const mtpBuffer &packet, const mtpPrime *from, const mtpPrime *end) : _buffer(packet), _offset(from - packet.constData()), _size(end - from) {
 	}
 	mtpResponse &operator=(const mtpBuffer &v) {
-		mtpBuffer::operator=(v);
+		_buffer = v;
+		_offset = 0;
+		_size = v.size();
 		return (*this);
 	}
+
+	const mtpPrime *constData() const {
+		return _buffer.constData() + _offset;
+	}
+	int32 size() const {
+		return _size;
+	}
+	bool isEmpty() const {
+		return !_size;
+	}
+	mtpPrime operator[](int32 i) const {
+		return constData()[i];
+	}
+
 	bool needAck() const {
 		if (size() < 8) return false;
 		uint32 seqNo = *(uint32*)(constData() + 6);
 		return (seqNo & 0x01) ? true : false;
 	}
+
+private:
+	mtpBuffer _buffer;
+	int32 _offset, _size;
 };
 
 typedef QMap<mtpRequestId, mtpRequest> mtpPreRequestMap;
@@ -31,7 +31,14 @@ namespace {
 
 	typedef QMap<int32, mtpAuthKeyPtr> _KeysMapForWrite;
 	_KeysMapForWrite _keysMapForWrite;
+	mtpServerSaltsMap _saltsMapForWrite; // future salts are bound to the dc auth key
+	QMap<int32, int32> _saltsRequested; // dc -> unixtime of the last get_future_salts
 	QMutex _keysMapForWriteMutex;
+
+	typedef QMap<int32, QList<mtpDcOption> > DcAlternatives;
+	DcAlternatives dcAlternatives;
+	mtpDcWinners dcWinners;
+	QMutex dcAlternativesMutex; // both maps are accessed from connection threads
 }
 
 int32 mtpAuthed() {
@@ -79,6 +86,8 @@ void mtpSetDC(int32 dc, bool firstOnly) {
 
 MTProtoDC::MTProtoDC(int32 id, const mtpAuthKeyPtr &key) : _id(id), _key(key), _connectionInited(false) {
 	connect(this, SIGNAL(authKeyCreated()), this, SLOT(authKeyWrite()), Qt::QueuedConnection);
+	connect(this, SIGNAL(serverSaltsReceived()), this, SLOT(serverSaltsWrite()), Qt::QueuedConnection);
+	connect(this, SIGNAL(winnerChanged()), this, SLOT(dcWinnerWrite()), Qt::QueuedConnection);
 
 	QMutexLocker lock(&_keysMapForWriteMutex);
 	if (_key) {
@@ -95,6 +104,29 @@ void MTProtoDC::authKeyWrite() {
 	}
 }
 
+void MTProtoDC::serverSaltsWrite() {
+	DEBUG_LOG(("MTP Info: MTProtoDC::serverSaltsWrite() slot, dc %1").arg(_id));
+	if (_key) {
+		Local::writeMtpData();
+	}
+}
+
+void MTProtoDC::setServerSalts(const mtpServerSalts &salts) {
+	mtpSetServerSalts(_id, salts);
+	emit serverSaltsReceived();
+}
+
+void MTProtoDC::dcWinnerWrite() {
+	DEBUG_LOG(("MTP Info: MTProtoDC::dcWinnerWrite() slot, dc %1").arg(_id));
+	Local::writeMtpData();
+}
+
+void MTProtoDC::setWinner(const mtpDcWinner &winner) {
+	if (mtpSetDcWinner(_id, winner)) {
+		emit winnerChanged();
+	}
+}
+
 void MTProtoDC::setKey(const mtpAuthKeyPtr &key) {
 	DEBUG_LOG(("AuthKey Info: MTProtoDC::setKey(%1), emitting authKeyCreated, dc %2").arg(key ? key->keyId() : 0).arg(_id));
 	_key = key;
@@ -102,6 +134,7 @@ void MTProtoDC::setKey(const mtpAuthKeyPtr &key) {
 	emit authKeyCreated();
 
 	QMutexLocker lock(&_keysMapForWriteMutex);
+	_saltsMapForWrite.remove(_id);
 	if (_key) {
 		_keysMapForWrite[_id] = _key;
 	} else {
@@ -122,6 +155,7 @@ void MTProtoDC::destroyKey() {
 
 	QMutexLocker lock(&_keysMapForWriteMutex);
 	_keysMapForWrite.remove(_id);
+	_saltsMapForWrite.remove(_id);
 }
 
 namespace {
@@ -170,6 +204,18 @@ void mtpUpdateDcOptions(const QVector<MTPDcOption> &options) {
 		}
 		cSetDcOptions(opts);
 	}
+	{
+		QMutexLocker lock(&dcAlternativesMutex);
+		dcAlternatives.clear();
+		for (QVector<MTPDcOption>::const_iterator i = options.cbegin(), e = options.cend(); i != e; ++i) {
+			const MTPDdcOption &optData(i->c_dcOption());
+			const string &ip(optData.vip_address.c_string().v);
+			mtpDcOptions::const_iterator a = cDcOptions().constFind(optData.vid.v);
+			if (a != cDcOptions().cend() && a.value().ip == ip && a.value().port == optData.vport.v) continue;
+
+			dcAlternatives[optData.vid.v].push_back(mtpDcOption(optData.vid.v, optData.vhostname.c_string().v, ip, optData.vport.v));
+		}
+	}
 	for (QSet<int32>::const_iterator i = restart.cbegin(), e = restart.cend(); i != e; ++i) {
 		MTP::restart(*i);
 	}
@@ -256,3 +302,88 @@ void mtpSetKey(int32 dcId, mtpAuthKeyPtr key) {
 	MTProtoDCPtr dc(new MTProtoDC(dcId, key));
 	gDCs.insert(dcId, dc);
 }
+
+mtpServerSaltsMap mtpGetServerSalts() {
+	QMutexLocker lock(&_keysMapForWriteMutex);
+	return _saltsMapForWrite;
+}
+
+void mtpSetServerSalts(int32 dc, const mtpServerSalts &salts) {
+	dc %= _mtp_internal::dcShift;
+
+	QMutexLocker lock(&_keysMapForWriteMutex);
+	if (salts.isEmpty()) {
+		_saltsMapForWrite.remove(dc);
+	} else {
+		_saltsMapForWrite.insert(dc, salts);
+	}
+}
+
+uint64 mtpServerSaltFor(int32 dc, int32 now) {
+	QMutexLocker lock(&_keysMapForWriteMutex);
+	mtpServerSaltsMap::const_iterator i = _saltsMapForWrite.constFind(dc % _mtp_internal::dcShift);
+	if (i == _saltsMapForWrite.cend()) return 0;
+
+	for (mtpServerSalts::const_iterator j = i->cbegin(), e = i->cend(); j != e; ++j) {
+		if (j->validSince <= now && j->validUntil > now + MTPServerSaltReserve) {
+			return j->salt;
+		}
+	}
+	return 0;
+}
+
+int32 mtpServerSaltsValidUntil(int32 dc) {
+	QMutexLocker lock(&_keysMapForWriteMutex);
+	mtpServerSaltsMap::const_iterator i = _saltsMapForWrite.constFind(dc % _mtp_internal::dcShift);
+	if (i == _saltsMapForWrite.cend()) return 0;
+
+	int32 result = 0;
+	for (mtpServerSalts::const_iterator j = i->cbegin(), e = i->cend(); j != e; ++j) {
+		if (j->validUntil > result) result = j->validUntil;
+	}
+	return result;
+}
+
+bool mtpServerSaltsNeedRequest(int32 dc, int32 now) {
+	if (mtpServerSaltsValidUntil(dc) >= now + MTPFutureSaltsRefresh) return false;
+
+	dc %= _mtp_internal::dcShift;
+
+	QMutexLocker lock(&_keysMapForWriteMutex);
+	QMap<int32, int32>::iterator i = _saltsRequested.find(dc);
+	if (i != _saltsRequested.end() && i.value() + MTPFutureSaltsRetry > now) return false;
+
+	_saltsRequested[dc] = now;
+	return true;
+}
+
+QList<mtpDcOption> mtpDcAlternatives(int32 dc) {
+	QMutexLocker lock(&dcAlternativesMutex);
+	return dcAlternatives.value(dc % _mtp_internal::dcShift);
+}
+
+mtpDcWinners mtpGetDcWinners() {
+	QMutexLocker lock(&dcAlternativesMutex);
+	return dcWinners;
+}
+
+bool mtpGetDcWinner(int32 dc, mtpDcWinner &winner) {
+	QMutexLocker lock(&dcAlternativesMutex);
+	mtpDcWinners::const_iterator i = dcWinners.constFind(dc % _mtp_internal::dcShift);
+	if (i == dcWinners.cend()) return false;
+
+	winner = i.value();
+	return true;
+}
+
+bool mtpSetDcWinner(int32 dc, const mtpDcWinner &winner) {
+	dc %= _mtp_internal::dcShift;
+
+	QMutexLocker lock(&dcAlternativesMutex);
+	mtpDcWinners::iterator i = dcWinners.find(dc);
+	if (i != dcWinners.end() && i.value().ip == winner.ip && i.value().port == winner.port && i.value().http == winner.http) {
+		return false;
+	}
+	dcWinners.insert(dc, winner);
+	return true;
+}
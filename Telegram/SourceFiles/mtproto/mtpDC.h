@@ -17,6 +17,28 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 */
 #pragma once
 
+struct mtpServerSalt {
+	mtpServerSalt() : validSince(0), validUntil(0), salt(0) {
+	}
+	mtpServerSalt(int32 validSince, int32 validUntil, uint64 salt) : validSince(validSince), validUntil(validUntil), salt(salt) {
+	}
+	int32 validSince, validUntil;
+	uint64 salt;
+};
+typedef QVector<mtpServerSalt> mtpServerSalts;
+typedef QMap<int32, mtpServerSalts> mtpServerSaltsMap;
+
+struct mtpDcWinner { // address and transport that won the last connection race to the dc
+	mtpDcWinner() : port(0), http(false) {
+	}
+	mtpDcWinner(const string &ip, int32 port, bool http) : ip(ip), port(port), http(http) {
+	}
+	string ip;
+	int32 port;
+	bool http;
+};
+typedef QMap<int32, mtpDcWinner> mtpDcWinners;
+
 class MTProtoDC : public QObject {
 	Q_OBJECT
 
@@ -29,6 +51,9 @@ public:
 	void setKey(const mtpAuthKeyPtr &key);
 	void destroyKey();
 
+	void setServerSalts(const mtpServerSalts &salts); // from any thread, saves them to mtp data
+	void setWinner(const mtpDcWinner &winner); // from any thread, saves it to mtp data if changed
+
 	bool connectionInited() const {
 		QMutexLocker lock(&initLock);
 		bool res = _connectionInited;
@@ -43,10 +68,14 @@ signals:
 
 	void authKeyCreated();
 	void layerWasInited(bool was);
+	void serverSaltsReceived();
+	void winnerChanged();
 
 private slots:
 
 	void authKeyWrite();
+	void serverSaltsWrite();
+	void dcWinnerWrite();
 
 private:
 
@@ -103,4 +132,17 @@ void mtpAuthed(int32 uid);
 mtpKeysMap mtpGetKeys();
 void mtpSetKey(int32 dc, mtpAuthKeyPtr key);
 
+mtpServerSaltsMap mtpGetServerSalts();
+void mtpSetServerSalts(int32 dc, const mtpServerSalts &salts);
+uint64 mtpServerSaltFor(int32 dc, int32 now); // 0 if no stored salt is valid at that time
+int32 mtpServerSaltsValidUntil(int32 dc); // 0 if no salts are stored
+bool mtpServerSaltsNeedRequest(int32 dc, int32 now); // marks them requested, so only one session asks
+
 void mtpUpdateDcOptions(const QVector<MTPDcOption> &options);
+
+// other addresses for the dc from the last config, they are not saved in settings
+QList<mtpDcOption> mtpDcAlternatives(int32 dc);
+
+mtpDcWinners mtpGetDcWinners();
+bool mtpGetDcWinner(int32 dc, mtpDcWinner &winner);
+bool mtpSetDcWinner(int32 dc, const mtpDcWinner &winner); // returns true if the winner changed, saved with mtp data
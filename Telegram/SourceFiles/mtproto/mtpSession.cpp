@@ -18,6 +18,152 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 #include "stdafx.h"
 #include <QtCore/QSharedPointer>
 
+void MTPStatsHistogram::add(uint32 value) {
+	uint32 bucket = 0;
+	for (uint32 v = value; v && bucket + 1 < BucketsCount; v >>= 1) {
+		++bucket;
+	}
+	++buckets[bucket];
+	if (!count || value < min) min = value;
+	if (!count || value > max) max = value;
+	++count;
+	sum += value;
+}
+
+void MTPStatsHistogram::add(const MTPStatsHistogram &other) {
+	if (!other.count) return;
+	for (uint32 i = 0; i < BucketsCount; ++i) {
+		buckets[i] += other.buckets[i];
+	}
+	if (!count || other.min < min) min = other.min;
+	if (!count || other.max > max) max = other.max;
+	count += other.count;
+	sum += other.sum;
+}
+
+uint32 MTPStatsHistogram::percentile(uint32 percent) const {
+	if (!count) return 0;
+
+	uint64 need = (uint64(count) * percent + 99) / 100, have = 0;
+	for (uint32 i = 0; i < BucketsCount; ++i) {
+		have += buckets[i];
+		if (have >= need) {
+			return (i + 1 < BucketsCount) ? qMin(uint32(1U << i), max) : max;
+		}
+	}
+	return max;
+}
+
+QString MTPStatsHistogram::dump() const {
+	if (!count) return qsl("none");
+	return qsl("count %1, avg %2, min %3, p50 %4, p90 %5, p99 %6, max %7").arg(count).arg(sum / count).arg(min).arg(percentile(50)).arg(percentile(90)).arg(percentile(99)).arg(max);
+}
+
+void MTPSessionStats::add(const MTPSessionStats &other) {
+	since = qMin(since, other.since);
+	bytesSent += other.bytesSent;
+	bytesReceived += other.bytesReceived;
+	messagesSent += other.messagesSent;
+	messagesReceived += other.messagesReceived;
+	containersSent += other.containersSent;
+	resent += other.resent;
+	badServerSalts += other.badServerSalts;
+	badMsgNotifications += other.badMsgNotifications;
+	reconnects += other.reconnects;
+	pingsSent += other.pingsSent;
+	pongsReceived += other.pongsReceived;
+	requestsSent += other.requestsSent;
+	toSendDepth += other.toSendDepth;
+	toSendDepthMax = qMax(toSendDepthMax, other.toSendDepthMax);
+	haveSentDepth += other.haveSentDepth;
+	haveSentDepthMax = qMax(haveSentDepthMax, other.haveSentDepthMax);
+	rtt.add(other.rtt);
+	containerSize.add(other.containerSize);
+}
+
+QString MTPSessionStats::dump() const {
+	uint64 secs = (getms(true) - since) / 1000;
+	QStringList result;
+	result.push_back(qsl("for %1 sec").arg(secs));
+	result.push_back(qsl("sent %1 bytes in %2 messages (%3 containers)").arg(bytesSent).arg(messagesSent).arg(containersSent));
+	if (requestsSent) {
+		result.push_back(qsl("%1 requests, %2 packets per request").arg(requestsSent).arg(double(messagesSent) / requestsSent, 0, 'f', 2));
+	}
+	result.push_back(qsl("received %1 bytes in %2 messages").arg(bytesReceived).arg(messagesReceived));
+	result.push_back(qsl("resent %1, bad_server_salt %2, bad_msg_notification %3, reconnects %4").arg(resent).arg(badServerSalts).arg(badMsgNotifications).arg(reconnects));
+	result.push_back(qsl("queues toSend %1 (max %2), haveSent %3 (max %4)").arg(toSendDepth).arg(toSendDepthMax).arg(haveSentDepth).arg(haveSentDepthMax));
+	result.push_back(qsl("pings %1, pongs %2, rtt ms: %3").arg(pingsSent).arg(pongsReceived).arg(rtt.dump()));
+	result.push_back(qsl("container size: %1").arg(containerSize.dump()));
+	return result.join(qsl("; "));
+}
+
+void MTPSessionData::statsSent(uint32 bytes) {
+	QMutexLocker locker(&statsLock);
+	_stats.bytesSent += bytes;
+	++_stats.messagesSent;
+}
+
+void MTPSessionData::statsRequests(uint32 count) {
+	QMutexLocker locker(&statsLock);
+	_stats.requestsSent += count;
+}
+
+uint32 MTPSessionData::statsRtt() const {
+	QMutexLocker locker(&statsLock);
+	return _stats.rtt.percentile(50);
+}
+
+void MTPSessionData::statsReceived(uint32 bytes) {
+	QMutexLocker locker(&statsLock);
+	_stats.bytesReceived += bytes;
+	++_stats.messagesReceived;
+}
+
+void MTPSessionData::statsContainer(uint32 messages) {
+	QMutexLocker locker(&statsLock);
+	++_stats.containersSent;
+	_stats.containerSize.add(messages);
+}
+
+void MTPSessionData::statsQueues(uint32 toSendCount, uint32 haveSentCount) {
+	QMutexLocker locker(&statsLock);
+	_stats.toSendDepth = toSendCount;
+	_stats.haveSentDepth = haveSentCount;
+	if (toSendCount > _stats.toSendDepthMax) _stats.toSendDepthMax = toSendCount;
+	if (haveSentCount > _stats.haveSentDepthMax) _stats.haveSentDepthMax = haveSentCount;
+}
+
+void MTPSessionData::statsPing() {
+	QMutexLocker locker(&statsLock);
+	++_stats.pingsSent;
+}
+
+void MTPSessionData::statsPong(uint64 rtt) {
+	QMutexLocker locker(&statsLock);
+	++_stats.pongsReceived;
+	_stats.rtt.add(uint32(qMin(rtt, uint64(0xFFFFFFFFU))));
+}
+
+void MTPSessionData::statsResent() {
+	QMutexLocker locker(&statsLock);
+	++_stats.resent;
+}
+
+void MTPSessionData::statsBadServerSalt() {
+	QMutexLocker locker(&statsLock);
+	++_stats.badServerSalts;
+}
+
+void MTPSessionData::statsBadMsgNotification() {
+	QMutexLocker locker(&statsLock);
+	++_stats.badMsgNotifications;
+}
+
+void MTPSessionData::statsReconnect() {
+	QMutexLocker locker(&statsLock);
+	++_stats.reconnects;
+}
+
 void MTPSessionData::clear() {
 	RPCCallbackClears clearCallbacks;
 	{
@@ -63,7 +209,7 @@ void MTPSessionData::clear() {
 }
 
 
-MTProtoSession::MTProtoSession() : data(this), dcId(0), dc(0), msSendCall(0), msWait(0), _ping(false) {
+MTProtoSession::MTProtoSession() : data(this), dcId(0), dc(0), msSendCall(0), msWait(0), _ping(false), _immediateSentAt(0), _statsDumpAt(0) {
 }
 
 void MTProtoSession::start(int32 dcenter) {
@@ -108,6 +254,10 @@ void MTProtoSession::start(int32 dcenter) {
 			if (lock && dc->connectionInited()) {
 				data.setLayerWasInited(true);
 			}
+			if (data.getKey()) { // stored future salt saves a bad_server_salt round trip
+				uint64 salt = mtpServerSaltFor(dcId, unixtime());
+				if (salt) data.setSalt(salt);
+			}
 			connect(dc.data(), SIGNAL(authKeyCreated()), this, SLOT(authKeyCreatedForDC()), Qt::QueuedConnection);
 			connect(dc.data(), SIGNAL(layerWasInited(bool)), this, SLOT(layerWasInitedForDC(bool)), Qt::QueuedConnection);
 		}
@@ -126,8 +276,13 @@ void MTProtoSession::stop() {
 	}
 }
 
-void MTProtoSession::sendAnything(quint64 msCanWait) {
+void MTProtoSession::sendAnything(quint64 msCanWait, bool batched) {
 	uint64 ms = getms(true);
+	if (batched) { // goes right away if nothing was sent lately, else joins the next packet
+		uint64 budget = qMin(uint64(data.statsRtt() / MTPBatchRttShare), uint64(MTPBatchWaitMax));
+		uint64 batchWait = (_immediateSentAt && ms < _immediateSentAt + budget) ? (_immediateSentAt + budget - ms) : 0;
+		if (batchWait > msCanWait) msCanWait = batchWait;
+	}
 	if (msSendCall) {
 		if (ms > msSendCall + msWait) {
 			msWait = 0;
@@ -148,6 +303,7 @@ void MTProtoSession::sendAnything(quint64 msCanWait) {
 		DEBUG_LOG(("MTP Info: dc %1 stopped send timer, can wait for %2ms from current %3").arg(dcId).arg(msWait).arg(msSendCall));
 		sender.stop();
 		msSendCall = 0;
+		_immediateSentAt = ms;
 		needToResumeAndSend();
 	}
 }
@@ -256,6 +412,21 @@ void MTProtoSession::checkRequestsByTimer() {
 		}
 		_mtp_internal::clearCallbacksDelayed(clearCallbacks);
 	}
+
+	if (data.getKey() && data.isCheckedKey() && mtpServerSaltsNeedRequest(dcId, unixtime())) {
+		DEBUG_LOG(("MTP Info: requesting future salts for dc %1").arg(dcId));
+		send(MTPGet_future_salts(MTP_int(MTPFutureSaltsCount)));
+	}
+
+	if (cNetStatsPeriod() > 0) {
+		uint64 ms = getms(true);
+		if (!_statsDumpAt) {
+			_statsDumpAt = ms + cNetStatsPeriod() * 1000ULL;
+		} else if (ms >= _statsDumpAt) {
+			_statsDumpAt = ms + cNetStatsPeriod() * 1000ULL;
+			LOG(("MTP Stats: dc %1, %2").arg(dcId).arg(data.stats().dump()));
+		}
+	}
 }
 
 void MTProtoSession::onConnectionStateChange(qint32 newState) {
@@ -346,6 +517,19 @@ QString MTProtoSession::transport() const {
 	return QString();
 }
 
+MTPSessionStats MTProtoSession::stats() const {
+	MTPSessionStats result(data.stats());
+	{
+		QReadLocker locker(data.toSendMutex());
+		result.toSendDepth = data.toSendMap().size();
+	}
+	{
+		QReadLocker locker(data.haveSentMutex());
+		result.haveSentDepth = data.haveSentMap().size();
+	}
+	return result;
+}
+
 mtpRequestId MTProtoSession::resend(quint64 msgId, quint64 msCanWait, bool forceContainer, bool sendMsgStateInfo) {
 	mtpRequest request;
 	{
@@ -366,6 +550,9 @@ mtpRequestId MTProtoSession::resend(quint64 msgId, quint64 msCanWait, bool force
 		request = i.value();
 		haveSent.erase(i);
 	}
+	if (request->requestId) {
+		data.statsResent();
+	}
 	if (mtpRequestData::isSentContainer(request)) { // for container just resend all messages we can
 		DEBUG_LOG(("Message Info: resending container from haveSent, msgId %1").arg(msgId));
 		const mtpMsgId *ids = (const mtpMsgId *)(request->constData() + 8);
@@ -407,7 +594,7 @@ void MTProtoSession::resendAll() {
 	}
 }
 
-void MTProtoSession::sendPrepared(const mtpRequest &request, uint64 msCanWait, bool newRequest) { // returns true, if emit of needToSend() is needed
+void MTProtoSession::sendPrepared(const mtpRequest &request, uint64 msCanWait, bool newRequest, bool batched) { // returns true, if emit of needToSend() is needed
 	{
 		QWriteLocker locker(data.toSendMutex());
 		data.toSendMap().insert(request->requestId, request);
@@ -420,7 +607,7 @@ void MTProtoSession::sendPrepared(const mtpRequest &request, uint64 msCanWait, b
 
 	DEBUG_LOG(("MTP Info: added, requestId %1").arg(request->requestId));
 
-	sendAnything(msCanWait);
+	sendAnything(msCanWait, batched);
 }
 
 QReadWriteLock *MTProtoSession::keyMutex() const {
@@ -449,6 +636,15 @@ void MTProtoSession::notifyLayerInited(bool wasInited) {
 	emit dc->layerWasInited(wasInited);
 }
 
+void MTProtoSession::notifyServerSalts(const mtpServerSalts &salts) {
+	DEBUG_LOG(("MTP Info: future salts received for dc %1, count %2").arg(dcId).arg(salts.size()));
+	if (dc) dc->setServerSalts(salts);
+}
+
+void MTProtoSession::notifyDcWinner(const mtpDcWinner &winner) {
+	if (dc) dc->setWinner(winner);
+}
+
 void MTProtoSession::destroyKey() {
 	if (!dc) return;
 
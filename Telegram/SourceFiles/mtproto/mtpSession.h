@@ -23,6 +23,47 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 
 class MTProtoSession;
 
+struct MTPStatsHistogram { // bucket i counts values in [2^(i-1), 2^i), the last one is open
+	enum {
+		BucketsCount = 16,
+	};
+	MTPStatsHistogram() : count(0), sum(0), min(0), max(0) {
+		memset(buckets, 0, sizeof(buckets));
+	}
+
+	void add(uint32 value);
+	void add(const MTPStatsHistogram &other);
+	uint32 percentile(uint32 percent) const; // upper bound of the bucket
+	QString dump() const;
+
+	uint32 buckets[BucketsCount];
+	uint32 count;
+	uint64 sum;
+	uint32 min, max;
+};
+
+struct MTPSessionStats {
+	MTPSessionStats() : since(getms(true))
+	, bytesSent(0), bytesReceived(0), messagesSent(0), messagesReceived(0)
+	, containersSent(0), resent(0), badServerSalts(0), badMsgNotifications(0)
+	, reconnects(0), pingsSent(0), pongsReceived(0), requestsSent(0)
+	, toSendDepth(0), toSendDepthMax(0), haveSentDepth(0), haveSentDepthMax(0) {
+	}
+
+	void add(const MTPSessionStats &other); // for per dc totals
+	QString dump() const;
+
+	uint64 since;
+	uint64 bytesSent, bytesReceived;
+	uint32 messagesSent, messagesReceived; // encrypted packets
+	uint32 containersSent, resent, badServerSalts, badMsgNotifications;
+	uint32 reconnects, pingsSent, pongsReceived;
+	uint32 requestsSent; // from toSend, messagesSent / requestsSent gives packets per request
+	uint32 toSendDepth, toSendDepthMax, haveSentDepth, haveSentDepthMax;
+	MTPStatsHistogram rtt; // ms between ping and pong
+	MTPStatsHistogram containerSize; // messages in one container
+};
+
 class MTPSessionData {
 public:
 	
@@ -183,6 +224,23 @@ public:
 
 	void clear();
 
+	MTPSessionStats stats() const {
+		QMutexLocker locker(&statsLock);
+		return _stats;
+	}
+	void statsSent(uint32 bytes);
+	void statsRequests(uint32 count);
+	uint32 statsRtt() const; // median ping rtt in ms, 0 if unknown
+	void statsReceived(uint32 bytes);
+	void statsContainer(uint32 messages);
+	void statsQueues(uint32 toSendCount, uint32 haveSentCount);
+	void statsPing();
+	void statsPong(uint64 rtt);
+	void statsResent();
+	void statsBadServerSalt();
+	void statsBadMsgNotification();
+	void statsReconnect();
+
 private:
 	uint64 _session, _salt;
 
@@ -212,6 +270,9 @@ private:
 	mutable QReadWriteLock haveReceivedLock;
 	mutable QReadWriteLock stateRequestLock;
 
+	MTPSessionStats _stats;
+	mutable QMutex statsLock;
+
 };
 
 class MTProtoSession : public QObject {
@@ -232,17 +293,20 @@ public:
 	void notifyKeyCreated(const mtpAuthKeyPtr &key);
 	void destroyKey();
 	void notifyLayerInited(bool wasInited);
+	void notifyServerSalts(const mtpServerSalts &salts);
+	void notifyDcWinner(const mtpDcWinner &winner);
 
 	template <typename TRequest>
-	mtpRequestId send(const TRequest &request, RPCResponseHandler callbacks = RPCResponseHandler(), uint64 msCanWait = 0, bool needsLayer = false, bool toMainDC = false, mtpRequestId after = 0); // send mtp request
+	mtpRequestId send(const TRequest &request, RPCResponseHandler callbacks = RPCResponseHandler(), uint64 msCanWait = 0, bool needsLayer = false, bool toMainDC = false, mtpRequestId after = 0, bool batched = false); // send mtp request
 
 	void ping();
 	void cancel(mtpRequestId requestId, mtpMsgId msgId);
 	int32 requestState(mtpRequestId requestId) const;
 	int32 getState() const;
 	QString transport() const;
+	MTPSessionStats stats() const;
 
-	void sendPrepared(const mtpRequest &request, uint64 msCanWait = 0, bool newRequest = true); // nulls msgId and seqNo in request, if newRequest = true
+	void sendPrepared(const mtpRequest &request, uint64 msCanWait = 0, bool newRequest = true, bool batched = false); // nulls msgId and seqNo in request, if newRequest = true
 
 signals:
 
@@ -267,7 +331,7 @@ public slots:
 	void onConnectionStateChange(qint32 newState);
 	void onResetDone();
 
-	void sendAnything(quint64 msCanWait = 0);
+	void sendAnything(quint64 msCanWait = 0, bool batched = false); // batched - background request, see MTP::sendBatched()
 	void sendPong(quint64 msgId, quint64 pingId);
 	void sendMsgsStateInfo(quint64 msgId, QByteArray data);
 
@@ -284,6 +348,9 @@ private:
 	uint64 msSendCall, msWait;
 
 	bool _ping;
+	uint64 _immediateSentAt; // for coalescing batched requests
+
+	uint64 _statsDumpAt;
 
 	QTimer timeouter;
 	SingleTimer sender;
@@ -18,7 +18,7 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 #pragma once
 
 template <typename TRequest>
-mtpRequestId MTProtoSession::send(const TRequest &request, RPCResponseHandler callbacks, uint64 msCanWait, bool needsLayer, bool toMainDC, mtpRequestId after) {
+mtpRequestId MTProtoSession::send(const TRequest &request, RPCResponseHandler callbacks, uint64 msCanWait, bool needsLayer, bool toMainDC, mtpRequestId after, bool batched) {
     mtpRequestId requestId = 0;
     try {
 		uint32 requestSize = request.innerLength() >> 2;
@@ -32,7 +32,7 @@ mtpRequestId MTProtoSession::send(const TRequest &request, RPCResponseHandler ca
 		if (after) reqSerialized->after = _mtp_internal::getRequest(after);
 		requestId = _mtp_internal::storeRequest(reqSerialized, callbacks);
 
-        sendPrepared(reqSerialized, msCanWait);
+        sendPrepared(reqSerialized, msCanWait, true, batched);
     } catch (Exception &e) {
         requestId = 0;
         _mtp_internal::rpcErrorOccured(requestId, callbacks, rpcClientError("NO_REQUEST_ID", QString("send() failed to queue request, exception: %1").arg(e.what())));
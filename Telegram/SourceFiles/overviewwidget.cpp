@@ -40,6 +40,10 @@ OverviewInner::OverviewInner(OverviewWidget *overview, ScrollArea *scroll, const
 	, _photosInRow(1)
 	, _photosToAdd(0)
 	, _selMode(false)
+	, _visibleTop(0)
+	, _visibleBottom(0)
+	, _preloadTop(0)
+	, _preloadBottom(0)
 	, _width(0)
 	, _height(0)
 	, _minHeight(0)
@@ -547,6 +551,65 @@ void OverviewInner::clear() {
 	_cached.clear();
 }
 
+PhotoData *OverviewInner::photoAt(int32 index) const {
+	HistoryItem *item = App::histItemById(_hist->_overview[_type][index]);
+	HistoryMedia *m = item ? item->getMedia(true) : 0;
+	return (m && m->type() == MediaTypePhoto) ? static_cast<HistoryPhoto*>(m)->photo() : 0;
+}
+
+int32 OverviewInner::photoIndexAt(int32 y) const {
+	int32 row = (y > _addToY + st::overviewPhotoSkip) ? ((y - _addToY - st::overviewPhotoSkip) / int32(_vsize + st::overviewPhotoSkip)) : 0;
+	return snap(row * _photosInRow - _photosToAdd, 0, _hist->_overview[_type].size());
+}
+
+void OverviewInner::preloadPhotos(int32 visibleTop, int32 visibleBottom, int32 preloadTop, int32 preloadBottom) {
+	_visibleTop = visibleTop;
+	_visibleBottom = visibleBottom;
+	_preloadTop = preloadTop;
+	_preloadBottom = preloadBottom;
+	preloadPhotos();
+}
+
+void OverviewInner::preloadPhotos() {
+	PreloadedPhotos preloaded, visible;
+	if (_type == OverviewPhotos && _preloadBottom > _preloadTop) {
+		int32 visibleFrom = photoIndexAt(_visibleTop), visibleTill = photoIndexAt(_visibleBottom + _vsize + st::overviewPhotoSkip);
+		int32 preloadFrom = photoIndexAt(_preloadTop), preloadTill = photoIndexAt(_preloadBottom + _vsize + st::overviewPhotoSkip);
+
+		// visible photos go first, then the larger side of the window (the scroll direction) from the nearest row
+		bool up = (_visibleTop - _preloadTop > _preloadBottom - _visibleBottom);
+		int32 inside[3] = { visibleFrom, visibleTill, 1 }, above[3] = { visibleFrom - 1, preloadFrom - 1, -1 }, below[3] = { visibleTill, preloadTill, 1 };
+		const int32 *order[3] = { inside, up ? above : below, up ? below : above };
+		for (int32 part = 0; part < 3; ++part) {
+			for (int32 index = order[part][0]; index != order[part][1]; index += order[part][2]) {
+				PhotoData *photo = photoAt(index);
+				if (!photo) continue;
+
+				if (!part) visible.insert(photo);
+				if (!photo->full->loaded() && !photo->thumb->loaded()) {
+					photo->thumb->load();
+				}
+				preloaded.insert(photo);
+			}
+		}
+	}
+
+	for (PreloadedPhotos::const_iterator i = _preloaded.cbegin(), e = _preloaded.cend(); i != e; ++i) {
+		if (preloaded.contains(*i)) continue;
+		(*i)->thumb->pause();
+		(*i)->medium->pause();
+	}
+	_preloaded = preloaded;
+
+	for (CachedSizes::iterator i = _cached.begin(); i != _cached.end();) {
+		if (visible.contains(i.key())) {
+			++i;
+		} else {
+			i = _cached.erase(i);
+		}
+	}
+}
+
 QPixmap OverviewInner::genPix(PhotoData *photo, int32 size) {
 	size *= cIntRetinaFactor();
 	QImage img = (photo->full->loaded() ? photo->full : (photo->medium->loaded() ? photo->medium : photo->thumb))->pix().toImage();
@@ -613,7 +676,7 @@ void OverviewInner::paintEvent(QPaintEvent *e) {
 						if (photo->thumb->loaded()) {
 							photo->medium->load(false, false);
 							quality = photo->medium->loaded();
-						} else {
+						} else if (!photo->thumb->loading()) {
 							photo->thumb->load();
 						}
 					}
@@ -1153,6 +1216,8 @@ void OverviewInner::switchType(MediaOverviewType type) {
 		_items.clear();
 		_cached.clear();
 		_type = type;
+		_preloadTop = _preloadBottom = 0;
+		preloadPhotos();
 	}
 	mediaOverviewUpdated();
 	if (App::wnd()) App::wnd()->update();
@@ -1541,6 +1606,9 @@ OverviewWidget::OverviewWidget(QWidget *parent, const PeerData *peer, MediaOverv
 , _showing(false)
 , _scrollSetAfterShow(0)
 , _scrollDelta(0)
+, _lastScrollTop(0)
+, _lastScrollTime(0)
+, _scrollSpeed(0)
 , _selCount(0) {
 	_scroll.setFocusPolicy(Qt::NoFocus);
 	_scroll.setWidget(&_inner);
@@ -1565,7 +1633,22 @@ void OverviewWidget::clear() {
 
 void OverviewWidget::onScroll() {
 	MTP::clearLoaderPriorities();
-	if (_scroll.scrollTop() < _scroll.height() * 5) {
+
+	int32 scrollTop = _scroll.scrollTop(), scrollHeight = _scroll.height();
+	uint64 ms = getms();
+	if (_lastScrollTime && ms > _lastScrollTime) {
+		float64 speed = float64(scrollTop - _lastScrollTop) / (ms - _lastScrollTime);
+		_scrollSpeed = (ms - _lastScrollTime > MediaOverviewScrollSpeedReset) ? speed : ((_scrollSpeed + speed) / 2);
+	}
+	_lastScrollTop = scrollTop;
+	_lastScrollTime = ms;
+
+	int32 behind = scrollHeight * MediaOverviewPreloadScreensMin;
+	int32 ahead = snap(int32(qAbs(_scrollSpeed) * MediaOverviewPreloadTime), behind, scrollHeight * MediaOverviewPreloadScreensMax);
+	int32 preloadTop = scrollTop - (_scrollSpeed < 0 ? ahead : behind), preloadBottom = scrollTop + scrollHeight + (_scrollSpeed > 0 ? ahead : behind);
+	_inner.preloadPhotos(scrollTop, scrollTop + scrollHeight, preloadTop, preloadBottom);
+
+	if (preloadTop < scrollHeight * MediaOverviewPreloadMetaScreens) {
 		if (App::main()) {
 			App::main()->loadMediaBack(peer(), type(), true);
 		}
@@ -1680,6 +1763,8 @@ void OverviewWidget::switchType(MediaOverviewType type) {
 	noSelectingScroll();
 	App::main()->topBar()->showSelected(0);
 	updateTopBarSelection();
+	_lastScrollTime = 0;
+	_scrollSpeed = 0;
 	_scroll.scrollToY(_scroll.scrollTopMax());
 	onScroll();
 }
@@ -51,6 +51,8 @@ public:
 	int32 resizeToWidth(int32 nwidth, int32 scrollTop, int32 minHeight); // returns new scroll top
 	void dropResizeIndex();
 
+	void preloadPhotos(int32 visibleTop, int32 visibleBottom, int32 preloadTop, int32 preloadBottom);
+
 	PeerData *peer() const;
 	MediaOverviewType type() const;
 	void switchType(MediaOverviewType type);
@@ -109,6 +111,10 @@ private:
 	QPixmap genPix(PhotoData *photo, int32 size);
 	void showAll();
 
+	PhotoData *photoAt(int32 index) const;
+	int32 photoIndexAt(int32 y) const; // first photo index in the row at y
+	void preloadPhotos();
+
 	OverviewWidget *_overview;
 	ScrollArea *_scroll;
 	int32 _resizeIndex, _resizeSkip;
@@ -128,6 +134,11 @@ private:
 	CachedSizes _cached;
 	bool _selMode;
 
+	// thumbs are loaded in the [preloadTop, preloadBottom) window, pixmaps are cached only for [visibleTop, visibleBottom)
+	int32 _visibleTop, _visibleBottom, _preloadTop, _preloadBottom;
+	typedef QSet<PhotoData*> PreloadedPhotos;
+	PreloadedPhotos _preloaded;
+
 	// other
 	typedef struct _CachedItem {
 		_CachedItem() : msgid(0), y(0) {
@@ -260,6 +271,10 @@ private:
 	QTimer _scrollTimer;
 	int32 _scrollDelta;
 
+	int32 _lastScrollTop;
+	uint64 _lastScrollTime;
+	float64 _scrollSpeed; // pixels per ms, negative when scrolling up
+
 	int32 _selCount;
 
 };
@@ -29,7 +29,8 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 PasscodeWidget::PasscodeWidget(QWidget *parent) : QWidget(parent),
 _passcode(this, st::passcodeInput),
 _submit(this, lang(lng_passcode_submit), st::passcodeSubmit),
-_logout(this, lang(lng_passcode_logout)) {
+_logout(this, lang(lng_passcode_logout)),
+_deriver(0) {
 	setGeometry(QRect(0, st::titleHeight, App::wnd()->width(), App::wnd()->height() - st::titleHeight));
 	connect(App::wnd(), SIGNAL(resized(const QSize &)), this, SLOT(onParentResize(const QSize &)));
 
@@ -63,8 +64,23 @@ void PasscodeWidget::onSubmit() {
 		return;
 	}
 
+	if (_deriver) return; // still checking the previous one
+
+	_deriver = new Local::KeyDeriver(_passcode.text().toUtf8(), !App::main()); // on startup the map is read and decrypted there as well
+	connect(_deriver, SIGNAL(done(void*)), this, SLOT(onDerived(void*)));
+	_deriver->start();
+}
+
+void PasscodeWidget::onDerived(void *deriver) {
+	if (!_deriver || deriver != _deriver) return;
+
+	Local::KeyDeriver *derived = _deriver;
+	_deriver = 0;
+
 	if (App::main()) {
-		if (Local::checkPasscode(_passcode.text().toUtf8())) {
+		bool correct = Local::checkPasscode(derived);
+		delete derived;
+		if (correct) {
 			cSetPasscodeBadTries(0);
 			App::wnd()->clearPasscode();
 		} else {
@@ -74,11 +90,17 @@ void PasscodeWidget::onSubmit() {
 			return;
 		}
 	} else {
-		if (Local::readMap(_passcode.text().toUtf8()) != Local::ReadMapPassNeeded) {
+		Local::ReadMapState state = Local::readMap(derived);
+		delete derived;
+		if (state != Local::ReadMapPassNeeded) {
 			cSetPasscodeBadTries(0);
+
+			MTP::start(); // connects while the rest of local data is read
+			if (state == Local::ReadMapDone) {
+				Local::readMapUserData();
+			}
 			App::app()->checkMapVersion();
 
-			MTP::start();
 			if (MTP::authedId()) {
 				App::wnd()->setupMain(true);
 			} else {
@@ -208,4 +230,5 @@ void PasscodeWidget::setInnerFocus() {
 }
 
 PasscodeWidget::~PasscodeWidget() {
+	delete _deriver;
 }
@@ -17,6 +17,10 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 */
 #pragma once
 
+namespace Local {
+	class KeyDeriver;
+}
+
 class PasscodeWidget : public QWidget, public Animated {
 	Q_OBJECT
 
@@ -41,6 +45,7 @@ public slots:
 	void onError();
 	void onChanged();
 	void onSubmit();
+	void onDerived(void *deriver);
 
 signals:
 
@@ -58,4 +63,6 @@ private:
 	LinkButton _logout;
 	QString _error;
 
+	Local::KeyDeriver *_deriver;
+
 };
@@ -28,6 +28,8 @@ mtpDcOptions gDcOptions;
 bool gTestMode = false;
 bool gDebug = false;
 bool gManyInstance = false;
+bool gStartupTrace = false, gStartupTraceQuit = false;
+int32 gNetStatsPeriod = 0;
 QString gKeyFile;
 QString gWorkingDir, gExeDir, gExeName;
 
@@ -160,6 +162,12 @@ void settingsParseArgs(int argc, char *argv[]) {
 			gDebug = true;
 		} else if (string("-many") == argv[i]) {
 			gManyInstance = true;
+		} else if (string("-tracestartup") == argv[i]) {
+			gStartupTrace = true;
+		} else if (string("-tracequit") == argv[i]) { // benchmark mode: trace startup of the given -workdir and quit
+			gStartupTrace = gStartupTraceQuit = true;
+		} else if (string("-netstats") == argv[i] && i + 1 < argc) {
+			gNetStatsPeriod = qMax(QString::fromLocal8Bit(argv[++i]).toInt(), 0);
 		} else if (string("-key") == argv[i] && i + 1 < argc) {
 			gKeyFile = QString::fromLocal8Bit(argv[++i]);
 		} else if (string("-autostart") == argv[i]) {
@@ -117,6 +117,9 @@ DeclareSetting(bool, StartToSettings);
 DeclareSetting(int32, MaxGroupCount);
 DeclareSetting(bool, ReplaceEmojis);
 DeclareReadSetting(bool, ManyInstance);
+DeclareReadSetting(bool, StartupTrace);
+DeclareReadSetting(bool, StartupTraceQuit);
+DeclareReadSetting(int32, NetStatsPeriod); // seconds between MTP Stats log dumps, 0 - disabled
 DeclareSetting(bool, AskDownloadPath);
 DeclareSetting(QString, DownloadPath);
 DeclareSetting(QByteArray, LocalSalt);
@@ -153,9 +156,9 @@ T convertScale(T v) {
 DeclareSetting(DBIEmojiTab, EmojiTab);
 
 struct EmojiData {
-	EmojiData(uint16 x, uint16 y, uint32 code, uint32 code2, uint16 len, uint16 postfix = 0) : x(x), y(y), code(code), code2(code2), len(len), postfix(postfix) {
+	EmojiData(uint16 x, uint16 y, uint16 tile, uint32 code, uint32 code2, uint16 len, uint16 postfix = 0) : x(x), y(y), tile(tile), code(code), code2(code2), len(len), postfix(postfix) {
 	}
-	uint16 x, y;
+	uint16 x, y, tile; // position in the atlas tile of its category, see App::emojis()
 	uint32 code, code2;
 	uint16 len;
 	uint16 postfix;
@@ -30,6 +30,8 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 #include "localstorage.h"
 
 namespace {
+	int32 _usernamesVersion = 0; // incremented on any username change, chat mention indices are rebuilt after that
+
 	int32 peerColorIndex(const PeerId &peer) {
 		int32 myId(MTP::authedId()), peerId(peer & 0xFFFFFFFFL);
 		bool chat = (peer & 0x100000000L);
@@ -190,6 +192,7 @@ void UserData::setName(const QString &first, const QString &last, const QString
 		updateName(lastName.isEmpty() ? firstName : (firstName + ' ' + lastName), phoneName, usern);
 	}
 	if (updUsername) {
+		++_usernamesVersion;
 		if (App::main()) {
 			App::main()->peerUsernameChanged(this);
 		}
@@ -224,6 +227,39 @@ void ChatData::setPhoto(const MTPChatPhoto &p, const PhotoId &phId) {
 	emit App::main()->peerPhotoChanged(this);
 }
 
+const ChatData::MentionIndex &ChatData::mentionIndex() {
+	if (_mentionIndexVersion != _usernamesVersion) {
+		_mentionIndex.clear();
+		for (Participants::const_iterator i = participants.cbegin(), e = participants.cend(); i != e; ++i) {
+			if (!i.key()->username.isEmpty()) {
+				_mentionIndex.insert(i.key()->username.toLower(), i.key());
+			}
+		}
+		_mentionIndexVersion = _usernamesVersion;
+	}
+	return _mentionIndex;
+}
+
+void ChatData::mentionIndexAdd(UserData *user) {
+	if (_mentionIndexVersion != _usernamesVersion || user->username.isEmpty()) return;
+
+	QString key(user->username.toLower());
+	if (!_mentionIndex.contains(key, user)) {
+		_mentionIndex.insert(key, user);
+	}
+}
+
+void ChatData::mentionIndexRemove(UserData *user) {
+	if (_mentionIndexVersion != _usernamesVersion || user->username.isEmpty()) return;
+
+	_mentionIndex.remove(user->username.toLower(), user);
+}
+
+void ChatData::mentionIndexInvalidate() {
+	_mentionIndex.clear();
+	_mentionIndexVersion = -1;
+}
+
 void PhotoLink::onClick(Qt::MouseButton button) const {
 	if (button == Qt::LeftButton) {
 		App::wnd()->showPhoto(this, App::hoveredLinkItem());
@@ -143,9 +143,16 @@ struct UserData : public PeerData {
 };
 
 struct ChatData : public PeerData {
-	ChatData(const PeerId &id) : PeerData(id), count(0), date(0), version(0), left(false), forbidden(true), photoId(0) {
+	ChatData(const PeerId &id) : PeerData(id), count(0), date(0), version(0), left(false), forbidden(true), photoId(0), _mentionIndexVersion(-1) {
 	}
 	void setPhoto(const MTPChatPhoto &photo, const PhotoId &phId = 0);
+
+	typedef QMultiMap<QString, UserData*> MentionIndex; // lowercase username -> participant, prefix queries with lowerBound()
+	const MentionIndex &mentionIndex();
+	void mentionIndexAdd(UserData *user);
+	void mentionIndexRemove(UserData *user);
+	void mentionIndexInvalidate(); // when participants are replaced, index is rebuilt on next use
+
 	int32 count;
 	int32 date;
 	int32 version;
@@ -162,6 +169,10 @@ struct ChatData : public PeerData {
 	PhotoId photoId;
 	QString invitationUrl;
 	// geo
+
+private:
+	MentionIndex _mentionIndex;
+	int32 _mentionIndexVersion; // usernames version the index was built for, -1 if it was invalidated
 };
 
 typedef QMap<char, QPixmap> PreparedPhotoThumbs;
@@ -77,7 +77,7 @@ namespace {
 
 namespace {
 	QReadWriteLock unixtimeLock;
-	volatile int32 unixtimeDelta = 0;
+	volatile int32 unixtimeDelta = 0, unixtimeRestored = 0;
 	volatile bool unixtimeWasSet = false;
     volatile uint64 _msgIdStart, _msgIdLocal = 0, _msgIdMsStart;
 	uint32 _reqId = 0;
@@ -109,11 +109,29 @@ void unixtimeInit() {
 	{
 		QWriteLocker locker(&unixtimeLock);
 		unixtimeWasSet = false;
-		unixtimeDelta = 0;
+		unixtimeDelta = unixtimeRestored;
 	}
 	_initMsgIdConstants();
 }
 
+void unixtimeRestore(int32 delta) {
+	{
+		QWriteLocker locker(&unixtimeLock);
+		unixtimeRestored = delta;
+		if (unixtimeWasSet) return;
+
+		DEBUG_LOG(("MTP Info: restored unixtimeDelta %1").arg(delta));
+		unixtimeDelta = delta;
+	}
+	_initMsgIdConstants();
+}
+
+bool unixtimeDeltaGet(int32 &delta) {
+	QReadLocker locker(&unixtimeLock);
+	delta = unixtimeDelta;
+	return unixtimeWasSet;
+}
+
 void unixtimeSet(int32 serverTime, bool force) {
 	{
 		QWriteLocker locker(&unixtimeLock);
@@ -245,6 +263,103 @@ uint64 getms(bool checked) {
 #endif
 }
 
+namespace {
+	struct SlabFreeObject {
+		SlabFreeObject *next;
+	};
+	struct Slab { // objects of one size class
+		char *data;
+		uint32 sizeClass;
+		uint32 used; // objects allocated and not freed yet, the slab is released when it becomes zero
+		uint32 fresh; // bytes at the end of data which were never allocated
+		SlabFreeObject *free;
+		Slab *prev, *next; // in the list of slabs with space left for this size class
+		bool available;
+	};
+	typedef QMap<quintptr, Slab*> Slabs; // by data address, for finding the slab of a freed object
+	Slabs _slabs;
+	Slab *_slabsAvailable[SlabMaxObjectSize / SlabAlignment + 1] = { 0 }; // by size class
+	QMutex _slabLock;
+
+	void _slabMakeAvailable(Slab *slab) {
+		slab->prev = 0;
+		slab->next = _slabsAvailable[slab->sizeClass];
+		if (slab->next) slab->next->prev = slab;
+		_slabsAvailable[slab->sizeClass] = slab;
+		slab->available = true;
+	}
+
+	void _slabMakeUnavailable(Slab *slab) {
+		if (slab->prev) {
+			slab->prev->next = slab->next;
+		} else {
+			_slabsAvailable[slab->sizeClass] = slab->next;
+		}
+		if (slab->next) slab->next->prev = slab->prev;
+		slab->prev = slab->next = 0;
+		slab->available = false;
+	}
+}
+
+void *slabAlloc(size_t size) {
+	if (size > SlabMaxObjectSize) return ::operator new(size);
+
+	uint32 sizeClass = (size + SlabAlignment - 1) / SlabAlignment, slotSize = sizeClass * SlabAlignment;
+
+	QMutexLocker lock(&_slabLock);
+	Slab *slab = _slabsAvailable[sizeClass];
+	if (!slab) {
+		slab = new Slab();
+		slab->data = static_cast<char*>(::operator new(SlabSize));
+		slab->sizeClass = sizeClass;
+		slab->used = 0;
+		slab->fresh = SlabSize;
+		slab->free = 0;
+		_slabs.insert(quintptr(slab->data), slab);
+		_slabMakeAvailable(slab);
+	}
+
+	void *result;
+	if (slab->free) {
+		result = slab->free;
+		slab->free = slab->free->next;
+	} else {
+		result = slab->data + (SlabSize - slab->fresh);
+		slab->fresh -= slotSize;
+	}
+	++slab->used;
+	if (!slab->free && slab->fresh < slotSize) {
+		_slabMakeUnavailable(slab);
+	}
+	return result;
+}
+
+void slabFree(void *p, size_t size) {
+	if (!p) return;
+	if (size > SlabMaxObjectSize) return ::operator delete(p);
+
+	QMutexLocker lock(&_slabLock);
+	Slabs::iterator i = _slabs.upperBound(quintptr(p));
+	if (i == _slabs.begin()) {
+		LOG(("Memory Error: freed object is not in a slab"));
+		return;
+	}
+	Slab *slab = (--i).value();
+
+	if (!--slab->used) {
+		if (slab->available) _slabMakeUnavailable(slab);
+		_slabs.erase(i);
+		::operator delete(slab->data);
+		delete slab;
+		return;
+	}
+
+	SlabFreeObject *free = static_cast<SlabFreeObject*>(p);
+	free->next = slab->free;
+	slab->free = free;
+	if (!slab->available) _slabMakeAvailable(slab);
+}
+
 SingleTimer::SingleTimer() : _finishing(0), _inited(false) {
 	QTimer::setSingleShot(true);
 	if (App::app()) {
@@ -74,6 +74,8 @@ class MTPint;
 
 int32 myunixtime();
 void unixtimeInit();
+void unixtimeRestore(int32 delta); // stored delta is used until the first server time is received
+bool unixtimeDeltaGet(int32 &delta); // returns false if server time was not received yet
 void unixtimeSet(int32 servertime, bool force = false);
 int32 unixtime();
 int32 fromServerTime(const MTPint &serverTime);
@@ -221,6 +223,22 @@ protected:
 	typedef ManagedPtr<T> Parent;
 };
 
+// small objects (history items and media, text blocks) are allocated in slabs of one size class each,
+// freed objects are reused from the free list of their slab and a slab is released when it becomes empty
+// both can be called from any thread
+void *slabAlloc(size_t size);
+void slabFree(void *p, size_t size);
+
+class SlabAllocated {
+public:
+	static void *operator new(size_t size) {
+		return slabAlloc(size);
+	}
+	static void operator delete(void *p, size_t size) { // size of the most derived class, destructors must be virtual
+		slabFree(p, size);
+	}
+};
+
 QString translitRusEng(const QString &rus);
 QString rusKeyboardLayoutSwitch(const QString &from);
 
@@ -261,6 +279,9 @@ enum DataBlockId {
 	dbiTileBackground = 33,
 	dbiAutoLock = 34,
 	dbiDialogLastPath = 35,
+	dbiServerSalts = 36,
+	dbiTimeDelta = 37,
+	dbiDcWinner = 38,
 
 	dbiEncryptedWithSalt = 333,
 	dbiEncrypted = 444,
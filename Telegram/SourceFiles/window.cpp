@@ -1221,7 +1221,7 @@ void Window::quit() {
 }
 
 void Window::notifySchedule(History *history, HistoryItem *item) {
-	if (App::quiting() || !history->currentNotification() || !main) return;
+	if (App::quiting() || !history->currentNotification() || !main || main->notifySilent(item)) return;
 
 	UserData *notifyByFrom = (history->peer->chat && item->notifyByFrom()) ? item->from() : 0;
 